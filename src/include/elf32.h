@@ -99,6 +99,15 @@ typedef struct {
   } d_un;
 } Elf32_Dyn;
 
+typedef struct {
+  Elf32_Word    st_name;
+  Elf32_Addr    st_value;
+  Elf32_Word    st_size;
+  unsigned char st_info;
+  unsigned char st_other;
+  Elf32_Half    st_shndx;
+} Elf32_Sym;
+
 typedef struct {
   Elf32_Word n_namesz;
   Elf32_Word n_descsz;
@@ -104,4 +104,21 @@ typedef struct {
   Elf64_Xword  sh_entsize;
 } Elf64_Shdr;
 
+typedef struct {
+  Elf64_Sxword d_tag;
+  union {
+    Elf64_Xword d_val;
+    Elf64_Addr  d_ptr;
+  } d_un;
+} Elf64_Dyn;
+
+typedef struct {
+  Elf64_Word    st_name;
+  unsigned char st_info;
+  unsigned char st_other;
+  Elf64_Half    st_shndx;
+  Elf64_Addr    st_value;
+  Elf64_Xword   st_size;
+} Elf64_Sym;
+
 #endif  /* NATIVE_CLIENT_SRC_INCLUDE_ELF64_H_ */
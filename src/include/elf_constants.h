@@ -131,8 +131,12 @@ EXTERN_C_BEGIN
 #define SHF_MASKPROC    0xf0000000  /* Processor-specific use */
 
 #define DT_NULL         0
+#define DT_HASH         4
+#define DT_STRTAB       5
+#define DT_SYMTAB       6
 #define DT_REL          17
 #define DT_RELSZ        18
+#define DT_DEBUG        21
 
 #define ELF_NOTE_GNU    "GNU"
 
@@ -10,6 +10,10 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#if !defined(__native_client__)
+#include <sys/resource.h>
+#endif
+
 #include "native_client/src/include/elf.h"
 #include "native_client/src/public/nonsfi/elf_loader.h"
 #include "native_client/src/shared/platform/nacl_log.h"
@@ -26,6 +30,10 @@
 #define NONSFI_PAGE_MASK (NONSFI_PAGE_SIZE - 1)
 #define MAX_PHNUM 128
 
+/* Size of an x86 transparent huge page. */
+#define HUGE_PAGE_SIZE 0x200000
+#define HUGE_PAGE_MASK (HUGE_PAGE_SIZE - 1)
+
 static uintptr_t PageSizeRoundDown(uintptr_t addr) {
   return addr & ~NONSFI_PAGE_MASK;
 }
@@ -34,6 +42,101 @@ static uintptr_t PageSizeRoundUp(uintptr_t addr) {
   return PageSizeRoundDown(addr + NONSFI_PAGE_SIZE - 1);
 }
 
+static int SegmentWantsPrefault(int pflags, uint32_t flags) {
+  if ((pflags & PF_X) != 0)
+    return (flags & NACL_ELF_LOAD_PREFAULT_TEXT) != 0;
+  return (flags & NACL_ELF_LOAD_PREFAULT_DATA) != 0;
+}
+
+/*
+ * Returns the extra mmap() flags that fault in a mapping as it is
+ * created.  Where MAP_POPULATE is not available, Prefault() is used
+ * after mapping instead.
+ */
+static int PrefaultMmapFlags(int prefault) {
+#if defined(MAP_POPULATE)
+  return prefault ? MAP_POPULATE : 0;
+#else
+  (void) prefault;
+  return 0;
+#endif
+}
+
+static void Prefault(void *addr, size_t size) {
+#if !defined(MAP_POPULATE) && defined(MADV_WILLNEED)
+  if (madvise(addr, size, MADV_WILLNEED) != 0) {
+    NaClLog(LOG_WARNING, "madvise(MADV_WILLNEED) failed\n");
+  }
+#else
+  (void) addr;
+  (void) size;
+#endif
+}
+
+/*
+ * Replaces the file mapping of the executable segment at
+ * [segment_addr, segment_addr + size) with an anonymous copy that the
+ * kernel may back with transparent huge pages.  Only the 2MB-aligned
+ * part of the segment can use huge pages, so this is only worthwhile
+ * for large segments.  Returns 0 if the segment was left alone.
+ */
+static int RemapTextOntoHugePages(int fd, void *segment_addr, size_t size,
+                                  off_t file_offset, size_t file_size,
+                                  int prot) {
+#if defined(MADV_HUGEPAGE)
+  uintptr_t start = (uintptr_t) segment_addr;
+  uintptr_t huge_start = (start + HUGE_PAGE_MASK) & ~HUGE_PAGE_MASK;
+  uintptr_t huge_end = (start + size) & ~HUGE_PAGE_MASK;
+  if (huge_end <= huge_start)
+    return 0;
+
+  void *map_result = mmap(segment_addr, size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANON | MAP_FIXED, -1, 0);
+  if (map_result != segment_addr) {
+    NaClLog(LOG_FATAL, "Failed to map anonymous memory for ELF text\n");
+  }
+  if (madvise((void *) huge_start, huge_end - huge_start,
+              MADV_HUGEPAGE) != 0) {
+    /* Not fatal: the copy still works, just with small pages. */
+    NaClLog(LOG_WARNING, "madvise(MADV_HUGEPAGE) failed\n");
+  }
+  size_t copied = 0;
+  while (copied < file_size) {
+    ssize_t got = pread(fd, (char *) segment_addr + copied,
+                        file_size - copied, file_offset + copied);
+    if (got <= 0) {
+      NaClLog(LOG_FATAL, "Failed to read ELF text segment\n");
+    }
+    copied += got;
+  }
+  if (mprotect(segment_addr, size, prot) != 0) {
+    NaClLog(LOG_FATAL, "Failed to mprotect ELF text segment\n");
+  }
+  return 1;
+#else
+  (void) fd;
+  (void) segment_addr;
+  (void) size;
+  (void) file_offset;
+  (void) file_size;
+  (void) prot;
+  return 0;
+#endif
+}
+
+static void GetPageFaultCounts(long *minor, long *major) {
+#if !defined(__native_client__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    *minor = usage.ru_minflt;
+    *major = usage.ru_majflt;
+    return;
+  }
+#endif
+  *minor = 0;
+  *major = 0;
+}
+
 static int ElfFlagsToMmapFlags(int pflags) {
   return ((pflags & PF_X) != 0 ? PROT_EXEC : 0) |
          ((pflags & PF_R) != 0 ? PROT_READ : 0) |
@@ -68,6 +171,14 @@ static void CheckElfHeaders(ElfW(Ehdr) *ehdr) {
 }
 
 uintptr_t NaClLoadElfFile(int fd) {
+  return NaClLoadElfFileWithFlags(fd, 0);
+}
+
+uintptr_t NaClLoadElfFileWithFlags(int fd, uint32_t flags) {
+  long minor_faults_before;
+  long major_faults_before;
+  GetPageFaultCounts(&minor_faults_before, &major_faults_before);
+
   /* Read ELF file headers. */
   ElfW(Ehdr) ehdr;
   ssize_t bytes_read = pread(fd, &ehdr, sizeof(ehdr), 0);
@@ -109,12 +220,26 @@ uintptr_t NaClLoadElfFile(int fd) {
   }
   size_t span = last_load->p_vaddr + last_load->p_memsz;
 
-  /* Reserve address space. */
-  void *mapping = mmap(NULL, span, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+  /*
+   * Reserve address space.  For huge page text, the image must start
+   * on a huge page boundary so that the text's alignment in the file
+   * carries over to its address, so reserve extra and trim.
+   */
+  size_t align = (flags & NACL_ELF_LOAD_HUGE_TEXT) != 0 ? HUGE_PAGE_SIZE : 0;
+  void *mapping = mmap(NULL, span + align, PROT_NONE, MAP_ANON | MAP_PRIVATE,
+                       -1, 0);
   if (mapping == MAP_FAILED) {
     NaClLog(LOG_FATAL, "Failed to reserve address space for executable\n");
   }
   uintptr_t load_bias = (uintptr_t) mapping;
+  if (align != 0) {
+    uintptr_t aligned = (load_bias + HUGE_PAGE_MASK) & ~HUGE_PAGE_MASK;
+    if (aligned > load_bias)
+      munmap(mapping, aligned - load_bias);
+    if (load_bias + align > aligned)
+      munmap((void *) (aligned + span), load_bias + align - aligned);
+    load_bias = aligned;
+  }
 
   /* Map the PT_LOAD segments. */
   uintptr_t prev_segment_end = 0;
@@ -131,13 +256,27 @@ uintptr_t NaClLoadElfFile(int fd) {
     }
     prev_segment_end = segment_end;
     void *segment_addr = (void *) (load_bias + segment_start);
+    int prefault = SegmentWantsPrefault(ph->p_flags, flags);
     void *map_result = mmap((void *) segment_addr,
                             segment_end - segment_start,
-                            prot, MAP_PRIVATE | MAP_FIXED, fd,
+                            prot,
+                            MAP_PRIVATE | MAP_FIXED |
+                            PrefaultMmapFlags(prefault),
+                            fd,
                             PageSizeRoundDown(ph->p_offset));
     if (map_result != segment_addr) {
       NaClLog(LOG_FATAL, "Failed to map ELF segment\n");
     }
+    if ((ph->p_flags & PF_X) != 0 &&
+        (flags & NACL_ELF_LOAD_HUGE_TEXT) != 0 &&
+        (ph->p_flags & PF_W) == 0) {
+      size_t page_offset = ph->p_vaddr - segment_start;
+      RemapTextOntoHugePages(fd, segment_addr, segment_end - segment_start,
+                             PageSizeRoundDown(ph->p_offset),
+                             page_offset + ph->p_filesz, prot);
+    }
+    if (prefault)
+      Prefault(segment_addr, segment_end - segment_start);
 
     if ((ph->p_flags & PF_X) != 0 &&
         ph->p_vaddr <= ehdr.e_entry &&
@@ -173,11 +312,15 @@ uintptr_t NaClLoadElfFile(int fd) {
       if (bss_map_start < segment_end) {
         void *map_addr = (void *) (load_bias + bss_map_start);
         map_result = mmap(map_addr, segment_end - bss_map_start,
-                          prot, MAP_PRIVATE | MAP_ANON | MAP_FIXED,
+                          prot,
+                          MAP_PRIVATE | MAP_ANON | MAP_FIXED |
+                          PrefaultMmapFlags(prefault),
                           -1, 0);
         if (map_result != map_addr) {
           NaClLog(LOG_FATAL, "Failed to map BSS for ELF segment\n");
         }
+        if (prefault)
+          Prefault(map_addr, segment_end - bss_map_start);
       }
     }
   }
@@ -190,5 +333,15 @@ uintptr_t NaClLoadElfFile(int fd) {
     NaClLog(LOG_FATAL, "ELF entry point does not point into an executable "
             "PT_LOAD segment\n");
   }
+
+  if ((flags & NACL_ELF_LOAD_REPORT_FAULTS) != 0) {
+    long minor_faults;
+    long major_faults;
+    GetPageFaultCounts(&minor_faults, &major_faults);
+    NaClLog(LOG_INFO, "NaClLoadElfFile: %ld minor and %ld major page faults"
+            " while loading\n",
+            minor_faults - minor_faults_before,
+            major_faults - major_faults_before);
+  }
   return load_bias + ehdr.e_entry;
 }
@@ -13,19 +13,46 @@
 #include "native_client/src/public/irt_core.h"
 #include "native_client/src/public/nonsfi/elf_loader.h"
 
+static const struct {
+  const char *name;
+  uint32_t flag;
+} kLoadFlags[] = {
+  { "--prefault-text", NACL_ELF_LOAD_PREFAULT_TEXT },
+  { "--prefault-data", NACL_ELF_LOAD_PREFAULT_DATA },
+  { "--huge-text", NACL_ELF_LOAD_HUGE_TEXT },
+  { "--report-faults", NACL_ELF_LOAD_REPORT_FAULTS },
+};
+
+static int ParseLoadFlag(const char *arg, uint32_t *flags) {
+  size_t i;
+  for (i = 0; i < sizeof(kLoadFlags) / sizeof(kLoadFlags[0]); ++i) {
+    if (strcmp(arg, kLoadFlags[i].name) == 0) {
+      *flags |= kLoadFlags[i].flag;
+      return 1;
+    }
+  }
+  return 0;
+}
+
 int main(int argc, char **argv, char **environ) {
   nacl_irt_nonsfi_allow_dev_interfaces();
-  if (argc < 2) {
-    fprintf(stderr, "Usage: %s <executable> <args...>\n", argv[0]);
+  uint32_t flags = 0;
+  int arg_index = 1;
+  while (arg_index < argc && ParseLoadFlag(argv[arg_index], &flags))
+    ++arg_index;
+  if (arg_index >= argc) {
+    fprintf(stderr,
+            "Usage: %s [--prefault-text] [--prefault-data] [--huge-text]\n"
+            "       [--report-faults] <executable> <args...>\n", argv[0]);
     return 1;
   }
-  const char *nexe_filename = argv[1];
+  const char *nexe_filename = argv[arg_index];
   int fd = open(nexe_filename, O_RDONLY);
   if (fd < 0) {
     fprintf(stderr, "Failed to open %s: %s\n", nexe_filename, strerror(errno));
     return 1;
   }
-  uintptr_t entry = NaClLoadElfFile(fd);
-  return nacl_irt_nonsfi_entry(argc - 1, argv + 1, environ,
+  uintptr_t entry = NaClLoadElfFileWithFlags(fd, flags);
+  return nacl_irt_nonsfi_entry(argc - arg_index, argv + arg_index, environ,
                                (nacl_entry_func_t) entry, nacl_irt_query_core);
 }
@@ -16,6 +16,7 @@
 extern "C" {
 #endif
 
+struct NaClAbiNaClImcMMsgHdr;  /* imc_types.h */
 struct NaClAbiNaClImcMsgHdr;  /* imc_types.h */
 
 /**
@@ -83,6 +84,41 @@ extern int imc_sendmsg(int desc, const struct NaClAbiNaClImcMsgHdr *nmhp,
  */
 extern int imc_recvmsg(int desc, struct NaClAbiNaClImcMsgHdr *nmhp, int flags);
 
+/**
+ *  @nacl
+ *  Sends up to vlen messages over a specified IMC socket descriptor
+ *  with a single system call.  At most NACL_ABI_IMC_MSG_BATCH_MAX
+ *  messages are sent per call.
+ *  @param desc The file descriptor of an IMC socket.
+ *  @param msgvec The array of messages to send.  The msg_len field of
+ *  each message sent is set to the number of bytes sent.
+ *  @param vlen The number of entries in msgvec.
+ *  @param flags As for imc_sendmsg.
+ *  @return On success, imc_sendmmsg returns the number of messages sent,
+ *  which may be fewer than vlen.  On failure, it returns -1 and sets errno
+ *  appropriately.
+ */
+extern int imc_sendmmsg(int desc, struct NaClAbiNaClImcMMsgHdr *msgvec,
+                        unsigned int vlen, int flags);
+
+/**
+ *  @nacl
+ *  Receives up to vlen messages over a specified IMC socket descriptor
+ *  with a single system call.  Only the wait for the first message
+ *  blocks; the rest of the batch is filled with messages that are
+ *  already queued.
+ *  @param desc The file descriptor of an IMC socket.
+ *  @param msgvec The array of message headers to be populated, as for
+ *  imc_recvmsg.  The msg_len field of each message received is set to the
+ *  number of bytes read.
+ *  @param vlen The number of entries in msgvec.
+ *  @param flags As for imc_recvmsg.
+ *  @return On success, imc_recvmmsg returns the number of messages
+ *  received.  On failure, it returns -1 and sets errno appropriately.
+ */
+extern int imc_recvmmsg(int desc, struct NaClAbiNaClImcMMsgHdr *msgvec,
+                        unsigned int vlen, int flags);
+
 /**
  *  @nacl
  *  Creates an IMC shared memory region, returning a file descriptor.
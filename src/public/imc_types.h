@@ -59,6 +59,16 @@ struct NaClAbiNaClImcMsgHdr {
   int                     flags;
 };
 
+/*
+ * Element of the message vector used by imc_sendmmsg and
+ * imc_recvmmsg.  msg_len is set to the number of user bytes sent or
+ * received for that message.
+ */
+struct NaClAbiNaClImcMMsgHdr {
+  struct NaClAbiNaClImcMsgHdr   msg_hdr;
+  nacl_abi_size_t               msg_len;
+};
+
 #ifndef __native_client__
 struct NaClImcMsgIoVec {
   void    *base;
@@ -112,6 +122,14 @@ struct NaClImcMsgHdr {
  * next 16 bytes.
  */
 
+/*
+ * NACL_ABI_IMC_MSG_BATCH_MAX: How many messages may one imc_sendmmsg
+ * or imc_recvmmsg call move?  Longer vectors are truncated to this
+ * length.  This must match NACL_MESSAGE_BATCH_MAX in
+ * src/shared/imc/nacl_imc_c.h.
+ */
+#define NACL_ABI_IMC_MSG_BATCH_MAX  64
+
 /* these values must match src/shared/imc/nacl_imc{,_c}.h */
 #define NACL_ABI_RECVMSG_DATA_TRUNCATED 0x1
 #define NACL_ABI_RECVMSG_DESC_TRUNCATED 0x2
@@ -11,6 +11,21 @@
 
 EXTERN_C_BEGIN
 
+/* Flags for NaClLoadElfFileWithFlags(). */
+/* Fault in executable PT_LOAD segments at load time. */
+#define NACL_ELF_LOAD_PREFAULT_TEXT   0x1
+/* Fault in non-executable PT_LOAD segments (data and BSS) at load time. */
+#define NACL_ELF_LOAD_PREFAULT_DATA   0x2
+/*
+ * Copy executable segments of at least 2MB into anonymous memory backed
+ * by transparent huge pages, to reduce iTLB misses.  The copied text is
+ * no longer shared with the page cache.  Ignored where the host does not
+ * support MADV_HUGEPAGE.
+ */
+#define NACL_ELF_LOAD_HUGE_TEXT       0x4
+/* Log the number of page faults taken while loading. */
+#define NACL_ELF_LOAD_REPORT_FAULTS   0x8
+
 /*
  * Loads the ELF binary from the given file descriptor.
  * This takes the ownership of the given fd, so a caller does not need to
@@ -19,6 +34,12 @@ EXTERN_C_BEGIN
  */
 uintptr_t NaClLoadElfFile(int fd);
 
+/*
+ * As NaClLoadElfFile(), but with NACL_ELF_LOAD_* flags controlling
+ * how the segments are mapped.
+ */
+uintptr_t NaClLoadElfFileWithFlags(int fd, uint32_t flags);
+
 EXTERN_C_END
 
 #endif
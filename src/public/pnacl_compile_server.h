@@ -0,0 +1,69 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef NATIVE_CLIENT_SRC_PUBLIC_PNACL_COMPILE_SERVER_H_
+#define NATIVE_CLIENT_SRC_PUBLIC_PNACL_COMPILE_SERVER_H_ 1
+
+/*
+ * Protocol for the server mode of the IRT's PNaCl translator compile
+ * interface (serve_translate_request() in
+ * src/untrusted/irt/irt_pnacl_translator_compile.c).
+ *
+ * If the environment variable NACL_PNACL_COMPILE_SERVER_FD_VAR names a
+ * NaCl descriptor (normally an IMC socket passed with sel_ldr -i), the
+ * translator handles a stream of compile requests on it instead of a
+ * single request described by environment variables.  The client sends
+ * one IMC message per translation:
+ *
+ *   struct NaClPnaclCompileRequest, followed by arg_count
+ *   null-terminated command line flags;
+ *   descriptors: the bitcode input, then 1 to
+ *   NACL_PNACL_COMPILE_OUTPUTS_MAX object file outputs.
+ *
+ * The translator closes the descriptors once the translation is done
+ * and replies with one message:
+ *
+ *   struct NaClPnaclCompileReply, followed by a null-terminated error
+ *   message, which is empty on success.
+ *
+ * Requests are handled one at a time, in order.  The server returns
+ * when the client closes its end of the channel.
+ */
+
+#include <stdint.h>
+
+#define NACL_PNACL_COMPILE_SERVER_FD_VAR \
+  "NACL_IRT_PNACL_TRANSLATOR_COMPILE_SERVER_FD"
+
+#define NACL_PNACL_COMPILE_REQUEST_MAGIC  0x51524350  /* "PCRQ" */
+#define NACL_PNACL_COMPILE_REPLY_MAGIC    0x50524350  /* "PCRP" */
+
+/* The IMC message carries the input and at most 7 outputs. */
+#define NACL_PNACL_COMPILE_OUTPUTS_MAX    7
+#define NACL_PNACL_COMPILE_REQUEST_BYTES_MAX  (64 << 10)
+#define NACL_PNACL_COMPILE_REPLY_BYTES_MAX    (4 << 10)
+
+struct NaClPnaclCompileRequest {
+  uint32_t magic;
+  uint32_t thread_count;  /* passed to init_callback */
+  uint32_t arg_count;
+};
+
+enum NaClPnaclCompileStatus {
+  NACL_PNACL_COMPILE_OK = 0,
+  NACL_PNACL_COMPILE_BAD_REQUEST,   /* malformed message; nothing was run */
+  NACL_PNACL_COMPILE_INPUT_ERROR,   /* reading the input failed */
+  NACL_PNACL_COMPILE_INIT_FAILED,   /* init_callback returned an error */
+  NACL_PNACL_COMPILE_DATA_FAILED,   /* data_callback failed */
+  NACL_PNACL_COMPILE_END_FAILED     /* end_callback returned an error */
+};
+
+struct NaClPnaclCompileReply {
+  uint32_t magic;
+  int32_t  status;  /* enum NaClPnaclCompileStatus */
+};
+
+#endif  /* NATIVE_CLIENT_SRC_PUBLIC_PNACL_COMPILE_SERVER_H_ */
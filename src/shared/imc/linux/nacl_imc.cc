@@ -79,11 +79,14 @@ int NaClClose(NaClHandle handle) {
   return close(handle);
 }
 
-int NaClSendDatagram(NaClHandle handle, const NaClMessageHeader* message,
-                     int flags) {
-  struct msghdr msg;
-  unsigned char buf[CMSG_SPACE(NACL_HANDLE_COUNT_MAX * sizeof(int))];
-
+/*
+ * Fills in msg to send message.  buf must have room for
+ * CMSG_SPACE(NACL_HANDLE_COUNT_MAX * sizeof(int)) bytes and must
+ * outlive msg.  Returns -1 with errno set if the message is invalid.
+ */
+static int FillSendMsgHdr(const NaClMessageHeader* message,
+                          struct msghdr* msg,
+                          unsigned char* buf) {
   if (NACL_HANDLE_COUNT_MAX < message->handle_count) {
     errno = EMSGSIZE;
     return -1;
@@ -108,43 +111,44 @@ int NaClSendDatagram(NaClHandle handle, const NaClMessageHeader* message,
     return -1;
   }
 
-  msg.msg_iov = (struct iovec *) message->iov;
-  msg.msg_iovlen = message->iov_length;
-  msg.msg_name = 0;
-  msg.msg_namelen = 0;
+  msg->msg_iov = (struct iovec *) message->iov;
+  msg->msg_iovlen = message->iov_length;
+  msg->msg_name = 0;
+  msg->msg_namelen = 0;
 
   if (0 < message->handle_count && message->handles != NULL) {
     struct cmsghdr* cmsg;
     int size = message->handle_count * sizeof(int);
-    msg.msg_control = buf;
-    msg.msg_controllen = CMSG_SPACE(size);
-    cmsg = CMSG_FIRSTHDR(&msg);
+    msg->msg_control = buf;
+    msg->msg_controllen = CMSG_SPACE(size);
+    cmsg = CMSG_FIRSTHDR(msg);
     cmsg->cmsg_level = SOL_SOCKET;
     cmsg->cmsg_type = SCM_RIGHTS;
     cmsg->cmsg_len = CMSG_LEN(size);
     memcpy(CMSG_DATA(cmsg), message->handles, size);
-    msg.msg_controllen = cmsg->cmsg_len;
+    msg->msg_controllen = cmsg->cmsg_len;
   } else {
-    msg.msg_control = 0;
-    msg.msg_controllen = 0;
+    msg->msg_control = 0;
+    msg->msg_controllen = 0;
   }
-  msg.msg_flags = 0;
-  return sendmsg(handle, &msg,
-                 MSG_NOSIGNAL | ((flags & NACL_DONT_WAIT) ? MSG_DONTWAIT : 0));
+  msg->msg_flags = 0;
+  return 0;
 }
 
-int NaClReceiveDatagram(NaClHandle handle, NaClMessageHeader* message,
-                        int flags) {
-  struct msghdr msg;
-  unsigned char buf[CMSG_SPACE(NACL_HANDLE_COUNT_MAX * sizeof(int))];
-  int count;
-
+/*
+ * Fills in msg to receive into message.  buf must have room for
+ * CMSG_SPACE(NACL_HANDLE_COUNT_MAX * sizeof(int)) bytes and must
+ * outlive msg.  Returns -1 with errno set if the message is invalid.
+ */
+static int FillRecvMsgHdr(NaClMessageHeader* message,
+                          struct msghdr* msg,
+                          unsigned char* buf) {
   if (NACL_HANDLE_COUNT_MAX < message->handle_count) {
     errno = EMSGSIZE;
     return -1;
   }
-  msg.msg_name = 0;
-  msg.msg_namelen = 0;
+  msg->msg_name = 0;
+  msg->msg_namelen = 0;
 
   /*
    * Make sure we cannot receive more than 2**32-1 bytes.
@@ -154,26 +158,157 @@ int NaClReceiveDatagram(NaClHandle handle, NaClMessageHeader* message,
     return -1;
   }
 
-  msg.msg_iov = (struct iovec *) message->iov;
-  msg.msg_iovlen = message->iov_length;
+  msg->msg_iov = (struct iovec *) message->iov;
+  msg->msg_iovlen = message->iov_length;
   if (0 < message->handle_count && message->handles != NULL) {
-    msg.msg_control = buf;
-    msg.msg_controllen = CMSG_SPACE(message->handle_count * sizeof(int));
+    msg->msg_control = buf;
+    msg->msg_controllen = CMSG_SPACE(message->handle_count * sizeof(int));
   } else {
-    msg.msg_control = 0;
-    msg.msg_controllen = 0;
+    msg->msg_control = 0;
+    msg->msg_controllen = 0;
   }
-  msg.msg_flags = 0;
+  msg->msg_flags = 0;
   message->flags = 0;
+  return 0;
+}
+
+/*
+ * Copies the received handles and truncation flags from msg back
+ * into message.
+ */
+static void FinishRecvMsgHdr(NaClMessageHeader* message,
+                             struct msghdr* msg) {
+  message->handle_count = GetRights(msg, message->handles);
+  if (msg->msg_flags & MSG_TRUNC) {
+    message->flags |= NACL_MESSAGE_TRUNCATED;
+  }
+  if (msg->msg_flags & MSG_CTRUNC) {
+    message->flags |= NACL_HANDLES_TRUNCATED;
+  }
+}
+
+int NaClSendDatagram(NaClHandle handle, const NaClMessageHeader* message,
+                     int flags) {
+  struct msghdr msg;
+  unsigned char buf[CMSG_SPACE(NACL_HANDLE_COUNT_MAX * sizeof(int))];
+
+  if (FillSendMsgHdr(message, &msg, buf) != 0) {
+    return -1;
+  }
+  return sendmsg(handle, &msg,
+                 MSG_NOSIGNAL | ((flags & NACL_DONT_WAIT) ? MSG_DONTWAIT : 0));
+}
+
+int NaClReceiveDatagram(NaClHandle handle, NaClMessageHeader* message,
+                        int flags) {
+  struct msghdr msg;
+  unsigned char buf[CMSG_SPACE(NACL_HANDLE_COUNT_MAX * sizeof(int))];
+  int count;
+
+  if (FillRecvMsgHdr(message, &msg, buf) != 0) {
+    return -1;
+  }
   count = recvmsg(handle, &msg, (flags & NACL_DONT_WAIT) ? MSG_DONTWAIT : 0);
   if (0 <= count) {
-    message->handle_count = GetRights(&msg, message->handles);
-    if (msg.msg_flags & MSG_TRUNC) {
-      message->flags |= NACL_MESSAGE_TRUNCATED;
+    FinishRecvMsgHdr(message, &msg);
+  }
+  return count;
+}
+
+/*
+ * sendmmsg() and recvmmsg() may be missing from an old kernel, in
+ * which case we fall back to one system call per message.
+ */
+int NaClSendDatagramBatch(NaClHandle handle,
+                          const NaClMessageHeader* messages,
+                          uint32_t count,
+                          int* sizes,
+                          int flags) {
+  struct mmsghdr msgs[NACL_MESSAGE_BATCH_MAX];
+  unsigned char bufs[NACL_MESSAGE_BATCH_MAX]
+                    [CMSG_SPACE(NACL_HANDLE_COUNT_MAX * sizeof(int))];
+  uint32_t ix;
+  int sent;
+
+  if (NACL_MESSAGE_BATCH_MAX < count) {
+    errno = EINVAL;
+    return -1;
+  }
+  for (ix = 0; ix < count; ++ix) {
+    if (FillSendMsgHdr(&messages[ix], &msgs[ix].msg_hdr, bufs[ix]) != 0) {
+      if (0 == ix) {
+        return -1;
+      }
+      /* Send the valid prefix; the caller retries from the bad one. */
+      count = ix;
+      break;
     }
-    if (msg.msg_flags & MSG_CTRUNC) {
-      message->flags |= NACL_HANDLES_TRUNCATED;
+  }
+  sent = sendmmsg(handle, msgs, count,
+                  MSG_NOSIGNAL | ((flags & NACL_DONT_WAIT) ? MSG_DONTWAIT : 0));
+  if (sent < 0 && ENOSYS == errno) {
+    for (sent = 0; (uint32_t) sent < count; ++sent) {
+      int result = NaClSendDatagram(handle, &messages[sent], flags);
+      if (result < 0) {
+        return 0 == sent ? -1 : sent;
+      }
+      sizes[sent] = result;
     }
+    return sent;
   }
-  return count;
+  for (ix = 0; sent > 0 && ix < (uint32_t) sent; ++ix) {
+    sizes[ix] = msgs[ix].msg_len;
+  }
+  return sent;
+}
+
+int NaClReceiveDatagramBatch(NaClHandle handle,
+                             NaClMessageHeader* messages,
+                             uint32_t count,
+                             int* sizes,
+                             int flags) {
+  struct mmsghdr msgs[NACL_MESSAGE_BATCH_MAX];
+  unsigned char bufs[NACL_MESSAGE_BATCH_MAX]
+                    [CMSG_SPACE(NACL_HANDLE_COUNT_MAX * sizeof(int))];
+  uint32_t ix;
+  int received;
+
+  if (NACL_MESSAGE_BATCH_MAX < count) {
+    errno = EINVAL;
+    return -1;
+  }
+  for (ix = 0; ix < count; ++ix) {
+    if (FillRecvMsgHdr(&messages[ix], &msgs[ix].msg_hdr, bufs[ix]) != 0) {
+      if (0 == ix) {
+        return -1;
+      }
+      count = ix;
+      break;
+    }
+  }
+  /*
+   * MSG_WAITFORONE blocks until the first message arrives and then
+   * returns what is already queued, matching NaClReceiveDatagramBatch()
+   * on other platforms.
+   */
+  received = recvmmsg(handle, msgs, count,
+                      (flags & NACL_DONT_WAIT) ? MSG_DONTWAIT : MSG_WAITFORONE,
+                      NULL);
+  if (received < 0 && ENOSYS == errno) {
+    for (received = 0; (uint32_t) received < count; ++received) {
+      int result = NaClReceiveDatagram(
+          handle, &messages[received],
+          0 == received ? flags : flags | NACL_DONT_WAIT);
+      if (result < 0) {
+        return 0 == received ? -1 : received;
+      }
+      sizes[received] = result;
+    }
+    return received;
+  }
+  for (ix = 0; received > 0 && ix < (uint32_t) received; ++ix) {
+    FinishRecvMsgHdr(&messages[ix], &msgs[ix].msg_hdr);
+    sizes[ix] = msgs[ix].msg_len;
+  }
+  return received;
 }
@@ -210,6 +210,41 @@ int NaClSendDatagramTo(const NaClMessageHeader* message,
 int NaClReceiveDatagram(NaClHandle socket, NaClMessageHeader* message,
                         int flags);
 
+/*
+ * The maximum number of messages moved by one NaClSendDatagramBatch()
+ * or NaClReceiveDatagramBatch() call.  This must match
+ * NACL_ABI_IMC_MSG_BATCH_MAX in src/public/imc_types.h.
+ */
+#define NACL_MESSAGE_BATCH_MAX 64
+
+/*
+ * Sends or receives up to count messages on a socket, using a single
+ * host system call where the platform provides one (sendmmsg and
+ * recvmmsg on Linux) and a loop over NaClSendDatagram() or
+ * NaClReceiveDatagram() otherwise.  count must not exceed
+ * NACL_MESSAGE_BATCH_MAX.
+ *
+ * On success, the number of messages transferred (at least 1) is
+ * returned and sizes[i] is set to the byte count of the i-th message.
+ * If no message could be transferred, -1 is returned and the error is
+ * reported as for the single-message functions.
+ *
+ * NaClReceiveDatagramBatch() waits only for the first message (unless
+ * NACL_DONT_WAIT is given) and then returns whatever further messages
+ * are already queued.  The handles and flags fields of each message
+ * are updated as by NaClReceiveDatagram().
+ */
+int NaClSendDatagramBatch(NaClHandle socket,
+                          const NaClMessageHeader* messages,
+                          uint32_t count,
+                          int* sizes,
+                          int flags);
+int NaClReceiveDatagramBatch(NaClHandle socket,
+                             NaClMessageHeader* messages,
+                             uint32_t count,
+                             int* sizes,
+                             int flags);
+
 /*
  * Message size validator.  The ABI requires that the data size must
  * be less than 2**32 bytes.
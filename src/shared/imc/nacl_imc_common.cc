@@ -40,3 +40,53 @@ int NaClMessageSizeIsValid(const NaClMessageHeader *message) {
   }
   return 1;
 }
+
+#if !NACL_LINUX && !defined(__native_client__)
+/*
+ * Platforms without a batched socket interface send and receive one
+ * message at a time.
+ */
+int NaClSendDatagramBatch(NaClHandle socket,
+                          const NaClMessageHeader* messages,
+                          uint32_t count,
+                          int* sizes,
+                          int flags) {
+  uint32_t ix;
+  int result;
+
+  for (ix = 0; ix < count; ++ix) {
+    result = NaClSendDatagram(socket, &messages[ix], flags);
+    if (result < 0) {
+      if (0 == ix) {
+        return -1;
+      }
+      break;
+    }
+    sizes[ix] = result;
+  }
+  return (int) ix;
+}
+
+int NaClReceiveDatagramBatch(NaClHandle socket,
+                             NaClMessageHeader* messages,
+                             uint32_t count,
+                             int* sizes,
+                             int flags) {
+  uint32_t ix;
+  int result;
+
+  for (ix = 0; ix < count; ++ix) {
+    /* Only the first receive may block. */
+    result = NaClReceiveDatagram(socket, &messages[ix],
+                                 0 == ix ? flags : flags | NACL_DONT_WAIT);
+    if (result < 0) {
+      if (0 == ix) {
+        return -1;
+      }
+      break;
+    }
+    sizes[ix] = result;
+  }
+  return (int) ix;
+}
+#endif
@@ -51,6 +51,18 @@ extern int NaClXlateErrno(int errnum);
 extern int NaClHostDirOpen(struct NaClHostDir *d,
                            char               *path);
 
+#if NACL_LINUX
+/*
+ * Constructor for a NaClHostDir object from a host descriptor that is
+ * already open on a directory.  On success the NaClHostDir owns
+ * dir_desc.
+ *
+ * Returns 0 for success and a negated NaCl errno for failure.
+ */
+extern int NaClHostDirCtor(struct NaClHostDir *d,
+                           int                dir_desc);
+#endif
+
 /*
  * Read data from an opened directory into a memory buffer.
  *
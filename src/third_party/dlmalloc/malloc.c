@@ -5044,7 +5044,11 @@ static void** ialloc(mstate m,
     remainder_size = contents_size;
   }
 
-  /* split out elements */
+  /*
+     split out elements.  set_inuse keeps the pinuse bit of the first
+     element: the chunk before it may have been freed by another thread
+     since internal_malloc returned.
+  */
   for (i = 0; ; ++i) {
     marray[i] = chunk2mem(p);
     if (i != n_elements-1) {
@@ -5053,11 +5057,11 @@ static void** ialloc(mstate m,
       else
         size = request2size(sizes[i]);
       remainder_size -= size;
-      set_size_and_pinuse_of_inuse_chunk(m, p, size);
+      set_inuse(m, p, size);
       p = chunk_plus_offset(p, size);
     }
     else { /* the final element absorbs any overallocation slop */
-      set_size_and_pinuse_of_inuse_chunk(m, p, remainder_size);
+      set_inuse(m, p, remainder_size);
       break;
     }
   }
@@ -350,6 +350,29 @@ bool Packet::GetBlock(void *ptr, uint32_t len) {
   return res;
 }
 
+bool Packet::GetEscapedBlock(void *ptr, uint32_t len) {
+  assert(ptr);
+
+  uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
+
+  for (uint32_t offs = 0; offs < len; offs++) {
+    char ch;
+    if (!GetRawChar(&ch)) {
+      return false;
+    }
+    // '}' is followed by the original character xor-ed with 0x20.
+    if (ch == '}') {
+      if (!GetRawChar(&ch)) {
+        return false;
+      }
+      ch ^= 0x20;
+    }
+    p[offs] = static_cast<uint8_t>(ch);
+  }
+
+  return true;
+}
+
 bool Packet::GetWord16(uint16_t *ptr) {
   assert(ptr);
   return GetBlock(ptr, sizeof(*ptr));
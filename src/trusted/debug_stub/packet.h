@@ -81,6 +81,9 @@ class Packet {
   // Retrieve "len" ASCII character pairs.
   bool GetBlock(void *ptr, uint32_t len);
 
+  // Retrieve "len" bytes of binary data escaped as by AddEscapedData.
+  bool GetEscapedBlock(void *ptr, uint32_t len);
+
   // Retrieve a 8, 16, 32, or 64 bit word as pairs of hex digits.  These
   // functions will always consume bits/4 characters from the stream.
   bool GetWord8(uint8_t *val);
@@ -91,6 +91,20 @@ int VerifyPacket(Packet *wr, Packet *rd, void *ctx, PacketFunc_t tx) {
     printf("Failed to decompress as expected.\n");
   }
 
+  // Binary data, including the characters which must be escaped and a
+  // run which is compressed, must survive a round trip.
+  const char binary[] = { 0, '}', '#', '$', '*', 1, 1, 1, 1, 1, 1, '\xff' };
+  char binary_out[sizeof(binary)];
+
+  wr->Clear();
+  wr->AddEscapedData(binary, sizeof(binary));
+  if (tx) tx(ctx, wr, rd);
+  if (!rd->GetEscapedBlock(binary_out, sizeof(binary_out)) ||
+      memcmp(binary, binary_out, sizeof(binary))) {
+    errs++;
+    printf("Failed to unescape binary data.\n");
+  }
+
   if (errs)
     printf("FAILED PACKET TEST\n");
 
@@ -11,6 +11,7 @@
 #include <algorithm>
 
 #include "native_client/src/include/build_config.h"
+#include "native_client/src/include/elf.h"
 #include "native_client/src/include/nacl_scoped_ptr.h"
 #include "native_client/src/shared/platform/nacl_check.h"
 #include "native_client/src/shared/platform/nacl_exit.h"
@@ -25,6 +26,7 @@
 #include "native_client/src/trusted/desc/nacl_desc_base.h"
 #include "native_client/src/trusted/service_runtime/nacl_app_thread.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
+#include "native_client/src/trusted/service_runtime/sel_mem.h"
 #include "native_client/src/trusted/service_runtime/thread_suspension.h"
 #include "native_client/src/trusted/validator/ncvalidate.h"
 #include "native_client/src/trusted/validator_arm/model.h"
@@ -60,6 +62,71 @@ static const uint64_t kGdbEBADF = 9;
 // Assume a buffer size that matches GDB's actual current request size.
 static const size_t kGdbPreadChunkSize = 4096;
 
+// Largest packet we accept or send, advertised to GDB as PacketSize.
+// GDB sizes its memory reads and writes to fit, so a large value lets a
+// big block of memory move in a few round trips.
+static const uint32_t kMaxPacketSize = 0x20000;
+
+// Limits on walking untrusted data structures which may be corrupt.
+static const uint32_t kMaxDynamicEntries = 1024;
+static const uint32_t kMaxLibraries = 4096;
+static const uint32_t kMaxSymbols = 1 << 16;
+static const uint32_t kMaxLibraryNameLength = 4096;
+
+// Untrusted (ILP32) layouts of the dynamic linker's debugger interface,
+// see <link.h>.
+struct UserRDebug {
+  int32_t r_version;
+  uint32_t r_map;
+  uint32_t r_brk;
+  int32_t r_state;
+  uint32_t r_ldbase;
+};
+
+struct UserLinkMap {
+  uint32_t l_addr;
+  uint32_t l_name;
+  uint32_t l_ld;
+  uint32_t l_next;
+  uint32_t l_prev;
+};
+
+static void AppendXmlEscaped(string *out, const string &str) {
+  for (size_t i = 0; i < str.length(); ++i) {
+    switch (str[i]) {
+      case '&': *out += "&amp;"; break;
+      case '<': *out += "&lt;"; break;
+      case '>': *out += "&gt;"; break;
+      case '"': *out += "&quot;"; break;
+      case '\'': *out += "&apos;"; break;
+      default: *out += str[i]; break;
+    }
+  }
+}
+
+static void AppendXmlAttr(string *out, const char *name, uint64_t value) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), " %s=\"0x%" NACL_PRIx64 "\"", name, value);
+  *out += buf;
+}
+
+struct MemoryMapState {
+  string *xml;
+  uint64_t alias_base;
+};
+
+static void AppendMemoryMapEntry(void *state_ptr,
+                                 struct NaClVmmapEntry *entry) {
+  MemoryMapState *state = reinterpret_cast<MemoryMapState *>(state_ptr);
+  uint64_t start = static_cast<uint64_t>(entry->page_num) << NACL_PAGESHIFT;
+  uint64_t length = static_cast<uint64_t>(entry->npages) << NACL_PAGESHIFT;
+
+  *state->xml += "<memory type=\"ram\"";
+  AppendXmlAttr(state->xml, "start", state->alias_base + start);
+  AppendXmlAttr(state->xml, "length", length);
+  *state->xml += "/>";
+}
+
 
 Target::Target(struct NaClApp *nap, const Abi *abi)
   : nap_(nap),
@@ -71,6 +138,7 @@ Target::Target(struct NaClApp *nap, const Abi *abi)
     sig_thread_(0),
     reg_thread_(0),
     step_over_breakpoint_thread_(0),
+    r_debug_addr_(0),
     all_threads_suspended_(false),
     detaching_(false),
     should_exit_(false) {
@@ -91,8 +159,12 @@ bool Target::Init() {
 
   // Set a more specific result which won't change.
   properties_["target.xml"] = targ_xml;
-  properties_["Supported"] =
-    "PacketSize=1000;qXfer:features:read+";
+  char supported[128];
+  snprintf(supported, sizeof(supported),
+           "PacketSize=%x;qXfer:features:read+;"
+           "qXfer:libraries-svr4:read+;qXfer:memory-map:read+",
+           kMaxPacketSize);
+  properties_["Supported"] = supported;
 
   NaClXMutexCtor(&mutex_);
   ctx_ = new uint8_t[abi_->GetContextSize()];
@@ -645,6 +717,205 @@ void Target::ProcessFilePacket(Packet *pktIn, Packet *pktOut, ErrDef *err) {
   *err = BAD_FORMAT;
 }
 
+bool Target::ReadUserMemory(uint32_t user_addr, void *dst, uint32_t len) {
+  uintptr_t sys_addr = NaClUserToSysAddrRange(nap_, user_addr, len);
+  if (sys_addr == kNaClBadAddress)
+    return false;
+  return IPlatform::GetMemory(sys_addr, len, dst);
+}
+
+bool Target::ReadUserString(uint32_t user_addr, string *str) {
+  str->clear();
+  for (uint32_t i = 0; i < kMaxLibraryNameLength; ++i) {
+    char ch;
+    if (!ReadUserMemory(user_addr + i, &ch, 1))
+      return false;
+    if (ch == 0)
+      return true;
+    *str += ch;
+  }
+  return false;
+}
+
+void Target::AddXferReply(const string &data, const char *args,
+                          Packet *pktOut, ErrDef *err) {
+  stringvec toks = StringSplit(args, ",");
+  if (toks.size() != 2) {
+    *err = BAD_FORMAT;
+    return;
+  }
+  size_t offset = strtoul(toks[0].c_str(), NULL, 16);
+  size_t length = strtoul(toks[1].c_str(), NULL, 16);
+
+  // Leave room for the 'm'/'l' prefix and escaping.
+  length = std::min<size_t>(length, kMaxPacketSize / 2);
+  if (offset >= data.length()) {
+    pktOut->AddRawChar('l');
+    return;
+  }
+  length = std::min(length, data.length() - offset);
+  pktOut->AddRawChar(offset + length < data.length() ? 'm' : 'l');
+  pktOut->AddEscapedData(data.data() + offset, length);
+}
+
+// The memory map is in untrusted addresses.  On x86-64, GDB sometimes
+// uses addresses with the sandbox base added (see AdjustUserAddr()), so
+// each region is listed at that alias too, as GDB refuses to access
+// memory outside the map.
+void Target::GetMemoryMapXml(string *xml) {
+  MemoryMapState state;
+
+  *xml = "<memory-map>";
+  state.xml = xml;
+  state.alias_base = 0;
+  NaClXMutexLock(&nap_->mu);
+  NaClVmmapVisit(&nap_->mem_map, AppendMemoryMapEntry, &state);
+  if (NACL_ARCH(NACL_BUILD_ARCH) == NACL_x86 && NACL_BUILD_SUBARCH == 64) {
+    state.alias_base = nap_->mem_start;
+    NaClVmmapVisit(&nap_->mem_map, AppendMemoryMapEntry, &state);
+  }
+  NaClXMutexUnlock(&nap_->mu);
+  *xml += "</memory-map>";
+}
+
+// Finds the dynamic linker's r_debug structure.  The main nexe is either
+// a static executable, which has none, or the dynamic linker itself,
+// which exports it as _r_debug.  It is looked up through the nexe's
+// dynamic section as loaded in memory, using the DT_HASH table for the
+// number of dynamic symbols.
+uint32_t Target::FindRDebug() {
+  NaClDesc *desc = nap_->main_nexe_desc;
+  if (NULL == desc)
+    return 0;
+
+  union {
+    Elf32_Ehdr e32;
+    Elf64_Ehdr e64;
+  } ehdr;
+  if ((*NACL_VTBL(NaClDesc, desc)->PRead)(desc, &ehdr, sizeof(ehdr), 0) !=
+      static_cast<ssize_t>(sizeof(ehdr))) {
+    return 0;
+  }
+  bool is64 = ehdr.e32.e_ident[EI_CLASS] == ELFCLASS64;
+  uint64_t phoff = is64 ? ehdr.e64.e_phoff : ehdr.e32.e_phoff;
+  uint32_t phnum = is64 ? ehdr.e64.e_phnum : ehdr.e32.e_phnum;
+  size_t phentsize = is64 ? sizeof(Elf64_Phdr) : sizeof(Elf32_Phdr);
+
+  uint32_t dynamic_addr = 0;
+  for (uint32_t i = 0; i < phnum && dynamic_addr == 0; ++i) {
+    union {
+      Elf32_Phdr p32;
+      Elf64_Phdr p64;
+    } phdr;
+    if ((*NACL_VTBL(NaClDesc, desc)->PRead)(
+            desc, &phdr, phentsize,
+            static_cast<nacl_off64_t>(phoff + i * phentsize)) !=
+        static_cast<ssize_t>(phentsize)) {
+      return 0;
+    }
+    if ((is64 ? phdr.p64.p_type : phdr.p32.p_type) == PT_DYNAMIC) {
+      dynamic_addr = static_cast<uint32_t>(
+          is64 ? phdr.p64.p_vaddr : phdr.p32.p_vaddr);
+    }
+  }
+  if (dynamic_addr == 0)
+    return 0;
+
+  uint32_t hash = 0;
+  uint32_t symtab = 0;
+  uint32_t strtab = 0;
+  size_t dynsize = is64 ? sizeof(Elf64_Dyn) : sizeof(Elf32_Dyn);
+  for (uint32_t i = 0; i < kMaxDynamicEntries; ++i) {
+    union {
+      Elf32_Dyn d32;
+      Elf64_Dyn d64;
+    } dyn;
+    if (!ReadUserMemory(dynamic_addr + i * dynsize, &dyn, dynsize))
+      return 0;
+    int64_t tag = is64 ? dyn.d64.d_tag : dyn.d32.d_tag;
+    uint32_t val = static_cast<uint32_t>(
+        is64 ? dyn.d64.d_un.d_val : dyn.d32.d_un.d_val);
+    if (tag == DT_NULL)
+      break;
+    if (tag == DT_DEBUG && val != 0)
+      return val;
+    if (tag == DT_HASH)
+      hash = val;
+    else if (tag == DT_SYMTAB)
+      symtab = val;
+    else if (tag == DT_STRTAB)
+      strtab = val;
+  }
+  if (hash == 0 || symtab == 0 || strtab == 0)
+    return 0;
+
+  uint32_t nchain;
+  if (!ReadUserMemory(hash + sizeof(uint32_t), &nchain, sizeof(nchain)))
+    return 0;
+  // nchain comes from untrusted memory; don't let it keep us busy.
+  if (nchain > kMaxSymbols)
+    nchain = kMaxSymbols;
+  size_t symsize = is64 ? sizeof(Elf64_Sym) : sizeof(Elf32_Sym);
+  for (uint32_t i = 0; i < nchain; ++i) {
+    union {
+      Elf32_Sym s32;
+      Elf64_Sym s64;
+    } sym;
+    if (!ReadUserMemory(symtab + i * symsize, &sym, symsize))
+      return 0;
+    uint32_t name = is64 ? sym.s64.st_name : sym.s32.st_name;
+    char buf[sizeof("_r_debug")];
+    if (ReadUserMemory(strtab + name, buf, sizeof(buf)) &&
+        memcmp(buf, "_r_debug", sizeof(buf)) == 0) {
+      return static_cast<uint32_t>(is64 ? sym.s64.st_value
+                                        : sym.s32.st_value);
+    }
+  }
+  return 0;
+}
+
+// Lists the loaded objects in the format of gdbserver's
+// qXfer:libraries-svr4, so that GDB need not walk the dynamic linker's
+// list itself one small memory read at a time.  Returns false if the
+// list cannot be found, in which case GDB falls back to walking it.
+bool Target::GetLibrariesSvr4Xml(string *xml) {
+  if (r_debug_addr_ == 0)
+    r_debug_addr_ = FindRDebug();
+  if (r_debug_addr_ == 0)
+    return false;
+
+  UserRDebug r_debug;
+  if (!ReadUserMemory(r_debug_addr_, &r_debug, sizeof(r_debug)))
+    return false;
+
+  *xml = "<library-list-svr4 version=\"1.0\"";
+  if (r_debug.r_map != 0)
+    AppendXmlAttr(xml, "main-lm", r_debug.r_map);
+  *xml += ">";
+  uint32_t lm_addr = r_debug.r_map;
+  for (uint32_t i = 0; i < kMaxLibraries && lm_addr != 0; ++i) {
+    UserLinkMap lm;
+    if (!ReadUserMemory(lm_addr, &lm, sizeof(lm)))
+      return false;
+    // The first entry is the main program, reported as main-lm.
+    if (i != 0) {
+      string name;
+      if (!ReadUserString(lm.l_name, &name))
+        return false;
+      *xml += "<library name=\"";
+      AppendXmlEscaped(xml, name);
+      *xml += "\"";
+      AppendXmlAttr(xml, "lm", lm_addr);
+      AppendXmlAttr(xml, "l_addr", lm.l_addr);
+      AppendXmlAttr(xml, "l_ld", lm.l_ld);
+      *xml += "/>";
+    }
+    lm_addr = lm.l_next;
+  }
+  *xml += "</library-list-svr4>";
+  return true;
+}
+
 bool Target::ProcessPacket(Packet *pktIn, Packet *pktOut) {
   char cmd;
   int32_t seq = -1;
@@ -781,6 +1052,10 @@ bool Target::ProcessPacket(Packet *pktIn, Packet *pktOut) {
           err = BAD_FORMAT;
           break;
         }
+        if (wlen > kMaxPacketSize) {
+          err = BAD_ARGS;
+          break;
+        }
         user_addr = AdjustUserAddr(user_addr);
         uint64_t sys_addr = NaClUserToSysAddrRange(nap_, (uintptr_t) user_addr,
                                                    (size_t) wlen);
@@ -817,6 +1092,10 @@ bool Target::ProcessPacket(Packet *pktIn, Packet *pktOut) {
           err = BAD_FORMAT;
           break;
         }
+        if (wlen > kMaxPacketSize) {
+          err = BAD_ARGS;
+          break;
+        }
         user_addr = AdjustUserAddr(user_addr);
         uint64_t sys_addr = NaClUserToSysAddrRange(nap_, (uintptr_t) user_addr,
                                                    (size_t) wlen);
@@ -843,6 +1122,59 @@ bool Target::ProcessPacket(Packet *pktIn, Packet *pktOut) {
         break;
       }
 
+    // IN : $Xaaaa,llll:bb..bb  (binary data, escaped)
+    // OUT: $OK
+    case 'X':  {
+        uint64_t user_addr;
+        uint64_t wlen;
+        uint32_t len;
+
+        if (!pktIn->GetNumberSep(&user_addr, 0)) {
+          err = BAD_FORMAT;
+          break;
+        }
+        if (!pktIn->GetNumberSep(&wlen, 0)) {
+          err = BAD_FORMAT;
+          break;
+        }
+        if (wlen > kMaxPacketSize) {
+          err = BAD_ARGS;
+          break;
+        }
+        // GDB probes for 'X' support with an empty write.
+        if (wlen == 0) {
+          pktOut->AddString("OK");
+          break;
+        }
+        user_addr = AdjustUserAddr(user_addr);
+        uint64_t sys_addr = NaClUserToSysAddrRange(nap_, (uintptr_t) user_addr,
+                                                   (size_t) wlen);
+        if (sys_addr == kNaClBadAddress) {
+          err = FAILED;
+          break;
+        }
+        len = static_cast<uint32_t>(wlen);
+        // We disallow the debugger from modifying code.
+        if (user_addr < nap_->dynamic_text_end) {
+          err = FAILED;
+          break;
+        }
+
+        nacl::scoped_array<uint8_t> block(new uint8_t[len]);
+        if (!pktIn->GetEscapedBlock(block.get(), len)) {
+          err = BAD_FORMAT;
+          break;
+        }
+
+        if (!port::IPlatform::SetMemory(nap_, sys_addr, len, block.get())) {
+          err = FAILED;
+          break;
+        }
+
+        pktOut->AddString("OK");
+        break;
+      }
+
     case 'q': {
       string tmp;
       const char *str = &pktIn->GetPayload()[1];
@@ -888,6 +1220,25 @@ bool Target::ProcessPacket(Packet *pktIn, Packet *pktOut) {
         break;
       }
 
+      tmp = "Xfer:memory-map:read::";
+      if (!strncmp(str, tmp.data(), tmp.length())) {
+        string xml;
+        GetMemoryMapXml(&xml);
+        AddXferReply(xml, &str[tmp.length()], pktOut, &err);
+        break;
+      }
+
+      tmp = "Xfer:libraries-svr4:read::";
+      if (!strncmp(str, tmp.data(), tmp.length())) {
+        string xml;
+        if (!GetLibrariesSvr4Xml(&xml)) {
+          err = FAILED;
+          break;
+        }
+        AddXferReply(xml, &str[tmp.length()], pktOut, &err);
+        break;
+      }
+
       // Check the property cache
       if (itr != properties_.end()) {
         pktOut->AddString(itr->second.data());
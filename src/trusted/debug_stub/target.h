@@ -93,6 +93,16 @@ class Target {
   void EmitFileError(Packet *pktOut, int code);
   void ProcessFilePacket(Packet *pktIn, Packet *pktOut, ErrDef *err);
 
+  bool ReadUserMemory(uint32_t user_addr, void *dst, uint32_t len);
+  bool ReadUserString(uint32_t user_addr, std::string *str);
+
+  // Replies to a qXfer read of "offset,length" from the given object.
+  void AddXferReply(const std::string &data, const char *args,
+                    Packet *pktOut, ErrDef *err);
+  void GetMemoryMapXml(std::string *xml);
+  uint32_t FindRDebug();
+  bool GetLibrariesSvr4Xml(std::string *xml);
+
   void SetStopReply(Packet *pktOut) const;
 
   void Destroy();
@@ -161,6 +171,9 @@ class Target {
   // suspended.
   uint32_t step_over_breakpoint_thread_;
 
+  // Untrusted address of the dynamic linker's r_debug, once found.
+  uint32_t r_debug_addr_;
+
   // Whether all threads are currently suspended.
   bool all_threads_suspended_;
 
@@ -376,6 +376,102 @@ static ssize_t NaClDescXferableDataDescLowLevelRecvMsg(
 }
 
 
+ssize_t NaClDescImcConnectedDescLowLevelSendMsgBatch(
+    struct NaClDesc                 *vself,
+    struct NaClMessageHeader const  *dgrams,
+    uint32_t                        count,
+    int                             *sizes,
+    int                             flags) {
+  struct NaClDescImcConnectedDesc *self = ((struct NaClDescImcConnectedDesc *)
+                                           vself);
+  enum NaClDescTypeTag            type_tag;
+  uint32_t                        i;
+  int                             result;
+
+  type_tag = NACL_VTBL(NaClDesc, vself)->typeTag;
+  if (NACL_DESC_IMC_SOCKET == type_tag) {
+    struct NaClDescImcDesc *imc = (struct NaClDescImcDesc *) vself;
+
+    NaClXMutexLock(&imc->sendmsg_mu);
+    result = NaClSendDatagramBatch(self->h, dgrams, count, sizes, flags);
+    NaClXMutexUnlock(&imc->sendmsg_mu);
+  } else if (NACL_DESC_TRANSFERABLE_DATA_SOCKET == type_tag) {
+    /* See NaClDescXferableDataDescLowLevelSendMsg. */
+    for (i = 0; i < count; ++i) {
+      if (0 != dgrams[i].handle_count) {
+        NaClLog(2,
+                ("NaClDescImcConnectedDescLowLevelSendMsgBatch: tranferable"
+                 " and non-zero handle_count\n"));
+        return -NACL_ABI_EINVAL;
+      }
+    }
+    result = NaClSendDatagramBatch(self->h, dgrams, count, sizes, flags);
+  } else {
+    return -NACL_ABI_EINVAL;
+  }
+
+  if (-1 == result) {
+#if NACL_WINDOWS
+    return -NaClXlateSystemError(GetLastError());
+#elif NACL_LINUX || NACL_OSX
+    return -NaClXlateErrno(errno);
+#else
+# error "Unknown target platform: cannot translate error code(s) from SendMsg"
+#endif
+  }
+  return result;
+}
+
+
+ssize_t NaClDescImcConnectedDescLowLevelRecvMsgBatch(
+    struct NaClDesc                 *vself,
+    struct NaClMessageHeader        *dgrams,
+    uint32_t                        count,
+    int                             *sizes,
+    int                             flags) {
+  struct NaClDescImcConnectedDesc *self = ((struct NaClDescImcConnectedDesc *)
+                                           vself);
+  enum NaClDescTypeTag            type_tag;
+  uint32_t                        i;
+  int                             result;
+
+  NaClLog(4, "Entered NaClDescImcConnectedDescLowLevelRecvMsgBatch, h=%d\n",
+          self->h);
+  type_tag = NACL_VTBL(NaClDesc, vself)->typeTag;
+  if (NACL_DESC_IMC_SOCKET == type_tag) {
+    struct NaClDescImcDesc *imc = (struct NaClDescImcDesc *) vself;
+
+    NaClXMutexLock(&imc->recvmsg_mu);
+    result = NaClReceiveDatagramBatch(self->h, dgrams, count, sizes, flags);
+    NaClXMutexUnlock(&imc->recvmsg_mu);
+  } else if (NACL_DESC_TRANSFERABLE_DATA_SOCKET == type_tag) {
+    /* See NaClDescXferableDataDescLowLevelRecvMsg. */
+    for (i = 0; i < count; ++i) {
+      if (0 != dgrams[i].handle_count) {
+        NaClLog(2,
+                "NaClDescImcConnectedDescLowLevelRecvMsgBatch:"
+                " tranferable and non-zero handle_count\n");
+        return -NACL_ABI_EINVAL;
+      }
+    }
+    result = NaClReceiveDatagramBatch(self->h, dgrams, count, sizes, flags);
+  } else {
+    return -NACL_ABI_EINVAL;
+  }
+
+  if (-1 == result) {
+#if NACL_WINDOWS
+    return -NaClXlateSystemError(GetLastError());
+#elif NACL_LINUX || NACL_OSX
+    return -errno;
+#else
+# error "Unknown target platform: cannot translate error code(s) from RecvMsg"
+#endif
+  }
+  return result;
+}
+
+
 static struct NaClDescVtbl const kNaClDescImcConnectedDescVtbl = {
   {
     NaClDescImcConnectedDescDtor,
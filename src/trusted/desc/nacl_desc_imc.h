@@ -72,6 +72,29 @@ int NaClDescXferableDataDescCtor(struct NaClDescXferableDataDesc  *self,
                                  NaClHandle                       h)
     NACL_WUR;
 
+/*
+ * Batched versions of the LowLevelSendMsg and LowLevelRecvMsg
+ * methods, for use when vself is a NaClDescImcDesc or a
+ * NaClDescXferableDataDesc.  They move up to count datagrams with
+ * NaClSendDatagramBatch()/NaClReceiveDatagramBatch(), holding the
+ * same locks as the single-message methods.  sizes[i] receives the
+ * byte count of the i-th datagram.  Return the number of datagrams
+ * transferred, or a negated errno value if none were.
+ */
+ssize_t NaClDescImcConnectedDescLowLevelSendMsgBatch(
+    struct NaClDesc                 *vself,
+    struct NaClMessageHeader const  *dgrams,
+    uint32_t                        count,
+    int                             *sizes,
+    int                             flags) NACL_WUR;
+
+ssize_t NaClDescImcConnectedDescLowLevelRecvMsgBatch(
+    struct NaClDesc                 *vself,
+    struct NaClMessageHeader        *dgrams,
+    uint32_t                        count,
+    int                             *sizes,
+    int                             flags) NACL_WUR;
+
 EXTERN_C_END
 
 #endif  // NATIVE_CLIENT_SRC_TRUSTED_DESC_NACL_DESC_IMC_H_
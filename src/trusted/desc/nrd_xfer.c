@@ -127,29 +127,33 @@ int NaClDescExternalizeToXferBuffer(struct NaClDescXferState  *xferp,
   return (*NACL_VTBL(NaClDesc, out)->Externalize)(out, xferp);
 }
 
-ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
-                                const struct NaClImcTypedMsgHdr *nitmhp,
-                                int                              flags) {
-  int                       supported_flags;
+/*
+ * Translates the high-level message nitmhp into a datagram for the
+ * low-level IMC layer.  kern_iov must have room for
+ * nitmhp->iov_length + 1 entries and kern_handle for
+ * NACL_ABI_IMC_DESC_MAX entries; both are referenced by *kern_msg_hdr
+ * on return.  If descriptors are being sent, the buffer holding the
+ * NaClInternalHeader and descriptor data is malloc'd and returned via
+ * *hdr_buf, which the caller must free after the send completes.
+ *
+ * Returns 0 on success, or a negated errno value.
+ */
+static ssize_t NaClImcTypedMessageToDatagram(
+    struct NaClDesc                 *channel,
+    const struct NaClImcTypedMsgHdr *nitmhp,
+    struct NaClImcMsgIoVec          *kern_iov,
+    NaClHandle                      *kern_handle,
+    struct NaClMessageHeader        *kern_msg_hdr,
+    char                            **hdr_buf) {
   ssize_t                   retval = -NACL_ABI_EINVAL;
-  struct NaClMessageHeader  kern_msg_hdr;  /* xlated interface */
   size_t                    i;
-  /*
-   * BEWARE: NaClImcMsgIoVec has the same layout as NaClIOVec, so
-   * there will be type punning below to avoid copying from a struct
-   * NaClImcMsgIoVec array to a struct NaClIOVec array in order to
-   * call the IMC library code using kern_msg_hdr.
-   */
-  struct NaClImcMsgIoVec    kern_iov[NACL_ABI_IMC_IOVEC_MAX + 1];
   struct NaClDesc           **kern_desc;
-  NaClHandle                kern_handle[NACL_ABI_IMC_DESC_MAX];
   size_t                    user_bytes;
   size_t                    sys_bytes;
   size_t                    sys_handles;
   size_t                    desc_bytes;
   size_t                    desc_handles;
   struct NaClInternalHeader *hdr;
-  char                      *hdr_buf;
   struct NaClDescXferState  xfer_state;
 
   static struct NaClInternalHeader const kNoHandles = {
@@ -157,23 +161,7 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
     /* and implicit zeros for pad bytes */
   };
 
-  NaClLog(3,
-          ("Entered"
-           " NaClImcSendTypedMessage(0x%08"NACL_PRIxPTR", "
-           "0x%08"NACL_PRIxPTR", 0x%x)\n"),
-          (uintptr_t) channel, (uintptr_t) nitmhp, flags);
-  /*
-   * What flags do we know now?  If a program was compiled using a
-   * newer ABI than what this implementation knows, the extra flag
-   * bits are ignored but will generate a warning.
-   */
-  supported_flags = NACL_ABI_IMC_NONBLOCK;
-  if (0 != (flags & ~supported_flags)) {
-    NaClLog(LOG_WARNING,
-            "WARNING: NaClImcSendTypedMessage: unknown IMC flag used: 0x%x\n",
-            flags);
-    flags &= supported_flags;
-  }
+  *hdr_buf = NULL;
 
   /*
    * use (ahem) RTTI -- or a virtual function that's been partially
@@ -221,19 +209,18 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
   }
 
   kern_desc = nitmhp->ndescv;
-  hdr_buf = NULL;
 
   /*
    * NOTE: type punning w/ NaClImcMsgIoVec and NaClIOVec.
    * This breaks ansi type aliasing rules and hence we may use
    * soemthing like '-fno-strict-aliasing'
    */
-  kern_msg_hdr.iov = (struct NaClIOVec *) kern_iov;
-  kern_msg_hdr.iov_length = nitmhp->iov_length + 1;  /* header */
+  kern_msg_hdr->iov = (struct NaClIOVec *) kern_iov;
+  kern_msg_hdr->iov_length = nitmhp->iov_length + 1;  /* header */
 
   if (0 == nitmhp->ndesc_length) {
-    kern_msg_hdr.handles = NULL;
-    kern_msg_hdr.handle_count = 0;
+    kern_msg_hdr->handles = NULL;
+    kern_msg_hdr->handle_count = 0;
     kern_iov[0].base = (void *) &kNoHandles;
     kern_iov[0].length = sizeof kNoHandles;
   } else {
@@ -256,7 +243,7 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
                 ("NaClImcSendTypedMessage: ExternalizeSize"
                  " returned %"NACL_PRIdS"\n"),
                 retval);
-        goto cleanup;
+        return retval;
       }
       /*
        * No integer overflow should be possible given the max-handles
@@ -265,8 +252,7 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
       if (desc_bytes > NACL_ABI_SIZE_T_MAX - 1
           || (desc_bytes + 1) > NACL_ABI_SIZE_T_MAX - sys_bytes
           || desc_handles > NACL_ABI_SIZE_T_MAX - sys_handles) {
-        retval = -NACL_ABI_EOVERFLOW;
-        goto cleanup;
+        return -NACL_ABI_EOVERFLOW;
       }
       sys_bytes += (1 + desc_bytes);
       sys_handles += desc_handles;
@@ -291,21 +277,19 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
       NaClLog(LOG_FATAL, "NaClImcSendTypedMessage: "
               "Buffer size overflow (%"NACL_PRIuS" bytes)",
               sys_bytes);
-      retval = -NACL_ABI_EOVERFLOW;
-      goto cleanup;
+      return -NACL_ABI_EOVERFLOW;
     }
-    hdr_buf = malloc(sys_bytes + sizeof *hdr);
-    if (NULL == hdr_buf) {
+    *hdr_buf = malloc(sys_bytes + sizeof *hdr);
+    if (NULL == *hdr_buf) {
       NaClLog(4, "NaClImcSendTypedMessage: out of memory for iov");
-      retval = -NACL_ABI_ENOMEM;
-      goto cleanup;
+      return -NACL_ABI_ENOMEM;
     }
-    kern_iov[0].base = (void *) hdr_buf;
+    kern_iov[0].base = (void *) *hdr_buf;
 
     /* Checked above that sys_bytes <= NACL_ABI_SIZE_T_MAX - sizeof *hdr */
     kern_iov[0].length = (nacl_abi_size_t)(sys_bytes + sizeof *hdr);
 
-    hdr = (struct NaClInternalHeader *) hdr_buf;
+    hdr = (struct NaClInternalHeader *) *hdr_buf;
     memset(hdr, 0, sizeof(*hdr));  /* Initilize the struct's padding bytes. */
     hdr->h.xfer_protocol_version = NACL_HANDLE_TRANSFER_PROTOCOL;
     if (sys_bytes > UINT32_MAX) {
@@ -322,8 +306,7 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
        * max_xfer is upper bound on data transferred), and max_xfer <=
        * INT32_MAX = NACL_ABI_SSIZE_MAX <= SSIZE_T_MAX holds.
        */
-      retval = -NACL_ABI_EOVERFLOW;
-      goto cleanup;
+      return -NACL_ABI_EOVERFLOW;
     }
     hdr->h.descriptor_data_bytes = (uint32_t) sys_bytes;
 
@@ -340,7 +323,7 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
                 ("NaClImcSendTypedMessage: Externalize for"
                  " descriptor %"NACL_PRIuS" returned %"NACL_PRIdS"\n"),
                 i, retval);
-        goto cleanup;
+        return retval;
       }
     }
     *xfer_state.next_byte++ = (uint8_t) NACL_DESC_TYPE_END_TAG;
@@ -352,15 +335,21 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
       *xfer_state.next_byte++ = '\0';
     }
 
-    kern_msg_hdr.handles = kern_handle;
-    kern_msg_hdr.handle_count = (uint32_t) sys_handles;
+    kern_msg_hdr->handles = kern_handle;
+    kern_msg_hdr->handle_count = (uint32_t) sys_handles;
   }
+  return 0;
+}
 
-  NaClLog(4, "Invoking LowLevelSendMsg, flags 0x%x\n", flags);
-
-  retval = (*((struct NaClDescVtbl const *) channel->base.vtbl)->
-            LowLevelSendMsg)(channel, &kern_msg_hdr, flags);
-  NaClLog(4, "LowLevelSendMsg returned %"NACL_PRIdS"\n", retval);
+/*
+ * Converts the result of a low-level send of a datagram whose first
+ * iov entry (the NaClInternalHeader and descriptor data) is
+ * header_bytes long into the number of user bytes sent, or a negated
+ * errno value.
+ */
+static ssize_t NaClImcSendResult(ssize_t retval,
+                                 size_t  header_bytes,
+                                 int     flags) {
   if (NaClSSizeIsNegErrno(&retval)) {
     /*
      * NaClWouldBlock uses TSD (for both the errno-based and
@@ -385,9 +374,9 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
        */
       retval = -NACL_ABI_EIO;
     }
-  } else if ((unsigned) retval < kern_iov[0].length) {
+  } else if ((size_t) retval < header_bytes) {
     /*
-     * retval >= 0, so cast to unsigned is value preserving.
+     * retval >= 0, so cast to size_t is value preserving.
      */
     retval = -NACL_ABI_ENOBUFS;
   } else {
@@ -395,8 +384,73 @@ ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
      * The return value (number of bytes sent) should not include the
      * "out of band" additional information added by the service runtime.
      */
-    retval -= kern_iov[0].length;
+    retval -= header_bytes;
   }
+  return retval;
+}
+
+static int NaClImcCheckFlags(const char *who, int flags) {
+  /*
+   * What flags do we know now?  If a program was compiled using a
+   * newer ABI than what this implementation knows, the extra flag
+   * bits are ignored but will generate a warning.
+   */
+  int supported_flags = NACL_ABI_IMC_NONBLOCK;
+  if (0 != (flags & ~supported_flags)) {
+    NaClLog(LOG_WARNING,
+            "WARNING: %s: unknown IMC flag used: 0x%x\n",
+            who, flags);
+    flags &= supported_flags;
+  }
+  return flags;
+}
+
+/*
+ * Returns true if channel sends and receives through the
+ * NaClDescImcConnectedDesc batched low-level methods.
+ */
+static int NaClImcChannelCanBatch(struct NaClDesc *channel) {
+  enum NaClDescTypeTag type_tag = NACL_VTBL(NaClDesc, channel)->typeTag;
+
+  return (NACL_DESC_IMC_SOCKET == type_tag
+          || NACL_DESC_TRANSFERABLE_DATA_SOCKET == type_tag);
+}
+
+ssize_t NaClImcSendTypedMessage(struct NaClDesc                 *channel,
+                                const struct NaClImcTypedMsgHdr *nitmhp,
+                                int                              flags) {
+  ssize_t                   retval = -NACL_ABI_EINVAL;
+  struct NaClMessageHeader  kern_msg_hdr;  /* xlated interface */
+  /*
+   * BEWARE: NaClImcMsgIoVec has the same layout as NaClIOVec, so
+   * there will be type punning below to avoid copying from a struct
+   * NaClImcMsgIoVec array to a struct NaClIOVec array in order to
+   * call the IMC library code using kern_msg_hdr.
+   */
+  struct NaClImcMsgIoVec    kern_iov[NACL_ABI_IMC_IOVEC_MAX + 1];
+  NaClHandle                kern_handle[NACL_ABI_IMC_DESC_MAX];
+  char                      *hdr_buf;
+
+  NaClLog(3,
+          ("Entered"
+           " NaClImcSendTypedMessage(0x%08"NACL_PRIxPTR", "
+           "0x%08"NACL_PRIxPTR", 0x%x)\n"),
+          (uintptr_t) channel, (uintptr_t) nitmhp, flags);
+  flags = NaClImcCheckFlags("NaClImcSendTypedMessage", flags);
+
+  retval = NaClImcTypedMessageToDatagram(channel, nitmhp, kern_iov,
+                                         kern_handle, &kern_msg_hdr,
+                                         &hdr_buf);
+  if (0 != retval) {
+    goto cleanup;
+  }
+
+  NaClLog(4, "Invoking LowLevelSendMsg, flags 0x%x\n", flags);
+
+  retval = (*((struct NaClDescVtbl const *) channel->base.vtbl)->
+            LowLevelSendMsg)(channel, &kern_msg_hdr, flags);
+  NaClLog(4, "LowLevelSendMsg returned %"NACL_PRIdS"\n", retval);
+  retval = NaClImcSendResult(retval, kern_iov[0].length, flags);
 
 cleanup:
 
@@ -407,42 +461,139 @@ cleanup:
   return retval;
 }
 
-
-ssize_t NaClImcRecvTypedMessage(
-    struct NaClDesc               *channel,
-    struct NaClImcTypedMsgHdr     *nitmhp,
-    int                           flags) {
-  int                       supported_flags;
-  ssize_t                   retval;
-  char                      *recv_buf;
-  size_t                    user_bytes;
-  NaClHandle                kern_handle[NACL_ABI_IMC_DESC_MAX];
-  struct NaClIOVec          recv_iov;
-  struct NaClMessageHeader  recv_hdr;
-  ssize_t                   total_recv_bytes;
-  struct NaClInternalHeader intern_hdr;
-  size_t                    recv_user_bytes_avail;
-  size_t                    tmp;
-  char                      *user_data;
-  size_t                    iov_copy_size;
-  struct NaClDescXferState  xfer;
-  struct NaClDesc           *new_desc[NACL_ABI_IMC_DESC_MAX];
-  int                       xfer_status;
+ssize_t NaClImcSendTypedMessageBatch(struct NaClDesc                 *channel,
+                                     const struct NaClImcTypedMsgHdr *nitmhp,
+                                     size_t                          count,
+                                     size_t                          *sizes,
+                                     int                             flags) {
+  ssize_t                   retval = -NACL_ABI_ENOMEM;
+  struct NaClMessageHeader  *kern_msg_hdr = NULL;
+  struct NaClImcMsgIoVec    *kern_iov = NULL;
+  struct NaClImcMsgIoVec    *next_iov;
+  NaClHandle                *kern_handle = NULL;
+  char                      **hdr_buf = NULL;
+  int                       *dgram_sizes = NULL;
+  size_t                    total_iov;
+  size_t                    prepared;
   size_t                    i;
-  size_t                    num_user_desc;
 
-  NaClLog(4,
-          "Entered NaClImcRecvTypedMsg(0x%08"NACL_PRIxPTR", "
-          "0x%08"NACL_PRIxPTR", %d)\n",
-          (uintptr_t) channel, (uintptr_t) nitmhp, flags);
+  NaClLog(3,
+          ("Entered"
+           " NaClImcSendTypedMessageBatch(0x%08"NACL_PRIxPTR", "
+           "0x%08"NACL_PRIxPTR", %"NACL_PRIuS", 0x%x)\n"),
+          (uintptr_t) channel, (uintptr_t) nitmhp, count, flags);
+  flags = NaClImcCheckFlags("NaClImcSendTypedMessageBatch", flags);
 
-  supported_flags = NACL_ABI_IMC_NONBLOCK;
-  if (0 != (flags & ~supported_flags)) {
-    NaClLog(LOG_WARNING,
-            "WARNING: NaClImcRecvTypedMsg: unknown IMC flag used: 0x%x\n",
-            flags);
-    flags &= supported_flags;
+  if (count > NACL_ABI_IMC_MSG_BATCH_MAX) {
+    count = NACL_ABI_IMC_MSG_BATCH_MAX;
+  }
+  if (0 == count) {
+    return 0;
+  }
+
+  if (!NaClImcChannelCanBatch(channel)) {
+    for (i = 0; i < count; ++i) {
+      retval = (*NACL_VTBL(NaClDesc, channel)->SendMsg)(channel,
+                                                        &nitmhp[i],
+                                                        flags);
+      if (retval < 0) {
+        return 0 == i ? retval : (ssize_t) i;
+      }
+      sizes[i] = retval;
+    }
+    return (ssize_t) count;
+  }
+
+  total_iov = 0;
+  for (i = 0; i < count; ++i) {
+    if (nitmhp[i].iov_length > NACL_ABI_IMC_IOVEC_MAX) {
+      if (0 == i) {
+        NaClLog(4, "gather/scatter array too large\n");
+        return -NACL_ABI_EINVAL;
+      }
+      count = i;
+      break;
+    }
+    total_iov += nitmhp[i].iov_length + 1;
+  }
+
+  kern_msg_hdr = malloc(count * sizeof *kern_msg_hdr);
+  kern_iov = malloc(total_iov * sizeof *kern_iov);
+  kern_handle = malloc(count * NACL_ABI_IMC_DESC_MAX * sizeof *kern_handle);
+  hdr_buf = calloc(count, sizeof *hdr_buf);
+  dgram_sizes = malloc(count * sizeof *dgram_sizes);
+  if (NULL == kern_msg_hdr || NULL == kern_iov || NULL == kern_handle
+      || NULL == hdr_buf || NULL == dgram_sizes) {
+    NaClLog(4, "NaClImcSendTypedMessageBatch: out of memory\n");
+    goto cleanup;
+  }
+
+  /*
+   * Messages that fail to translate end the batch; the ones before
+   * them are still sent and the caller sees a short count.
+   */
+  next_iov = kern_iov;
+  for (prepared = 0; prepared < count; ++prepared) {
+    retval = NaClImcTypedMessageToDatagram(
+        channel, &nitmhp[prepared], next_iov,
+        kern_handle + prepared * NACL_ABI_IMC_DESC_MAX,
+        &kern_msg_hdr[prepared], &hdr_buf[prepared]);
+    if (0 != retval) {
+      break;
+    }
+    next_iov += nitmhp[prepared].iov_length + 1;
+  }
+  if (0 == prepared) {
+    goto cleanup;
+  }
+
+  NaClLog(4, "Invoking LowLevelSendMsgBatch, %"NACL_PRIuS" messages\n",
+          prepared);
+  retval = NaClDescImcConnectedDescLowLevelSendMsgBatch(
+      channel, kern_msg_hdr, (uint32_t) prepared, dgram_sizes, flags);
+  NaClLog(4, "LowLevelSendMsgBatch returned %"NACL_PRIdS"\n", retval);
+  if (retval < 0) {
+    retval = NaClImcSendResult(retval, 0, flags);
+    goto cleanup;
+  }
+  prepared = (size_t) retval;
+  for (i = 0; i < prepared; ++i) {
+    retval = NaClImcSendResult(dgram_sizes[i],
+                               kern_msg_hdr[i].iov[0].length, flags);
+    if (retval < 0) {
+      break;
+    }
+    sizes[i] = (size_t) retval;
+  }
+  if (i > 0) {
+    retval = (ssize_t) i;
+  }
+
+cleanup:
+  if (NULL != hdr_buf) {
+    for (i = 0; i < count; ++i) {
+      free(hdr_buf[i]);
+    }
   }
+  free(dgram_sizes);
+  free(hdr_buf);
+  free(kern_handle);
+  free(kern_iov);
+  free(kern_msg_hdr);
+
+  NaClLog(4, "NaClImcSendTypedMessageBatch: returning %"NACL_PRIdS"\n",
+          retval);
+  return retval;
+}
+
+
+/*
+ * Validates nitmhp for a receive and computes in *user_bytes how many
+ * bytes of user data it can hold.  Returns 0 or a negated errno value.
+ */
+static ssize_t NaClImcRecvUserBytes(const struct NaClImcTypedMsgHdr *nitmhp,
+                                    size_t                          *user_bytes) {
+  size_t i;
 
   if (nitmhp->iov_length > NACL_ABI_IMC_IOVEC_MAX) {
     NaClLog(4, "gather/scatter array too large\n");
@@ -453,44 +604,46 @@ ssize_t NaClImcRecvTypedMessage(
     return -NACL_ABI_EINVAL;
   }
 
-  user_bytes = 0;
+  *user_bytes = 0;
   for (i = 0; i < nitmhp->iov_length; ++i) {
-    if (user_bytes > SIZE_T_MAX - nitmhp->iov[i].length) {
+    if (*user_bytes > SIZE_T_MAX - nitmhp->iov[i].length) {
       NaClLog(4, "integer overflow in iov length summation\n");
       return -NACL_ABI_EINVAL;
     }
-    user_bytes += nitmhp->iov[i].length;
+    *user_bytes += nitmhp->iov[i].length;
   }
   /*
    * if user_bytes > NACL_ABI_IMC_USER_BYTES_MAX,
    * we will just never fill up all the buffer space.
    */
-  user_bytes = min_size(user_bytes, NACL_ABI_IMC_USER_BYTES_MAX);
+  *user_bytes = min_size(*user_bytes, NACL_ABI_IMC_USER_BYTES_MAX);
   /*
    * user_bytes = \min(\sum_{i=0}{nitmhp->iov_length-1} nitmhp->iov[i].length,
    *                   NACL_ABI_IMC_USER_BYTES_MAX)
    */
+  return 0;
+}
 
-  recv_buf = NULL;
-  memset(new_desc, 0, sizeof new_desc);
-  /*
-   * from here on, set retval and jump to cleanup code.
-   */
-
-  recv_buf = malloc(NACL_ABI_IMC_BYTES_MAX);
-  if (NULL == recv_buf) {
-    NaClLog(4, "no memory for receive buffer\n");
-    retval = -NACL_ABI_ENOMEM;
-    goto cleanup;
-  }
+/*
+ * Sets up recv_hdr to receive a datagram into the buffer recv_buf of
+ * recv_buf_size bytes, with handles going into kern_handle, which
+ * must have room for NACL_ABI_IMC_DESC_MAX entries.
+ */
+static void NaClImcPrepareRecvDatagram(struct NaClDesc          *channel,
+                                       char                     *recv_buf,
+                                       size_t                   recv_buf_size,
+                                       struct NaClIOVec         *recv_iov,
+                                       NaClHandle               *kern_handle,
+                                       struct NaClMessageHeader *recv_hdr) {
+  size_t i;
 
-  recv_iov.base = (void *) recv_buf;
-  recv_iov.length = NACL_ABI_IMC_BYTES_MAX;
+  recv_iov->base = (void *) recv_buf;
+  recv_iov->length = recv_buf_size;
 
-  recv_hdr.iov = &recv_iov;
-  recv_hdr.iov_length = 1;
+  recv_hdr->iov = recv_iov;
+  recv_hdr->iov_length = 1;
 
-  for (i = 0; i < NACL_ARRAY_SIZE(kern_handle); ++i) {
+  for (i = 0; i < NACL_ABI_IMC_DESC_MAX; ++i) {
     kern_handle[i] = NACL_INVALID_HANDLE;
   }
 
@@ -500,8 +653,8 @@ ssize_t NaClImcRecvTypedMessage(
      * Channel can transfer access rights.
      */
 
-    recv_hdr.handles = kern_handle;
-    recv_hdr.handle_count = NACL_ARRAY_SIZE(kern_handle);
+    recv_hdr->handles = kern_handle;
+    recv_hdr->handle_count = NACL_ABI_IMC_DESC_MAX;
     NaClLog(4, "Connected socket, may transfer descriptors\n");
   } else {
     /*
@@ -509,27 +662,44 @@ ssize_t NaClImcRecvTypedMessage(
      * if recv_iov.length is non-zero.
      */
 
-    recv_hdr.handles = (NaClHandle *) NULL;
-    recv_hdr.handle_count = 0;
+    recv_hdr->handles = (NaClHandle *) NULL;
+    recv_hdr->handle_count = 0;
     NaClLog(4, "Transferable Data Only socket\n");
   }
 
-  recv_hdr.flags = 0;  /* just to make it obvious; IMC will clear it for us */
+  recv_hdr->flags = 0;  /* just to make it obvious; IMC will clear it for us */
+}
 
-  total_recv_bytes = (*((struct NaClDescVtbl const *) channel->base.vtbl)->
-                      LowLevelRecvMsg)(channel,
-                                       &recv_hdr,
-                                       flags);
-  if (NaClSSizeIsNegErrno(&total_recv_bytes)) {
-    NaClLog(1, "LowLevelRecvMsg failed, returned %"NACL_PRIdS"\n",
-            total_recv_bytes);
-    retval = total_recv_bytes;
-    goto cleanup;
-  }
-  /* total_recv_bytes >= 0 */
+/*
+ * Decodes a datagram of total_recv_bytes bytes in recv_buf, received
+ * with recv_hdr, into nitmhp, which can hold user_bytes bytes of user
+ * data.  Handles consumed from recv_hdr->handles are replaced with
+ * NACL_INVALID_HANDLE; the caller closes any that are left.
+ *
+ * Returns the number of user bytes received, or a negated errno value.
+ */
+static ssize_t NaClImcDatagramToTypedMessage(
+    struct NaClImcTypedMsgHdr     *nitmhp,
+    size_t                        user_bytes,
+    char                          *recv_buf,
+    ssize_t                       total_recv_bytes,
+    struct NaClMessageHeader      *recv_hdr) {
+  ssize_t                   retval;
+  struct NaClInternalHeader intern_hdr;
+  size_t                    recv_user_bytes_avail;
+  size_t                    tmp;
+  char                      *user_data;
+  size_t                    iov_copy_size;
+  struct NaClDescXferState  xfer;
+  struct NaClDesc           *new_desc[NACL_ABI_IMC_DESC_MAX];
+  int                       xfer_status;
+  size_t                    i;
+  size_t                    num_user_desc;
+
+  memset(new_desc, 0, sizeof new_desc);
 
   /*
-   * NB: recv_hdr.flags may already contain NACL_ABI_MESSAGE_TRUNCATED
+   * NB: recv_hdr->flags may already contain NACL_ABI_MESSAGE_TRUNCATED
    * and/or NACL_ABI_HANDLES_TRUNCATED.
    *
    * First, parse the NaClInternalHeader and any subsequent fields to
@@ -587,7 +757,7 @@ ssize_t NaClImcRecvTypedMessage(
    * as inform the caller if data truncation occurred.
    */
   if (user_bytes < recv_user_bytes_avail) {
-    recv_hdr.flags |= NACL_ABI_RECVMSG_DATA_TRUNCATED;
+    recv_hdr->flags |= NACL_ABI_RECVMSG_DATA_TRUNCATED;
   }
   recv_user_bytes_avail = min_size(recv_user_bytes_avail, user_bytes);
 
@@ -642,8 +812,8 @@ ssize_t NaClImcRecvTypedMessage(
    */
   xfer.next_byte = recv_buf + sizeof intern_hdr;
   xfer.byte_buffer_end = xfer.next_byte + intern_hdr.h.descriptor_data_bytes;
-  xfer.next_handle = kern_handle;
-  xfer.handle_buffer_end = kern_handle + recv_hdr.handle_count;
+  xfer.next_handle = recv_hdr->handles;
+  xfer.handle_buffer_end = recv_hdr->handles + recv_hdr->handle_count;
 
   i = 0;
   while (xfer.next_byte < xfer.byte_buffer_end) {
@@ -689,8 +859,6 @@ ssize_t NaClImcRecvTypedMessage(
   /* retval is number of bytes received */
 
 cleanup:
-  free(recv_buf);
-
   /*
    * Note that we must exercise discipline when constructing NaClDesc
    * objects from NaClHandles -- the NaClHandle values *must* be set
@@ -705,16 +873,219 @@ cleanup:
       new_desc[i] = NULL;
     }
   }
-  for (i = 0; i < NACL_ARRAY_SIZE(kern_handle); ++i) {
+  return retval;
+}
+
+static void NaClImcCloseHandles(NaClHandle *kern_handle, size_t count) {
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
     if (NACL_INVALID_HANDLE != kern_handle[i]) {
       (void) NaClClose(kern_handle[i]);
     }
   }
+}
+
+ssize_t NaClImcRecvTypedMessage(
+    struct NaClDesc               *channel,
+    struct NaClImcTypedMsgHdr     *nitmhp,
+    int                           flags) {
+  ssize_t                   retval;
+  char                      *recv_buf;
+  size_t                    user_bytes;
+  NaClHandle                kern_handle[NACL_ABI_IMC_DESC_MAX];
+  struct NaClIOVec          recv_iov;
+  struct NaClMessageHeader  recv_hdr;
+  ssize_t                   total_recv_bytes;
+
+  NaClLog(4,
+          "Entered NaClImcRecvTypedMsg(0x%08"NACL_PRIxPTR", "
+          "0x%08"NACL_PRIxPTR", %d)\n",
+          (uintptr_t) channel, (uintptr_t) nitmhp, flags);
+  flags = NaClImcCheckFlags("NaClImcRecvTypedMsg", flags);
+
+  retval = NaClImcRecvUserBytes(nitmhp, &user_bytes);
+  if (0 != retval) {
+    return retval;
+  }
+
+  /*
+   * from here on, set retval and jump to cleanup code.
+   */
+
+  recv_buf = malloc(NACL_ABI_IMC_BYTES_MAX);
+  if (NULL == recv_buf) {
+    NaClLog(4, "no memory for receive buffer\n");
+    return -NACL_ABI_ENOMEM;
+  }
+
+  NaClImcPrepareRecvDatagram(channel, recv_buf, NACL_ABI_IMC_BYTES_MAX,
+                             &recv_iov, kern_handle, &recv_hdr);
+
+  total_recv_bytes = (*((struct NaClDescVtbl const *) channel->base.vtbl)->
+                      LowLevelRecvMsg)(channel,
+                                       &recv_hdr,
+                                       flags);
+  if (NaClSSizeIsNegErrno(&total_recv_bytes)) {
+    NaClLog(1, "LowLevelRecvMsg failed, returned %"NACL_PRIdS"\n",
+            total_recv_bytes);
+    retval = total_recv_bytes;
+    goto cleanup;
+  }
+  /* total_recv_bytes >= 0 */
+
+  retval = NaClImcDatagramToTypedMessage(nitmhp, user_bytes, recv_buf,
+                                         total_recv_bytes, &recv_hdr);
+
+cleanup:
+  free(recv_buf);
+  NaClImcCloseHandles(kern_handle, NACL_ARRAY_SIZE(kern_handle));
 
   NaClLog(3, "NaClImcRecvTypedMsg: returning %"NACL_PRIdS"\n", retval);
   return retval;
 }
 
+ssize_t NaClImcRecvTypedMessageBatch(
+    struct NaClDesc               *channel,
+    struct NaClImcTypedMsgHdr     *nitmhp,
+    size_t                        count,
+    size_t                        *sizes,
+    int                           flags) {
+  ssize_t                   retval = -NACL_ABI_ENOMEM;
+  /*
+   * The per-message receive buffer needs room for the header and
+   * descriptor data in addition to the user data.
+   */
+  static size_t const       kOverhead = (NACL_ABI_IMC_BYTES_MAX
+                                         - NACL_ABI_IMC_USER_BYTES_MAX);
+  size_t                    *user_bytes = NULL;
+  size_t                    *buf_offset = NULL;
+  char                      *recv_buf = NULL;
+  NaClHandle                *kern_handle = NULL;
+  struct NaClIOVec          *recv_iov = NULL;
+  struct NaClMessageHeader  *recv_hdr = NULL;
+  int                       *dgram_sizes = NULL;
+  size_t                    total_buf;
+  size_t                    received;
+  size_t                    decoded;
+  size_t                    i;
+
+  NaClLog(4,
+          "Entered NaClImcRecvTypedMessageBatch(0x%08"NACL_PRIxPTR", "
+          "0x%08"NACL_PRIxPTR", %"NACL_PRIuS", %d)\n",
+          (uintptr_t) channel, (uintptr_t) nitmhp, count, flags);
+  flags = NaClImcCheckFlags("NaClImcRecvTypedMessageBatch", flags);
+
+  if (count > NACL_ABI_IMC_MSG_BATCH_MAX) {
+    count = NACL_ABI_IMC_MSG_BATCH_MAX;
+  }
+  if (0 == count) {
+    return 0;
+  }
+
+  if (!NaClImcChannelCanBatch(channel)) {
+    for (i = 0; i < count; ++i) {
+      /* Only the first receive may block. */
+      retval = (*NACL_VTBL(NaClDesc, channel)->RecvMsg)(
+          channel, &nitmhp[i], 0 == i ? flags : flags | NACL_ABI_IMC_NONBLOCK);
+      if (retval < 0) {
+        return 0 == i ? retval : (ssize_t) i;
+      }
+      sizes[i] = retval;
+    }
+    return (ssize_t) count;
+  }
+
+  user_bytes = malloc(count * sizeof *user_bytes);
+  buf_offset = malloc(count * sizeof *buf_offset);
+  if (NULL == user_bytes || NULL == buf_offset) {
+    goto cleanup;
+  }
+  total_buf = 0;
+  for (i = 0; i < count; ++i) {
+    retval = NaClImcRecvUserBytes(&nitmhp[i], &user_bytes[i]);
+    if (0 != retval) {
+      if (0 == i) {
+        goto cleanup;
+      }
+      count = i;
+      break;
+    }
+    buf_offset[i] = total_buf;
+    total_buf += kOverhead + user_bytes[i];
+  }
+
+  retval = -NACL_ABI_ENOMEM;
+  recv_buf = malloc(total_buf);
+  kern_handle = malloc(count * NACL_ABI_IMC_DESC_MAX * sizeof *kern_handle);
+  recv_iov = malloc(count * sizeof *recv_iov);
+  recv_hdr = malloc(count * sizeof *recv_hdr);
+  dgram_sizes = malloc(count * sizeof *dgram_sizes);
+  if (NULL == recv_buf || NULL == kern_handle || NULL == recv_iov
+      || NULL == recv_hdr || NULL == dgram_sizes) {
+    NaClLog(4, "no memory for receive buffers\n");
+    /* kern_handle is not initialized yet, so do not close it */
+    count = 0;
+    goto cleanup;
+  }
+  for (i = 0; i < count; ++i) {
+    NaClImcPrepareRecvDatagram(channel, recv_buf + buf_offset[i],
+                               kOverhead + user_bytes[i], &recv_iov[i],
+                               kern_handle + i * NACL_ABI_IMC_DESC_MAX,
+                               &recv_hdr[i]);
+  }
+
+  retval = NaClDescImcConnectedDescLowLevelRecvMsgBatch(
+      channel, recv_hdr, (uint32_t) count, dgram_sizes, flags);
+  if (retval < 0) {
+    NaClLog(1, "LowLevelRecvMsgBatch failed, returned %"NACL_PRIdS"\n",
+            retval);
+    goto cleanup;
+  }
+
+  /*
+   * All received datagrams are already off the socket.  One that fails
+   * to decode is dropped on its own, as a failed
+   * NaClImcRecvTypedMessage() would drop it, and the ones after it move
+   * up into its slot.  Decoding into an earlier slot is fine since the
+   * copy-out is bounded by that slot's own user_bytes.
+   */
+  received = (size_t) retval;
+  decoded = 0;
+  for (i = 0; i < received; ++i) {
+    retval = NaClImcDatagramToTypedMessage(&nitmhp[decoded],
+                                           user_bytes[decoded],
+                                           recv_buf + buf_offset[i],
+                                           dgram_sizes[i], &recv_hdr[i]);
+    if (retval < 0) {
+      NaClLog(1, "NaClImcRecvTypedMessageBatch: dropping message %"NACL_PRIuS
+              ", decode returned %"NACL_PRIdS"\n", i, retval);
+      continue;
+    }
+    sizes[decoded] = (size_t) retval;
+    ++decoded;
+  }
+  if (decoded > 0) {
+    retval = (ssize_t) decoded;
+  }
+
+cleanup:
+  if (NULL != kern_handle) {
+    NaClImcCloseHandles(kern_handle, count * NACL_ABI_IMC_DESC_MAX);
+  }
+  free(dgram_sizes);
+  free(recv_hdr);
+  free(recv_iov);
+  free(kern_handle);
+  free(recv_buf);
+  free(buf_offset);
+  free(user_bytes);
+
+  NaClLog(3, "NaClImcRecvTypedMessageBatch: returning %"NACL_PRIdS"\n",
+          retval);
+  return retval;
+}
+
 int32_t NaClCommonDescSocketPair(struct NaClDesc *pair[2]) {
   int32_t                         retval = -NACL_ABI_EIO;
   struct NaClDescXferableDataDesc *d0;
@@ -66,6 +66,35 @@ ssize_t NaClImcRecvTypedMessage(struct NaClDesc               *channel,
                                 struct NaClImcTypedMsgHdr     *nitmhp,
                                 int32_t                       flags);
 
+/**
+ * Send up to count high-level IMC messages over an IMC channel,
+ * using a single host call where the platform supports it.  At most
+ * NACL_ABI_IMC_MSG_BATCH_MAX messages are sent.  The number of user
+ * bytes sent in each message is stored in sizes[].  Returns the number
+ * of messages sent, which may be fewer than count, or a negated errno
+ * value if the first message could not be sent.
+ */
+ssize_t NaClImcSendTypedMessageBatch(struct NaClDesc                 *channel,
+                                     const struct NaClImcTypedMsgHdr *nitmhp,
+                                     size_t                          count,
+                                     size_t                          *sizes,
+                                     int32_t                         flags);
+
+/**
+ * Receive up to count high-level IMC messages over an IMC channel.
+ * Only the wait for the first message blocks (unless
+ * NACL_ABI_IMC_NONBLOCK is given); the rest of the batch is whatever
+ * is already queued.  The number of user bytes received in each
+ * message is stored in sizes[].  A message that cannot be decoded is
+ * dropped and the ones after it fill its slot.  Returns the number of
+ * messages received, or a negated errno value if none were.
+ */
+ssize_t NaClImcRecvTypedMessageBatch(struct NaClDesc               *channel,
+                                     struct NaClImcTypedMsgHdr     *nitmhp,
+                                     size_t                        count,
+                                     size_t                        *sizes,
+                                     int32_t                       flags);
+
 /**
  * Create a bound socket and corresponding socket address as a pair.
  * Returns 0 on success, and a negative value (negated errno) on
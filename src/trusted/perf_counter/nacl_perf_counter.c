@@ -10,11 +10,11 @@
  */
 
 #include "native_client/src/shared/platform/nacl_log.h"
-#include "native_client/src/shared/platform/nacl_time.h"
 #include "native_client/src/include/portability.h"
 #include "native_client/src/include/portability_string.h"
 #include "native_client/src/include/nacl_macros.h"
 #include "native_client/src/trusted/perf_counter/nacl_perf_counter.h"
+#include "native_client/src/trusted/perf_counter/nacl_trace.h"
 
 #define LAST_IDX(X) (NACL_ARRAY_SIZE(X)-1)
 
@@ -39,14 +39,26 @@ void NaClPerfCounterCtor(struct NaClPerfCounter *sv,
 
   strncpy(sv->sample_names[0], "__start__", LAST_IDX(sv->sample_names[0]));
 
-
-  while (0 != NaClGetTimeOfDay(&sv->sample_list[sv->samples])) {
-    /* repeat until we get a sample */
-  }
+  sv->sample_list[sv->samples] = NaClTraceNowNanoseconds();
+  sv->last_ns = sv->sample_list[sv->samples];
 
   sv->samples++;
 }
 
+/*
+ * Records the span since the previous mark, and stretches the span
+ * covering the whole counter to now.  The outer span is only created
+ * on the first mark, so counters that are never marked cost nothing.
+ */
+static void NaClPerfCounterTrace(struct NaClPerfCounter *sv,
+                                 const char *ev_name, int64_t now) {
+  if (NULL == sv->trace_span) {
+    sv->trace_span = NaClTraceSpanBegin(sv->app_name, sv->sample_list[0]);
+  }
+  NaClTraceSpan(ev_name, sv->last_ns, now);
+  NaClTraceSpanSetEnd(sv->trace_span, now);
+}
+
 
 /*
  * Records the time in sv and  returns its index in sv
@@ -55,17 +67,22 @@ void NaClPerfCounterCtor(struct NaClPerfCounter *sv,
  * is actually the SECOND sample.
  */
 int NaClPerfCounterMark(struct NaClPerfCounter *sv, const char *ev_name) {
+  int64_t now;
+
   if ((NULL == sv) || (NULL == ev_name)) {
     NaClLog(LOG_ERROR, "NaClPerfCounterMark received null args\n");
     return -1;
   }
+  now = NaClTraceNowNanoseconds();
+  if (NaClTraceIsEnabled()) {
+    NaClPerfCounterTrace(sv, ev_name, now);
+  }
+  sv->last_ns = now;
   if (sv->samples >= NACL_MAX_PERF_COUNTER_SAMPLES) {
     NaClLog(LOG_ERROR, "NaClPerfCounterMark going beyond buffer size\n");
     return -1;
   }
-  while (0 != NaClGetTimeOfDay(&(sv->sample_list[sv->samples]))) {
-    /* busy loop until we succeed, damn it */
-  }
+  sv->sample_list[sv->samples] = now;
 
   /*
    * This relies upon memset() inside NaClPerfCounterCtor() for
@@ -91,11 +108,7 @@ int64_t NaClPerfCounterInterval(struct NaClPerfCounter *sv,
       (sv->samples <= NACL_MAX_PERF_COUNTER_SAMPLES)) {
     uint32_t lo = (a < b)? a : b;
     uint32_t hi = (b < a)? a : b;
-    int64_t seconds = (sv->sample_list[hi].nacl_abi_tv_sec -
-                       sv->sample_list[lo].nacl_abi_tv_sec);
-    int64_t usec = (sv->sample_list[hi].nacl_abi_tv_usec -
-                    sv->sample_list[lo].nacl_abi_tv_usec);
-    int64_t rtn = seconds * NACL_MICROS_PER_UNIT + usec;
+    int64_t rtn = (sv->sample_list[hi] - sv->sample_list[lo]) / 1000;
 
     NaClLog(1, "NaClPerfCounterInterval(%s %s:%s): %"NACL_PRId64" microsecs\n",
             sv->app_name, sv->sample_names[lo], sv->sample_names[hi], rtn);
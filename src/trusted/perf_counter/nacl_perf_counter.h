@@ -11,23 +11,36 @@
  */
 
 #include "native_client/src/include/nacl_base.h"
-#include "native_client/src/trusted/service_runtime/include/sys/time.h"
+#include "native_client/src/include/portability.h"
 
 EXTERN_C_BEGIN
 
 #define NACL_MAX_PERF_COUNTER_SAMPLES  (16)
 #define NACL_MAX_PERF_COUNTER_NAME     (20)
+
+struct NaClTraceEvent;
+
 struct NaClPerfCounter {
   char app_name[128]; /* name of the app being run */
 
   /*
-   * It's a basic NaClGetTimeOfDay() based measurement.
+   * Samples are monotonic clock readings, in nanoseconds; see
+   * NaClTraceNowNanoseconds().
    */
 
   uint32_t samples;
-  struct nacl_abi_timeval sample_list[NACL_MAX_PERF_COUNTER_SAMPLES];
+  int64_t sample_list[NACL_MAX_PERF_COUNTER_SAMPLES];
   char sample_names[NACL_MAX_PERF_COUNTER_SAMPLES][NACL_MAX_PERF_COUNTER_NAME];
 
+  /*
+   * When tracing is enabled (see nacl_trace.h), each mark also records
+   * a span from the previous mark, nested inside a span named app_name
+   * that covers all of the marks.  This is not limited to
+   * NACL_MAX_PERF_COUNTER_SAMPLES marks.
+   */
+  int64_t last_ns;
+  struct NaClTraceEvent *trace_span;
+
   /*
    * This struct may be extended in the future to include more
    * architecture-specific perf measurements.
@@ -43,7 +56,8 @@ extern void NaClPerfCounterCtor(struct NaClPerfCounter *sv,
 
 /*
  * Adds one more time measurement sample.
- * Returns the index of the time sample being made.
+ * Returns the index of the time sample being made, or -1 once the
+ * samples are used up.
  * Requires a non-null short string to tag the event with a name
  */
 extern int NaClPerfCounterMark(struct NaClPerfCounter *sv,
@@ -5,40 +5,144 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "native_client/src/include/nacl_assert.h"
 #include "native_client/src/include/portability.h"
 #include "native_client/src/include/portability_io.h"
 #include "native_client/src/include/portability_string.h"
+#include "native_client/src/shared/platform/nacl_clock.h"
 #include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_threads.h"
 #include "native_client/src/shared/platform/nacl_time.h"
 
 #include "native_client/src/trusted/perf_counter/nacl_perf_counter.h"
+#include "native_client/src/trusted/perf_counter/nacl_trace.h"
 
 /* A simple test of the performance counter basics. */
 
 struct perf_counter_test {
-  struct nacl_abi_timeval _[2];
-  int64_t res;
+  int64_t _[2];  /* nanoseconds */
+  int64_t res;   /* microseconds */
 };
 
 struct perf_counter_test arr[] = {
-  { { { 0, 0 }, { 0, 0 } }, 0 },
-  { { { 0, 100 }, { 0, 0 } }, -100 },
-  { { { 1, 100, }, { 2, 5 } }, (999*1000 + 905) },
-  { { { 0, 0 }, { 0, 0 } }, 0 },
+  { { 0, 0 }, 0 },
+  { { 100000, 0 }, -100 },
+  { { 1000100000, 2000005000 }, (999*1000 + 905) },
+  { { 0, 0 }, 0 },
 };
 
 
 #define ALEN(A) ((int)(sizeof(A)/sizeof(A[0])))
 
+static void MarkSome(char const *app_name) {
+  struct NaClPerfCounter tm;
+  int i;
+
+  NaClPerfCounterCtor(&tm, app_name);
+  /* Go past the sample limit: the trace keeps every mark. */
+  for (i = 0; i < NACL_MAX_PERF_COUNTER_SAMPLES + 4; ++i) {
+    NaClPerfCounterMark(&tm, i % 2 ? "odd_mark" : "even_mark");
+  }
+}
+
+static void WINAPI TraceThread(void *arg) {
+  UNREFERENCED_PARAMETER(arg);
+  MarkSome("trace_thread");
+}
+
+static void WINAPI EndSpanThread(void *arg) {
+  NaClTraceSpanSetEnd((struct NaClTraceEvent *) arg,
+                      NaClTraceNowNanoseconds());
+}
+
+static char *ReadFile(char const *path) {
+  FILE  *fp = fopen(path, "rb");
+  char  *buf;
+  long  len;
+  int   rc;
+
+  ASSERT_NE(NULL, fp);
+  ASSERT_EQ(0, fseek(fp, 0, SEEK_END));
+  len = ftell(fp);
+  ASSERT_GE(len, 0);
+  ASSERT_EQ(0, fseek(fp, 0, SEEK_SET));
+  buf = malloc(len + 1);
+  ASSERT_NE(NULL, buf);
+  ASSERT_EQ((size_t) len, fread(buf, 1, len, fp));
+  /* ASSERT_EQ() evaluates its operands again when it fails. */
+  rc = fclose(fp);
+  ASSERT_EQ(0, rc);
+  buf[len] = '\0';
+  return buf;
+}
+
+static int CountOccurrences(char const *haystack, char const *needle) {
+  int count = 0;
+
+  while (NULL != (haystack = strstr(haystack, needle))) {
+    ++count;
+    ++haystack;
+  }
+  return count;
+}
+
+/*
+ * Checks that marks on two threads end up in the trace file, nested
+ * in their counters' spans, and that a span can be ended on a thread
+ * other than the one which began it.
+ */
+static void TestTrace(char const *temp_dir) {
+  static char const     kPrefix[] = "{\"traceEvents\":[";
+  struct NaClThread     thread;
+  struct NaClTraceEvent *span;
+  char                  path[1024];
+  char                  *json;
+
+  ASSERT_LT(snprintf(path, sizeof path, "%s/trace.json", temp_dir),
+            (int) sizeof path);
+  ASSERT_EQ(0, NaClTraceIsEnabled());
+  MarkSome("not_traced");
+  NaClTraceEnable();
+  ASSERT_NE(0, NaClTraceIsEnabled());
+
+  MarkSome("main_thread");
+  ASSERT_NE(0, NaClThreadCreateJoinable(&thread, TraceThread, NULL,
+                                        65536));
+  NaClThreadJoin(&thread);
+
+  span = NaClTraceSpanBegin("cross_thread", NaClTraceNowNanoseconds());
+  ASSERT_NE(NULL, span);
+  ASSERT_NE(0, NaClThreadCreateJoinable(&thread, EndSpanThread, span,
+                                        65536));
+  NaClThreadJoin(&thread);
+  ASSERT_NE(0, NaClTraceWriteJson(path));
+
+  json = ReadFile(path);
+  ASSERT_EQ(0, strncmp(json, kPrefix, sizeof kPrefix - 1));
+  ASSERT_EQ(1, CountOccurrences(json, "\"name\":\"cross_thread\""));
+  ASSERT_EQ(NULL, strstr(json, "not_traced"));
+  ASSERT_EQ(1, CountOccurrences(json, "\"name\":\"main_thread\""));
+  ASSERT_EQ(1, CountOccurrences(json, "\"name\":\"trace_thread\""));
+  ASSERT_EQ(2 * (NACL_MAX_PERF_COUNTER_SAMPLES + 4),
+            CountOccurrences(json, "_mark\""));
+  ASSERT_EQ(2 * (NACL_MAX_PERF_COUNTER_SAMPLES + 5) + 1,
+            CountOccurrences(json, "\"ph\":\"X\""));
+  free(json);
+  NaClTraceFini();
+}
+
 int main(int argc, char*argv[]) {
   int i = 0;
   int64_t res = 0;
-  UNREFERENCED_PARAMETER(argc);
-  UNREFERENCED_PARAMETER(argv);
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s temp_dir\n", argv[0]);
+    return 1;
+  }
   NaClLogModuleInit();
   NaClTimeInit();
+  ASSERT_NE(0, NaClClockInit());
 
   for (; i < ALEN(arr)-1; ++i) {
     struct NaClPerfCounter tm;
@@ -118,6 +222,9 @@ int main(int argc, char*argv[]) {
     ASSERT_NE(-1, NaClPerfCounterInterval(&tm, 0, tm.samples - 1));
   } while (0);
 
+  TestTrace(argv[1]);
+
+  NaClClockFini();
   NaClTimeFini();
   NaClLogModuleFini();
   return 0;
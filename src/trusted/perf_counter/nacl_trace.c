@@ -0,0 +1,259 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Trace-event recording and export for the service runtime.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "native_client/src/include/nacl_compiler_annotations.h"
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/include/portability_process.h"
+#include "native_client/src/include/portability_string.h"
+#include "native_client/src/shared/platform/nacl_clock.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_sync.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/shared/platform/nacl_threads.h"
+#include "native_client/src/trusted/perf_counter/nacl_trace.h"
+
+#define NACL_TRACE_CHUNK_EVENTS  (256)
+
+struct NaClTraceEvent {
+  struct NaClTraceBuffer  *owner;  /* whose mu guards end_ns */
+  char                    *name;
+  int64_t                 start_ns;
+  int64_t                 end_ns;
+};
+
+struct NaClTraceChunk {
+  struct NaClTraceChunk *next;
+  size_t                count;
+  struct NaClTraceEvent events[NACL_TRACE_CHUNK_EVENTS];
+};
+
+struct NaClTraceBuffer {
+  struct NaClTraceBuffer  *next;  /* protected by g_trace_mu */
+  uint32_t                tid;
+  /*
+   * mu is only contended when the trace is written out while this
+   * thread is recording.  Chunks are never moved, so span handles stay
+   * valid.
+   */
+  struct NaClFastMutex    mu;
+  struct NaClTraceChunk   *first;
+  struct NaClTraceChunk   *last;
+};
+
+static int g_trace_enabled = 0;
+static struct NaClMutex g_trace_mu;
+static struct NaClTraceBuffer *g_trace_buffers = NULL;
+static THREAD struct NaClTraceBuffer *t_trace_buffer = NULL;
+
+void NaClTraceEnable(void) {
+  if (g_trace_enabled) {
+    return;
+  }
+  NaClXMutexCtor(&g_trace_mu);
+  g_trace_enabled = 1;
+}
+
+int NaClTraceIsEnabled(void) {
+  return g_trace_enabled;
+}
+
+int64_t NaClTraceNowNanoseconds(void) {
+  struct nacl_abi_timespec now;
+
+  while (0 != NaClClockGetTime(NACL_CLOCK_MONOTONIC, &now)) {
+    /* repeat until we get a sample */
+  }
+  return (int64_t) now.tv_sec * NACL_NANOS_PER_UNIT + now.tv_nsec;
+}
+
+/* Returns this thread's buffer, creating it if need be. */
+static struct NaClTraceBuffer *NaClTraceThreadBuffer(void) {
+  struct NaClTraceBuffer *buf = t_trace_buffer;
+
+  if (NULL != buf) {
+    return buf;
+  }
+  buf = calloc(1, sizeof *buf);
+  if (NULL == buf || !NaClFastMutexCtor(&buf->mu)) {
+    NaClLog(LOG_ERROR, "NaClTraceThreadBuffer: out of memory\n");
+    free(buf);
+    return NULL;
+  }
+  buf->tid = NaClThreadId();
+  NaClXMutexLock(&g_trace_mu);
+  buf->next = g_trace_buffers;
+  g_trace_buffers = buf;
+  NaClXMutexUnlock(&g_trace_mu);
+  t_trace_buffer = buf;
+  return buf;
+}
+
+static struct NaClTraceEvent *NaClTraceRecord(char const *name,
+                                              int64_t start_ns,
+                                              int64_t end_ns) {
+  struct NaClTraceBuffer  *buf;
+  struct NaClTraceChunk   *chunk;
+  struct NaClTraceEvent   *ev = NULL;
+  char                    *name_copy;
+
+  if (!g_trace_enabled) {
+    return NULL;
+  }
+  buf = NaClTraceThreadBuffer();
+  if (NULL == buf) {
+    return NULL;
+  }
+  name_copy = STRDUP(name);
+  if (NULL == name_copy) {
+    return NULL;
+  }
+
+  NaClFastMutexLock(&buf->mu);
+  chunk = buf->last;
+  if (NULL == chunk || NACL_TRACE_CHUNK_EVENTS == chunk->count) {
+    chunk = malloc(sizeof *chunk);
+    if (NULL == chunk) {
+      NaClFastMutexUnlock(&buf->mu);
+      free(name_copy);
+      return NULL;
+    }
+    chunk->next = NULL;
+    chunk->count = 0;
+    if (NULL == buf->last) {
+      buf->first = chunk;
+    } else {
+      buf->last->next = chunk;
+    }
+    buf->last = chunk;
+  }
+  ev = &chunk->events[chunk->count++];
+  ev->owner = buf;
+  ev->name = name_copy;
+  ev->start_ns = start_ns;
+  ev->end_ns = end_ns;
+  NaClFastMutexUnlock(&buf->mu);
+  return ev;
+}
+
+void NaClTraceSpan(char const *name, int64_t start_ns, int64_t end_ns) {
+  (void) NaClTraceRecord(name, start_ns, end_ns);
+}
+
+struct NaClTraceEvent *NaClTraceSpanBegin(char const *name,
+                                          int64_t start_ns) {
+  return NaClTraceRecord(name, start_ns, start_ns);
+}
+
+void NaClTraceSpanSetEnd(struct NaClTraceEvent *span, int64_t end_ns) {
+  if (NULL == span) {
+    return;
+  }
+  /* The span may have been begun on another thread. */
+  NaClFastMutexLock(&span->owner->mu);
+  span->end_ns = end_ns;
+  NaClFastMutexUnlock(&span->owner->mu);
+}
+
+static void NaClTraceWriteString(FILE *fp, char const *s) {
+  putc('"', fp);
+  for (; '\0' != *s; ++s) {
+    unsigned char c = (unsigned char) *s;
+    if ('"' == c || '\\' == c) {
+      fprintf(fp, "\\%c", c);
+    } else if (c < 0x20) {
+      fprintf(fp, "\\u%04x", c);
+    } else {
+      putc(c, fp);
+    }
+  }
+  putc('"', fp);
+}
+
+/* Trace-event times are in microseconds; keep the nanoseconds. */
+static void NaClTraceWriteMicros(FILE *fp, int64_t ns) {
+  fprintf(fp, "%"NACL_PRId64".%03d", ns / 1000, (int) (ns % 1000));
+}
+
+int NaClTraceWriteJson(char const *path) {
+  FILE                    *fp;
+  struct NaClTraceBuffer  *buf;
+  struct NaClTraceChunk   *chunk;
+  size_t                  i;
+  int                     pid = GETPID();
+  char const              *sep = "\n";
+  int                     ok;
+
+  if (!g_trace_enabled) {
+    return 0;
+  }
+  fp = fopen(path, "w");
+  if (NULL == fp) {
+    NaClLog(LOG_ERROR, "NaClTraceWriteJson: could not open %s\n", path);
+    return 0;
+  }
+  fprintf(fp, "{\"traceEvents\":[");
+  NaClXMutexLock(&g_trace_mu);
+  for (buf = g_trace_buffers; NULL != buf; buf = buf->next) {
+    NaClFastMutexLock(&buf->mu);
+    for (chunk = buf->first; NULL != chunk; chunk = chunk->next) {
+      for (i = 0; i < chunk->count; ++i) {
+        struct NaClTraceEvent *ev = &chunk->events[i];
+        fprintf(fp, "%s{\"name\":", sep);
+        NaClTraceWriteString(fp, ev->name);
+        fprintf(fp, ",\"cat\":\"nacl\",\"ph\":\"X\",\"ts\":");
+        NaClTraceWriteMicros(fp, ev->start_ns);
+        fprintf(fp, ",\"dur\":");
+        NaClTraceWriteMicros(fp, ev->end_ns - ev->start_ns);
+        fprintf(fp, ",\"pid\":%d,\"tid\":%u}", pid, (unsigned) buf->tid);
+        sep = ",\n";
+      }
+    }
+    NaClFastMutexUnlock(&buf->mu);
+  }
+  NaClXMutexUnlock(&g_trace_mu);
+  fprintf(fp, "\n],\"displayTimeUnit\":\"ns\"}\n");
+  ok = !ferror(fp);
+  if (0 != fclose(fp)) {
+    ok = 0;
+  }
+  if (!ok) {
+    NaClLog(LOG_ERROR, "NaClTraceWriteJson: error writing %s\n", path);
+  }
+  return ok;
+}
+
+void NaClTraceFini(void) {
+  struct NaClTraceBuffer  *buf;
+  struct NaClTraceChunk   *chunk;
+  size_t                  i;
+
+  if (!g_trace_enabled) {
+    return;
+  }
+  g_trace_enabled = 0;
+  while (NULL != (buf = g_trace_buffers)) {
+    g_trace_buffers = buf->next;
+    while (NULL != (chunk = buf->first)) {
+      buf->first = chunk->next;
+      for (i = 0; i < chunk->count; ++i) {
+        free(chunk->events[i].name);
+      }
+      free(chunk);
+    }
+    NaClFastMutexDtor(&buf->mu);
+    free(buf);
+  }
+  t_trace_buffer = NULL;
+  NaClMutexDtor(&g_trace_mu);
+}
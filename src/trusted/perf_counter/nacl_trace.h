@@ -0,0 +1,68 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+#ifndef NATIVE_CLIENT_SRC_TRUSTED_PERF_COUNTER_NACL_TRACE_H
+#define NATIVE_CLIENT_SRC_TRUSTED_PERF_COUNTER_NACL_TRACE_H 1
+
+/*
+ * Process-wide trace of timed spans, written out in the Chrome
+ * trace-event JSON format so that it can be loaded into a trace
+ * viewer (chrome://tracing or Perfetto).
+ *
+ * Each thread records into its own buffer, which grows as needed, so
+ * recording only takes an uncontended lock.  Spans on a thread nest
+ * by time: a span recorded while another is open shows up inside it.
+ * Times come from the monotonic clock, in nanoseconds.
+ *
+ * Nothing is recorded until NaClTraceEnable() is called.  sel_ldr
+ * does that when NACL_TRACE_FILE is set in its environment, and
+ * writes the trace to that file when the app exits.
+ */
+
+#include "native_client/src/include/nacl_base.h"
+#include "native_client/src/include/portability.h"
+
+EXTERN_C_BEGIN
+
+struct NaClTraceEvent;
+
+/*
+ * Starts recording.  Must be called before any other threads use the
+ * trace, and after NaClPlatformInit() (or NaClClockInit()).
+ */
+void NaClTraceEnable(void);
+
+int NaClTraceIsEnabled(void);
+
+/* Returns the monotonic time that spans are measured with. */
+int64_t NaClTraceNowNanoseconds(void);
+
+/* Records a span that started at start_ns and ended at end_ns. */
+void NaClTraceSpan(char const *name, int64_t start_ns, int64_t end_ns);
+
+/*
+ * Records a span that started at start_ns, and returns a handle for
+ * NaClTraceSpanSetEnd() (NULL if tracing is off).  Until then the span
+ * has no length.  The span may be ended on any thread, but not after
+ * NaClTraceFini().
+ */
+struct NaClTraceEvent *NaClTraceSpanBegin(char const *name,
+                                          int64_t start_ns);
+
+/* Sets, or moves, the end of a span returned by NaClTraceSpanBegin(). */
+void NaClTraceSpanSetEnd(struct NaClTraceEvent *span, int64_t end_ns);
+
+/*
+ * Writes every span recorded so far to path as trace-event JSON.
+ * Returns 0 on failure.
+ */
+int NaClTraceWriteJson(char const *path);
+
+/* Stops recording and frees the buffers.  Other threads must be done. */
+void NaClTraceFini(void);
+
+EXTERN_C_END
+
+#endif
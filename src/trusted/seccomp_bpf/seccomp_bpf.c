@@ -55,6 +55,11 @@
 #define SYS_SECCOMP 1
 #endif
 
+/* futex_waitv() was added in Linux 5.16; see sys_futex.c. */
+#if !defined(__NR_futex_waitv) && defined(__x86_64__)
+#define __NR_futex_waitv 449
+#endif
+
 #define BUF_SIZE 1024
 
 static void NaClSeccompBpfSigsysHandler(int nr, siginfo_t *info,
@@ -209,6 +214,18 @@ static struct sock_filter filter[] = {
   BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_futex, 0, 1),
   BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
 
+#ifdef __NR_futex_waitv
+  /* For futex_waitv_abs(), which falls back to ENOSYS on older kernels. */
+  BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_futex_waitv, 0, 1),
+  BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
+#endif
+
+#ifdef __NR_membarrier
+  /* Used to serialize processors after patching dynamic code. */
+  BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_membarrier, 0, 1),
+  BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
+#endif
+
   BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_clock_getres, 0, 1),
   BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
 
@@ -268,6 +285,25 @@ static struct sock_filter filter[] = {
   BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_sched_getaffinity, 0, 1),
   BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
 
+  /*
+   * For thread_sched(), which sets the calling thread's affinity, nice
+   * value and SCHED_DEADLINE reservation, and for putting them back
+   * when a thread exits.
+   */
+  BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_sched_setaffinity, 0, 1),
+  BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
+
+  BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_getpriority, 0, 1),
+  BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
+
+  BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_setpriority, 0, 1),
+  BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
+
+#ifdef __NR_sched_setattr
+  BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_sched_setattr, 0, 1),
+  BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
+#endif
+
   /* for abort(), called as tgkill(pid,tid,SIGABORT) */
   BPF_JUMP(BPF_JMP + BPF_JEQ + BPF_K, __NR_tgkill, 0, 1),
   BPF_STMT(BPF_RET + BPF_K, SECCOMP_RET_ALLOW),
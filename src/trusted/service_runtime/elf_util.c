@@ -779,13 +779,17 @@ static NaClErrorCode NaClElfFileMapSegment(struct NaClApp *nap,
 
 NaClErrorCode NaClElfImageLoad(struct NaClElfImage *image,
                                struct NaClDesc *ndp,
-                               struct NaClApp *nap) {
+                               struct NaClApp *nap,
+                               NaClElfLoadProgressFunc progress,
+                               void *progress_data) {
   int segnum;
   uintptr_t vaddr;
   uintptr_t paddr;
   uintptr_t end_vaddr;
   ssize_t read_ret;
   int safe_for_mmap;
+  Elf_Off piece_offset;
+  Elf_Off piece_size;
 
   for (segnum = 0; segnum < image->ehdr.e_phnum; ++segnum) {
     const Elf_Phdr *php = &image->phdrs[segnum];
@@ -837,6 +841,10 @@ NaClErrorCode NaClElfImageLoad(struct NaClElfImage *image,
       NaClLog(LOG_WARNING, "WARNING: BYPASSING DESCRIPTOR SAFETY CHECK\n");
       safe_for_mmap = 1;
     }
+    if (NULL != progress) {
+      /* The caller wants to see the segment arrive piece by piece. */
+      safe_for_mmap = 0;
+    }
     if (safe_for_mmap) {
       NaClErrorCode map_status;
       NaClLog(4, "NaClElfImageLoad: safe-for-mmap\n");
@@ -872,11 +880,23 @@ NaClErrorCode NaClElfImageLoad(struct NaClElfImage *image,
      */
     NACL_MAKE_MEM_UNDEFINED((void *) paddr, filesz);
 
-    read_ret = (*NACL_VTBL(NaClDesc, ndp)->
-                PRead)(ndp, (void *) paddr, filesz, (nacl_off64_t) offset);
-    if (NaClSSizeIsNegErrno(&read_ret) || (size_t) read_ret != filesz) {
-      NaClLog(LOG_ERROR, "load failure segment %d", segnum);
-      return LOAD_SEGMENT_BAD_PARAM;
+    piece_size = NULL != progress ? NACL_ELF_LOAD_PIECE_SIZE : filesz;
+    for (piece_offset = 0; piece_offset < filesz; piece_offset += piece_size) {
+      Elf_Off size = filesz - piece_offset;
+      if (size > piece_size) {
+        size = piece_size;
+      }
+      read_ret = (*NACL_VTBL(NaClDesc, ndp)->
+                  PRead)(ndp, (void *) (paddr + piece_offset), size,
+                         (nacl_off64_t) (offset + piece_offset));
+      if (NaClSSizeIsNegErrno(&read_ret) || (size_t) read_ret != size) {
+        NaClLog(LOG_ERROR, "load failure segment %d", segnum);
+        return LOAD_SEGMENT_BAD_PARAM;
+      }
+      if (NULL != progress) {
+        (*progress)(progress_data, vaddr + piece_offset,
+                    vaddr + piece_offset + size);
+      }
     }
     /* region from p_filesz to p_memsz should already be zero filled */
 
@@ -951,8 +971,13 @@ NaClErrorCode NaClElfImageLoadDynamically(
       if (NULL != metadata) {
         metadata->code_offset = offset;
       }
-      result = NaClTextDyncodeCreate(nap, (uint32_t) vaddr,
-                                     code_copy, (uint32_t) filesz, metadata);
+      /*
+       * The IRT is loaded at the same address with the same contents in
+       * every NaClApp, so it can share one validated copy of the code.
+       */
+      result = NaClTextDyncodeCreateShared(nap, (uint32_t) vaddr,
+                                           code_copy, (uint32_t) filesz,
+                                           metadata);
       free(code_copy);
       if (0 != result) {
         NaClLog(LOG_ERROR, "NaClElfImageLoadDynamically: "
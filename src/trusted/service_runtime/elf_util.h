@@ -35,13 +35,30 @@ NaClErrorCode NaClElfImageValidateProgramHeaders(
   uint8_t             addr_bits,
   struct NaClElfImageInfo *info);
 
+/*
+ * Called by NaClElfImageLoad each time the user addresses
+ * [vaddr_start, vaddr_end) have been loaded.
+ */
+typedef void (*NaClElfLoadProgressFunc)(void *progress_data,
+                                        uintptr_t vaddr_start,
+                                        uintptr_t vaddr_end);
+
 /*
  * Loads an ELF executable before the address space's memory
  * protections have been set up by NaClMemoryProtection().
+ *
+ * If progress is not NULL, segments are read (never mapped) in
+ * pieces of NACL_ELF_LOAD_PIECE_SIZE bytes, and progress is called
+ * after each piece, so that the caller can start working on the
+ * pieces which are already there.
  */
 NaClErrorCode NaClElfImageLoad(struct NaClElfImage *image,
                                struct NaClDesc *ndp,
-                               struct NaClApp *nap);
+                               struct NaClApp *nap,
+                               NaClElfLoadProgressFunc progress,
+                               void *progress_data);
+
+#define NACL_ELF_LOAD_PIECE_SIZE (1 << 20)
 
 /*
  * Loads an ELF object after NaClMemoryProtection() has been called.
@@ -45,11 +45,14 @@
 #define NACL_sys_fsync                  26
 #define NACL_sys_fdatasync              27
 #define NACL_sys_fchmod                 28
+#define NACL_sys_write_watch            29
 
 #define NACL_sys_exit                   30
 #define NACL_sys_getpid                 31
 #define NACL_sys_sched_yield            32
 #define NACL_sys_sysconf                33
+#define NACL_sys_checkpoint             34
+#define NACL_sys_thread_sched           35
 
 #define NACL_sys_gettimeofday           40
 #define NACL_sys_clock                  41
@@ -75,6 +78,8 @@
 #define NACL_sys_imc_recvmsg            64
 #define NACL_sys_imc_mem_obj_create     65
 #define NACL_sys_imc_socketpair         66
+#define NACL_sys_imc_sendmmsg           67
+#define NACL_sys_imc_recvmmsg           68
 
 #define NACL_sys_mutex_create           70
 #define NACL_sys_mutex_lock             71
@@ -118,6 +123,7 @@
 
 #define NACL_sys_futex_wait_abs         120
 #define NACL_sys_futex_wake             121
+#define NACL_sys_futex_waitv_abs        122
 
 #define NACL_sys_pread                  130
 #define NACL_sys_pwrite                 131
@@ -0,0 +1,29 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl futex_waitv_abs() argument.
+ */
+
+#ifndef _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_FUTEX_WAITV_H_
+#define _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_FUTEX_WAITV_H_ 1
+
+#if defined(NACL_IN_TOOLCHAIN_HEADERS)
+# include <stdint.h>
+#else
+# include "native_client/src/include/portability.h"
+#endif
+
+/* The most futex words that one futex_waitv_abs() call may wait on. */
+#define NACL_ABI_FUTEX_WAITV_MAX 128
+
+/* One futex word to wait on, with the value it is expected to hold. */
+struct NaClAbiFutexWaitv {
+  uint32_t addr;
+  uint32_t value;
+};
+
+#endif /* _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_FUTEX_WAITV_H_ */
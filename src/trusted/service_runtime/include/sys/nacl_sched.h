@@ -0,0 +1,67 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl thread_sched() operations and arguments.
+ */
+
+#ifndef _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_SCHED_H_
+#define _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_SCHED_H_ 1
+
+#if defined(NACL_IN_TOOLCHAIN_HEADERS)
+# include <stdint.h>
+#else
+# include "native_client/src/include/portability.h"
+#endif
+
+/*
+ * Operations.  Each applies to the calling thread.  The argument is a
+ * pointer to the type given, except for SET_PRIORITY which takes the
+ * priority band itself.
+ */
+#define NACL_ABI_SCHED_GET_INFO      0  /* struct NaClAbiSchedInfo * */
+#define NACL_ABI_SCHED_SET_AFFINITY  1  /* const uint64_t * */
+#define NACL_ABI_SCHED_GET_AFFINITY  2  /* uint64_t * */
+#define NACL_ABI_SCHED_SET_PRIORITY  3  /* int32_t */
+#define NACL_ABI_SCHED_SET_DEADLINE  4  /* const struct NaClAbiSchedDeadline * */
+
+/*
+ * Affinity masks are over virtual CPU numbers 0 .. cpu_count - 1,
+ * which the host maps onto the CPUs it allows the sandbox to use.
+ */
+#define NACL_ABI_SCHED_MAX_CPUS      64
+
+/*
+ * Priority bands run from NACL_ABI_SCHED_PRIORITY_MIN (lowest) up to
+ * the max_priority that the host allows, which is at most
+ * NACL_ABI_SCHED_PRIORITY_MAX.  Band 0 is the normal priority.
+ */
+#define NACL_ABI_SCHED_PRIORITY_MIN  (-19)
+#define NACL_ABI_SCHED_PRIORITY_MAX  20
+
+/*
+ * Deadline utilization is runtime / period, in millionths of a CPU.
+ */
+#define NACL_ABI_SCHED_UTIL_SCALE    1000000
+
+struct NaClAbiSchedInfo {
+  uint32_t cpu_count;
+  int32_t  min_priority;
+  int32_t  max_priority;
+  /* Total deadline utilization the host allows, 0 if none. */
+  uint32_t deadline_capacity;
+  /* Deadline utilization not yet taken by other threads. */
+  uint32_t deadline_available;
+};
+
+/* Times are in nanoseconds, with runtime <= deadline <= period. */
+struct NaClAbiSchedDeadline {
+  uint64_t runtime;
+  uint64_t deadline;
+  uint64_t period;
+};
+
+#endif /* _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_SCHED_H_ */
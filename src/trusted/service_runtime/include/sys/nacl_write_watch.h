@@ -0,0 +1,30 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl write watch operations.
+ */
+
+#ifndef _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_WRITE_WATCH_H_
+#define _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_WRITE_WATCH_H_ 1
+
+/*
+ * Pages are tracked at the mmap() granularity, 64KB.  Watched ranges
+ * must be aligned to it.
+ */
+#define NACL_ABI_WRITE_WATCH_PAGESIZE 0x10000
+
+/* Start tracking writes to the range, with all pages clean.  */
+#define NACL_ABI_WRITE_WATCH_ARM      0
+/* Stop tracking writes to the range.  */
+#define NACL_ABI_WRITE_WATCH_DISARM   1
+/*
+ * Report the pages of the range written since the range was armed or
+ * last fetched, and mark the reported pages clean again.
+ */
+#define NACL_ABI_WRITE_WATCH_FETCH    2
+
+#endif /* _NATIVE_CLIENT_SRC_SERVICE_RUNTIME_INCLUDE_SYS_NACL_WRITE_WATCH_H_ */
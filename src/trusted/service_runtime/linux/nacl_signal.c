@@ -24,6 +24,7 @@
 #include "native_client/src/trusted/service_runtime/nacl_tls.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
 #include "native_client/src/trusted/service_runtime/sel_rt.h"
+#include "native_client/src/trusted/service_runtime/sys_write_watch.h"
 #include "native_client/src/trusted/service_runtime/thread_suspension.h"
 
 
@@ -322,6 +323,31 @@ static void SignalCatch(int sig, siginfo_t *info, void *uc) {
     }
   }
 
+  /*
+   * Writes to pages under write watch fault, whether made by untrusted
+   * code or by trusted code copying out to untrusted memory.
+   */
+  if (sig == SIGSEGV) {
+    struct NaClAppThread *watch_natp = natp;
+#if NACL_ARCH(NACL_BUILD_ARCH) == NACL_x86 && NACL_BUILD_SUBARCH == 32
+    /*
+     * In a syscall %gs holds trusted_gs, so GetCurrentThread() finds no
+     * thread for a fault in trusted code.  %gs being trusted also means
+     * that trusted TLS works, and it knows which thread this is.
+     */
+    if (watch_natp == NULL && !is_untrusted) {
+      watch_natp = NaClTlsGetCurrentThread();
+    }
+#endif
+    if (watch_natp != NULL &&
+        NaClWriteWatchHandleFault(watch_natp->nap,
+                                  (uintptr_t) info->si_addr,
+                                  sig_ctx.prog_ctr)) {
+      /* Restart the write now that the page is writable. */
+      return;
+    }
+  }
+
   if (is_untrusted &&
       (sig == SIGSEGV || sig == SIGILL || sig == SIGFPE ||
        (NACL_ARCH(NACL_BUILD_ARCH) == NACL_mips && sig == SIGTRAP))) {
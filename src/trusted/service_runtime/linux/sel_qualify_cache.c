@@ -0,0 +1,332 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * On-disk cache of successful platform qualification.
+ */
+
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <link.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#include "native_client/src/include/build_config.h"
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/trusted/service_runtime/sel_qualify_cache.h"
+
+#if NACL_ARCH(NACL_BUILD_ARCH) == NACL_x86
+# include "native_client/src/trusted/cpu_features/arch/x86/cpu_x86.h"
+#endif
+
+#ifndef NT_GNU_BUILD_ID
+# define NT_GNU_BUILD_ID 3
+#endif
+#ifndef AT_HWCAP2
+# define AT_HWCAP2 26
+#endif
+
+#define NACL_BUILD_ID_MAX 64
+#define NOTE_ALIGN(n) (((n) + 3) & ~(size_t) 3)
+
+/*
+ * Appends to the key being built in buf.  Returns 0 if it does not
+ * fit, which makes the whole key unusable.
+ */
+static int KeyAppend(char *buf, size_t size, size_t *len,
+                     char const *fmt, ...) {
+  va_list ap;
+  int     n;
+
+  if (*len >= size) {
+    return 0;
+  }
+  va_start(ap, fmt);
+  n = vsnprintf(buf + *len, size - *len, fmt, ap);
+  va_end(ap);
+  if (n < 0 || (size_t) n >= size - *len) {
+    *len = size;
+    return 0;
+  }
+  *len += n;
+  return 1;
+}
+
+/* Reads the first line of a small file into buf, without the newline. */
+static int ReadLine(char const *path, char *buf, size_t size) {
+  int     fd;
+  ssize_t got;
+
+  fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return 0;
+  }
+  got = read(fd, buf, size - 1);
+  close(fd);
+  if (got <= 0) {
+    return 0;
+  }
+  buf[got] = '\0';
+  buf[strcspn(buf, "\n")] = '\0';
+  return 1;
+}
+
+struct BuildIdSearch {
+  uintptr_t     addr;      /* an address inside the object we want */
+  unsigned char id[NACL_BUILD_ID_MAX];
+  size_t        id_len;
+};
+
+static int FindBuildId(struct dl_phdr_info *info, size_t info_size,
+                       void *data) {
+  struct BuildIdSearch  *search = (struct BuildIdSearch *) data;
+  int                   contains = 0;
+  int                   i;
+
+  UNREFERENCED_PARAMETER(info_size);
+  for (i = 0; i < info->dlpi_phnum; ++i) {
+    ElfW(Phdr) const *ph = &info->dlpi_phdr[i];
+    uintptr_t start = info->dlpi_addr + ph->p_vaddr;
+    if (PT_LOAD == ph->p_type &&
+        search->addr >= start && search->addr - start < ph->p_memsz) {
+      contains = 1;
+    }
+  }
+  if (!contains) {
+    return 0;
+  }
+  for (i = 0; i < info->dlpi_phnum; ++i) {
+    ElfW(Phdr) const *ph = &info->dlpi_phdr[i];
+    char const *note;
+    char const *end;
+    if (PT_NOTE != ph->p_type) {
+      continue;
+    }
+    note = (char const *) (info->dlpi_addr + ph->p_vaddr);
+    end = note + ph->p_memsz;
+    while (note + sizeof(ElfW(Nhdr)) <= end) {
+      ElfW(Nhdr) const *nhdr = (ElfW(Nhdr) const *) note;
+      char const *name = note + sizeof *nhdr;
+      char const *desc = name + NOTE_ALIGN(nhdr->n_namesz);
+      char const *next = desc + NOTE_ALIGN(nhdr->n_descsz);
+      if (next > end) {
+        break;
+      }
+      if (NT_GNU_BUILD_ID == nhdr->n_type && 4 == nhdr->n_namesz &&
+          0 == memcmp(name, "GNU", 4) &&
+          nhdr->n_descsz <= sizeof search->id) {
+        memcpy(search->id, desc, nhdr->n_descsz);
+        search->id_len = nhdr->n_descsz;
+        return 1;
+      }
+      note = next;
+    }
+  }
+  /* This is our object, but it has no build id. */
+  return 1;
+}
+
+static int AppendCpuSignature(char *buf, size_t size, size_t *len) {
+#if NACL_ARCH(NACL_BUILD_ARCH) == NACL_x86
+  NaClCPUData data;
+  int         i;
+
+  NaClCPUDataGet(&data);
+  if (!KeyAppend(buf, size, len, ";cpu=%s", GetCPUIDString(&data))) {
+    return 0;
+  }
+  for (i = 0; i < kMaxCPUFeatureReg; ++i) {
+    uint32_t word = data._featurev[i];
+    /*
+     * The second word is EBX of CPUID leaf 1 (see CFReg_EBX_I in
+     * cpu_x86.c), whose top byte is the APIC id of whichever CPU we
+     * happen to be running on.
+     */
+    if (1 == i) {
+      word &= 0x00ffffff;
+    }
+    if (!KeyAppend(buf, size, len, ",%08x", word)) {
+      return 0;
+    }
+  }
+  for (i = 0; i < kMaxCPUXCRReg; ++i) {
+    if (!KeyAppend(buf, size, len, ",%016llx",
+                   (unsigned long long) data._xcrv[i])) {
+      return 0;
+    }
+  }
+  return 1;
+#else
+  /*
+   * The ARM and MIPS probes test what the hwcaps advertise, but the
+   * hwcaps are not a complete CPU identification, so add the CPU model
+   * lines the kernel reports too.
+   */
+  ElfW(auxv_t)  auxv;
+  unsigned long hwcap = 0;
+  unsigned long hwcap2 = 0;
+  char          cpuinfo[4096];
+  char const    *fields[] = { "CPU implementer", "CPU variant", "CPU part",
+                              "CPU revision", "cpu model" };
+  size_t        i;
+  int           fd;
+  ssize_t       got;
+
+  fd = open("/proc/self/auxv", O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return 0;
+  }
+  while (sizeof auxv == read(fd, &auxv, sizeof auxv) &&
+         AT_NULL != auxv.a_type) {
+    if (AT_HWCAP == auxv.a_type) {
+      hwcap = auxv.a_un.a_val;
+    } else if (AT_HWCAP2 == auxv.a_type) {
+      hwcap2 = auxv.a_un.a_val;
+    }
+  }
+  close(fd);
+  if (!KeyAppend(buf, size, len, ";hwcap=%lx,%lx", hwcap, hwcap2)) {
+    return 0;
+  }
+
+  fd = open("/proc/cpuinfo", O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return 0;
+  }
+  got = read(fd, cpuinfo, sizeof cpuinfo - 1);
+  close(fd);
+  if (got <= 0) {
+    return 0;
+  }
+  cpuinfo[got] = '\0';
+  for (i = 0; i < NACL_ARRAY_SIZE(fields); ++i) {
+    char const *line = strstr(cpuinfo, fields[i]);
+    char const *value;
+    if (NULL == line) {
+      continue;
+    }
+    value = line + strcspn(line, ":\n");
+    if (':' != *value) {
+      continue;
+    }
+    ++value;
+    if (!KeyAppend(buf, size, len, ",%.*s",
+                   (int) strcspn(value, "\n;"), value)) {
+      return 0;
+    }
+  }
+  return 1;
+#endif
+}
+
+int NaClQualificationCacheKey(char *key, size_t key_size) {
+  struct utsname        uts;
+  char                  boot_id[64];
+  struct BuildIdSearch  search;
+  size_t                len = 0;
+  size_t                i;
+
+  if (0 != uname(&uts)) {
+    return 0;
+  }
+  if (!ReadLine("/proc/sys/kernel/random/boot_id", boot_id, sizeof boot_id)) {
+    return 0;
+  }
+  memset(&search, 0, sizeof search);
+  search.addr = (uintptr_t) NaClQualificationCacheKey;
+  dl_iterate_phdr(FindBuildId, &search);
+  if (0 == search.id_len) {
+    NaClLog(2, "NaClQualificationCacheKey: sel_ldr has no build id\n");
+    return 0;
+  }
+
+  if (!KeyAppend(key, key_size, &len, "kernel=%s %s %s;boot=%s",
+                 uts.release, uts.version, uts.machine, boot_id) ||
+      !AppendCpuSignature(key, key_size, &len) ||
+      !KeyAppend(key, key_size, &len, ";build=")) {
+    return 0;
+  }
+  for (i = 0; i < search.id_len; ++i) {
+    if (!KeyAppend(key, key_size, &len, "%02x", search.id[i])) {
+      return 0;
+    }
+  }
+  /* The key is stored as one line. */
+  return NULL == strchr(key, '\n');
+}
+
+int NaClQualificationCacheLookup(char const *path, char const *key) {
+  int         fd;
+  struct stat st;
+  char        buf[NACL_QUALIFICATION_CACHE_KEY_MAX + 2];
+  size_t      key_len = strlen(key);
+  ssize_t     got;
+  int         hit = 0;
+
+  fd = open(path, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+  if (fd < 0) {
+    if (ENOENT != errno) {
+      NaClLog(LOG_WARNING, "NaClQualificationCacheLookup: cannot open %s\n",
+              path);
+    }
+    return 0;
+  }
+  if (0 != fstat(fd, &st)) {
+    goto done;
+  }
+  if (!S_ISREG(st.st_mode) || st.st_uid != geteuid() ||
+      0 != (st.st_mode & (S_IWGRP | S_IWOTH))) {
+    NaClLog(LOG_WARNING,
+            "NaClQualificationCacheLookup: ignoring %s, which is not a file"
+            " that only this user can write\n", path);
+    goto done;
+  }
+  got = read(fd, buf, sizeof buf);
+  hit = (got == (ssize_t) key_len + 1 &&
+         0 == memcmp(buf, key, key_len) &&
+         '\n' == buf[key_len]);
+ done:
+  close(fd);
+  return hit;
+}
+
+int NaClQualificationCacheStore(char const *path, char const *key) {
+  char    tmp_path[4096];
+  size_t  key_len = strlen(key);
+  int     fd;
+  int     ok;
+
+  if (snprintf(tmp_path, sizeof tmp_path, "%s.%d.tmp", path,
+               (int) getpid()) >= (int) sizeof tmp_path) {
+    return 0;
+  }
+  fd = open(tmp_path, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC,
+            0600);
+  if (fd < 0) {
+    NaClLog(LOG_WARNING, "NaClQualificationCacheStore: cannot create %s\n",
+            tmp_path);
+    return 0;
+  }
+  ok = (write(fd, key, key_len) == (ssize_t) key_len &&
+        write(fd, "\n", 1) == 1);
+  if (0 != close(fd)) {
+    ok = 0;
+  }
+  /* rename() keeps concurrent readers from seeing a partial key. */
+  if (!ok || 0 != rename(tmp_path, path)) {
+    NaClLog(LOG_WARNING, "NaClQualificationCacheStore: cannot write %s\n",
+            path);
+    unlink(tmp_path);
+    return 0;
+  }
+  return 1;
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "native_client/src/shared/platform/nacl_exit.h"
+#include "native_client/src/shared/platform/nacl_global_secure_random.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/trusted/service_runtime/sel_zygote.h"
+
+
+static void NaClZygoteReapChildren(void) {
+  pid_t pid;
+  int   status;
+
+  while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+    NaClLog(2, "NaClZygote: child %d exited, status 0x%x\n",
+            (int) pid, status);
+  }
+}
+
+static void NaClZygoteCloseFds(int const *fds, size_t count) {
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    (void) close(fds[i]);
+  }
+}
+
+static void NaClZygoteReply(int control_d, int32_t result) {
+  if (send(control_d, &result, sizeof result, MSG_NOSIGNAL)
+      != (ssize_t) sizeof result) {
+    NaClLog(LOG_ERROR, "NaClZygote: reply failed, errno %d\n", errno);
+  }
+}
+
+/*
+ * Receives one request into buf, which is NACL_ZYGOTE_MAX_REQUEST_BYTES
+ * long, and its attached descriptors into fds.  Returns the request
+ * length, 0 at end of file, or a negated errno value.  On failure no
+ * descriptors are left open.
+ */
+static ssize_t NaClZygoteRecv(int control_d, char *buf,
+                              int *fds, size_t *fd_count) {
+  struct msghdr   msg;
+  struct iovec    iov;
+  struct cmsghdr  *cmsg;
+  char            control[CMSG_SPACE(NACL_ZYGOTE_MAX_FDS * sizeof(int))];
+  ssize_t         len;
+  size_t          count;
+
+  iov.iov_base = buf;
+  iov.iov_len = NACL_ZYGOTE_MAX_REQUEST_BYTES;
+  memset(&msg, 0, sizeof msg);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof control;
+
+  do {
+    len = recvmsg(control_d, &msg, MSG_CMSG_CLOEXEC);
+  } while (-1 == len && EINTR == errno);
+  if (-1 == len) {
+    return -errno;
+  }
+
+  *fd_count = 0;
+  for (cmsg = CMSG_FIRSTHDR(&msg); NULL != cmsg;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (SOL_SOCKET == cmsg->cmsg_level && SCM_RIGHTS == cmsg->cmsg_type) {
+      count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+      if (*fd_count + count > NACL_ZYGOTE_MAX_FDS) {
+        /* cannot happen given the size of control; be defensive */
+        NaClZygoteCloseFds((int *) CMSG_DATA(cmsg), count);
+        continue;
+      }
+      memcpy(fds + *fd_count, CMSG_DATA(cmsg), count * sizeof(int));
+      *fd_count += count;
+    }
+  }
+  if (0 != (msg.msg_flags & (MSG_TRUNC | MSG_CTRUNC))) {
+    NaClZygoteCloseFds(fds, *fd_count);
+    *fd_count = 0;
+    return -EMSGSIZE;
+  }
+  return len;
+}
+
+/*
+ * Parses a request of len bytes in buf.  Returns NULL if the request
+ * is malformed.  On success, the request takes ownership of buf and
+ * copies fds.
+ */
+static struct NaClZygoteRequest *NaClZygoteParse(char *buf, size_t len,
+                                                 int const *fds,
+                                                 size_t fd_count,
+                                                 char *argv0) {
+  struct NaClZygoteRequestHeader  hdr;
+  struct NaClZygoteRequest        *req;
+  int32_t                         nacl_desc[NACL_ZYGOTE_MAX_FDS];
+  char                            *str;
+  char                            *end = buf + len;
+  size_t                          first_arg = NULL == argv0 ? 0 : 1;
+  size_t                          i;
+
+  if (len < sizeof hdr) {
+    return NULL;
+  }
+  memcpy(&hdr, buf, sizeof hdr);
+  if (NACL_ZYGOTE_REQUEST_MAGIC != hdr.magic
+      || hdr.fd_count != fd_count
+      || hdr.argc > NACL_ZYGOTE_MAX_REQUEST_BYTES
+      || hdr.envc > NACL_ZYGOTE_MAX_REQUEST_BYTES
+      || len - sizeof hdr < fd_count * sizeof nacl_desc[0]) {
+    return NULL;
+  }
+  memcpy(nacl_desc, buf + sizeof hdr, fd_count * sizeof nacl_desc[0]);
+
+  req = calloc(1, sizeof *req);
+  if (NULL == req) {
+    return NULL;
+  }
+  req->argv = calloc(hdr.argc + 2, sizeof *req->argv);
+  req->envp = calloc(hdr.envc + 1, sizeof *req->envp);
+  if (NULL == req->argv || NULL == req->envp) {
+    goto malformed;
+  }
+
+  str = buf + sizeof hdr + fd_count * sizeof nacl_desc[0];
+  req->argv[0] = argv0;
+  for (i = 0; i < hdr.argc + hdr.envc; ++i) {
+    char *nul = memchr(str, '\0', end - str);
+
+    if (NULL == nul) {
+      goto malformed;
+    }
+    if (i < hdr.argc) {
+      req->argv[i + first_arg] = str;
+    } else {
+      req->envp[i - hdr.argc] = str;
+    }
+    str = nul + 1;
+  }
+  req->argc = (int) (hdr.argc + first_arg);
+
+  for (i = 0; i < fd_count; ++i) {
+    int flags = fcntl(fds[i], F_GETFL);
+
+    if (-1 == flags || nacl_desc[i] < 0) {
+      goto malformed;
+    }
+    req->host_fd[i] = fds[i];
+    req->host_fd_mode[i] = flags & O_ACCMODE;
+    req->nacl_desc[i] = nacl_desc[i];
+  }
+  req->fd_count = (int) fd_count;
+  req->buf = buf;
+  return req;
+
+ malformed:
+  free(req->envp);
+  free(req->argv);
+  free(req);
+  return NULL;
+}
+
+static void NaClZygoteRequestFree(struct NaClZygoteRequest *req) {
+  free(req->buf);
+  free(req->envp);
+  free(req->argv);
+  free(req);
+}
+
+struct NaClZygoteRequest *NaClZygoteServe(int control_d, char *argv0) {
+  struct NaClZygoteRequest  *req;
+  char                      *buf;
+  int                       fds[NACL_ZYGOTE_MAX_FDS];
+  size_t                    fd_count;
+  ssize_t                   len;
+  pid_t                     pid;
+  int32_t                   result;
+
+  NaClLog(1, "NaClZygote: serving launch requests on descriptor %d\n",
+          control_d);
+
+  for (;;) {
+    NaClZygoteReapChildren();
+
+    buf = malloc(NACL_ZYGOTE_MAX_REQUEST_BYTES);
+    if (NULL == buf) {
+      NaClLog(LOG_FATAL, "NaClZygote: no memory for request buffer\n");
+    }
+    len = NaClZygoteRecv(control_d, buf, fds, &fd_count);
+    if (0 == len) {
+      NaClLog(1, "NaClZygote: control socket closed, exiting\n");
+      NaClExit(0);
+    }
+    if (len < 0) {
+      free(buf);
+      if (-EMSGSIZE == len) {
+        NaClZygoteReply(control_d, -EMSGSIZE);
+        continue;
+      }
+      NaClLog(LOG_ERROR, "NaClZygote: recvmsg failed, errno %d\n",
+              (int) -len);
+      NaClExit(1);
+    }
+
+    req = NaClZygoteParse(buf, (size_t) len, fds, fd_count, argv0);
+    if (NULL == req) {
+      NaClLog(LOG_ERROR, "NaClZygote: malformed launch request\n");
+      NaClZygoteCloseFds(fds, fd_count);
+      free(buf);
+      NaClZygoteReply(control_d, -EINVAL);
+      continue;
+    }
+
+    /* do not let buffered output be written by both processes */
+    fflush((FILE *) NULL);
+    pid = fork();
+    if (0 == pid) {
+      (void) close(control_d);
+      /*
+       * Each child must draw its own random numbers rather than
+       * replaying whatever the zygote had buffered.  The address
+       * space layout cannot be redrawn here; see sel_zygote.h.
+       */
+      NaClGlobalSecureRngFini();
+      NaClGlobalSecureRngInit();
+      NaClLog(2, "NaClZygote: child started with %d args\n", req->argc);
+      return req;
+    }
+    result = -1 == pid ? -errno : (int32_t) pid;
+    if (-1 == pid) {
+      NaClLog(LOG_ERROR, "NaClZygote: fork failed, errno %d\n", errno);
+    }
+    NaClZygoteCloseFds(req->host_fd, req->fd_count);
+    NaClZygoteRequestFree(req);
+    NaClZygoteReply(control_d, result);
+  }
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Starts "sel_ldr -Z 3 ... hello_world.nexe" (the command line given
+ * as our arguments) with a control socket on descriptor 3, asks the
+ * zygote for a few children, and checks that each one runs the nexe
+ * with its own stdout.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/trusted/service_runtime/sel_zygote.h"
+
+#define kControlFd 3
+#define kNumChildren 3
+
+static pid_t StartZygote(char **argv, int control_d) {
+  pid_t pid = fork();
+
+  CHECK(pid >= 0);
+  if (0 == pid) {
+    CHECK(dup2(control_d, kControlFd) == kControlFd);
+    execvp(argv[0], argv);
+    perror("sel_zygote_test: execvp");
+    _exit(127);
+  }
+  return pid;
+}
+
+struct TestRequest {
+  struct NaClZygoteRequestHeader  hdr;
+  int32_t                         nacl_desc[1];
+  char                            strings[32];
+};
+
+static int32_t RequestChild(int control_d, int stdout_d) {
+  struct TestRequest  req;
+  struct msghdr       msg;
+  struct iovec        iov;
+  struct cmsghdr      *cmsg;
+  char                control[CMSG_SPACE(sizeof(int))];
+  size_t              strings_len;
+  int32_t             reply;
+
+  memset(&req, 0, sizeof req);
+  req.hdr.magic = NACL_ZYGOTE_REQUEST_MAGIC;
+  req.hdr.argc = 1;
+  req.hdr.envc = 1;
+  req.hdr.fd_count = 1;
+  req.nacl_desc[0] = 1;
+  strings_len = 0;
+  strcpy(req.strings, "arg1");
+  strings_len += strlen("arg1") + 1;
+  strcpy(req.strings + strings_len, "ZYGOTE_CHILD=1");
+  strings_len += strlen("ZYGOTE_CHILD=1") + 1;
+
+  iov.iov_base = &req;
+  iov.iov_len = offsetof(struct TestRequest, strings) + strings_len;
+  memset(&msg, 0, sizeof msg);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof control;
+  cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(cmsg), &stdout_d, sizeof(int));
+
+  CHECK(sendmsg(control_d, &msg, 0) == (ssize_t) iov.iov_len);
+  CHECK(recv(control_d, &reply, sizeof reply, 0) == sizeof reply);
+  return reply;
+}
+
+static void CheckChildOutput(int read_d) {
+  char    buf[256];
+  size_t  total = 0;
+  ssize_t got;
+
+  while ((got = read(read_d, buf + total, sizeof buf - 1 - total)) > 0) {
+    total += got;
+  }
+  CHECK(got == 0);
+  buf[total] = '\0';
+  if (NULL == strstr(buf, "Hello, World!")) {
+    fprintf(stderr, "unexpected child output: \"%s\"\n", buf);
+    exit(1);
+  }
+}
+
+int main(int argc, char **argv) {
+  int     control[2];
+  int     out[2];
+  pid_t   zygote;
+  int32_t child;
+  int     status;
+  int     i;
+
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s sel_ldr -Z 3 [args...] nexe\n", argv[0]);
+    return 1;
+  }
+  CHECK(socketpair(AF_UNIX, SOCK_SEQPACKET, 0, control) == 0);
+  zygote = StartZygote(argv + 1, control[1]);
+  CHECK(close(control[1]) == 0);
+
+  /* A malformed request is rejected without killing the zygote. */
+  {
+    uint32_t junk = 0;
+    int32_t reply;
+
+    CHECK(send(control[0], &junk, sizeof junk, 0) == sizeof junk);
+    CHECK(recv(control[0], &reply, sizeof reply, 0) == sizeof reply);
+    CHECK(reply == -EINVAL);
+  }
+
+  for (i = 0; i < kNumChildren; ++i) {
+    CHECK(pipe(out) == 0);
+    child = RequestChild(control[0], out[1]);
+    CHECK(close(out[1]) == 0);
+    if (child <= 0) {
+      fprintf(stderr, "zygote failed to start child: %d\n", child);
+      return 1;
+    }
+    CheckChildOutput(out[0]);
+    CHECK(close(out[0]) == 0);
+  }
+
+  /* Closing the control socket makes the zygote exit. */
+  CHECK(close(control[0]) == 0);
+  CHECK(waitpid(zygote, &status, 0) == zygote);
+  CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  printf("PASSED\n");
+  return 0;
+}
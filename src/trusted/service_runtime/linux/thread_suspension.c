@@ -81,7 +81,19 @@ void NaClAppThreadSetSuspendState(struct NaClAppThread *natp,
       break;
     }
     if ((state & NACL_APP_THREAD_SUSPENDING) != 0) {
-      /* We have been asked to suspend, so wait. */
+      /*
+       * We have been asked to suspend, so wait.  Set
+       * NACL_APP_THREAD_SUSPEND_WAITER first so that
+       * NaClUntrustedThreadResume() knows to wake us.
+       */
+      if ((state & NACL_APP_THREAD_SUSPEND_WAITER) == 0) {
+        Atomic32 waiter_state = state | NACL_APP_THREAD_SUSPEND_WAITER;
+        if (CompareAndSwap(&natp->suspend_state, state, waiter_state)
+            != state) {
+          continue;  /* Retry */
+        }
+        state = waiter_state;
+      }
       FutexWait(&natp->suspend_state, state);
     } else {
       NaClLog(LOG_FATAL, "NaClAppThreadSetSuspendState: Unexpected state: %i\n",
@@ -95,9 +107,12 @@ static void HandleSuspendSignal(struct NaClSignalContext *regs) {
   struct NaClSignalContext *suspended_registers =
       &natp->suspended_registers->context;
 
-  /* Sanity check. */
-  if (natp->suspend_state != (NACL_APP_THREAD_UNTRUSTED |
-                              NACL_APP_THREAD_SUSPENDING)) {
+  /*
+   * Sanity check.  NACL_APP_THREAD_SUSPEND_WAITER is set if the
+   * signal interrupted a wait in NaClAppThreadSetSuspendState().
+   */
+  if ((natp->suspend_state & ~NACL_APP_THREAD_SUSPEND_WAITER) !=
+      (NACL_APP_THREAD_UNTRUSTED | NACL_APP_THREAD_SUSPENDING)) {
     NaClSignalErrorMessage("HandleSuspendSignal: "
                            "Unexpected suspend_state\n");
     NaClAbort();
@@ -217,11 +232,12 @@ static void WaitForUntrustedThreadToSuspend(struct NaClAppThread *natp) {
                                NACL_APP_THREAD_SUSPENDING);
   while (1) {
     Atomic32 state = natp->suspend_state;
-    if (state == kBaseState) {
+    Atomic32 masked_state = state & ~NACL_APP_THREAD_SUSPEND_WAITER;
+    if (masked_state == kBaseState) {
       FutexWait(&natp->suspend_state, state);
       continue;  /* Retry */
     }
-    if (state != (kBaseState | NACL_APP_THREAD_SUSPENDED)) {
+    if (masked_state != (kBaseState | NACL_APP_THREAD_SUSPENDED)) {
       NaClLog(LOG_FATAL, "WaitForUntrustedThreadToSuspend: "
               "Unexpected state: %d\n", state);
     }
@@ -229,8 +245,8 @@ static void WaitForUntrustedThreadToSuspend(struct NaClAppThread *natp) {
   }
 }
 
-void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
-                                int save_registers) {
+void NaClUntrustedThreadSuspendBegin(struct NaClAppThread *natp,
+                                     int save_registers) {
   Atomic32 old_state;
   Atomic32 suspending_state;
 
@@ -251,10 +267,12 @@ void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
   }
   /*
    * Once the thread has NACL_APP_THREAD_SUSPENDING set, it may not
-   * change state itself, so there should be no race condition in this
-   * check.
+   * change state itself, other than to add
+   * NACL_APP_THREAD_SUSPEND_WAITER, so there should be no race
+   * condition in this check.
    */
-  DCHECK(natp->suspend_state == suspending_state);
+  DCHECK((natp->suspend_state & ~NACL_APP_THREAD_SUSPEND_WAITER) ==
+         suspending_state);
 
   if (old_state == NACL_APP_THREAD_UNTRUSTED) {
     /*
@@ -265,14 +283,28 @@ void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
     if (save_registers && natp->suspended_registers == NULL) {
       natp->suspended_registers = malloc(sizeof(*natp->suspended_registers));
       if (natp->suspended_registers == NULL) {
-        NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspend: malloc() failed\n");
+        NaClLog(LOG_FATAL,
+                "NaClUntrustedThreadSuspendBegin: malloc() failed\n");
       }
     }
     CHECK(natp->host_thread_is_defined);
     if (pthread_kill(natp->host_thread.tid, NACL_THREAD_SUSPEND_SIGNAL) != 0) {
-      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspend: "
+      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspendBegin: "
               "pthread_kill() call failed\n");
     }
+  }
+}
+
+void NaClUntrustedThreadSuspendFinish(struct NaClAppThread *natp,
+                                      int save_registers) {
+  UNREFERENCED_PARAMETER(save_registers);
+
+  /*
+   * A thread that was in trusted code when we set
+   * NACL_APP_THREAD_SUSPENDING was not sent a signal, and it will
+   * block itself before returning to untrusted code.
+   */
+  if ((natp->suspend_state & NACL_APP_THREAD_UNTRUSTED) != 0) {
     WaitForUntrustedThreadToSuspend(natp);
   }
 }
@@ -283,7 +315,8 @@ void NaClUntrustedThreadResume(struct NaClAppThread *natp) {
   while (1) {
     old_state = natp->suspend_state;
     new_state = old_state & ~(NACL_APP_THREAD_SUSPENDING |
-                              NACL_APP_THREAD_SUSPENDED);
+                              NACL_APP_THREAD_SUSPENDED |
+                              NACL_APP_THREAD_SUSPEND_WAITER);
     DCHECK((old_state & NACL_APP_THREAD_SUSPENDING) != 0);
     if (CompareAndSwap(&natp->suspend_state, old_state, new_state)
         != old_state) {
@@ -293,10 +326,15 @@ void NaClUntrustedThreadResume(struct NaClAppThread *natp) {
   }
 
   /*
-   * TODO(mseaborn): A refinement would be to wake up the thread only
-   * if it actually suspended during the context switch.
+   * Only wake the thread if it is blocked: either in the signal
+   * handler (NACL_APP_THREAD_SUSPENDED) or during a context switch
+   * (NACL_APP_THREAD_SUSPEND_WAITER).  A thread that stayed in a
+   * syscall throughout the suspension does not need a futex() call.
    */
-  FutexWake(&natp->suspend_state, 1);
+  if ((old_state & (NACL_APP_THREAD_SUSPENDED |
+                    NACL_APP_THREAD_SUSPEND_WAITER)) != 0) {
+    FutexWake(&natp->suspend_state, 1);
+  }
 }
 
 void NaClAppThreadGetSuspendedRegistersInternal(
@@ -311,11 +349,13 @@ void NaClAppThreadSetSuspendedRegistersInternal(
 
 int NaClAppThreadUnblockIfFaulted(struct NaClAppThread *natp, int *signal) {
   /* This function may only be called on a thread that is suspended. */
-  DCHECK(natp->suspend_state == (NACL_APP_THREAD_UNTRUSTED |
-                                 NACL_APP_THREAD_SUSPENDING |
-                                 NACL_APP_THREAD_SUSPENDED) ||
-         natp->suspend_state == (NACL_APP_THREAD_TRUSTED |
-                                 NACL_APP_THREAD_SUSPENDING));
+  DCHECK((natp->suspend_state & ~NACL_APP_THREAD_SUSPEND_WAITER) ==
+         (NACL_APP_THREAD_UNTRUSTED |
+          NACL_APP_THREAD_SUSPENDING |
+          NACL_APP_THREAD_SUSPENDED) ||
+         (natp->suspend_state & ~NACL_APP_THREAD_SUSPEND_WAITER) ==
+         (NACL_APP_THREAD_TRUSTED |
+          NACL_APP_THREAD_SUSPENDING));
 
   if (natp->fault_signal == 0) {
     return 0;
@@ -12,6 +12,7 @@
 #include "native_client/src/trusted/fault_injection/fault_injection.h"
 #include "native_client/src/trusted/service_runtime/nacl_globals.h"
 #include "native_client/src/trusted/service_runtime/nacl_syscall_handlers.h"
+#include "native_client/src/trusted/service_runtime/nacl_text.h"
 #include "native_client/src/trusted/service_runtime/nacl_thread_nice.h"
 #include "native_client/src/trusted/service_runtime/nacl_tls.h"
 #include "native_client/src/trusted/service_runtime/nacl_stack_safety.h"
@@ -20,6 +21,7 @@ void  NaClAllModulesInit(void) {
   NaClNrdAllModulesInit();
   NaClFaultInjectionModuleInit();
   NaClGlobalModuleInit();  /* various global variables */
+  NaClTextModuleInit();
   NaClTlsInit();
   NaClThreadNiceInit();
 }
@@ -27,6 +29,7 @@ void  NaClAllModulesInit(void) {
 
 void NaClAllModulesFini(void) {
   NaClTlsFini();
+  NaClTextModuleFini();
   NaClGlobalModuleFini();
   NaClNrdAllModulesFini();
 }
@@ -26,12 +26,141 @@
 #include "native_client/src/trusted/service_runtime/osx/mach_thread_map.h"
 
 
-void WINAPI NaClAppThreadLauncher(void *state) {
-  struct NaClAppThread *natp = (struct NaClAppThread *) state;
-  uint32_t thread_idx;
-  NaClLog(4, "NaClAppThreadLauncher: entered\n");
+static void NaClAppThreadFree(struct NaClAppThread *natp);
 
-  NaClSignalStackRegister(natp->signal_stack);
+#if NACL_APP_THREAD_POOL
+/*
+ * Called by an exiting thread, after it has been removed from the
+ * thread table, to offer itself to the NaClApp's thread pool.  If
+ * this returns true, natp is on the pool's free list and may already
+ * have been handed to a new untrusted thread by NaClAppThreadSpawn(),
+ * so the caller must not touch natp other than to longjmp() back to
+ * NaClAppThreadLauncher().
+ */
+static int NaClAppThreadPoolPark(struct NaClAppThread *natp) {
+  struct NaClApp *nap = natp->nap;
+  int parked = 0;
+
+  if (!natp->host_thread_is_defined) {
+    return 0;
+  }
+  NaClXMutexLock(&nap->thread_pool_mu);
+  if (nap->thread_pool_count < nap->thread_pool_max) {
+    /*
+     * Release the thread index now; NaClAppThreadPoolSpawn()
+     * allocates a fresh one via NaClAppThreadInitArchSpecific().
+     */
+    NaClTlsFree(natp);
+    natp->pool_wakeup = 0;
+    natp->pool_next = nap->thread_pool_head;
+    nap->thread_pool_head = natp;
+    ++nap->thread_pool_count;
+    parked = 1;
+  }
+  NaClXMutexUnlock(&nap->thread_pool_mu);
+  return parked;
+}
+
+/*
+ * Blocks a parked thread until NaClAppThreadPoolSpawn() has assigned
+ * it a new untrusted entry point, in which case this returns true, or
+ * has taken it out of the pool for good, in which case this returns
+ * false and the thread should exit.
+ */
+static int NaClAppThreadPoolWait(struct NaClAppThread *natp) {
+  struct NaClApp *nap = natp->nap;
+  int wakeup;
+
+  NaClXMutexLock(&nap->thread_pool_mu);
+  while (0 == natp->pool_wakeup) {
+    NaClXCondVarWait(&natp->pool_cv, &nap->thread_pool_mu);
+  }
+  wakeup = natp->pool_wakeup;
+  natp->pool_wakeup = 0;
+  NaClXMutexUnlock(&nap->thread_pool_mu);
+  return wakeup > 0;
+}
+
+/*
+ * Takes a parked thread from the pool, reinitializes the per-thread
+ * state that NaClAppThreadMake() would set up, and wakes it.  The
+ * signal stack and synchronization objects are kept from the
+ * previous use.  Returns false if the pool is empty.
+ */
+static int NaClAppThreadPoolSpawn(struct NaClApp *nap,
+                                  uintptr_t      usr_entry,
+                                  uintptr_t      usr_stack_ptr,
+                                  uint32_t       user_tls1,
+                                  uint32_t       user_tls2) {
+  struct NaClAppThread *natp;
+
+  NaClXMutexLock(&nap->thread_pool_mu);
+  natp = nap->thread_pool_head;
+  if (NULL == natp) {
+    NaClXMutexUnlock(&nap->thread_pool_mu);
+    return 0;
+  }
+  nap->thread_pool_head = natp->pool_next;
+  --nap->thread_pool_count;
+  natp->pool_next = NULL;
+  natp->thread_num = -1;
+  if (!NaClAppThreadInitArchSpecific(natp, usr_entry, usr_stack_ptr)) {
+    /*
+     * natp no longer has a thread index, so it cannot stay in the
+     * pool.  Tell its host thread to exit.
+     */
+    natp->pool_wakeup = -1;
+    NaClXCondVarSignal(&natp->pool_cv);
+    NaClXMutexUnlock(&nap->thread_pool_mu);
+    return 0;
+  }
+  NaClTlsSetTlsValue1(natp, user_tls1);
+  NaClTlsSetTlsValue2(natp, user_tls2);
+  natp->exception_stack = 0;
+  natp->exception_flag = 0;
+  natp->suspend_state = NACL_APP_THREAD_TRUSTED;
+  natp->fault_signal = 0;
+  /*
+   * Starting at the current generation, rather than 0, keeps the
+   * minimum over all threads from going backwards.
+   */
+  natp->dynamic_delete_generation = nap->dynamic_delete_generation;
+
+  natp->pool_wakeup = 1;
+  NaClXCondVarSignal(&natp->pool_cv);
+  NaClXMutexUnlock(&nap->thread_pool_mu);
+
+  NaClLog(4, "NaClAppThreadPoolSpawn: reusing natp 0x%016"NACL_PRIxPTR"\n",
+          (uintptr_t) natp);
+  return 1;
+}
+#endif
+
+void NaClAppThreadPoolDrain(struct NaClApp *nap) {
+#if NACL_APP_THREAD_POOL
+  struct NaClAppThread *natp;
+
+  NaClXMutexLock(&nap->thread_pool_mu);
+  nap->thread_pool_max = 0;
+  while (NULL != (natp = nap->thread_pool_head)) {
+    nap->thread_pool_head = natp->pool_next;
+    --nap->thread_pool_count;
+    natp->pool_next = NULL;
+    natp->pool_wakeup = -1;
+    NaClXCondVarSignal(&natp->pool_cv);
+  }
+  NaClXMutexUnlock(&nap->thread_pool_mu);
+#else
+  UNREFERENCED_PARAMETER(nap);
+#endif
+}
+
+/*
+ * Runs natp's untrusted entry point on the current host thread.  The
+ * signal stack must already be registered.  Does not return.
+ */
+static void NaClAppThreadRun(struct NaClAppThread *natp) {
+  uint32_t thread_idx;
 
   NaClLog(4, "      natp = 0x%016"NACL_PRIxPTR"\n", (uintptr_t) natp);
   NaClLog(4, " prog_ctr  = 0x%016"NACL_PRIxNACL_REG"\n", natp->user.prog_ctr);
@@ -81,6 +210,37 @@ void WINAPI NaClAppThreadLauncher(void *state) {
 }
 
 
+void WINAPI NaClAppThreadLauncher(void *state) {
+  struct NaClAppThread *natp = (struct NaClAppThread *) state;
+  NaClLog(4, "NaClAppThreadLauncher: entered\n");
+
+  NaClSignalStackRegister(natp->signal_stack);
+
+#if NACL_APP_THREAD_POOL
+  if (0 != setjmp(natp->pool_jmp_buf)) {
+    /*
+     * We got here from NaClAppThreadTeardown() after natp was parked
+     * in the thread pool.  The signal stack is still registered.
+     */
+    if (!NaClAppThreadPoolWait(natp)) {
+      NaClLog(3, "NaClAppThreadLauncher: leaving thread pool\n");
+      NaClSignalStackUnregister();
+      NaClAppThreadFree(natp);
+      NaClThreadExit();
+      NaClLog(LOG_FATAL,
+              "NaClAppThreadLauncher: NaClThreadExit() should not return\n");
+    }
+  } else {
+    NaClSchedThreadStart(natp);
+  }
+#else
+  NaClSchedThreadStart(natp);
+#endif
+
+  NaClAppThreadRun(natp);
+}
+
+
 /*
  * natp should be thread_self(), called while holding no locks.
  */
@@ -139,10 +299,21 @@ void NaClAppThreadTeardown(struct NaClAppThread *natp) {
   NaClLog(3, " removing thread from thread table\n");
   /* Deallocate the ID natp->thread_num. */
   NaClRemoveThreadMu(nap, natp->thread_num);
+  /* This thread may have been holding back the minimum generation. */
+  nap->dynamic_min_stale = 1;
   NaClLog(3, " unlocking thread\n");
   NaClXMutexUnlock(&natp->mu);
   NaClLog(3, " unlocking thread table\n");
   NaClXMutexUnlock(&nap->threads_mu);
+  NaClResourceUsageRelease(&nap->resource_usage, NACL_RESOURCE_THREADS, 1);
+#if NACL_APP_THREAD_POOL
+  if (NaClSchedThreadReset(natp) && NaClAppThreadPoolPark(natp)) {
+    NaClLog(3, " parking host thread in thread pool\n");
+    longjmp(natp->pool_jmp_buf, 1);
+  }
+#else
+  (void) NaClSchedThreadReset(natp);
+#endif
   NaClLog(3, " unregistering signal stack\n");
   NaClSignalStackUnregister();
   NaClLog(3, " freeing thread object\n");
@@ -205,13 +376,29 @@ struct NaClAppThread *NaClAppThreadMake(struct NaClApp *nap,
   natp->suspended_registers = NULL;
   natp->fault_signal = 0;
 
-  natp->dynamic_delete_generation = 0;
+  natp->dynamic_delete_generation = nap->dynamic_delete_generation;
 
+  natp->sched_changed = 0;
+  natp->sched_deadline_util = 0;
+
+  natp->futex_wait_nodes = NULL;
+  natp->futex_wait_count = 0;
   if (!NaClCondVarCtor(&natp->futex_condvar)) {
     goto cleanup_suspend_mu;
   }
+#if NACL_APP_THREAD_POOL
+  natp->pool_next = NULL;
+  natp->pool_wakeup = 0;
+  if (!NaClCondVarCtor(&natp->pool_cv)) {
+    goto cleanup_futex_condvar;
+  }
+#endif
   return natp;
 
+#if NACL_APP_THREAD_POOL
+ cleanup_futex_condvar:
+  NaClCondVarDtor(&natp->futex_condvar);
+#endif
  cleanup_suspend_mu:
   NaClMutexDtor(&natp->suspend_mu);
  cleanup_mu:
@@ -231,9 +418,23 @@ int NaClAppThreadSpawn(struct NaClApp *nap,
                        uintptr_t      usr_stack_ptr,
                        uint32_t       user_tls1,
                        uint32_t       user_tls2) {
-  struct NaClAppThread *natp = NaClAppThreadMake(nap, usr_entry, usr_stack_ptr,
-                                                 user_tls1, user_tls2);
+  struct NaClAppThread *natp;
+
+  /* Released by NaClAppThreadTeardown(). */
+  if (0 != NaClResourceUsageCharge(&nap->resource_usage,
+                                   NACL_RESOURCE_THREADS, 1)) {
+    return 0;
+  }
+#if NACL_APP_THREAD_POOL
+  if (NaClAppThreadPoolSpawn(nap, usr_entry, usr_stack_ptr,
+                             user_tls1, user_tls2)) {
+    return 1;
+  }
+#endif
+  natp = NaClAppThreadMake(nap, usr_entry, usr_stack_ptr,
+                           user_tls1, user_tls2);
   if (natp == NULL) {
+    NaClResourceUsageRelease(&nap->resource_usage, NACL_RESOURCE_THREADS, 1);
     return 0;
   }
   /*
@@ -250,17 +451,18 @@ int NaClAppThreadSpawn(struct NaClApp *nap,
      */
     natp->host_thread_is_defined = 0;
     NaClAppThreadDelete(natp);
+    NaClResourceUsageRelease(&nap->resource_usage, NACL_RESOURCE_THREADS, 1);
     return 0;
   }
   return 1;
 }
 
 
-void NaClAppThreadDelete(struct NaClAppThread *natp) {
-  /*
-   * the thread must not be still running, else this crashes the system
-   */
-
+/*
+ * Frees everything NaClAppThreadDelete() does except natp's thread
+ * index, for threads that no longer hold one.
+ */
+static void NaClAppThreadFree(struct NaClAppThread *natp) {
   if (natp->host_thread_is_defined) {
     NaClThreadDtor(&natp->host_thread);
   }
@@ -269,7 +471,17 @@ void NaClAppThreadDelete(struct NaClAppThread *natp) {
   NaClSignalStackFree(natp->signal_stack);
   natp->signal_stack = NULL;
   NaClCondVarDtor(&natp->futex_condvar);
-  NaClTlsFree(natp);
+#if NACL_APP_THREAD_POOL
+  NaClCondVarDtor(&natp->pool_cv);
+#endif
   NaClMutexDtor(&natp->mu);
   NaClAlignedFree(natp);
 }
+
+void NaClAppThreadDelete(struct NaClAppThread *natp) {
+  /*
+   * the thread must not be still running, else this crashes the system
+   */
+  NaClTlsFree(natp);
+  NaClAppThreadFree(natp);
+}
@@ -11,6 +11,7 @@
 #ifndef NATIVE_CLIENT_SERVICE_RUNTIME_NACL_APP_THREAD_H__
 #define NATIVE_CLIENT_SERVICE_RUNTIME_NACL_APP_THREAD_H__ 1
 
+#include <setjmp.h>
 #include <stddef.h>
 
 #include "native_client/src/include/atomic_ops.h"
@@ -27,6 +28,19 @@ EXTERN_C_BEGIN
 struct NaClApp;
 struct NaClAppThreadSuspendedRegisters;
 
+/*
+ * Exited NaClAppThreads, together with their host threads, can be
+ * parked in a per-NaClApp pool and reused by NaClAppThreadSpawn().
+ * This relies on longjmp() back to NaClAppThreadLauncher() from the
+ * thread exit syscall, which does not play well with SEH unwinding,
+ * so it is not done on Windows.
+ */
+#if NACL_WINDOWS
+# define NACL_APP_THREAD_POOL 0
+#else
+# define NACL_APP_THREAD_POOL 1
+#endif
+
 /*
  * The thread hosting the NaClAppThread may change suspend_state
  * between NACL_APP_THREAD_TRUSTED and NACL_APP_THREAD_UNTRUSTED using
@@ -48,13 +62,20 @@ struct NaClAppThreadSuspendedRegisters;
  * The controlling thread will later change suspend_thread back to:
  *   NACL_APP_THREAD_UNTRUSTED
  * This tells the signal handler to resume execution.
+ *
+ * If the thread finds NACL_APP_THREAD_SUSPENDING set when it tries to
+ * switch between trusted and untrusted code, it adds
+ * NACL_APP_THREAD_SUSPEND_WAITER before blocking, so that the
+ * controlling thread knows it must be woken when suspend_state is
+ * changed back.
  */
 enum NaClSuspendState {
   NACL_APP_THREAD_UNTRUSTED = 1,
   NACL_APP_THREAD_TRUSTED = 2
 #if NACL_LINUX
   , NACL_APP_THREAD_SUSPENDING = 4,
-  NACL_APP_THREAD_SUSPENDED = 8
+  NACL_APP_THREAD_SUSPENDED = 8,
+  NACL_APP_THREAD_SUSPEND_WAITER = 16
 #endif
 };
 
@@ -146,26 +167,63 @@ struct NaClAppThread {
   uint32_t                  exception_flag;
 
   /*
-   * The last generation this thread reported into the service runtime
-   * Protected by mu
+   * sched_changed is set once this thread has changed its host
+   * scheduling parameters, so that NaClSchedThreadReset() knows to undo
+   * them.  sched_deadline_util is the deadline utilization it has
+   * reserved from NaClApp::sched_policy.  Only used by this thread.
    */
-  int                       dynamic_delete_generation;
+  int                       sched_changed;
+  uint32_t                  sched_deadline_util;
 
   /*
-   * If this thread is waiting on a futex, futex_wait_list_node is
-   * linked into the doubly linked list NaClApp::futex_wait_list_head.
+   * The last generation this thread reported into the service runtime.
+   * Only written by this thread, without locks; see
+   * NaClSetThreadGeneration().
    */
-  struct NaClListNode       futex_wait_list_node;
+  volatile Atomic32         dynamic_delete_generation;
+
   /*
-   * If this thread is waiting on a futex, futex_wait_addr contains
-   * the untrusted address that the thread is waiting on.
+   * If this thread is waiting on futexes, futex_wait_nodes points to
+   * futex_wait_count nodes that are linked into the doubly linked list
+   * NaClApp::futex_wait_list_head.  A wait on a single address uses
+   * futex_wait_node.  The thread that wakes this one clears
+   * futex_wait_nodes and sets futex_woken_index to the index of the
+   * node it woke.
    */
-  uint32_t                  futex_wait_addr;
+  struct NaClFutexWaitNode  futex_wait_node;
+  struct NaClFutexWaitNode  *futex_wait_nodes;
+  uint32_t                  futex_wait_count;
+  uint32_t                  futex_woken_index;
   struct NaClCondVar        futex_condvar;
+
+#if NACL_APP_THREAD_POOL
+  /*
+   * State for recycling this NaClAppThread and its host thread.  While
+   * parked, the thread is linked into NaClApp::thread_pool_head via
+   * pool_next and waits on pool_cv (with NaClApp::thread_pool_mu) for
+   * pool_wakeup to be set: positive to run again, negative to exit.
+   * pool_jmp_buf is the point in NaClAppThreadLauncher() that a parked
+   * thread returns to, so that the trusted stack does not grow across
+   * reuses.  These fields are protected by NaClApp::thread_pool_mu,
+   * except for pool_jmp_buf which is only used by the hosting thread.
+   */
+  struct NaClAppThread      *pool_next;
+  int                       pool_wakeup;
+  struct NaClCondVar        pool_cv;
+  jmp_buf                   pool_jmp_buf;
+#endif
 };
 
 void WINAPI NaClAppThreadLauncher(void *state);
 
+/*
+ * Empties the NaClApp's thread pool and stops it taking more threads,
+ * telling each parked host thread to free its NaClAppThread and exit.
+ * Host threads are detached, as for threads that are not pooled, so
+ * this does not wait for them.  Called once the app has exited.
+ */
+void NaClAppThreadPoolDrain(struct NaClApp *nap);
+
 void NaClAppThreadTeardown(struct NaClAppThread *natp);
 
 /*
@@ -184,8 +242,10 @@ struct NaClAppThread *NaClAppThreadMake(struct NaClApp *nap,
 
 /*
  * NaClAppThreadSpawn() creates a NaClAppThread and launches a host
- * thread that invokes the given entry point in untrusted code.  This
- * returns true on success, false on failure.
+ * thread that invokes the given entry point in untrusted code.  If
+ * the NaClApp's thread pool holds a parked thread, that thread is
+ * reused instead of creating a new host thread.  This returns true on
+ * success, false on failure.
  */
 int NaClAppThreadSpawn(struct NaClApp *nap,
                        uintptr_t      usr_entry,
@@ -43,6 +43,14 @@
 /* NACL_MAP_PAGESIFT >= NACL_PAGESHIFT must hold */
 #define NACL_PAGES_PER_MAP            (1 << (NACL_MAP_PAGESHIFT-NACL_PAGESHIFT))
 
+/*
+ * Host huge page size used when sel_ldr -H asks for large anonymous
+ * mappings to be huge page backed.  Must be a multiple of
+ * NACL_MAP_PAGESIZE.
+ */
+#define NACL_HUGE_PAGESHIFT           21
+#define NACL_HUGE_PAGESIZE            (1U << NACL_HUGE_PAGESHIFT)
+
 #define NACL_MEMORY_ALLOC_RETRY_MAX   256 /* see win/sel_memory.c */
 
 /*
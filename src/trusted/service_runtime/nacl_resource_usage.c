@@ -0,0 +1,304 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl service run-time, per-NaClApp resource accounting and limits.
+ */
+
+#include "native_client/src/trusted/service_runtime/nacl_resource_usage.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/include/portability_string.h"
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/trusted/service_runtime/include/sys/errno.h"
+#include "native_client/src/trusted/service_runtime/sel_ldr.h"
+#include "native_client/src/trusted/service_runtime/sel_mem.h"
+
+static char const *const kResourceKindNames[NACL_RESOURCE_KIND_MAX] = {
+  "read_bytes",
+  "write_bytes",
+  "imc_sent",
+  "imc_received",
+  "dyncode_bytes",
+  "mapped_bytes",
+  "threads",
+};
+
+int NaClResourceUsageCtor(struct NaClResourceUsage *self) {
+  memset(self, 0, sizeof *self);
+  return NaClFastMutexCtor(&self->mu);
+}
+
+void NaClResourceUsageDtor(struct NaClResourceUsage *self) {
+  NaClFastMutexDtor(&self->mu);
+}
+
+char const *NaClResourceKindName(enum NaClResourceKind kind) {
+  CHECK((unsigned) kind < NACL_RESOURCE_KIND_MAX);
+  return kResourceKindNames[kind];
+}
+
+void NaClResourceUsageSetLimit(struct NaClResourceUsage *self,
+                               enum NaClResourceKind    kind,
+                               uint64_t                 soft_limit,
+                               uint64_t                 hard_limit) {
+  CHECK((unsigned) kind < NACL_RESOURCE_KIND_MAX);
+  NaClFastMutexLock(&self->mu);
+  self->soft_limit[kind] = soft_limit;
+  self->hard_limit[kind] = hard_limit;
+  self->soft_limit_warned[kind] = 0;
+  NaClFastMutexUnlock(&self->mu);
+}
+
+static int ParseLimitValue(char const *str, char const **end,
+                           uint64_t *value) {
+  char *parse_end;
+
+  if (*str < '0' || *str > '9') {
+    return 0;
+  }
+  *value = (uint64_t) STRTOULL(str, &parse_end, 0);
+  *end = parse_end;
+  return 1;
+}
+
+int NaClResourceUsageParseLimit(struct NaClResourceUsage *self,
+                                char const               *spec) {
+  char const  *equals;
+  char const  *rest;
+  size_t      name_len;
+  int         kind;
+  uint64_t    soft_limit;
+  uint64_t    hard_limit = 0;
+
+  equals = strchr(spec, '=');
+  if (NULL == equals) {
+    return 0;
+  }
+  name_len = equals - spec;
+  for (kind = 0; kind < NACL_RESOURCE_KIND_MAX; ++kind) {
+    if (strlen(kResourceKindNames[kind]) == name_len &&
+        0 == strncmp(kResourceKindNames[kind], spec, name_len)) {
+      break;
+    }
+  }
+  if (NACL_RESOURCE_KIND_MAX == kind) {
+    return 0;
+  }
+  if (!ParseLimitValue(equals + 1, &rest, &soft_limit)) {
+    return 0;
+  }
+  if (':' == *rest) {
+    if (!ParseLimitValue(rest + 1, &rest, &hard_limit)) {
+      return 0;
+    }
+  }
+  if ('\0' != *rest) {
+    return 0;
+  }
+  NaClResourceUsageSetLimit(self, (enum NaClResourceKind) kind,
+                            soft_limit, hard_limit);
+  return 1;
+}
+
+/*
+ * Called with self->mu held once the new usage of a resource is known.
+ */
+static void NaClResourceUsageNoteMu(struct NaClResourceUsage *self,
+                                    enum NaClResourceKind    kind,
+                                    uint64_t                 usage) {
+  if (usage > self->peak[kind]) {
+    self->peak[kind] = usage;
+  }
+  if (0 != self->soft_limit[kind] && usage > self->soft_limit[kind] &&
+      !self->soft_limit_warned[kind]) {
+    self->soft_limit_warned[kind] = 1;
+    NaClLog(LOG_WARNING,
+            ("NaClResourceUsage: %s is %"NACL_PRIu64", over its soft limit"
+             " of %"NACL_PRIu64"\n"),
+            kResourceKindNames[kind], usage, self->soft_limit[kind]);
+  }
+}
+
+int32_t NaClResourceUsageCheck(struct NaClResourceUsage *self,
+                               enum NaClResourceKind    kind,
+                               uint64_t                 *amount) {
+  int32_t retval = 0;
+
+  NaClFastMutexLock(&self->mu);
+  if (0 != self->hard_limit[kind]) {
+    if (self->usage[kind] >= self->hard_limit[kind]) {
+      NaClLog(2, "NaClResourceUsageCheck: %s hard limit reached\n",
+              kResourceKindNames[kind]);
+      retval = -NACL_ABI_EDQUOT;
+    } else if (NULL != amount &&
+               *amount > self->hard_limit[kind] - self->usage[kind]) {
+      *amount = self->hard_limit[kind] - self->usage[kind];
+    }
+  }
+  NaClFastMutexUnlock(&self->mu);
+  return retval;
+}
+
+void NaClResourceUsageAdd(struct NaClResourceUsage *self,
+                          enum NaClResourceKind    kind,
+                          uint64_t                 amount) {
+  NaClFastMutexLock(&self->mu);
+  self->usage[kind] += amount;
+  NaClResourceUsageNoteMu(self, kind, self->usage[kind]);
+  NaClFastMutexUnlock(&self->mu);
+}
+
+int32_t NaClResourceUsageCharge(struct NaClResourceUsage *self,
+                                enum NaClResourceKind    kind,
+                                uint64_t                 amount) {
+  int32_t retval = 0;
+
+  NaClFastMutexLock(&self->mu);
+  if (0 != self->hard_limit[kind] &&
+      amount > self->hard_limit[kind] - self->usage[kind]) {
+    NaClLog(2, "NaClResourceUsageCharge: %s hard limit reached\n",
+            kResourceKindNames[kind]);
+    retval = NACL_RESOURCE_THREADS == kind ? -NACL_ABI_EAGAIN
+                                           : -NACL_ABI_ENOMEM;
+  } else {
+    self->usage[kind] += amount;
+    NaClResourceUsageNoteMu(self, kind, self->usage[kind]);
+  }
+  NaClFastMutexUnlock(&self->mu);
+  return retval;
+}
+
+void NaClResourceUsageRelease(struct NaClResourceUsage *self,
+                              enum NaClResourceKind    kind,
+                              uint64_t                 amount) {
+  NaClFastMutexLock(&self->mu);
+  CHECK(self->usage[kind] >= amount);
+  self->usage[kind] -= amount;
+  NaClFastMutexUnlock(&self->mu);
+}
+
+struct NaClMappedPagesState {
+  uintptr_t first_page;   /* range being replaced, may be empty */
+  uintptr_t end_page;
+  uint64_t  pages;        /* mapped pages outside that range */
+};
+
+static void NaClCountMappedPages(void                  *state,
+                                 struct NaClVmmapEntry *entry) {
+  struct NaClMappedPagesState *p = (struct NaClMappedPagesState *) state;
+  uintptr_t                   entry_end = entry->page_num + entry->npages;
+  uintptr_t                   overlap_first;
+  uintptr_t                   overlap_end;
+
+  p->pages += entry->npages;
+  overlap_first = entry->page_num > p->first_page ? entry->page_num
+                                                  : p->first_page;
+  overlap_end = entry_end < p->end_page ? entry_end : p->end_page;
+  if (overlap_first < overlap_end) {
+    p->pages -= overlap_end - overlap_first;
+  }
+}
+
+/*
+ * Returns the bytes which would be mapped once npages pages at
+ * page_num are (re)mapped.  Called with nap->mu held.
+ */
+static uint64_t NaClMappedBytesAfter_mu(struct NaClApp *nap,
+                                        uintptr_t      page_num,
+                                        size_t         npages) {
+  struct NaClMappedPagesState state;
+
+  state.first_page = page_num;
+  state.end_page = page_num + npages;
+  state.pages = 0;
+  NaClVmmapVisit(&nap->mem_map, NaClCountMappedPages, &state);
+  return (state.pages + npages) << NACL_PAGESHIFT;
+}
+
+int32_t NaClResourceUsageCheckMapping_mu(struct NaClApp *nap,
+                                         uintptr_t      page_num,
+                                         size_t         npages) {
+  struct NaClResourceUsage  *self = &nap->resource_usage;
+  enum NaClResourceKind     kind = NACL_RESOURCE_MAPPED_BYTES;
+  uint64_t                  soft_limit;
+  uint64_t                  hard_limit;
+  uint64_t                  mapped_bytes;
+  int32_t                   retval = 0;
+
+  NaClFastMutexLock(&self->mu);
+  soft_limit = self->soft_limit[kind];
+  hard_limit = self->hard_limit[kind];
+  NaClFastMutexUnlock(&self->mu);
+  if (0 == soft_limit && 0 == hard_limit) {
+    return 0;
+  }
+
+  mapped_bytes = NaClMappedBytesAfter_mu(nap, page_num, npages);
+  NaClFastMutexLock(&self->mu);
+  if (0 != hard_limit && mapped_bytes > hard_limit) {
+    NaClLog(2, "NaClResourceUsageCheckMapping_mu: %s hard limit reached\n",
+            kResourceKindNames[kind]);
+    retval = -NACL_ABI_ENOMEM;
+  } else {
+    NaClResourceUsageNoteMu(self, kind, mapped_bytes);
+  }
+  NaClFastMutexUnlock(&self->mu);
+  return retval;
+}
+
+void NaClResourceUsageGet(struct NaClApp *nap,
+                          uint64_t       usage[NACL_RESOURCE_KIND_MAX],
+                          uint64_t       peak[NACL_RESOURCE_KIND_MAX]) {
+  struct NaClResourceUsage  *self = &nap->resource_usage;
+  uint64_t                  mapped_bytes;
+
+  NaClXMutexLock(&nap->mu);
+  mapped_bytes = NaClMappedBytesAfter_mu(nap, 0, 0);
+  NaClXMutexUnlock(&nap->mu);
+
+  NaClFastMutexLock(&self->mu);
+  self->usage[NACL_RESOURCE_MAPPED_BYTES] = mapped_bytes;
+  if (mapped_bytes > self->peak[NACL_RESOURCE_MAPPED_BYTES]) {
+    self->peak[NACL_RESOURCE_MAPPED_BYTES] = mapped_bytes;
+  }
+  if (NULL != usage) {
+    memcpy(usage, self->usage, sizeof self->usage);
+  }
+  if (NULL != peak) {
+    memcpy(peak, self->peak, sizeof self->peak);
+  }
+  NaClFastMutexUnlock(&self->mu);
+}
+
+void NaClResourceUsageLog(struct NaClApp *nap, int detail_level) {
+  struct NaClResourceUsage  *self = &nap->resource_usage;
+  uint64_t                  usage[NACL_RESOURCE_KIND_MAX];
+  uint64_t                  peak[NACL_RESOURCE_KIND_MAX];
+  uint64_t                  soft_limit[NACL_RESOURCE_KIND_MAX];
+  uint64_t                  hard_limit[NACL_RESOURCE_KIND_MAX];
+  int                       kind;
+
+  NaClResourceUsageGet(nap, usage, peak);
+  NaClFastMutexLock(&self->mu);
+  memcpy(soft_limit, self->soft_limit, sizeof soft_limit);
+  memcpy(hard_limit, self->hard_limit, sizeof hard_limit);
+  NaClFastMutexUnlock(&self->mu);
+
+  NaClLog(detail_level, "Resource usage:\n");
+  for (kind = 0; kind < NACL_RESOURCE_KIND_MAX; ++kind) {
+    NaClLog(detail_level,
+            ("  %-14s %"NACL_PRIu64" (peak %"NACL_PRIu64", soft limit"
+             " %"NACL_PRIu64", hard limit %"NACL_PRIu64")\n"),
+            kResourceKindNames[kind], usage[kind], peak[kind],
+            soft_limit[kind], hard_limit[kind]);
+  }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl service run-time, per-NaClApp resource accounting and limits.
+ *
+ * Counts what each sandbox consumes on the syscall paths that can use
+ * a lot of a host resource: bytes read and written, IMC messages, bytes
+ * of dynamic code validated, address space mapped and untrusted
+ * threads.  Each resource may have a soft limit, which logs a warning
+ * the first time it is exceeded, and a hard limit, which makes the
+ * syscall fail with an errno instead of letting the sandbox take down
+ * the host.  A limit of zero means no limit.
+ *
+ * Cumulative resources (bytes read etc.) are charged after the
+ * operation with the amount actually used.  Reads, writes and batched
+ * IMC calls are shortened beforehand to what is left under the hard
+ * limit, so only concurrent calls, or a dyncode call, which cannot be
+ * shortened, can take usage past it; once it is reached further calls
+ * fail with NACL_ABI_EDQUOT.  Gauges (threads, mapped bytes) go down
+ * as well as up and are checked before the operation, so they never
+ * exceed the hard limit.
+ */
+
+#ifndef NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_NACL_RESOURCE_USAGE_H_
+#define NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_NACL_RESOURCE_USAGE_H_ 1
+
+#include "native_client/src/include/nacl_base.h"
+#include "native_client/src/include/portability.h"
+#include "native_client/src/shared/platform/nacl_sync.h"
+
+EXTERN_C_BEGIN
+
+struct NaClApp;
+
+enum NaClResourceKind {
+  NACL_RESOURCE_READ_BYTES,       /* read, pread */
+  NACL_RESOURCE_WRITE_BYTES,      /* write, pwrite */
+  NACL_RESOURCE_IMC_SENT,         /* messages sent with imc_sendmsg etc. */
+  NACL_RESOURCE_IMC_RECEIVED,     /* messages received */
+  NACL_RESOURCE_DYNCODE_BYTES,    /* dyncode_create and dyncode_modify */
+  NACL_RESOURCE_MAPPED_BYTES,     /* gauge: untrusted address space mapped */
+  NACL_RESOURCE_THREADS,          /* gauge: live untrusted threads */
+  NACL_RESOURCE_KIND_MAX
+};
+
+struct NaClResourceUsage {
+  /*
+   * mu protects all the fields below.  usage is not maintained for
+   * NACL_RESOURCE_MAPPED_BYTES, which is measured from the NaClApp's
+   * vmmap when needed; its peak is the largest value measured.
+   */
+  struct NaClFastMutex  mu;
+  uint64_t              usage[NACL_RESOURCE_KIND_MAX];
+  uint64_t              peak[NACL_RESOURCE_KIND_MAX];
+  uint64_t              soft_limit[NACL_RESOURCE_KIND_MAX];
+  uint64_t              hard_limit[NACL_RESOURCE_KIND_MAX];
+  int                   soft_limit_warned[NACL_RESOURCE_KIND_MAX];
+};
+
+int NaClResourceUsageCtor(struct NaClResourceUsage *self) NACL_WUR;
+
+void NaClResourceUsageDtor(struct NaClResourceUsage *self);
+
+/*
+ * Returns the name used for the resource in logs and on the sel_ldr
+ * command line, e.g. "read_bytes".
+ */
+char const *NaClResourceKindName(enum NaClResourceKind kind);
+
+/*
+ * Sets the limits for one resource.  Zero means no limit.
+ */
+void NaClResourceUsageSetLimit(struct NaClResourceUsage *self,
+                               enum NaClResourceKind    kind,
+                               uint64_t                 soft_limit,
+                               uint64_t                 hard_limit);
+
+/*
+ * Parses and applies a limit of the form "name=soft[:hard]", as given
+ * to sel_ldr's -L option.  A soft limit of zero may be used to set
+ * just a hard limit.  Returns 0 if the spec is malformed.
+ */
+int NaClResourceUsageParseLimit(struct NaClResourceUsage *self,
+                                char const               *spec) NACL_WUR;
+
+/*
+ * For cumulative resources: returns 0 if the hard limit has not yet
+ * been reached, else -NACL_ABI_EDQUOT.  Called before the operation.
+ * If amount is not NULL, it is the amount the operation would use,
+ * and is lowered to what is left under the hard limit.
+ */
+int32_t NaClResourceUsageCheck(struct NaClResourceUsage *self,
+                               enum NaClResourceKind    kind,
+                               uint64_t                 *amount);
+
+/*
+ * For cumulative resources: records amount units used by a completed
+ * operation.
+ */
+void NaClResourceUsageAdd(struct NaClResourceUsage *self,
+                          enum NaClResourceKind    kind,
+                          uint64_t                 amount);
+
+/*
+ * For gauges: takes amount units, or returns a negated errno without
+ * taking them if that would exceed the hard limit (NACL_ABI_EAGAIN for
+ * threads, as POSIX specifies for pthread_create).
+ */
+int32_t NaClResourceUsageCharge(struct NaClResourceUsage *self,
+                                enum NaClResourceKind    kind,
+                                uint64_t                 amount);
+
+/*
+ * For gauges: gives back units taken by NaClResourceUsageCharge().
+ */
+void NaClResourceUsageRelease(struct NaClResourceUsage *self,
+                              enum NaClResourceKind    kind,
+                              uint64_t                 amount);
+
+/*
+ * Called by NaClSysMmapIntern() with nap->mu held, before mapping
+ * npages pages at page_num.  Pages already mapped in that range are
+ * replaced rather than added to.  Returns 0, or -NACL_ABI_ENOMEM if
+ * the mapping would take the app over its mapped bytes hard limit.
+ * This walks the vmmap, so it does nothing unless a limit is set.
+ */
+int32_t NaClResourceUsageCheckMapping_mu(struct NaClApp *nap,
+                                         uintptr_t      page_num,
+                                         size_t         npages);
+
+/*
+ * Snapshot of current usage, with peak values for gauges.  Either
+ * array may be NULL.  This is the trusted query API; it takes nap->mu
+ * to measure the mapped bytes.
+ */
+void NaClResourceUsageGet(struct NaClApp *nap,
+                          uint64_t       usage[NACL_RESOURCE_KIND_MAX],
+                          uint64_t       peak[NACL_RESOURCE_KIND_MAX]);
+
+/*
+ * Logs the usage, and any limits, of every resource at the given
+ * NaClLog level.  sel_ldr calls this when the app exits.
+ */
+void NaClResourceUsageLog(struct NaClApp *nap, int detail_level);
+
+EXTERN_C_END
+
+#endif  /* NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_NACL_RESOURCE_USAGE_H_ */
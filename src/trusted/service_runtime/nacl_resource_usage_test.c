@@ -0,0 +1,145 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <stdio.h>
+
+#include "native_client/src/include/nacl_base.h"
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/trusted/service_runtime/include/sys/errno.h"
+#include "native_client/src/trusted/service_runtime/include/sys/mman.h"
+#include "native_client/src/trusted/service_runtime/nacl_all_modules.h"
+#include "native_client/src/trusted/service_runtime/nacl_config.h"
+#include "native_client/src/trusted/service_runtime/nacl_resource_usage.h"
+#include "native_client/src/trusted/service_runtime/sel_ldr.h"
+
+static void TestParseLimit(struct NaClResourceUsage *ru) {
+  CHECK(NaClResourceUsageParseLimit(ru, "read_bytes=100"));
+  CHECK(100 == ru->soft_limit[NACL_RESOURCE_READ_BYTES]);
+  CHECK(0 == ru->hard_limit[NACL_RESOURCE_READ_BYTES]);
+  CHECK(NaClResourceUsageParseLimit(ru, "threads=0:0x10"));
+  CHECK(0 == ru->soft_limit[NACL_RESOURCE_THREADS]);
+  CHECK(16 == ru->hard_limit[NACL_RESOURCE_THREADS]);
+
+  CHECK(!NaClResourceUsageParseLimit(ru, "read_bytes"));
+  CHECK(!NaClResourceUsageParseLimit(ru, "read=1"));
+  CHECK(!NaClResourceUsageParseLimit(ru, "read_bytes_x=1"));
+  CHECK(!NaClResourceUsageParseLimit(ru, "read_bytes="));
+  CHECK(!NaClResourceUsageParseLimit(ru, "read_bytes=-1"));
+  CHECK(!NaClResourceUsageParseLimit(ru, "read_bytes=1:"));
+  CHECK(!NaClResourceUsageParseLimit(ru, "read_bytes=1:2x"));
+
+  NaClResourceUsageSetLimit(ru, NACL_RESOURCE_READ_BYTES, 0, 0);
+  NaClResourceUsageSetLimit(ru, NACL_RESOURCE_THREADS, 0, 0);
+}
+
+static void TestCumulative(struct NaClResourceUsage *ru) {
+  enum NaClResourceKind kind = NACL_RESOURCE_WRITE_BYTES;
+  uint64_t              amount;
+
+  /* No limit. */
+  CHECK(0 == NaClResourceUsageCheck(ru, kind, NULL));
+  NaClResourceUsageAdd(ru, kind, 1000);
+  CHECK(1000 == ru->usage[kind]);
+
+  /* The call which reaches the limit succeeds; the next one fails. */
+  NaClResourceUsageSetLimit(ru, kind, 1100, 1500);
+  CHECK(0 == NaClResourceUsageCheck(ru, kind, NULL));
+  NaClResourceUsageAdd(ru, kind, 200);
+  CHECK(ru->soft_limit_warned[kind]);
+  CHECK(0 == NaClResourceUsageCheck(ru, kind, NULL));
+  NaClResourceUsageAdd(ru, kind, 400);
+  CHECK(-NACL_ABI_EDQUOT == NaClResourceUsageCheck(ru, kind, NULL));
+  CHECK(1600 == ru->usage[kind]);
+
+  /* Requests are shortened to what is left under the hard limit. */
+  NaClResourceUsageSetLimit(ru, kind, 0, 2000);
+  amount = 1000;
+  CHECK(0 == NaClResourceUsageCheck(ru, kind, &amount));
+  CHECK(400 == amount);
+  amount = 300;
+  CHECK(0 == NaClResourceUsageCheck(ru, kind, &amount));
+  CHECK(300 == amount);
+  NaClResourceUsageAdd(ru, kind, 400);
+  amount = 1;
+  CHECK(-NACL_ABI_EDQUOT == NaClResourceUsageCheck(ru, kind, &amount));
+
+  NaClResourceUsageSetLimit(ru, kind, 0, 0);
+  amount = 1000;
+  CHECK(0 == NaClResourceUsageCheck(ru, kind, &amount));
+  CHECK(1000 == amount);
+}
+
+static void TestGauge(struct NaClResourceUsage *ru) {
+  enum NaClResourceKind kind = NACL_RESOURCE_THREADS;
+  uint64_t              base = ru->usage[kind];
+
+  NaClResourceUsageSetLimit(ru, kind, 0, base + 2);
+  CHECK(0 == NaClResourceUsageCharge(ru, kind, 1));
+  CHECK(0 == NaClResourceUsageCharge(ru, kind, 1));
+  CHECK(-NACL_ABI_EAGAIN == NaClResourceUsageCharge(ru, kind, 1));
+  CHECK(base + 2 == ru->usage[kind]);
+  NaClResourceUsageRelease(ru, kind, 1);
+  CHECK(0 == NaClResourceUsageCharge(ru, kind, 1));
+  NaClResourceUsageRelease(ru, kind, 2);
+  CHECK(base == ru->usage[kind]);
+  CHECK(base + 2 == ru->peak[kind]);
+  NaClResourceUsageSetLimit(ru, kind, 0, 0);
+}
+
+static void TestMapping(struct NaClApp *nap) {
+  struct NaClResourceUsage  *ru = &nap->resource_usage;
+  uint64_t                  usage[NACL_RESOURCE_KIND_MAX];
+  uint64_t                  peak[NACL_RESOURCE_KIND_MAX];
+  uint64_t                  page = (uint64_t) 1 << NACL_PAGESHIFT;
+
+  /* Without a limit the vmmap is not even looked at. */
+  CHECK(0 == NaClResourceUsageCheckMapping_mu(nap, 0x100, 1000000));
+
+  NaClVmmapAdd(&nap->mem_map, 0x100, 10, NACL_ABI_PROT_READ,
+               NACL_ABI_MAP_PRIVATE, NULL, 0, 0);
+  NaClVmmapAdd(&nap->mem_map, 0x200, 10, NACL_ABI_PROT_READ,
+               NACL_ABI_MAP_PRIVATE, NULL, 0, 0);
+  NaClResourceUsageGet(nap, usage, peak);
+  CHECK(20 * page == usage[NACL_RESOURCE_MAPPED_BYTES]);
+  CHECK(20 * page == peak[NACL_RESOURCE_MAPPED_BYTES]);
+
+  NaClResourceUsageSetLimit(ru, NACL_RESOURCE_MAPPED_BYTES, 0, 30 * page);
+  CHECK(0 == NaClResourceUsageCheckMapping_mu(nap, 0x300, 10));
+  CHECK(-NACL_ABI_ENOMEM == NaClResourceUsageCheckMapping_mu(nap, 0x300, 11));
+  /* Remapping pages which are already mapped does not use more. */
+  CHECK(0 == NaClResourceUsageCheckMapping_mu(nap, 0x105, 15));
+  CHECK(0 == NaClResourceUsageCheckMapping_mu(nap, 0x100, 0x10a - 0x100));
+  CHECK(0 == NaClResourceUsageCheckMapping_mu(nap, 0x1fb, 15));
+  CHECK(-NACL_ABI_ENOMEM == NaClResourceUsageCheckMapping_mu(nap, 0x1f0, 21));
+  CHECK(30 * page == ru->peak[NACL_RESOURCE_MAPPED_BYTES]);
+  NaClResourceUsageSetLimit(ru, NACL_RESOURCE_MAPPED_BYTES, 0, 0);
+
+  NaClVmmapRemove(&nap->mem_map, 0x200, 10);
+  NaClResourceUsageGet(nap, usage, peak);
+  CHECK(10 * page == usage[NACL_RESOURCE_MAPPED_BYTES]);
+  CHECK(30 * page == peak[NACL_RESOURCE_MAPPED_BYTES]);
+}
+
+int main(void) {
+  struct NaClApp ap;
+  struct NaClApp *nap = &ap;
+
+  NaClAllModulesInit();
+
+  if (!NaClAppCtor(nap)) {
+    NaClLog(LOG_FATAL, "NaClAppCtor failed\n");
+  }
+
+  TestParseLimit(&nap->resource_usage);
+  TestCumulative(&nap->resource_usage);
+  TestGauge(&nap->resource_usage);
+  TestMapping(nap);
+  NaClResourceUsageLog(nap, LOG_INFO);
+
+  printf("Passed.\n");
+  return 0;
+}
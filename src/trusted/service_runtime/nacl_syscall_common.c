@@ -287,7 +287,8 @@ int32_t NaClSysSecondTlsGet(struct NaClAppThread *natp) {
 int NaClSysThreadNice(struct NaClAppThread *natp,
                       const int            nice) {
   /* Note: implementation of nacl_thread_nice is OS dependent. */
-  UNREFERENCED_PARAMETER(natp);
+  /* Have NaClSchedThreadReset() undo this when the thread exits. */
+  NaClSchedThreadChanged(natp);
   return nacl_thread_nice(nice);
 }
 
@@ -23,6 +23,7 @@
 #include "native_client/src/trusted/service_runtime/nacl_copy.h"
 #include "native_client/src/trusted/service_runtime/nacl_switch_to_app.h"
 #include "native_client/src/trusted/service_runtime/nacl_syscall_handlers.h"
+#include "native_client/src/trusted/service_runtime/nacl_text.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
 #include "native_client/src/trusted/service_runtime/sel_rt.h"
 
@@ -114,6 +115,13 @@ struct NaClThreadContext *NaClSyscallCSegHook(struct NaClThreadContext *ntcp) {
 
   nap = natp->nap;
 
+  /*
+   * Check in for dynamic code deletion.  Syscalls return to a bundle
+   * head, so from here on this thread cannot reach code in any region
+   * whose bundle heads have already been replaced with halts.
+   */
+  NaClSetThreadGeneration(natp, nap->dynamic_delete_generation);
+
   NaClCopyTakeLock(nap);
   /*
    * held until syscall args are copied, which occurs in the generated
@@ -8,6 +8,7 @@
 #include "native_client/src/trusted/service_runtime/nacl_syscall_handlers.h"
 #include "native_client/src/trusted/service_runtime/nacl_syscall_register.h"
 #include "native_client/src/trusted/service_runtime/nacl_text.h"
+#include "native_client/src/trusted/service_runtime/sys_checkpoint.h"
 #include "native_client/src/trusted/service_runtime/sys_clock.h"
 #include "native_client/src/trusted/service_runtime/sys_exception.h"
 #include "native_client/src/trusted/service_runtime/sys_fdio.h"
@@ -17,6 +18,8 @@
 #include "native_client/src/trusted/service_runtime/sys_memory.h"
 #include "native_client/src/trusted/service_runtime/sys_parallel_io.h"
 #include "native_client/src/trusted/service_runtime/sys_random.h"
+#include "native_client/src/trusted/service_runtime/sys_sched.h"
+#include "native_client/src/trusted/service_runtime/sys_write_watch.h"
 #include "native_client/src/trusted/service_runtime/include/bits/nacl_syscalls.h"
 
 /*
@@ -40,6 +43,7 @@ NACL_DEFINE_SYSCALL_1(NaClSysBrk)
 NACL_DEFINE_SYSCALL_6(NaClSysMmap)
 NACL_DEFINE_SYSCALL_3(NaClSysMprotect)
 NACL_DEFINE_SYSCALL_2(NaClSysListMappings)
+NACL_DEFINE_SYSCALL_5(NaClSysWriteWatch)
 NACL_DEFINE_SYSCALL_2(NaClSysMunmap)
 NACL_DEFINE_SYSCALL_1(NaClSysExit)
 NACL_DEFINE_SYSCALL_0(NaClSysGetpid)
@@ -80,6 +84,7 @@ NACL_DEFINE_SYSCALL_1(NaClSysTlsInit)
 NACL_DEFINE_SYSCALL_4(NaClSysThreadCreate)
 NACL_DEFINE_SYSCALL_0(NaClSysTlsGet)
 NACL_DEFINE_SYSCALL_1(NaClSysThreadNice)
+NACL_DEFINE_SYSCALL_2(NaClSysThreadSched)
 NACL_DEFINE_SYSCALL_0(NaClSysMutexCreate)
 NACL_DEFINE_SYSCALL_1(NaClSysMutexLock)
 NACL_DEFINE_SYSCALL_1(NaClSysMutexUnlock)
@@ -90,12 +95,15 @@ NACL_DEFINE_SYSCALL_1(NaClSysCondSignal)
 NACL_DEFINE_SYSCALL_1(NaClSysCondBroadcast)
 NACL_DEFINE_SYSCALL_3(NaClSysCondTimedWaitAbs)
 NACL_DEFINE_SYSCALL_1(NaClSysImcSocketPair)
+NACL_DEFINE_SYSCALL_4(NaClSysImcSendmmsg)
+NACL_DEFINE_SYSCALL_4(NaClSysImcRecvmmsg)
 NACL_DEFINE_SYSCALL_1(NaClSysSemCreate)
 NACL_DEFINE_SYSCALL_1(NaClSysSemWait)
 NACL_DEFINE_SYSCALL_1(NaClSysSemPost)
 NACL_DEFINE_SYSCALL_1(NaClSysSemGetValue)
 NACL_DEFINE_SYSCALL_0(NaClSysSchedYield)
 NACL_DEFINE_SYSCALL_2(NaClSysSysconf)
+NACL_DEFINE_SYSCALL_2(NaClSysCheckpoint)
 NACL_DEFINE_SYSCALL_3(NaClSysDyncodeCreate)
 NACL_DEFINE_SYSCALL_3(NaClSysDyncodeModify)
 NACL_DEFINE_SYSCALL_2(NaClSysDyncodeDelete)
@@ -108,6 +116,7 @@ NACL_DEFINE_SYSCALL_0(NaClSysTestInfoLeak)
 NACL_DEFINE_SYSCALL_1(NaClSysTestCrash)
 NACL_DEFINE_SYSCALL_3(NaClSysFutexWaitAbs)
 NACL_DEFINE_SYSCALL_2(NaClSysFutexWake)
+NACL_DEFINE_SYSCALL_3(NaClSysFutexWaitvAbs)
 NACL_DEFINE_SYSCALL_2(NaClSysGetRandomBytes)
 
 void NaClAppRegisterDefaultSyscalls(struct NaClApp *nap) {
@@ -127,6 +136,7 @@ void NaClAppRegisterDefaultSyscalls(struct NaClApp *nap) {
   NACL_REGISTER_SYSCALL(nap, NaClSysMmap, NACL_sys_mmap);
   NACL_REGISTER_SYSCALL(nap, NaClSysMprotect, NACL_sys_mprotect);
   NACL_REGISTER_SYSCALL(nap, NaClSysListMappings, NACL_sys_list_mappings);
+  NACL_REGISTER_SYSCALL(nap, NaClSysWriteWatch, NACL_sys_write_watch);
   NACL_REGISTER_SYSCALL(nap, NaClSysMunmap, NACL_sys_munmap);
   NACL_REGISTER_SYSCALL(nap, NaClSysExit, NACL_sys_exit);
   NACL_REGISTER_SYSCALL(nap, NaClSysGetpid, NACL_sys_getpid);
@@ -169,6 +179,7 @@ void NaClAppRegisterDefaultSyscalls(struct NaClApp *nap) {
   NACL_REGISTER_SYSCALL(nap, NaClSysThreadCreate, NACL_sys_thread_create);
   NACL_REGISTER_SYSCALL(nap, NaClSysTlsGet, NACL_sys_tls_get);
   NACL_REGISTER_SYSCALL(nap, NaClSysThreadNice, NACL_sys_thread_nice);
+  NACL_REGISTER_SYSCALL(nap, NaClSysThreadSched, NACL_sys_thread_sched);
   NACL_REGISTER_SYSCALL(nap, NaClSysMutexCreate, NACL_sys_mutex_create);
   NACL_REGISTER_SYSCALL(nap, NaClSysMutexLock, NACL_sys_mutex_lock);
   NACL_REGISTER_SYSCALL(nap, NaClSysMutexUnlock, NACL_sys_mutex_unlock);
@@ -180,12 +191,15 @@ void NaClAppRegisterDefaultSyscalls(struct NaClApp *nap) {
   NACL_REGISTER_SYSCALL(nap, NaClSysCondTimedWaitAbs,
                         NACL_sys_cond_timed_wait_abs);
   NACL_REGISTER_SYSCALL(nap, NaClSysImcSocketPair, NACL_sys_imc_socketpair);
+  NACL_REGISTER_SYSCALL(nap, NaClSysImcSendmmsg, NACL_sys_imc_sendmmsg);
+  NACL_REGISTER_SYSCALL(nap, NaClSysImcRecvmmsg, NACL_sys_imc_recvmmsg);
   NACL_REGISTER_SYSCALL(nap, NaClSysSemCreate, NACL_sys_sem_create);
   NACL_REGISTER_SYSCALL(nap, NaClSysSemWait, NACL_sys_sem_wait);
   NACL_REGISTER_SYSCALL(nap, NaClSysSemPost, NACL_sys_sem_post);
   NACL_REGISTER_SYSCALL(nap, NaClSysSemGetValue, NACL_sys_sem_get_value);
   NACL_REGISTER_SYSCALL(nap, NaClSysSchedYield, NACL_sys_sched_yield);
   NACL_REGISTER_SYSCALL(nap, NaClSysSysconf, NACL_sys_sysconf);
+  NACL_REGISTER_SYSCALL(nap, NaClSysCheckpoint, NACL_sys_checkpoint);
   NACL_REGISTER_SYSCALL(nap, NaClSysDyncodeCreate, NACL_sys_dyncode_create);
   NACL_REGISTER_SYSCALL(nap, NaClSysDyncodeModify, NACL_sys_dyncode_modify);
   NACL_REGISTER_SYSCALL(nap, NaClSysDyncodeDelete, NACL_sys_dyncode_delete);
@@ -200,5 +214,6 @@ void NaClAppRegisterDefaultSyscalls(struct NaClApp *nap) {
   NACL_REGISTER_SYSCALL(nap, NaClSysTestCrash, NACL_sys_test_crash);
   NACL_REGISTER_SYSCALL(nap, NaClSysFutexWaitAbs, NACL_sys_futex_wait_abs);
   NACL_REGISTER_SYSCALL(nap, NaClSysFutexWake, NACL_sys_futex_wake);
+  NACL_REGISTER_SYSCALL(nap, NaClSysFutexWaitvAbs, NACL_sys_futex_waitv_abs);
   NACL_REGISTER_SYSCALL(nap, NaClSysGetRandomBytes, NACL_sys_get_random_bytes);
 }
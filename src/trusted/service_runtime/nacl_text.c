@@ -6,11 +6,13 @@
 
 #include <string.h>
 
+#include "native_client/src/include/atomic_ops.h"
 #include "native_client/src/include/build_config.h"
 #include "native_client/src/include/concurrency_ops.h"
 #include "native_client/src/include/nacl_platform.h"
 #include "native_client/src/include/portability.h"
 #include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/shared/platform/nacl_host_desc.h"
 #include "native_client/src/shared/platform/nacl_log.h"
 #include "native_client/src/shared/platform/nacl_sync.h"
 #include "native_client/src/shared/platform/nacl_sync_checked.h"
@@ -343,16 +345,49 @@ void NaClDynamicRegionDelete(struct NaClApp *nap, struct NaClDynamicRegion* r) {
 }
 
 
+/*
+ * Deleted dynamic code is reclaimed by epoch.  Each NaClDynamicRegion
+ * that is being deleted is stamped with the nap->dynamic_delete_generation
+ * at which its bundle heads were overwritten with halts, and each thread
+ * records the last generation it has seen.  A thread that has seen
+ * generation g cannot be executing in a region stamped g or earlier,
+ * so once every thread is past a region's stamp its memory can be
+ * reused.
+ *
+ * Threads check in on every syscall entry (see NaClSyscallCSegHook()),
+ * which is a safe point because syscalls always return to a bundle
+ * head.  This must be cheap, so a thread's generation is written only
+ * by the thread itself and without locks.
+ *
+ * Finding the minimum generation over all threads takes a scan of the
+ * thread table, so NaClCachedMinimumThreadGeneration() keeps the result
+ * in nap->dynamic_min_generation and scans again only after a thread
+ * that may have been holding the minimum back has moved on, or exited.
+ * A single scan can then retire every region that is waiting on the
+ * same threads.
+ */
 void NaClSetThreadGeneration(struct NaClAppThread *natp, int generation) {
+  struct NaClApp *nap = natp->nap;
+  Atomic32 old_generation = natp->dynamic_delete_generation;
+
+  if (old_generation == generation) {
+    return;
+  }
+  CHECK(old_generation < generation);
   /*
-   * outer check handles fast case (no change)
-   * since threads only set their own generation it is safe
+   * Only this thread writes its own generation; CompareAndSwap() is
+   * used for its barrier, so that the new value is visible before we
+   * read the cached minimum below.
    */
-  if (natp->dynamic_delete_generation != generation)  {
-    NaClXMutexLock(&natp->mu);
-    CHECK(natp->dynamic_delete_generation <= generation);
-    natp->dynamic_delete_generation = generation;
-    NaClXMutexUnlock(&natp->mu);
+  CompareAndSwap(&natp->dynamic_delete_generation, old_generation,
+                 generation);
+  /*
+   * The cached minimum only needs refreshing if we were at it.  While
+   * a scan is running it reads as INT32_MAX, since the scan may or may
+   * not have seen our old value.
+   */
+  if (old_generation <= nap->dynamic_min_generation) {
+    nap->dynamic_min_stale = 1;
   }
 }
 
@@ -362,18 +397,33 @@ int NaClMinimumThreadGeneration(struct NaClApp *nap) {
   NaClXMutexLock(&nap->threads_mu);
   for (index = 0; index < nap->threads.num_entries; ++index) {
     struct NaClAppThread *thread = NaClGetThreadMu(nap, (int) index);
-    if (thread != NULL) {
-      NaClXMutexLock(&thread->mu);
-      if (rv > thread->dynamic_delete_generation) {
-        rv = thread->dynamic_delete_generation;
-      }
-      NaClXMutexUnlock(&thread->mu);
+    if (thread != NULL && rv > thread->dynamic_delete_generation) {
+      rv = thread->dynamic_delete_generation;
     }
   }
   NaClXMutexUnlock(&nap->threads_mu);
   return rv;
 }
 
+int NaClCachedMinimumThreadGeneration(struct NaClApp *nap) {
+  Atomic32 rv;
+
+  if (!nap->dynamic_min_stale) {
+    return nap->dynamic_min_generation;
+  }
+  /*
+   * Mark the scan as running and clear the stale flag before reading
+   * any thread's generation, so that a thread which moves on after we
+   * have read it is sure to set the flag again.
+   */
+  CompareAndSwap(&nap->dynamic_min_generation, nap->dynamic_min_generation,
+                 INT32_MAX);
+  CompareAndSwap(&nap->dynamic_min_stale, 1, 0);
+  rv = NaClMinimumThreadGeneration(nap);
+  CompareAndSwap(&nap->dynamic_min_generation, INT32_MAX, rv);
+  return rv;
+}
+
 static void CopyBundleTails(uint8_t *dest,
                             uint8_t *src,
                             int32_t size,
@@ -764,6 +814,289 @@ int32_t NaClTextDyncodeCreate(struct NaClApp *nap,
   return retval;
 }
 
+/*
+ * Code shared between NaClApps by NaClTextDyncodeCreateShared().  The
+ * table holds a reference to each entry's shm for the life of the
+ * process, so entries can be used without holding g_shared_code_mu.
+ */
+struct NaClSharedCode {
+  struct NaClSharedCode               *next;
+  uint64_t                            hash;
+  uint32_t                            dest;
+  uint32_t                            size;
+  int                                 pnacl_mode;
+  const struct NaClValidatorInterface *validator;
+  uint8_t                             *cpu_features;  /* CPUFeatureSize */
+  struct NaClDesc                     *shm;
+  size_t                              map_size;
+  uint8_t                             *view;  /* read-only, trusted */
+};
+
+static struct NaClMutex g_shared_code_mu;
+static struct NaClSharedCode *g_shared_code = NULL;
+
+static void NaClSharedCodeFree(struct NaClSharedCode *entry) {
+  if (NULL != entry->view) {
+    NaClHostDescUnmapUnsafe(entry->view, entry->map_size);
+  }
+  NaClDescSafeUnref(entry->shm);
+  free(entry->cpu_features);
+  free(entry);
+}
+
+void NaClTextModuleInit(void) {
+  NaClXMutexCtor(&g_shared_code_mu);
+}
+
+void NaClTextModuleFini(void) {
+  struct NaClSharedCode *entry;
+
+  while (NULL != (entry = g_shared_code)) {
+    g_shared_code = entry->next;
+    NaClSharedCodeFree(entry);
+  }
+  NaClMutexDtor(&g_shared_code_mu);
+}
+
+/*
+ * FNV-1a over 64-bit words.  This only picks out candidates: a match
+ * is always confirmed by comparing the code itself.
+ */
+static uint64_t NaClSharedCodeHash(uint8_t const *code, uint32_t size) {
+  uint64_t  hash = 14695981039346656037ULL;
+  uint64_t  word;
+  uint32_t  offset;
+
+  for (offset = 0; offset < size; offset += sizeof word) {
+    memcpy(&word, code + offset, sizeof word);
+    hash = (hash ^ word) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+static int NaClSharedCodeAllowed(struct NaClApp *nap,
+                                 uint32_t       dest,
+                                 uint32_t       size) {
+#if NACL_WINDOWS
+  /*
+   * Mapping over part of the dynamic text region would mean opening an
+   * address space hole; see NaClMakeDynamicTextShared().
+   */
+  UNREFERENCED_PARAMETER(nap);
+  UNREFERENCED_PARAMETER(dest);
+  UNREFERENCED_PARAMETER(size);
+  return 0;
+#else
+  /*
+   * The shared copy has to be exactly the code that was validated, and
+   * must never be written through, so anything that edits code in
+   * place (stubout, or a debugger's breakpoints) rules sharing out.
+   */
+  return (NULL != nap->text_shm &&
+          !nap->skip_validator &&
+          !nap->ignore_validator_result &&
+          !nap->validator_stub_out_mode &&
+          NULL == nap->debug_stub_callbacks &&
+          0 != size &&
+          0 == (size & (nap->bundle_size - 1)) &&
+          0 == (dest & (NACL_MAP_PAGESIZE - 1)) &&
+          dest >= nap->dynamic_text_start &&
+          dest + NaClRoundAllocPage(size) <=
+              nap->dynamic_text_end - NACL_HALT_SLED_SIZE);
+#endif
+}
+
+static int NaClSharedCodeMatches(struct NaClSharedCode const *entry,
+                                 struct NaClApp *nap,
+                                 uint32_t dest,
+                                 uint8_t const *code,
+                                 uint32_t size,
+                                 uint64_t hash) {
+  return (entry->hash == hash &&
+          entry->dest == dest &&
+          entry->size == size &&
+          entry->pnacl_mode == nap->pnacl_mode &&
+          entry->validator == nap->validator &&
+          0 == memcmp(entry->cpu_features, nap->cpu_features,
+                      nap->validator->CPUFeatureSize) &&
+          0 == memcmp(entry->view, code, size));
+}
+
+/*
+ * Validates code into a new shared memory object, padded with halts to
+ * an allocation page.  Returns NULL, with *retval set to a negated
+ * errno if the code does not validate and left at 0 if it merely
+ * cannot be shared.  Caller must hold g_shared_code_mu.
+ */
+static struct NaClSharedCode *NaClSharedCodeCreate(
+    struct NaClApp *nap,
+    uint32_t dest,
+    uint8_t *code,
+    uint32_t size,
+    uint64_t hash,
+    const struct NaClValidationMetadata *metadata,
+    int32_t *retval) {
+  struct NaClSharedCode *entry;
+  uintptr_t             mapping;
+  size_t                cpu_features_size = nap->validator->CPUFeatureSize;
+
+  entry = calloc(1, sizeof *entry);
+  if (NULL == entry) {
+    return NULL;
+  }
+  entry->cpu_features = malloc(cpu_features_size);
+  entry->map_size = NaClRoundAllocPage(size);
+  entry->shm = MakeImcShmDesc(entry->map_size);
+  if (NULL == entry->cpu_features || NULL == entry->shm) {
+    goto fail;
+  }
+  mapping = (*NACL_VTBL(NaClDesc, entry->shm)->
+             Map)(entry->shm,
+                  NaClDescEffectorTrustedMem(),
+                  NULL,
+                  entry->map_size,
+                  NACL_ABI_PROT_READ | NACL_ABI_PROT_WRITE,
+                  NACL_ABI_MAP_SHARED,
+                  0);
+  if (NaClPtrIsNegErrno(&mapping)) {
+    goto fail;
+  }
+  entry->view = (uint8_t *) mapping;
+  NaClFillMemoryRegionWithHalt(entry->view, entry->map_size);
+  memcpy(entry->view, code, size);
+
+  if (LOAD_OK != NaClValidateCode(nap, dest, code, size, metadata)) {
+    NaClLog(1, "NaClTextDyncodeCreateShared: "
+            "Validation of dynamic code failed\n");
+    *retval = -NACL_ABI_EINVAL;
+    goto fail;
+  }
+  if (0 != memcmp(entry->view, code, size)) {
+    NaClLog(1, "NaClTextDyncodeCreateShared: validator rewrote code;"
+            " not sharing it\n");
+    goto fail;
+  }
+  if (0 != NaClMprotect(entry->view, entry->map_size, PROT_READ)) {
+    goto fail;
+  }
+
+  entry->hash = hash;
+  entry->dest = dest;
+  entry->size = size;
+  entry->pnacl_mode = nap->pnacl_mode;
+  entry->validator = nap->validator;
+  memcpy(entry->cpu_features, nap->cpu_features, cpu_features_size);
+  return entry;
+
+ fail:
+  NaClSharedCodeFree(entry);
+  return NULL;
+}
+
+/*
+ * Maps entry's code read+execute into nap at its address.  Returns 0
+ * if the pages are not free for it, so that the caller can fall back
+ * to NaClTextDyncodeCreate() and report the error from there.
+ */
+static int NaClSharedCodeMap(struct NaClApp *nap,
+                             struct NaClSharedCode *entry) {
+  uintptr_t dest_addr = NaClUserToSys(nap, entry->dest);
+  uint32_t  page_index_min =
+      (uint32_t) ((entry->dest - nap->dynamic_text_start) / NACL_MAP_PAGESIZE);
+  uint32_t  page_index_max =
+      page_index_min + (uint32_t) (entry->map_size / NACL_MAP_PAGESIZE);
+  uint32_t  index;
+  uintptr_t mmap_ret;
+
+  NaClXMutexLock(&nap->dynamic_load_mutex);
+  /*
+   * Pages that were made visible before hold (or held) other code, and
+   * would be writable through text_shm.
+   */
+  for (index = page_index_min; index < page_index_max; index++) {
+    if (BitmapIsBitSet(nap->dynamic_page_bitmap, index)) {
+      NaClXMutexUnlock(&nap->dynamic_load_mutex);
+      return 0;
+    }
+  }
+  /*
+   * Like code mmapped from a file, the region is marked is_mmap so that
+   * dyncode_modify and dyncode_delete refuse to touch it.
+   */
+  if (NaClDynamicRegionCreate(nap, dest_addr, entry->map_size, 1) != 1) {
+    NaClXMutexUnlock(&nap->dynamic_load_mutex);
+    return 0;
+  }
+  for (index = page_index_min; index < page_index_max; index++) {
+    BitmapSetBit(nap->dynamic_page_bitmap, index);
+  }
+  /* This replaces the inaccessible text_shm pages atomically. */
+  mmap_ret = (*NACL_VTBL(NaClDesc, entry->shm)->
+              Map)(entry->shm,
+                   NaClDescEffectorTrustedMem(),
+                   (void *) dest_addr,
+                   entry->map_size,
+                   NACL_ABI_PROT_READ | NACL_ABI_PROT_EXEC,
+                   NACL_ABI_MAP_SHARED | NACL_ABI_MAP_FIXED,
+                   0);
+  if (dest_addr != mmap_ret) {
+    NaClLog(LOG_FATAL, "NaClTextDyncodeCreateShared: Could not map in"
+            " shared code: got 0x%"NACL_PRIxPTR"\n", mmap_ret);
+  }
+  NaClFlushCacheForDoublyMappedCode(entry->view, (uint8_t *) dest_addr,
+                                    entry->size);
+  NaClXMutexUnlock(&nap->dynamic_load_mutex);
+  return 1;
+}
+
+int32_t NaClTextDyncodeCreateShared(
+    struct NaClApp *nap,
+    uint32_t       dest,
+    void           *code_copy,
+    uint32_t       size,
+    const struct NaClValidationMetadata *metadata) {
+  struct NaClSharedCode   *entry;
+  uint64_t                hash;
+  int32_t                 retval = 0;
+  struct NaClPerfCounter  time_shared_create;
+
+  if (!NaClSharedCodeAllowed(nap, dest, size)) {
+    return NaClTextDyncodeCreate(nap, dest, code_copy, size, metadata);
+  }
+  NaClPerfCounterCtor(&time_shared_create, "NaClTextDyncodeCreateShared");
+
+  hash = NaClSharedCodeHash((uint8_t *) code_copy, size);
+  NaClXMutexLock(&g_shared_code_mu);
+  for (entry = g_shared_code; NULL != entry; entry = entry->next) {
+    if (NaClSharedCodeMatches(entry, nap, dest, (uint8_t *) code_copy,
+                              size, hash)) {
+      break;
+    }
+  }
+  if (NULL != entry) {
+    NaClPerfCounterMark(&time_shared_create, "SharedCodeFound");
+  } else {
+    entry = NaClSharedCodeCreate(nap, dest, (uint8_t *) code_copy, size,
+                                 hash, metadata, &retval);
+    if (NULL != entry) {
+      entry->next = g_shared_code;
+      g_shared_code = entry;
+    }
+    NaClPerfCounterMark(&time_shared_create,
+                        NACL_PERF_IMPORTANT_PREFIX "SharedCodeValidate");
+  }
+  NaClXMutexUnlock(&g_shared_code_mu);
+  NaClPerfCounterIntervalLast(&time_shared_create);
+
+  if (0 != retval) {
+    return retval;
+  }
+  if (NULL != entry && NaClSharedCodeMap(nap, entry)) {
+    return 0;
+  }
+  return NaClTextDyncodeCreate(nap, dest, code_copy, size, metadata);
+}
+
 int32_t NaClSysDyncodeCreate(struct NaClAppThread *natp,
                              uint32_t             dest,
                              uint32_t             src,
@@ -785,6 +1118,12 @@ int32_t NaClSysDyncodeCreate(struct NaClAppThread *natp,
     return -NACL_ABI_EFAULT;
   }
 
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_DYNCODE_BYTES, NULL);
+  if (0 != retval) {
+    return retval;
+  }
+
   /*
    * Make a private copy of the code, so that we can validate it
    * without a TOCTTOU race condition.
@@ -797,6 +1136,8 @@ int32_t NaClSysDyncodeCreate(struct NaClAppThread *natp,
 
   /* Unknown data source, no metadata. */
   retval = NaClTextDyncodeCreate(nap, dest, code_copy, size, NULL);
+  NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_DYNCODE_BYTES,
+                       size);
 
   free(code_copy);
   return retval;
@@ -849,6 +1190,12 @@ int32_t NaClSysDyncodeModify(struct NaClAppThread *natp,
     return -NACL_ABI_EFAULT;
   }
 
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_DYNCODE_BYTES, NULL);
+  if (0 != retval) {
+    return retval;
+  }
+
   NaClXMutexLock(&nap->dynamic_load_mutex);
 
   region = NaClDynamicRegionFind(nap, dest_addr, size);
@@ -902,6 +1249,8 @@ int32_t NaClSysDyncodeModify(struct NaClAppThread *natp,
                                                  (uint8_t*) dest_addr,
                                                  code_copy,
                                                  size);
+  NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_DYNCODE_BYTES,
+                       size);
 
   if (validator_result != LOAD_OK
       && nap->ignore_validator_result) {
@@ -961,14 +1310,10 @@ int32_t NaClSysDyncodeDelete(struct NaClAppThread *natp,
   }
 
   if (0 == size) {
-    /* Nothing to delete.  Just update our generation. */
-    int gen;
-    /* fetch current generation */
-    NaClXMutexLock(&nap->dynamic_load_mutex);
-    gen = nap->dynamic_delete_generation;
-    NaClXMutexUnlock(&nap->dynamic_load_mutex);
-    /* set our generation */
-    NaClSetThreadGeneration(natp, gen);
+    /*
+     * Nothing to delete.  NaClSyscallCSegHook() has already updated our
+     * generation.
+     */
     return 0;
   }
 
@@ -1023,14 +1368,20 @@ int32_t NaClSysDyncodeDelete(struct NaClAppThread *natp,
 
     NaClTextMapClearCacheIfNeeded(nap, dest, size);
 
-    /* increment and record the generation deletion was requested */
-    region->delete_generation = ++nap->dynamic_delete_generation;
+    /*
+     * Increment and record the generation deletion was requested.
+     * AtomicIncrement() orders this after the halts above, for threads
+     * that read the generation without dynamic_load_mutex on syscall
+     * entry.
+     */
+    region->delete_generation =
+        AtomicIncrement(&nap->dynamic_delete_generation, 1);
   }
 
   /* update our own generation */
   NaClSetThreadGeneration(natp, nap->dynamic_delete_generation);
 
-  if (region->delete_generation <= NaClMinimumThreadGeneration(nap)) {
+  if (region->delete_generation <= NaClCachedMinimumThreadGeneration(nap)) {
     /*
      * All threads have checked in since we marked region for deletion.
      * It is safe to remove the region.
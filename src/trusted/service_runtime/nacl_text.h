@@ -75,8 +75,27 @@ NaClErrorCode NaClMakeDynamicTextShared(struct NaClApp *nap) NACL_WUR;
 struct NaClDescEffectorShm;
 int NaClDescEffectorShmCtor(struct NaClDescEffectorShm *self) NACL_WUR;
 
+/*
+ * Records that natp has seen deletion generation |generation|, i.e. it
+ * is at a point where it cannot be executing in dynamic code that was
+ * deleted at or before that generation.  Called by natp itself.
+ */
+void NaClSetThreadGeneration(struct NaClAppThread *natp, int generation);
+
+/*
+ * Returns the lowest generation any of nap's threads has seen, or
+ * INT_MAX if there are no threads.  This scans the thread table.
+ */
 int NaClMinimumThreadGeneration(struct NaClApp *nap);
 
+/*
+ * Like NaClMinimumThreadGeneration(), but returns a cached value unless
+ * a thread may since have moved the minimum on.  The cached value may
+ * be lower than the true minimum, but never higher.  Caller must hold
+ * nap->dynamic_load_mutex.
+ */
+int NaClCachedMinimumThreadGeneration(struct NaClApp *nap);
+
 int32_t NaClTextDyncodeCreate(
     struct NaClApp *nap,
     uint32_t       dest,
@@ -84,6 +103,30 @@ int32_t NaClTextDyncodeCreate(
     uint32_t       size,
     const struct NaClValidationMetadata *metadata) NACL_WUR;
 
+/*
+ * Like NaClTextDyncodeCreate(), for code that many NaClApps in this
+ * process load at the same address (i.e., the IRT).  The first load
+ * validates the code into a shared memory object that is kept for the
+ * life of the process; later loads of identical code, for the same
+ * CPU features and validator settings, map that object read+execute
+ * at dest without copying or validating it again.  The region cannot
+ * be changed with dyncode_modify or dyncode_delete.
+ *
+ * Falls back to NaClTextDyncodeCreate() when sharing is not possible:
+ * dest is not allocation-page aligned, validation is skipped, patched
+ * or stubbed out, a debug stub is attached, or on Windows.
+ */
+int32_t NaClTextDyncodeCreateShared(
+    struct NaClApp *nap,
+    uint32_t       dest,
+    void           *code_copy,
+    uint32_t       size,
+    const struct NaClValidationMetadata *metadata) NACL_WUR;
+
+/* Sets up and tears down the shared code table used by the above. */
+void NaClTextModuleInit(void);
+void NaClTextModuleFini(void);
+
 int32_t NaClSysDyncodeCreate(struct NaClAppThread *natp,
                              uint32_t             dest,
                              uint32_t             src,
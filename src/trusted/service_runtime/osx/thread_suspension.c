@@ -46,8 +46,10 @@ void NaClAppThreadSetSuspendState(struct NaClAppThread *natp,
   NaClXMutexUnlock(&natp->suspend_mu);
 }
 
-void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
-                                int save_registers) {
+void NaClUntrustedThreadSuspendBegin(struct NaClAppThread *natp,
+                                     int save_registers) {
+  UNREFERENCED_PARAMETER(save_registers);
+
   /*
    * We claim suspend_mu here to block trusted/untrusted context
    * switches by blocking NaClAppThreadSetSuspendState().  This blocks
@@ -58,38 +60,41 @@ void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
    */
   NaClXMutexLock(&natp->suspend_mu);
   if (natp->suspend_state == NACL_APP_THREAD_UNTRUSTED) {
-    kern_return_t result;
-    mach_msg_type_number_t size;
-    mach_port_t thread_port = GetHostThreadPort(natp);
-
-    result = thread_suspend(thread_port);
+    kern_return_t result = thread_suspend(GetHostThreadPort(natp));
     if (result != KERN_SUCCESS) {
-      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspend: "
+      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspendBegin: "
               "thread_suspend() call failed: error %d\n", (int) result);
     }
+  }
+  /*
+   * We leave suspend_mu held so that NaClAppThreadSetSuspendState()
+   * will block.
+   */
+}
 
-    if (save_registers) {
+void NaClUntrustedThreadSuspendFinish(struct NaClAppThread *natp,
+                                      int save_registers) {
+  if (natp->suspend_state == NACL_APP_THREAD_UNTRUSTED && save_registers) {
+    kern_return_t result;
+    mach_msg_type_number_t size;
+
+    if (natp->suspended_registers == NULL) {
+      natp->suspended_registers = malloc(sizeof(*natp->suspended_registers));
       if (natp->suspended_registers == NULL) {
-        natp->suspended_registers = malloc(sizeof(*natp->suspended_registers));
-        if (natp->suspended_registers == NULL) {
-          NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspend: malloc() failed\n");
-        }
+        NaClLog(LOG_FATAL,
+                "NaClUntrustedThreadSuspendFinish: malloc() failed\n");
       }
+    }
 
-      size = sizeof(natp->suspended_registers->context) / sizeof(natural_t);
-      result = thread_get_state(thread_port, x86_THREAD_STATE,
-                                (void *) &natp->suspended_registers->context,
-                                &size);
-      if (result != KERN_SUCCESS) {
-        NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspend: "
-                "thread_get_state() call failed: error %d\n", (int) result);
-      }
+    size = sizeof(natp->suspended_registers->context) / sizeof(natural_t);
+    result = thread_get_state(GetHostThreadPort(natp), x86_THREAD_STATE,
+                              (void *) &natp->suspended_registers->context,
+                              &size);
+    if (result != KERN_SUCCESS) {
+      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspendFinish: "
+              "thread_get_state() call failed: error %d\n", (int) result);
     }
   }
-  /*
-   * We leave suspend_mu held so that NaClAppThreadSetSuspendState()
-   * will block.
-   */
 }
 
 void NaClUntrustedThreadResume(struct NaClAppThread *natp) {
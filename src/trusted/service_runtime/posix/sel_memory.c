@@ -171,3 +171,23 @@ int NaClMadvise(void *start, size_t length, int advice) {
    */
   return ret == -1 ? -errno : ret;
 }
+
+void NaClHugePageAdvise(void *start, size_t length) {
+#if NACL_LINUX && defined(MADV_HUGEPAGE)
+  uintptr_t first = ((uintptr_t) start + NACL_HUGE_PAGESIZE - 1)
+      & ~((uintptr_t) NACL_HUGE_PAGESIZE - 1);
+  uintptr_t last = ((uintptr_t) start + length)
+      & ~((uintptr_t) NACL_HUGE_PAGESIZE - 1);
+
+  if (first >= last) {
+    return;
+  }
+  if (0 != madvise((void *) first, last - first, MADV_HUGEPAGE)) {
+    /* EINVAL if the kernel was built without THP support */
+    NaClLog(3, "NaClHugePageAdvise: madvise failed, errno %d\n", errno);
+  }
+#else
+  UNREFERENCED_PARAMETER(start);
+  UNREFERENCED_PARAMETER(length);
+#endif
+}
@@ -54,6 +54,7 @@
 #include "native_client/src/trusted/service_runtime/sel_addrspace.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
 #include "native_client/src/trusted/service_runtime/sel_memory.h"
+#include "native_client/src/trusted/service_runtime/sys_write_watch.h"
 #include "native_client/src/trusted/validator/rich_file_info.h"
 
 static int IsEnvironmentVariableSet(char const *env_name) {
@@ -140,6 +141,8 @@ int NaClAppWithEmptySyscallTableCtor(struct NaClApp *nap) {
     goto cleanup_mem_map;
   }
 
+  nap->write_watch = NULL;
+
   effp = (struct NaClDescEffectorLdr *) malloc(sizeof *effp);
   if (NULL == effp) {
     goto cleanup_mem_io_regions;
@@ -161,6 +164,8 @@ int NaClAppWithEmptySyscallTableCtor(struct NaClApp *nap) {
   nap->num_dynamic_regions = 0;
   nap->dynamic_regions_allocated = 0;
   nap->dynamic_delete_generation = 0;
+  nap->dynamic_min_generation = 0;
+  nap->dynamic_min_stale = 1;
 
   nap->dynamic_mapcache_offset = 0;
   nap->dynamic_mapcache_size = 0;
@@ -215,9 +220,17 @@ int NaClAppWithEmptySyscallTableCtor(struct NaClApp *nap) {
     goto cleanup_cv;
   }
   nap->num_threads = 0;
-  if (!NaClFastMutexCtor(&nap->desc_mu)) {
+  if (!NaClMutexCtor(&nap->thread_pool_mu)) {
     goto cleanup_threads_mu;
   }
+  nap->thread_pool_head = NULL;
+  nap->thread_pool_count = 0;
+  nap->thread_pool_max = 0;
+  nap->huge_page_heap = 0;
+  nap->checkpoint_file = NULL;
+  if (!NaClFastMutexCtor(&nap->desc_mu)) {
+    goto cleanup_thread_pool_mu;
+  }
 
   nap->running = 0;
   nap->exit_status = -1;
@@ -236,6 +249,12 @@ int NaClAppWithEmptySyscallTableCtor(struct NaClApp *nap) {
   if (!NaClMutexCtor(&nap->exception_mu)) {
     goto cleanup_desc_mu;
   }
+  if (!NaClSchedPolicyCtor(&nap->sched_policy)) {
+    goto cleanup_exception_mu;
+  }
+  if (!NaClResourceUsageCtor(&nap->resource_usage)) {
+    goto cleanup_sched_policy;
+  }
   nap->enable_exception_handling = 0;
 #if NACL_WINDOWS
   nap->debug_exception_handler_state = NACL_DEBUG_EXCEPTION_HANDLER_NOT_STARTED;
@@ -264,7 +283,7 @@ int NaClAppWithEmptySyscallTableCtor(struct NaClApp *nap) {
 
 #if !NACL_LINUX
   if (!NaClMutexCtor(&nap->futex_wait_list_mu)) {
-    goto cleanup_exception_mu;
+    goto cleanup_resource_usage;
   }
   nap->futex_wait_list_head.next = &nap->futex_wait_list_head;
   nap->futex_wait_list_head.prev = &nap->futex_wait_list_head;
@@ -273,11 +292,17 @@ int NaClAppWithEmptySyscallTableCtor(struct NaClApp *nap) {
   return 1;
 
 #if !NACL_LINUX
+ cleanup_resource_usage:
+  NaClResourceUsageDtor(&nap->resource_usage);
+#endif
+ cleanup_sched_policy:
+  NaClSchedPolicyDtor(&nap->sched_policy);
  cleanup_exception_mu:
   NaClMutexDtor(&nap->exception_mu);
-#endif
  cleanup_desc_mu:
   NaClFastMutexDtor(&nap->desc_mu);
+ cleanup_thread_pool_mu:
+  NaClMutexDtor(&nap->thread_pool_mu);
  cleanup_threads_mu:
   NaClMutexDtor(&nap->threads_mu);
  cleanup_cv:
@@ -874,6 +899,10 @@ void NaClAppStartModule(struct NaClApp *nap) {
 /*
  * It is fine to have multiple I/O operations read from memory in Write
  * or SendMsg like operations.
+ *
+ * The host kernel cannot write to pages under write watch, so they are
+ * marked dirty here.  This is conservative for operations which only
+ * read the range.
  */
 void NaClVmIoWillStart(struct NaClApp *nap,
                        uint32_t addr_first_usr,
@@ -882,6 +911,7 @@ void NaClVmIoWillStart(struct NaClApp *nap,
   (*nap->mem_io_regions->vtbl->AddInterval)(nap->mem_io_regions,
                                             addr_first_usr,
                                             addr_last_usr);
+  NaClWriteWatchTouch_mu(nap, addr_first_usr, addr_last_usr);
   NaClXMutexUnlock(&nap->mu);
 }
 
@@ -48,12 +48,14 @@
 #include "native_client/src/trusted/service_runtime/include/bits/nacl_syscalls.h"
 #include "native_client/src/trusted/service_runtime/nacl_error_code.h"
 #include "native_client/src/trusted/service_runtime/nacl_resource.h"
+#include "native_client/src/trusted/service_runtime/nacl_resource_usage.h"
 #include "native_client/src/trusted/service_runtime/nacl_syscall_handlers.h"
 #include "native_client/src/trusted/service_runtime/sel_addrspace.h"
 #include "native_client/src/trusted/service_runtime/sel_mem.h"
 #include "native_client/src/trusted/service_runtime/sel_rt.h"
 #include "native_client/src/trusted/service_runtime/sel_util.h"
 #include "native_client/src/trusted/service_runtime/sys_futex.h"
+#include "native_client/src/trusted/service_runtime/sys_sched.h"
 
 #include "native_client/src/trusted/validator/ncvalidate.h"
 
@@ -67,6 +69,7 @@ struct NaClDynamicRegion;
 struct NaClSignalContext;
 struct NaClValidationCache;
 struct NaClValidationMetadata;
+struct NaClWriteWatch;
 
 struct NaClDebugCallbacks {
   void (*thread_create_hook)(struct NaClAppThread *natp);
@@ -218,6 +221,12 @@ struct NaClApp {
 
   struct NaClResourceNaClApp        resources;
 
+  /* Counters and limits; see nacl_resource_usage.h. */
+  struct NaClResourceUsage  resource_usage;
+
+  /* What thread_sched may do; see sys_sched.h. */
+  struct NaClSchedPolicy    sched_policy;
+
   /*
    * The ordering in this enum is important. We use the ordering
    * to check that the status of module initialization; the state
@@ -253,6 +262,12 @@ struct NaClApp {
 
   struct NaClIntervalMultiset *mem_io_regions;
 
+  /*
+   * Dirty page tracking for the write_watch syscall.  Created on first
+   * use under mu; see sys_write_watch.h.
+   */
+  struct NaClWriteWatch     *write_watch;
+
   /*
    * This is the effector interface object that is used to manipulate
    * NaCl apps by the objects in the NaClDesc class hierarchy.  This
@@ -297,10 +312,19 @@ struct NaClApp {
   uintptr_t                 dynamic_mapcache_ret;
 
   /*
-   * Monotonically increasing generation number used for deletion
-   * Accesses must be protected by dynamic_load_mutex
+   * Monotonically increasing generation number used for deletion.
+   * Written with dynamic_load_mutex held; threads read it without locks
+   * on syscall entry.
    */
-  int                       dynamic_delete_generation;
+  volatile Atomic32         dynamic_delete_generation;
+
+  /*
+   * Cached result of NaClMinimumThreadGeneration(), written with
+   * dynamic_load_mutex held.  dynamic_min_stale is set by threads that
+   * may have moved the minimum on.  See nacl_text.c.
+   */
+  volatile Atomic32         dynamic_min_generation;
+  volatile Atomic32         dynamic_min_stale;
 
 
   int                       running;
@@ -333,6 +357,30 @@ struct NaClApp {
   struct DynArray           threads;   /* NaClAppThread pointers */
   int                       num_threads;  /* number actually running */
 
+  /*
+   * Pool of exited NaClAppThreads whose host threads are parked
+   * waiting to be reused by NaClAppThreadSpawn().  At most
+   * thread_pool_max threads are kept; 0 disables pooling.
+   * thread_pool_mu is lower in the locking order than threads_mu.
+   */
+  struct NaClMutex          thread_pool_mu;
+  struct NaClAppThread      *thread_pool_head;
+  int                       thread_pool_count;
+  int                       thread_pool_max;
+
+  /*
+   * If non-zero, anonymous mmaps of at least NACL_HUGE_PAGESIZE bytes
+   * are placed so that they are huge page aligned in the host address
+   * space, and the host is asked to back them with huge pages.
+   */
+  int                       huge_page_heap;
+
+  /*
+   * Host path that the checkpoint syscall writes its snapshot to, or
+   * NULL if the syscall is disabled.  See sys_checkpoint.h.
+   */
+  char const                *checkpoint_file;
+
   struct NaClFastMutex      desc_mu;
   struct DynArray           desc_tbl;  /* NaClDesc pointers */
 
@@ -483,8 +531,74 @@ int NaClCopyCode(struct NaClApp *nap, uintptr_t guest_addr,
  */
 int NaClCopyInstruction(uint8_t *dst, uint8_t *src, uint8_t sz);
 
+#if NACL_ARCH(NACL_BUILD_ARCH) == NACL_x86
+/*
+ * The three steps of NaClCopyInstruction()'s slow path, which
+ * NaClCopyCode() applies to a whole region at a time: put a HLT over
+ * the first byte of each instruction which cannot be changed with one
+ * store (others are changed straight away), copy the rest of those
+ * instructions, then copy their first bytes.  Every processor must be
+ * serialized between the steps.
+ */
+int NaClCopyInstructionBatchHalt(uint8_t *dst, uint8_t *src, uint8_t sz);
+int NaClCopyInstructionBatchBody(uint8_t *dst, uint8_t *src, uint8_t sz);
+int NaClCopyInstructionBatchFirstByte(uint8_t *dst, uint8_t *src,
+                                      uint8_t sz);
+
+/*
+ * Makes every processor running this process execute a serializing
+ * instruction, with membarrier() where the host has it and otherwise
+ * by changing the protection of a page.  Returns 0 on failure.
+ */
+int NaClSerializeAllProcessors(void);
+#endif
+
 NaClErrorCode NaClValidateImage(struct NaClApp  *nap) NACL_WUR;
 
+/*
+ * Validation of the main executable's text while it is being loaded.
+ * A thread validates the text as NaClValidateStreamProgress (an
+ * NaClElfLoadProgressFunc) reports pieces of it loaded, so reading the
+ * file and validating it overlap.  static_text_end must already
+ * include the halt padding, which must be in place before the load.
+ */
+struct NaClValidateStream {
+  struct NaClApp        *nap;
+  void                  *stream;  /* validator's stream, owned by thread */
+  size_t                size;
+  NaClValidationStatus  status;   /* set by thread */
+  struct NaClThread     thread;
+  struct NaClMutex      mu;
+  struct NaClCondVar    cv;
+  /* Protected by mu. */
+  size_t                loaded;   /* bytes of text available */
+  int                   load_done;
+  int                   abandoned;
+};
+
+/*
+ * Returns non-zero if the validator and the validation mode allow
+ * streaming.  Otherwise use NaClValidateImage once the image is loaded.
+ */
+int NaClValidateStreamIsUsable(struct NaClApp *nap);
+
+/* Starts the validation thread. */
+NaClErrorCode NaClValidateStreamCtor(struct NaClValidateStream *vs,
+                                     struct NaClApp *nap) NACL_WUR;
+
+void NaClValidateStreamProgress(void *progress_data,
+                                uintptr_t vaddr_start,
+                                uintptr_t vaddr_end);
+
+/*
+ * Called once the whole image is loaded: validates whatever is left,
+ * waits for the thread, and returns what NaClValidateImage would.
+ */
+NaClErrorCode NaClValidateStreamFinish(struct NaClValidateStream *vs) NACL_WUR;
+
+/* Stops the validation without a result, e.g. after a load failure. */
+void NaClValidateStreamAbandon(struct NaClValidateStream *vs);
+
 
 int NaClAddrIsValidEntryPt(struct NaClApp *nap,
                            uintptr_t      addr);
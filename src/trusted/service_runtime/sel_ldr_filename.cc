@@ -11,13 +11,29 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "native_client/src/include/build_config.h"
+
+#if !NACL_WINDOWS
+# include <fcntl.h>
+# include <pthread.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+#if NACL_LINUX
+# include <sys/syscall.h>
+#endif
+
 #include <string>
 #include <vector>
 
-#include "native_client/src/include/build_config.h"
 #include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/shared/platform/nacl_host_dir.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/trusted/desc/nacl_desc_dir.h"
+#include "native_client/src/trusted/desc/nacl_desc_io.h"
 #include "native_client/src/trusted/service_runtime/filename_util.h"
 #include "native_client/src/trusted/service_runtime/include/sys/errno.h"
+#include "native_client/src/trusted/service_runtime/include/sys/fcntl.h"
 #include "native_client/src/trusted/service_runtime/nacl_copy.h"
 #include "native_client/src/trusted/service_runtime/nacl_syscall_common.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
@@ -45,7 +61,104 @@ int PathContainsRootPrefix(const char *path, size_t path_len) {
   return 1;
 }
 
+uint32_t CopyPathInFromUser(struct NaClApp *nap,
+                            char           *dest,
+                            size_t         dest_max_size,
+                            uint32_t       src) {
+  /*
+   * NaClCopyInFromUserZStr may (try to) get bytes that is outside the
+   * app's address space and generate a fault.
+   */
+  if (!NaClCopyInFromUserZStr(nap, dest, dest_max_size, src)) {
+    if (dest[0] == '\0') {
+      NaClLog(LOG_ERROR, "NaClSys: invalid address for pathname\n");
+      return (uint32_t) -NACL_ABI_EFAULT;
+    }
+
+    NaClLog(LOG_ERROR, "NaClSys: pathname string too long\n");
+    return (uint32_t) -NACL_ABI_ENAMETOOLONG;
+  }
+  return 0;
+}
+
 #if !NACL_WINDOWS
+/*
+ * State shared by all threads for resolving paths under the mounted root,
+ * set up on first use.
+ *
+ * g_virtual_cwd caches the host working directory with the NaClRootDir
+ * prefix removed ("" when the working directory is the root), so that
+ * relative paths do not each cost a getcwd.  It is only changed by
+ * chdir/fchdir, which call NaClMountedCwdChanged.
+ */
+pthread_once_t g_mounted_once = PTHREAD_ONCE_INIT;
+struct NaClMutex g_cwd_mu;
+char g_virtual_cwd[NACL_CONFIG_PATH_MAX];
+int g_virtual_cwd_valid = 0;  /* guarded by g_cwd_mu */
+
+#if NACL_LINUX
+/*
+ * Descriptor for NaClRootDir that anchors path resolution, or -1.
+ * g_openat2_unavailable is set once the host kernel is found to lack
+ * openat2; it only ever goes from 0 to 1, so it needs no lock.
+ */
+int g_root_d = -1;
+volatile int g_openat2_unavailable = 0;
+#endif
+
+void MountedOnceInit(void) {
+  NaClXMutexCtor(&g_cwd_mu);
+#if NACL_LINUX
+  g_root_d = open(NaClRootDir, O_PATH | O_DIRECTORY | O_CLOEXEC);
+  if (-1 == g_root_d) {
+    NaClLog(LOG_WARNING,
+            "Could not open mount directory, errno %d; using path checks\n",
+            errno);
+  }
+#endif
+}
+
+void MountedInit(void) {
+  pthread_once(&g_mounted_once, MountedOnceInit);
+}
+
+/*
+ * Copies the working directory relative to the mounted root into |cwd|.
+ *
+ * @param[out] cwd The virtual working directory, without a trailing slash.
+ * @return 0 on success, else a negated NaCl errno.
+ */
+uint32_t GetVirtualCwd(std::string *cwd) {
+  uint32_t retval = 0;
+
+  MountedInit();
+  NaClXMutexLock(&g_cwd_mu);
+  if (!g_virtual_cwd_valid) {
+    char cwd_path[NACL_CONFIG_PATH_MAX];
+    retval = NaClHostDescGetcwd(cwd_path, sizeof(cwd_path));
+    if (retval != 0) {
+      NaClLog(LOG_ERROR, "NaClHostDescGetcwd failed\n");
+      goto done;
+    }
+
+    /*
+     * This shouldn't fail unless someone outside of the restricted filesystem
+     * has moved the root directory.
+     */
+    if (!PathContainsRootPrefix(cwd_path, strlen(cwd_path))) {
+      retval = (uint32_t) -NACL_ABI_EACCES;
+      goto done;
+    }
+
+    strcpy(g_virtual_cwd, cwd_path + NaClRootDirLen); //NOLINT
+    g_virtual_cwd_valid = 1;
+  }
+  cwd->assign(g_virtual_cwd);
+ done:
+  NaClXMutexUnlock(&g_cwd_mu);
+  return retval;
+}
+
 /*
  * Given a |virtual_path| (a path supplied by the user with no knowledge of the
  * mounted directory) transform it into an |absolute_path|, which is a path that
@@ -61,21 +174,9 @@ uint32_t VirtualToAbsolutePath(const std::string &virtual_path,
   CHECK(virtual_path.length() >= 1);
   if (virtual_path[0] != '/') {
     /* Relative Path = Cwd + '/' + Relative Virtual Path */
-    char cwd_path[NACL_CONFIG_PATH_MAX];
-    int retval = NaClHostDescGetcwd(cwd_path, sizeof(cwd_path));
-    if (retval != 0) {
-      NaClLog(LOG_ERROR, "NaClHostDescGetcwd failed\n");
+    uint32_t retval = GetVirtualCwd(absolute_path);
+    if (retval != 0)
       return retval;
-    }
-
-    /*
-     * This shouldn't fail unless someone outside of the restricted filesystem
-     * has moved the root directory.
-     */
-    if (!PathContainsRootPrefix(cwd_path, strlen(cwd_path)))
-      return (uint32_t) -NACL_ABI_EACCES;
-
-    absolute_path->append(cwd_path + NaClRootDirLen);
     absolute_path->push_back('/');
   }
   absolute_path->append(virtual_path);
@@ -193,25 +294,145 @@ uint32_t CopyHostPathMounted(char *dest, size_t dest_max_size) {
 }
 #endif /* !NACL_WINDOWS */
 
+#if NACL_LINUX
+/* Older C library headers predate openat2 and <linux/openat2.h>. */
+#if !defined(__NR_openat2)
+# define __NR_openat2 437
+#endif
+
+/* Mirrors struct open_how from <linux/openat2.h>. */
+struct NaClOpenHow {
+  uint64_t flags;
+  uint64_t mode;
+  uint64_t resolve;
+};
+
+#define NACL_RESOLVE_NO_MAGICLINKS  0x02
+#define NACL_RESOLVE_NO_SYMLINKS    0x04
+#define NACL_RESOLVE_IN_ROOT        0x10
+
+/*
+ * openat2 fails with EAGAIN if a concurrent rename may have let ".." escape
+ * the root; it is then safe to retry.
+ */
+const int kMaxResolveAttempts = 8;
+
+/*
+ * Returns nonzero if paths can be resolved against g_root_d.
+ */
+int AnchoredResolutionAvailable(void) {
+  if (NaClRootDir == NULL || g_openat2_unavailable)
+    return 0;
+  MountedInit();
+  return g_root_d != -1;
+}
+
+/* Map our ABI open flags to the host's.  See NaClMapOpenFlags. */
+int HostOpenFlags(int flags) {
+  int host_flags = O_LARGEFILE;
+
+  switch (flags & NACL_ABI_O_ACCMODE) {
+    case NACL_ABI_O_RDONLY:
+      host_flags |= O_RDONLY;
+      break;
+    case NACL_ABI_O_WRONLY:
+      host_flags |= O_WRONLY;
+      break;
+    case NACL_ABI_O_RDWR:
+      host_flags |= O_RDWR;
+      break;
+  }
+  if (flags & NACL_ABI_O_CREAT)
+    host_flags |= O_CREAT;
+  if (flags & NACL_ABI_O_EXCL)
+    host_flags |= O_EXCL;
+  if (flags & NACL_ABI_O_TRUNC)
+    host_flags |= O_TRUNC;
+  if (flags & NACL_ABI_O_APPEND)
+    host_flags |= O_APPEND;
+  if (flags & NACL_ABI_O_DIRECTORY)
+    host_flags |= O_DIRECTORY;
+  return host_flags;
+}
+
+/*
+ * Opens the virtual absolute |path| beneath g_root_d, treating g_root_d as
+ * "/" so that ".." stops at the root exactly as CanonicalizeAbsolutePath
+ * does, and refusing symbolic links anywhere in the path.
+ *
+ * @return A host descriptor, else a negated host errno.
+ */
+int OpenInRoot(const std::string &path, int host_flags, int host_mode) {
+  struct NaClOpenHow how;
+  long fd;
+
+  memset(&how, 0, sizeof how);
+  how.flags = host_flags | O_CLOEXEC;
+  /* The kernel rejects a mode unless a file may be created. */
+  how.mode = (host_flags & O_CREAT) ? (host_mode & (S_IRUSR | S_IWUSR)) : 0;
+  how.resolve = (NACL_RESOLVE_IN_ROOT | NACL_RESOLVE_NO_SYMLINKS |
+                 NACL_RESOLVE_NO_MAGICLINKS);
+  for (int attempt = 0; ; ++attempt) {
+    fd = syscall(__NR_openat2, g_root_d, path.c_str(), &how, sizeof how);
+    if (fd >= 0)
+      return (int) fd;
+    if (errno != EAGAIN || attempt + 1 == kMaxResolveAttempts)
+      return -errno;
+  }
+}
+
+/*
+ * Translates a host errno from OpenInRoot into a negated NaCl errno.
+ */
+int32_t XlateResolveErrno(int host_errno) {
+  switch (host_errno) {
+    case ENOSYS:
+      NaClLog(1, "openat2 unavailable; using path checks for '-m'\n");
+      g_openat2_unavailable = 1;
+      return -NACL_ABI_ENOSYS;
+    case ELOOP:
+    case EXDEV:
+      /* A symbolic link, which the mounted directory may not contain. */
+      return -NACL_ABI_EACCES;
+  }
+  return -NaClXlateErrno(host_errno);
+}
+
+/*
+ * Copies the user path at |src| and makes it a virtual absolute path.
+ *
+ * @return 0 on success, else a negated NaCl errno.
+ */
+uint32_t CopyVirtualPathInFromUser(struct NaClApp *nap, uint32_t src,
+                                   std::string *path) {
+  char raw_path[NACL_CONFIG_PATH_MAX];
+  uint32_t retval = CopyPathInFromUser(nap, raw_path, sizeof raw_path, src);
+  if (retval != 0)
+    return retval;
+  if (raw_path[0] == '\0') {
+    NaClLog(LOG_ERROR, "Dest cannot be empty path\n");
+    return (uint32_t) -NACL_ABI_ENOENT;
+  }
+  retval = VirtualToAbsolutePath(raw_path, path);
+  if (retval != 0)
+    return retval;
+  if (path->length() >= NACL_CONFIG_PATH_MAX) {
+    NaClLog(LOG_WARNING, "Pathname too long: %s\n", path->c_str());
+    return (uint32_t) -NACL_ABI_ENAMETOOLONG;
+  }
+  return 0;
+}
+#endif /* NACL_LINUX */
+
 }  // namespace
 
 uint32_t CopyHostPathInFromUser(struct NaClApp *nap,
                                 char           *dest,
                                 size_t         dest_max_size,
                                 uint32_t       src) {
-  /*
-   * NaClCopyInFromUserZStr may (try to) get bytes that is outside the
-   * app's address space and generate a fault.
-   */
-  if (!NaClCopyInFromUserZStr(nap, dest, dest_max_size, src)) {
-    if (dest[0] == '\0') {
-      NaClLog(LOG_ERROR, "NaClSys: invalid address for pathname\n");
-      return (uint32_t) -NACL_ABI_EFAULT;
-    }
-
-    NaClLog(LOG_ERROR, "NaClSys: pathname string too long\n");
-    return (uint32_t) -NACL_ABI_ENAMETOOLONG;
-  }
+  uint32_t retval = CopyPathInFromUser(nap, dest, dest_max_size, src);
+  if (retval != 0)
+    return retval;
 
   /*
    * Without the '-m' option, this function should act like a simple
@@ -266,3 +487,119 @@ uint32_t CopyHostPathOutToUser(struct NaClApp *nap,
     return (uint32_t) -NACL_ABI_EFAULT;
   return 0;
 }
+
+int32_t NaClMountedOpen(struct NaClApp   *nap,
+                        uint32_t         src,
+                        int              flags,
+                        int              mode,
+                        struct NaClDesc  **out_desc) {
+#if NACL_LINUX
+  if (!AnchoredResolutionAvailable())
+    return -NACL_ABI_ENOSYS;
+
+  std::string path;
+  int32_t retval = (int32_t) CopyVirtualPathInFromUser(nap, src, &path);
+  if (retval != 0)
+    return retval;
+
+  int fd = OpenInRoot(path, HostOpenFlags(flags), mode);
+  if (fd == -EISDIR) {
+    /*
+     * Writable opens of a directory fail, but like NaClSysOpen's path
+     * based fallback we open directories read-only whatever was asked.
+     */
+    fd = OpenInRoot(path, O_RDONLY | O_DIRECTORY, 0);
+  }
+  if (fd < 0)
+    return XlateResolveErrno(-fd);
+
+  nacl_host_stat_t stbuf;
+  if (NACL_HOST_FSTAT64(fd, &stbuf) != 0) {
+    retval = -NaClXlateErrno(errno);
+    (void) close(fd);
+    return retval;
+  }
+
+  if (S_ISDIR(stbuf.st_mode)) {
+    /* Directories cannot be opened with O_EXCL. */
+    if (flags & NACL_ABI_O_EXCL) {
+      (void) close(fd);
+      return -NACL_ABI_EEXIST;
+    }
+    struct NaClHostDir *hd =
+        static_cast<struct NaClHostDir *>(malloc(sizeof *hd));
+    if (hd == NULL) {
+      (void) close(fd);
+      return -NACL_ABI_ENOMEM;
+    }
+    retval = NaClHostDirCtor(hd, fd);
+    if (retval != 0) {
+      free(hd);
+      (void) close(fd);
+      return retval;
+    }
+    *out_desc = (struct NaClDesc *) NaClDescDirDescMake(hd);
+  } else {
+    struct NaClHostDesc *hd =
+        static_cast<struct NaClHostDesc *>(malloc(sizeof *hd));
+    if (hd == NULL) {
+      (void) close(fd);
+      return -NACL_ABI_ENOMEM;
+    }
+    retval = NaClHostDescPosixTake(hd, fd, flags & ~NACL_ABI_O_DIRECTORY);
+    if (retval != 0) {
+      free(hd);
+      (void) close(fd);
+      return retval;
+    }
+    *out_desc = (struct NaClDesc *) NaClDescIoDescMake(hd);
+  }
+  return 0;
+#else
+  UNREFERENCED_PARAMETER(nap);
+  UNREFERENCED_PARAMETER(src);
+  UNREFERENCED_PARAMETER(flags);
+  UNREFERENCED_PARAMETER(mode);
+  UNREFERENCED_PARAMETER(out_desc);
+  return -NACL_ABI_ENOSYS;
+#endif /* NACL_LINUX */
+}
+
+int32_t NaClMountedStat(struct NaClApp   *nap,
+                        uint32_t         src,
+                        nacl_host_stat_t *stbuf) {
+#if NACL_LINUX
+  if (!AnchoredResolutionAvailable())
+    return -NACL_ABI_ENOSYS;
+
+  std::string path;
+  int32_t retval = (int32_t) CopyVirtualPathInFromUser(nap, src, &path);
+  if (retval != 0)
+    return retval;
+
+  int fd = OpenInRoot(path, O_PATH, 0);
+  if (fd < 0)
+    return XlateResolveErrno(-fd);
+  retval = 0;
+  if (NACL_HOST_FSTAT64(fd, stbuf) != 0)
+    retval = -NaClXlateErrno(errno);
+  (void) close(fd);
+  return retval;
+#else
+  UNREFERENCED_PARAMETER(nap);
+  UNREFERENCED_PARAMETER(src);
+  UNREFERENCED_PARAMETER(stbuf);
+  return -NACL_ABI_ENOSYS;
+#endif /* NACL_LINUX */
+}
+
+void NaClMountedCwdChanged(void) {
+#if !NACL_WINDOWS
+  if (NaClRootDir == NULL)
+    return;
+  MountedInit();
+  NaClXMutexLock(&g_cwd_mu);
+  g_virtual_cwd_valid = 0;
+  NaClXMutexUnlock(&g_cwd_mu);
+#endif
+}
@@ -15,10 +15,13 @@
 #define NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_SEL_LDR_FILENAME_H_
 
 #include "native_client/src/include/nacl_base.h"
+#include "native_client/src/shared/platform/nacl_host_desc.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
 
 EXTERN_C_BEGIN
 
+struct NaClDesc;
+
 /*
  * Given a file path at |src| from the user, copy the path into a buffer |dest|.
  *
@@ -52,6 +55,45 @@ uint32_t CopyHostPathInFromUser(struct NaClApp *nap, char *dest,
 uint32_t CopyHostPathOutToUser(struct NaClApp *nap, uint32_t dst_usr_addr,
                                char *path);
 
+/*
+ * Opens the user path at |src| inside the mounted root directory with a
+ * single host path resolution anchored on a descriptor for the root
+ * (openat2 with RESOLVE_IN_ROOT and RESOLVE_NO_SYMLINKS on Linux).  The
+ * kernel, rather than a check followed by a separate access, keeps the
+ * lookup beneath the root and refuses symbolic links, so there is no
+ * window for a link to be swapped in.
+ *
+ * @param[in] nap The NaCl application object.
+ * @param[in] src A pointer to user's path buffer.
+ * @param[in] flags NaCl open flags, already restricted to those NaClSysOpen
+ *            accepts.
+ * @param[in] mode NaCl permission bits for a newly created file.
+ * @param[out] out_desc A NaClDescIoDesc, or a NaClDescDirDesc if the path
+ *             names a directory.
+ * @return 0 on success; -NACL_ABI_ENOSYS if anchored resolution is not
+ *         available (no '-m' root, or an older host kernel), in which case
+ *         the caller should fall back to CopyHostPathInFromUser; else a
+ *         negated NaCl errno.
+ */
+int32_t NaClMountedOpen(struct NaClApp *nap, uint32_t src, int flags,
+                        int mode, struct NaClDesc **out_desc);
+
+/*
+ * Like NaClMountedOpen, but stats the path instead.  Symbolic links are
+ * refused rather than followed, so this also serves for lstat.
+ *
+ * @return 0 on success, -NACL_ABI_ENOSYS if the caller should fall back to
+ *         CopyHostPathInFromUser, else a negated NaCl errno.
+ */
+int32_t NaClMountedStat(struct NaClApp *nap, uint32_t src,
+                        nacl_host_stat_t *stbuf);
+
+/*
+ * Must be called after any change of the host working directory, since
+ * the mounted-root path resolution caches the working directory.
+ */
+void NaClMountedCwdChanged(void);
+
 EXTERN_C_END
 
 #endif /* NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_SEL_LDR_FILENAME_H_ */
@@ -192,6 +192,52 @@ void NaClLogAddressSpaceLayout(struct NaClApp *nap) {
   NaClLog(2, "nap->bundle_size        = 0x%x\n", nap->bundle_size);
 }
 
+/*
+ * Sets up the dynamic text region and pads the static text with halt
+ * instructions, updating static_text_end.
+ */
+static NaClErrorCode NaClAppPrepareTextRegion(
+    struct NaClApp *nap,
+    struct NaClPerfCounter *time_load_file) {
+  NaClErrorCode subret;
+
+  /*
+   * NB: mem_map object has been initialized, but is empty.
+   * NaClMakeDynamicTextShared does not touch it.
+   *
+   * NaClMakeDynamicTextShared also fills the dynamic memory region
+   * with the architecture-specific halt instruction.  If/when we use
+   * memory mapping to save paging space for the dynamic region and
+   * lazily halt fill the memory as the pages become
+   * readable/executable, we must make sure that the *last*
+   * NACL_MAP_PAGESIZE chunk is nonetheless mapped and written with
+   * halts.
+   */
+  NaClLog(2,
+          ("Replacing gap between static text and"
+           " (ro)data with shareable memory\n"));
+  subret = NaClMakeDynamicTextShared(nap);
+  NaClPerfCounterMark(time_load_file,
+                      NACL_PERF_IMPORTANT_PREFIX "MakeDynText");
+  NaClPerfCounterIntervalLast(time_load_file);
+  if (LOAD_OK != subret) {
+    return subret;
+  }
+
+  /*
+   * NaClFillEndOfTextRegion will fill with halt instructions the
+   * padding space after the static text region.
+   *
+   * Shm-backed dynamic text space was filled with halt instructions
+   * in NaClMakeDynamicTextShared.  This extends to the rodata.  For
+   * non-shm-backed text space, this extend to the next page (and not
+   * allocation page).  static_text_end is updated to include the
+   * padding.
+   */
+  NaClFillEndOfTextRegion(nap);
+  return LOAD_OK;
+}
+
 /*
  * Expects that "nap->mu" lock is already held.
  */
@@ -206,6 +252,8 @@ NaClErrorCode NaClAppLoadFileAslr(struct NaClDesc *ndp,
   struct NaClElfImage *image = NULL;
   struct NaClPerfCounter  time_load_file;
   struct NaClElfImageInfo info;
+  struct NaClValidateStream validate_stream;
+  int                 validate_while_loading;
 
   NaClPerfCounterCtor(&time_load_file, "NaClAppLoadFile");
 
@@ -337,52 +385,55 @@ NaClErrorCode NaClAppLoadFileAslr(struct NaClDesc *ndp,
             "Error code 0x%x\n",
             ret);
   }
-  subret = NaClElfImageLoad(image, ndp, nap);
-  NaClPerfCounterMark(&time_load_file,
-                      NACL_PERF_IMPORTANT_PREFIX "NaClElfImageLoad");
-  NaClPerfCounterIntervalLast(&time_load_file);
-  if (LOAD_OK != subret) {
-    ret = subret;
-    goto done;
-  }
-
   /*
-   * NB: mem_map object has been initialized, but is empty.
-   * NaClMakeDynamicTextShared does not touch it.
-   *
-   * NaClMakeDynamicTextShared also fills the dynamic memory region
-   * with the architecture-specific halt instruction.  If/when we use
-   * memory mapping to save paging space for the dynamic region and
-   * lazily halt fill the memory as the pages become
-   * readable/executable, we must make sure that the *last*
-   * NACL_MAP_PAGESIZE chunk is nonetheless mapped and written with
-   * halts.
+   * If the text is going to be read rather than mapped, validate it
+   * while it is being read.  The validator has to see the final text
+   * region, so in that case the dynamic text and the halt padding are
+   * set up before loading rather than after: neither overlaps what is
+   * read from the file.
    */
-  NaClLog(2,
-          ("Replacing gap between static text and"
-           " (ro)data with shareable memory\n"));
-  subret = NaClMakeDynamicTextShared(nap);
+  validate_while_loading = (!NaClDescIsSafeForMmap(ndp) &&
+                            NaClValidateStreamIsUsable(nap));
+  if (validate_while_loading) {
+    subret = NaClAppPrepareTextRegion(nap, &time_load_file);
+    if (LOAD_OK != subret) {
+      ret = subret;
+      goto done;
+    }
+    subret = NaClValidateStreamCtor(&validate_stream, nap);
+    if (LOAD_OK != subret) {
+      ret = subret;
+      goto done;
+    }
+    subret = NaClElfImageLoad(image, ndp, nap,
+                              NaClValidateStreamProgress, &validate_stream);
+  } else {
+    subret = NaClElfImageLoad(image, ndp, nap, NULL, NULL);
+  }
   NaClPerfCounterMark(&time_load_file,
-                      NACL_PERF_IMPORTANT_PREFIX "MakeDynText");
+                      NACL_PERF_IMPORTANT_PREFIX "NaClElfImageLoad");
   NaClPerfCounterIntervalLast(&time_load_file);
   if (LOAD_OK != subret) {
+    if (validate_while_loading) {
+      NaClValidateStreamAbandon(&validate_stream);
+    }
     ret = subret;
     goto done;
   }
 
-  /*
-   * NaClFillEndOfTextRegion will fill with halt instructions the
-   * padding space after the static text region.
-   *
-   * Shm-backed dynamic text space was filled with halt instructions
-   * in NaClMakeDynamicTextShared.  This extends to the rodata.  For
-   * non-shm-backed text space, this extend to the next page (and not
-   * allocation page).  static_text_end is updated to include the
-   * padding.
-   */
-  NaClFillEndOfTextRegion(nap);
+  if (!validate_while_loading) {
+    subret = NaClAppPrepareTextRegion(nap, &time_load_file);
+    if (LOAD_OK != subret) {
+      ret = subret;
+      goto done;
+    }
+  }
 
-  if (nap->main_exe_prevalidated) {
+  if (validate_while_loading) {
+    /* Nothing was mapped, so main_exe_prevalidated is not set. */
+    NaClLog(2, "Validating rest of image\n");
+    subret = NaClValidateStreamFinish(&validate_stream);
+  } else if (nap->main_exe_prevalidated) {
     NaClLog(2, "Main executable segment hit validation cache and mapped in,"
             " skipping validation.\n");
     subret = LOAD_OK;
@@ -760,6 +811,8 @@ int NaClWaitForMainThreadToExit(struct NaClApp  *nap) {
    * Some thread invoked the exit (exit_group) syscall.
    */
 
+  NaClAppThreadPoolDrain(nap);
+
   if (NULL != nap->debug_stub_callbacks) {
     nap->debug_stub_callbacks->process_exit_hook();
   }
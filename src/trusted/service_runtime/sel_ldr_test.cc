@@ -8,6 +8,7 @@
 #include "native_client/src/shared/platform/aligned_malloc.h"
 #include "native_client/src/shared/platform/nacl_host_desc.h"
 #include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
 #include "native_client/src/trusted/service_runtime/nacl_app_thread.h"
 #include "native_client/src/trusted/service_runtime/nacl_text.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
@@ -183,6 +184,43 @@ TEST_F(SelLdrTest, MinimumThreadGenerationTest) {
   ASSERT_EQ(300, NaClMinimumThreadGeneration(&app));
 }
 
+TEST_F(SelLdrTest, CachedMinimumThreadGenerationTest) {
+  struct NaClApp app;
+  ASSERT_EQ(1, NaClAppCtor(&app));
+
+  struct NaClAppThread thread1;
+  struct NaClAppThread thread2;
+  memset(&thread1, 0, sizeof(thread1));
+  memset(&thread2, 0, sizeof(thread2));
+  thread1.nap = &app;
+  thread2.nap = &app;
+  thread1.dynamic_delete_generation = 1;
+  thread2.dynamic_delete_generation = 2;
+  ASSERT_EQ(0, NaClAddThread(&app, &thread1));
+  ASSERT_EQ(1, NaClAddThread(&app, &thread2));
+
+  NaClXMutexLock(&app.dynamic_load_mutex);
+  ASSERT_EQ(1, NaClCachedMinimumThreadGeneration(&app));
+  ASSERT_EQ(0, app.dynamic_min_stale);
+
+  // thread2 was not holding back the minimum, so moving it on does
+  // not require another scan.
+  NaClSetThreadGeneration(&thread2, 3);
+  ASSERT_EQ(0, app.dynamic_min_stale);
+  ASSERT_EQ(1, NaClCachedMinimumThreadGeneration(&app));
+
+  // thread1 was, so the next call scans again.
+  NaClSetThreadGeneration(&thread1, 4);
+  ASSERT_EQ(1, app.dynamic_min_stale);
+  ASSERT_EQ(3, NaClCachedMinimumThreadGeneration(&app));
+  ASSERT_EQ(0, app.dynamic_min_stale);
+
+  // Checking in at the same generation is a no-op.
+  NaClSetThreadGeneration(&thread2, 3);
+  ASSERT_EQ(0, app.dynamic_min_stale);
+  NaClXMutexUnlock(&app.dynamic_load_mutex);
+}
+
 TEST_F(SelLdrTest, NaClUserToSysAddrRangeTest) {
   struct NaClApp app;
 
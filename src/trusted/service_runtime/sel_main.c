@@ -19,6 +19,7 @@
 #include <signal.h>
 #endif
 
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -34,6 +35,7 @@
 #include "native_client/src/trusted/fault_injection/fault_injection.h"
 #include "native_client/src/trusted/fault_injection/test_injection.h"
 #include "native_client/src/trusted/perf_counter/nacl_perf_counter.h"
+#include "native_client/src/trusted/perf_counter/nacl_trace.h"
 #include "native_client/src/trusted/service_runtime/env_cleanser.h"
 #include "native_client/src/trusted/service_runtime/include/sys/fcntl.h"
 #include "native_client/src/trusted/service_runtime/load_file.h"
@@ -49,6 +51,9 @@
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
 #include "native_client/src/trusted/service_runtime/sel_main_common.h"
 #include "native_client/src/trusted/service_runtime/sel_qualify.h"
+#include "native_client/src/trusted/service_runtime/sel_zygote.h"
+#include "native_client/src/trusted/service_runtime/sys_checkpoint.h"
+#include "native_client/src/trusted/service_runtime/sys_sched.h"
 #include "native_client/src/trusted/service_runtime/win/exception_patch/ntdll_patch.h"
 #include "native_client/src/trusted/service_runtime/win/debug_exception_handler.h"
 
@@ -119,7 +124,11 @@ static void PrintUsage(void) {
           "               [-f nacl_file]\n"
           "               [-l log_file]\n"
           "               [-m fs_root]\n"
-          "               [-acFglQsSQv]\n"
+          "               [-t thread_pool_size]\n"
+          "               [-k snapshot_file] [-K snapshot_file]\n"
+          "               [-L resource=soft[:hard]]\n"
+          "               [-P name=value]\n"
+          "               [-acFgHlQsSQv]\n"
           "               -- [nacl_file] [args]\n"
           "\n");
   fprintf(stderr,
@@ -134,7 +143,27 @@ static void PrintUsage(void) {
           " -v increases verbosity\n"
           " -e enable hardware exception handling\n"
           " -E <name=value>|<name> set an environment variable\n"
-          " -p pass through all environment variables\n");
+          " -p pass through all environment variables\n"
+          " -t <n> keep up to n exited threads parked for reuse\n"
+          " -k <file> let the nexe checkpoint itself to a snapshot file\n"
+          " -K <file> resume from a snapshot file made with -k by the same\n"
+          "    nexe, instead of starting at its entry point.  The same IRT\n"
+          "    and descriptors (-h, -r, -w, -i) must be given.  Not supported\n"
+          "    on Windows.\n"
+          " -H align large anonymous mmaps to huge pages and ask the host\n"
+          "    to back them with transparent huge pages (Linux only)\n"
+          " -Z <d> zygote mode: load once, then fork a child per launch\n"
+          "    request read from control socket d (Linux only).  Children\n"
+          "    share the zygote's address space layout.\n"
+          " -L <resource>=<soft>[:<hard>] limit the app's use of a resource,\n"
+          "    one of read_bytes, write_bytes, imc_sent, imc_received,\n"
+          "    dyncode_bytes, mapped_bytes or threads.  Going over the soft\n"
+          "    limit logs a warning; the hard limit makes syscalls fail.\n"
+          "    0 means no limit.  Usage is logged at exit with -v.\n"
+          " -P <name>=<value> let the app's threads use thread_sched within\n"
+          "    cpus=<list> (host CPUs, e.g. 0-3,6), priority=<0..20> (the\n"
+          "    highest priority band) and deadline=<percent> (total\n"
+          "    SCHED_DEADLINE utilization; 0 disables it).  Linux only.\n");
   fprintf(stderr,
           " -m <directory> mount directory as root.\n"
           "    If not provided (and -a is also missing), no filesystem access\n"
@@ -179,6 +208,7 @@ struct SelLdrOptions {
   char *nacl_file;
   char *blob_library_file;
   char *root_mount;
+  char *restore_file;
   int app_argc;
   char **app_argv;
 
@@ -193,6 +223,7 @@ struct SelLdrOptions {
   int debug_mode_bypass_acl_checks;
   int debug_mode_ignore_validator;
   int debug_mode_startup_signal;
+  int zygote_control_d;
   struct redir *redir_queue;
   struct redir **redir_qend;
 };
@@ -204,6 +235,7 @@ static void SelLdrOptionsCtor(struct SelLdrOptions *options) {
   options->nacl_file = NULL;
   options->blob_library_file = NULL;
   options->root_mount = NULL;
+  options->restore_file = NULL;
   options->app_argc = 0;
   options->app_argv = NULL;
 
@@ -218,6 +250,7 @@ static void SelLdrOptionsCtor(struct SelLdrOptions *options) {
   options->debug_mode_bypass_acl_checks = 0;
   options->debug_mode_ignore_validator = 0;
   options->debug_mode_startup_signal = 0;
+  options->zygote_control_d = -1;
   options->redir_queue = NULL;
   options->redir_qend = &(options->redir_queue);
 }
@@ -247,9 +280,9 @@ static void NaClSelLdrParseArgs(int argc, char **argv,
    */
   while ((opt = my_getopt(argc, argv,
 #if NACL_LINUX
-                       "+D:z:"
+                       "+D:z:Z:"
 #endif
-                       "aB:cdeE:f:Fgh:i:l:m:pqQr:RsSvw:X:")) != -1) {
+                       "aB:cdeE:f:FgHh:i:k:K:l:L:m:pP:qQr:RsSt:vw:X:")) != -1) {
     switch (opt) {
       case 'a':
         if (!options->quiet)
@@ -300,6 +333,9 @@ static void NaClSelLdrParseArgs(int argc, char **argv,
       case 'g':
         options->enable_debug_stub = 1;
         break;
+      case 'H':
+        nap->huge_page_heap = 1;
+        break;
       case 'h':
       case 'r':
       case 'w':
@@ -332,6 +368,12 @@ static void NaClSelLdrParseArgs(int argc, char **argv,
         *(options->redir_qend) = entry;
         options->redir_qend = &entry->next;
         break;
+      case 'k':
+        nap->checkpoint_file = optarg;
+        break;
+      case 'K':
+        options->restore_file = optarg;
+        break;
       case 'l':
         if (NULL != optarg) {
           /*
@@ -343,12 +385,24 @@ static void NaClSelLdrParseArgs(int argc, char **argv,
           NaClLogSetFile(optarg);
         }
         break;
+      case 'L':
+        if (!NaClResourceUsageParseLimit(&nap->resource_usage, optarg)) {
+          fprintf(stderr, "-L: bad resource limit: %s\n", optarg);
+          exit(1);
+        }
+        break;
       case 'm':
         options->root_mount = optarg;
         break;
       case 'p':
         options->enable_env_passthrough = 1;
         break;
+      case 'P':
+        if (!NaClSchedPolicyParse(&nap->sched_policy, optarg)) {
+          fprintf(stderr, "-P: bad scheduling policy: %s\n", optarg);
+          exit(1);
+        }
+        break;
       case 'q':
         options->quiet = 1;
         break;
@@ -369,6 +423,17 @@ static void NaClSelLdrParseArgs(int argc, char **argv,
       case 'S':
         options->handle_signals = 1;
         break;
+      case 't': {
+        long pool_max = strtol(optarg, &rest, 0);
+        if (rest == optarg || '\0' != *rest ||
+            pool_max < 0 || pool_max > NACL_THREAD_MAX) {
+          fprintf(stderr, "-t: thread pool size must be 0 to %d\n",
+                  NACL_THREAD_MAX);
+          exit(1);
+        }
+        nap->thread_pool_max = (int) pool_max;
+        break;
+      }
       case 'v':
         ++(options->verbosity);
         NaClLogIncrVerbosity();
@@ -378,6 +443,16 @@ static void NaClSelLdrParseArgs(int argc, char **argv,
       case 'z':
         NaClHandleReservedAtZero(optarg);
         break;
+      case 'Z': {
+        long control_d = strtol(optarg, &rest, 0);
+        if (rest == optarg || '\0' != *rest ||
+            control_d < 0 || control_d > INT_MAX) {
+          fprintf(stderr, "-Z: bad control descriptor: %s\n", optarg);
+          exit(1);
+        }
+        options->zygote_control_d = (int) control_d;
+        break;
+      }
 #endif
       default:
         fprintf(stderr, "ERROR: unknown option: [%c]\n\n", opt);
@@ -484,12 +559,22 @@ int NaClSelLdrMain(int argc, char **argv) {
   char const *const             *envp;
 
   struct NaClPerfCounter        time_all_main;
+  char const                    *trace_file;
 
 
   ret_code = 1;
 
   NaClAllModulesInit();
 
+  /*
+   * Record a timeline of the perf counter marks (see nacl_trace.h) for
+   * loading into a trace viewer.
+   */
+  trace_file = getenv("NACL_TRACE_FILE");
+  if (NULL != trace_file) {
+    NaClTraceEnable();
+  }
+
   /*
    * If this is a secondary process spun up to assist windows exception
    * handling, the following function will not return.  If this is a normal
@@ -694,6 +779,49 @@ int NaClSelLdrMain(int argc, char **argv) {
     NaClDescUnref(blob_file);
   }
 
+#if NACL_LINUX
+  if (-1 != options->zygote_control_d) {
+    struct NaClZygoteRequest  *request;
+    size_t                    env_ix;
+    int                       ix;
+
+    /*
+     * Everything up to here is shared by all children.  This only
+     * returns in a child, which applies the per-launch arguments,
+     * environment and descriptors.
+     */
+    request = NaClZygoteServe(options->zygote_control_d,
+                              options->app_argc > 0 ?
+                              options->app_argv[0] : NULL);
+    options->app_argc = request->argc;
+    options->app_argv = request->argv;
+
+    /* overwrite the NULL terminator and append the request's entries */
+    env_ix = env_vars.num_entries - 1;
+    for (ix = 0; NULL != request->envp[ix]; ++ix) {
+      if (!DynArraySet(&env_vars, env_ix++, request->envp[ix])) {
+        NaClLog(LOG_FATAL, "Adding item to env_vars failed\n");
+      }
+    }
+    if (!DynArraySet(&env_vars, env_ix, NULL)) {
+      NaClLog(LOG_FATAL, "Adding env_vars NULL terminator failed\n");
+    }
+    NaClEnvCleanserDtor(&env_cleanser);
+    NaClEnvCleanserCtor(&env_cleanser, 0, options->enable_env_passthrough);
+    if (!NaClEnvCleanserInit(&env_cleanser, NaClGetEnviron(),
+                             (char const *const *) env_vars.ptr_array)) {
+      NaClLog(LOG_FATAL, "Failed to initialise env cleanser\n");
+    }
+    envp = NaClEnvCleanserEnvironment(&env_cleanser);
+
+    for (ix = 0; ix < request->fd_count; ++ix) {
+      NaClAddHostDescriptor(nap, request->host_fd[ix],
+                            request->host_fd_mode[ix],
+                            request->nacl_desc[ix]);
+    }
+  }
+#endif
+
   /*
    * Print out a marker for scripts to use to mark the start of app
    * output.
@@ -723,10 +851,15 @@ int NaClSelLdrMain(int argc, char **argv) {
     }
   }
   NACL_TEST_INJECTION(BeforeMainThreadLaunches, ());
-  if (!NaClCreateMainThread(nap,
-                            options->app_argc,
-                            options->app_argv,
-                            envp)) {
+  if (NULL != options->restore_file) {
+    if (!NaClCheckpointRestore(nap, options->restore_file)) {
+      NaClLog(LOG_ERROR, "restoring from %s failed\n", options->restore_file);
+      goto error;
+    }
+  } else if (!NaClCreateMainThread(nap,
+                                   options->app_argc,
+                                   options->app_argv,
+                                   envp)) {
     NaClLog(LOG_FATAL, "creating main thread failed\n");
   }
 
@@ -740,12 +873,17 @@ int NaClSelLdrMain(int argc, char **argv) {
   NaClPerfCounterIntervalLast(&time_all_main);
 
   ret_code = NaClWaitForMainThreadToExit(nap);
+  NaClResourceUsageLog(nap, 1);
   NaClPerfCounterMark(&time_all_main, "WaitForMainThread");
   NaClPerfCounterIntervalLast(&time_all_main);
 
   NaClPerfCounterMark(&time_all_main, "SelMainEnd");
   NaClPerfCounterIntervalTotal(&time_all_main);
 
+  if (NULL != trace_file && !NaClTraceWriteJson(trace_file)) {
+    NaClLog(LOG_ERROR, "Could not write trace to %s\n", trace_file);
+  }
+
   /*
    * exit_group or equiv kills any still running threads while module
    * addr space is still valid.  otherwise we'd have to kill threads
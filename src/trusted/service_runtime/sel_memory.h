@@ -29,6 +29,14 @@ int NaClMprotect(void *addr, size_t len, int prot) NACL_WUR;
 
 int NaClMadvise(void *start, size_t length, int advice) NACL_WUR;
 
+/*
+ * Asks the host to back the NACL_HUGE_PAGESIZE-aligned part of
+ * [start, start + length) with huge pages.  This is only a hint: it
+ * does nothing on hosts without transparent huge pages, and failure
+ * is logged but otherwise ignored.
+ */
+void NaClHugePageAdvise(void *start, size_t length);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
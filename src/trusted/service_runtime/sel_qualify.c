@@ -4,9 +4,13 @@
  * found in the LICENSE file.
  */
 
+#include <stdlib.h>
+
 #include "native_client/src/include/build_config.h"
 #include "native_client/src/trusted/service_runtime/sel_qualify.h"
 
+#include "native_client/src/shared/platform/nacl_log.h"
+
 #include "native_client/src/trusted/platform_qualify/nacl_cpuwhitelist.h"
 #include "native_client/src/trusted/platform_qualify/nacl_dep_qualify.h"
 #include "native_client/src/trusted/platform_qualify/nacl_os_qualify.h"
@@ -15,8 +19,11 @@
 #elif NACL_ARCH(NACL_BUILD_ARCH) == NACL_mips
 #include "native_client/src/trusted/platform_qualify/arch/mips/nacl_mips_qualify.h"
 #endif
+#if NACL_LINUX
+#include "native_client/src/trusted/service_runtime/sel_qualify_cache.h"
+#endif
 
-NaClErrorCode NaClRunSelQualificationTests(void) {
+static NaClErrorCode NaClRunSelQualificationTestsUncached(void) {
   if (!NaClOsIsSupported()) {
     return LOAD_UNSUPPORTED_OS_PLATFORM;
   }
@@ -50,3 +57,27 @@ NaClErrorCode NaClRunSelQualificationTests(void) {
 
   return LOAD_OK;
 }
+
+NaClErrorCode NaClRunSelQualificationTests(void) {
+#if NACL_LINUX
+  char const    *cache_path = getenv(NACL_QUALIFICATION_CACHE_ENV);
+  char          key[NACL_QUALIFICATION_CACHE_KEY_MAX];
+  NaClErrorCode result;
+
+  if (NULL == cache_path || !NaClQualificationCacheKey(key, sizeof key)) {
+    return NaClRunSelQualificationTestsUncached();
+  }
+  if (NaClQualificationCacheLookup(cache_path, key)) {
+    NaClLog(2, "NaClRunSelQualificationTests: passed (cached in %s)\n",
+            cache_path);
+    return LOAD_OK;
+  }
+  result = NaClRunSelQualificationTestsUncached();
+  if (LOAD_OK == result) {
+    (void) NaClQualificationCacheStore(cache_path, key);
+  }
+  return result;
+#else
+  return NaClRunSelQualificationTestsUncached();
+#endif
+}
@@ -24,6 +24,9 @@ EXTERN_C_BEGIN
  * may be a subset of the full set of PQ tests: it includes the tests that are
  * important enough to check at every startup, and tests that check aspects of
  * the system that may be subject to change.
+ *
+ * On Linux, a pass may be cached on disk and reused by later starts on
+ * the same host; see sel_qualify_cache.h.
  */
 NaClErrorCode NaClRunSelQualificationTests(void);
 
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_SEL_QUALIFY_CACHE_H_
+#define NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_SEL_QUALIFY_CACHE_H_ 1
+
+/*
+ * On-disk cache of successful platform qualification (Linux only).
+ *
+ * If NACL_QUALIFICATION_CACHE_ENV names a file, NaClRunSelQualificationTests()
+ * records each pass there under a key describing the host and the
+ * sel_ldr binary, and skips the tests on later starts whose key
+ * matches.  The key covers:
+ *
+ *   the kernel release and build (uname),
+ *   the boot id, so that a reboot (e.g., with different kernel
+ *   parameters or microcode) invalidates the cache,
+ *   the CPUID signature and feature words on x86, or the ELF hwcaps
+ *   elsewhere,
+ *   the GNU build id of the sel_ldr binary.
+ *
+ * Failures are never cached.  Since a cache entry disables the
+ * qualification tests, the file is ignored unless it is a regular file
+ * owned by the current user and not writable by anyone else.
+ */
+
+#include "native_client/src/include/nacl_base.h"
+#include "native_client/src/include/portability.h"
+
+EXTERN_C_BEGIN
+
+#define NACL_QUALIFICATION_CACHE_ENV      "NACL_QUALIFICATION_CACHE"
+#define NACL_QUALIFICATION_CACHE_KEY_MAX  1024
+
+/*
+ * Fills key with the cache key for this host and sel_ldr.  Returns 0
+ * if no key can be made (e.g., the binary has no build id), in which
+ * case qualification is not cached.
+ */
+int NaClQualificationCacheKey(char *key, size_t key_size);
+
+/* Returns 1 if the cache file at path records a pass for key. */
+int NaClQualificationCacheLookup(char const *path, char const *key);
+
+/*
+ * Records a pass for key in the cache file at path, replacing it
+ * atomically.  Returns 0 on failure, which is only worth a warning.
+ */
+int NaClQualificationCacheStore(char const *path, char const *key);
+
+EXTERN_C_END
+
+#endif  /* NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_SEL_QUALIFY_CACHE_H_ */
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "native_client/src/trusted/service_runtime/sel_qualify_cache.h"
+
+#include "gtest/gtest.h"
+
+class SelQualifyCacheTest : public testing::Test {
+ protected:
+  virtual void SetUp() {
+    char dir_template[] = "/tmp/sel_qualify_cache_test.XXXXXX";
+    ASSERT_TRUE(mkdtemp(dir_template) != NULL);
+    dir_ = dir_template;
+    path_ = dir_ + "/cache";
+  }
+
+  virtual void TearDown() {
+    unlink(path_.c_str());
+    rmdir(dir_.c_str());
+  }
+
+  void WriteCache(const char *contents, mode_t mode) {
+    FILE *fp = fopen(path_.c_str(), "w");
+    ASSERT_TRUE(fp != NULL);
+    ASSERT_EQ(strlen(contents), fwrite(contents, 1, strlen(contents), fp));
+    ASSERT_EQ(0, fclose(fp));
+    ASSERT_EQ(0, chmod(path_.c_str(), mode));
+  }
+
+  std::string dir_;
+  std::string path_;
+};
+
+// sel_ldr and this test are linked with --build-id, so a key can be
+// made, and it is stable within a boot.
+TEST_F(SelQualifyCacheTest, KeyIsStable) {
+  char key1[NACL_QUALIFICATION_CACHE_KEY_MAX];
+  char key2[NACL_QUALIFICATION_CACHE_KEY_MAX];
+
+  ASSERT_TRUE(NaClQualificationCacheKey(key1, sizeof key1));
+  ASSERT_TRUE(NaClQualificationCacheKey(key2, sizeof key2));
+  EXPECT_STREQ(key1, key2);
+  EXPECT_TRUE(strstr(key1, "kernel=") != NULL);
+  EXPECT_TRUE(strstr(key1, ";build=") != NULL);
+  EXPECT_TRUE(strchr(key1, '\n') == NULL);
+
+  // Too small a buffer gives no key rather than a truncated one.
+  EXPECT_FALSE(NaClQualificationCacheKey(key2, 16));
+}
+
+TEST_F(SelQualifyCacheTest, StoreThenLookup) {
+  EXPECT_FALSE(NaClQualificationCacheLookup(path_.c_str(), "key-a"));
+  ASSERT_TRUE(NaClQualificationCacheStore(path_.c_str(), "key-a"));
+  EXPECT_TRUE(NaClQualificationCacheLookup(path_.c_str(), "key-a"));
+  EXPECT_FALSE(NaClQualificationCacheLookup(path_.c_str(), "key-b"));
+  EXPECT_FALSE(NaClQualificationCacheLookup(path_.c_str(), "key-"));
+  EXPECT_FALSE(NaClQualificationCacheLookup(path_.c_str(), "key-aa"));
+
+  // A new key replaces the old one.
+  ASSERT_TRUE(NaClQualificationCacheStore(path_.c_str(), "key-b"));
+  EXPECT_TRUE(NaClQualificationCacheLookup(path_.c_str(), "key-b"));
+  EXPECT_FALSE(NaClQualificationCacheLookup(path_.c_str(), "key-a"));
+}
+
+TEST_F(SelQualifyCacheTest, IgnoresWritableByOthers) {
+  WriteCache("key-a\n", 0600);
+  EXPECT_TRUE(NaClQualificationCacheLookup(path_.c_str(), "key-a"));
+  WriteCache("key-a\n", 0620);
+  EXPECT_FALSE(NaClQualificationCacheLookup(path_.c_str(), "key-a"));
+  WriteCache("key-a\n", 0602);
+  EXPECT_FALSE(NaClQualificationCacheLookup(path_.c_str(), "key-a"));
+}
+
+TEST_F(SelQualifyCacheTest, IgnoresSymlink) {
+  std::string target = dir_ + "/target";
+
+  ASSERT_TRUE(NaClQualificationCacheStore(target.c_str(), "key-a"));
+  ASSERT_EQ(0, symlink(target.c_str(), path_.c_str()));
+  EXPECT_FALSE(NaClQualificationCacheLookup(path_.c_str(), "key-a"));
+  unlink(target.c_str());
+}
@@ -4,9 +4,15 @@
  * found in the LICENSE file.
  */
 
+#include <string.h>
+
 #include "native_client/src/include/concurrency_ops.h"
+#include "native_client/src/shared/platform/nacl_check.h"
 #include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
 #include "native_client/src/shared/utils/types.h"
+#include "native_client/src/trusted/perf_counter/nacl_perf_counter.h"
+#include "native_client/src/trusted/service_runtime/nacl_config.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
 #include "native_client/src/trusted/validator/ncvalidate.h"
 
@@ -98,14 +104,61 @@ int NaClValidateCodeReplacement(struct NaClApp *nap, uintptr_t guest_addr,
       guest_addr, data_old, data_new, size, nap->cpu_features));
 }
 
+#if NACL_ARCH(NACL_BUILD_ARCH) == NACL_x86
+/*
+ * Copying instructions one at a time costs two cross-processor
+ * serializations for each instruction which cannot be changed with a
+ * single store, and JITs patching many inline caches at once can have
+ * a lot of those.  Instead, make a pass over the region with the
+ * validator for each step of the slow path, so that the whole region
+ * needs two serializations.
+ */
+static NaClValidationStatus NaClCopyCodeBatched(struct NaClApp *nap,
+                                                uintptr_t guest_addr,
+                                                uint8_t *data_old,
+                                                uint8_t *data_new,
+                                                size_t size) {
+  NaClValidationStatus status;
+
+  status = nap->validator->CopyCode(guest_addr, data_old, data_new, size,
+                                    nap->cpu_features,
+                                    NaClCopyInstructionBatchHalt);
+  if (NaClValidationSucceeded != status ||
+      0 == memcmp(data_old, data_new, size)) {
+    /* Failed, or every change was made with a single store. */
+    return status;
+  }
+  if (!NaClSerializeAllProcessors()) {
+    return NaClValidationFailed;
+  }
+  status = nap->validator->CopyCode(guest_addr, data_old, data_new, size,
+                                    nap->cpu_features,
+                                    NaClCopyInstructionBatchBody);
+  if (NaClValidationSucceeded != status) {
+    return status;
+  }
+  if (!NaClSerializeAllProcessors()) {
+    return NaClValidationFailed;
+  }
+  return nap->validator->CopyCode(guest_addr, data_old, data_new, size,
+                                  nap->cpu_features,
+                                  NaClCopyInstructionBatchFirstByte);
+}
+#endif
+
 int NaClCopyCode(struct NaClApp *nap, uintptr_t guest_addr,
                  uint8_t *data_old, uint8_t *data_new,
                  size_t size) {
   int status;
+#if NACL_ARCH(NACL_BUILD_ARCH) == NACL_x86
+  status = NaClValidateStatus(NaClCopyCodeBatched(nap, guest_addr,
+                                                  data_old, data_new, size));
+#else
   status = NaClValidateStatus(nap->validator->CopyCode(
                               guest_addr, data_old, data_new, size,
                               nap->cpu_features,
                               NaClCopyInstruction));
+#endif
   /*
    * Flush the processor's instruction cache.  This is not necessary
    * for security, because any old cached instructions will just be
@@ -119,6 +172,25 @@ int NaClCopyCode(struct NaClApp *nap, uintptr_t guest_addr,
   return status;
 }
 
+/* Applies the debug-mode policy to the result of validating the image. */
+static NaClErrorCode NaClValidateImageResult(struct NaClApp *nap,
+                                             NaClErrorCode rcode) {
+  if (LOAD_OK != rcode) {
+    if (nap->ignore_validator_result) {
+      NaClLog(LOG_ERROR, "VALIDATION FAILED: continuing anyway...\n");
+      rcode = LOAD_OK;
+    } else {
+      NaClLog(LOG_ERROR, "VALIDATION FAILED.\n");
+      NaClLog(LOG_ERROR,
+              "Run sel_ldr in debug mode to ignore validation failure.\n");
+      NaClLog(LOG_ERROR,
+              "Run ncval <module-name> for validation error details.\n");
+      rcode = LOAD_VALIDATION_FAILED;
+    }
+  }
+  return rcode;
+}
+
 NaClErrorCode NaClValidateImage(struct NaClApp  *nap) {
   uintptr_t               memp;
   uintptr_t               endp;
@@ -139,19 +211,149 @@ NaClErrorCode NaClValidateImage(struct NaClApp  *nap) {
     /* TODO(ncbray) metadata for the main image. */
     rcode = NaClValidateCode(nap, NACL_TRAMPOLINE_END,
                              (uint8_t *) memp, regionsize, NULL);
-    if (LOAD_OK != rcode) {
-      if (nap->ignore_validator_result) {
-        NaClLog(LOG_ERROR, "VALIDATION FAILED: continuing anyway...\n");
-        rcode = LOAD_OK;
-      } else {
-        NaClLog(LOG_ERROR, "VALIDATION FAILED.\n");
-        NaClLog(LOG_ERROR,
-                "Run sel_ldr in debug mode to ignore validation failure.\n");
-        NaClLog(LOG_ERROR,
-                "Run ncval <module-name> for validation error details.\n");
-        rcode = LOAD_VALIDATION_FAILED;
-      }
-    }
+    rcode = NaClValidateImageResult(nap, rcode);
   }
   return rcode;
 }
+
+/*
+ * The validation thread: validates the text as NaClValidateStreamProgress
+ * reports it loaded, and the rest once loading is over.
+ */
+static void WINAPI NaClValidateStreamThread(void *state) {
+  struct NaClValidateStream *vs = (struct NaClValidateStream *) state;
+  const struct NaClValidatorInterface *validator = vs->nap->validator;
+  struct NaClPerfCounter time_validate;
+  size_t validated = 0;
+  size_t loaded;
+  int load_done;
+  int abandoned;
+
+  NaClPerfCounterCtor(&time_validate, "NaClValidateStream");
+  for (;;) {
+    NaClXMutexLock(&vs->mu);
+    while (vs->loaded == validated && !vs->load_done) {
+      NaClXCondVarWait(&vs->cv, &vs->mu);
+    }
+    loaded = vs->loaded;
+    load_done = vs->load_done;
+    abandoned = vs->abandoned;
+    NaClXMutexUnlock(&vs->mu);
+
+    if (load_done) {
+      break;
+    }
+    (*validator->ValidateStreamAdd)(vs->stream, loaded);
+    validated = loaded;
+  }
+  NaClPerfCounterMark(&time_validate,
+                      NACL_PERF_IMPORTANT_PREFIX "ValidateWhileLoading");
+  NaClPerfCounterIntervalLast(&time_validate);
+
+  if (!abandoned) {
+    vs->status = (*validator->ValidateStreamFinish)(vs->stream);
+    NaClPerfCounterMark(&time_validate, "ValidateRest");
+    NaClPerfCounterIntervalLast(&time_validate);
+  } else {
+    (*validator->ValidateStreamDestroy)(vs->stream);
+  }
+  vs->stream = NULL;
+}
+
+int NaClValidateStreamIsUsable(struct NaClApp *nap) {
+  /*
+   * Stub-out mode validates twice, and skip_validator does not
+   * validate at all; leave both to NaClValidateImage.
+   */
+  return (NULL != nap->validator->ValidateStreamCreate &&
+          !nap->validator_stub_out_mode &&
+          !nap->skip_validator);
+}
+
+NaClErrorCode NaClValidateStreamCtor(struct NaClValidateStream *vs,
+                                     struct NaClApp *nap) {
+  const struct NaClValidatorInterface *validator = nap->validator;
+  uint32_t flags = nap->pnacl_mode ? NACL_DISABLE_NONTEMPORALS_X86 : 0;
+
+  CHECK(NaClValidateStreamIsUsable(nap));
+  if (nap->static_text_end < NACL_TRAMPOLINE_END) {
+    return LOAD_NO_MEMORY;
+  }
+  memset(vs, 0, sizeof *vs);
+  vs->nap = nap;
+  vs->size = nap->static_text_end - NACL_TRAMPOLINE_END;
+  vs->status = NaClValidationFailed;
+  vs->stream = (*validator->ValidateStreamCreate)(
+      NACL_TRAMPOLINE_END,
+      (uint8_t *) (nap->mem_start + NACL_TRAMPOLINE_END),
+      vs->size, flags, nap->cpu_features);
+  if (NULL == vs->stream) {
+    return LOAD_NO_MEMORY;
+  }
+  if (!NaClMutexCtor(&vs->mu)) {
+    goto cleanup_stream;
+  }
+  if (!NaClCondVarCtor(&vs->cv)) {
+    goto cleanup_mutex;
+  }
+  if (!NaClThreadCreateJoinable(&vs->thread, NaClValidateStreamThread,
+                                vs, NACL_KERN_STACK_SIZE)) {
+    goto cleanup_condvar;
+  }
+  return LOAD_OK;
+
+ cleanup_condvar:
+  NaClCondVarDtor(&vs->cv);
+ cleanup_mutex:
+  NaClMutexDtor(&vs->mu);
+ cleanup_stream:
+  (*validator->ValidateStreamDestroy)(vs->stream);
+  vs->stream = NULL;
+  return LOAD_NO_MEMORY;
+}
+
+void NaClValidateStreamProgress(void *progress_data,
+                                uintptr_t vaddr_start,
+                                uintptr_t vaddr_end) {
+  struct NaClValidateStream *vs = (struct NaClValidateStream *) progress_data;
+  uintptr_t loaded_end;
+
+  NaClXMutexLock(&vs->mu);
+  loaded_end = NACL_TRAMPOLINE_END + vs->loaded;
+  /* Only a piece which extends the loaded prefix of the text helps. */
+  if (vaddr_start <= loaded_end && vaddr_end > loaded_end) {
+    size_t loaded = vaddr_end - NACL_TRAMPOLINE_END;
+    if (loaded > vs->size) {
+      loaded = vs->size;
+    }
+    /* The validator wants whole bundles. */
+    loaded &= ~(size_t) (vs->nap->bundle_size - 1);
+    if (loaded > vs->loaded) {
+      vs->loaded = loaded;
+      NaClXCondVarSignal(&vs->cv);
+    }
+  }
+  NaClXMutexUnlock(&vs->mu);
+}
+
+static void NaClValidateStreamJoin(struct NaClValidateStream *vs,
+                                   int abandoned) {
+  NaClXMutexLock(&vs->mu);
+  vs->load_done = 1;
+  vs->abandoned = abandoned;
+  NaClXCondVarSignal(&vs->cv);
+  NaClXMutexUnlock(&vs->mu);
+
+  NaClThreadJoin(&vs->thread);
+  NaClCondVarDtor(&vs->cv);
+  NaClMutexDtor(&vs->mu);
+}
+
+NaClErrorCode NaClValidateStreamFinish(struct NaClValidateStream *vs) {
+  NaClValidateStreamJoin(vs, 0);
+  return NaClValidateImageResult(vs->nap, NaClValidateStatus(vs->status));
+}
+
+void NaClValidateStreamAbandon(struct NaClValidateStream *vs) {
+  NaClValidateStreamJoin(vs, 1);
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl Simple/secure ELF loader (NaCl SEL) zygote mode.
+ *
+ * A zygote sel_ldr loads and validates the nexe and IRT once, stops
+ * just before the main thread would be created, and then forks one
+ * child per launch request read from a control socket.  Each child
+ * skips straight to starting the module, so its startup cost is a
+ * fork rather than a load and validation.
+ *
+ * The control socket must preserve message boundaries (e.g., an
+ * AF_UNIX SOCK_SEQPACKET socket).  Each request is one message:
+ *
+ *   struct NaClZygoteRequestHeader
+ *   int32_t nacl_desc[fd_count]    app descriptor numbers
+ *   char strings[]                 argc args, then envc environment
+ *                                  entries, each NUL terminated
+ *
+ * with fd_count host descriptors attached as SCM_RIGHTS ancillary
+ * data, in the same order as nacl_desc[].  argv[0] is supplied by the
+ * zygote; the args are the ones following it.  The environment
+ * entries are added to those given to the zygote with -E.
+ *
+ * The zygote answers each request with a single int32_t: the child's
+ * pid, or a negated errno value if the request was malformed or the
+ * fork failed.  Children are reaped by the zygote.  The zygote exits
+ * when the control socket is closed.
+ *
+ * Since the untrusted address space is laid out before the fork,
+ * every child has the same sandbox base address, nexe and IRT
+ * placement and trusted heap layout as the zygote and as each other.
+ * This is the price of not loading and validating per launch:
+ * re-randomizing would mean moving the sandbox and the validated code
+ * in it, which is the work the zygote exists to avoid.  A child that
+ * learns its own layout therefore learns its siblings' too.  Embedders
+ * that need per-instance ASLR should not use zygote mode, or should
+ * limit how many children one zygote serves and start a new zygote
+ * after that.  Only the trusted secure RNG is reseeded in each child.
+ */
+
+#ifndef NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_SEL_ZYGOTE_H_
+#define NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_SEL_ZYGOTE_H_ 1
+
+#include "native_client/src/include/nacl_base.h"
+#include "native_client/src/include/portability.h"
+
+EXTERN_C_BEGIN
+
+#define NACL_ZYGOTE_REQUEST_MAGIC     0x4e5a7967  /* "NZyg" */
+#define NACL_ZYGOTE_MAX_FDS           16
+#define NACL_ZYGOTE_MAX_REQUEST_BYTES (64 << 10)
+
+struct NaClZygoteRequestHeader {
+  uint32_t  magic;
+  uint32_t  argc;
+  uint32_t  envc;
+  uint32_t  fd_count;
+};
+
+/*
+ * A parsed launch request, as seen by the child.  argv and envp are
+ * NULL terminated.
+ */
+struct NaClZygoteRequest {
+  int   argc;
+  char  **argv;
+  char  **envp;
+  int   fd_count;
+  int   host_fd[NACL_ZYGOTE_MAX_FDS];
+  int   host_fd_mode[NACL_ZYGOTE_MAX_FDS];  /* O_RDONLY etc. */
+  int   nacl_desc[NACL_ZYGOTE_MAX_FDS];
+  char  *buf;
+};
+
+/*
+ * Serves launch requests on control_d.  The calling process must be
+ * single threaded, since only the calling thread survives in the
+ * children.  argv0, if not NULL, becomes argv[0] for every child.
+ *
+ * Returns only in a forked child, with the request that started it.
+ * The zygote itself exits when the control socket is closed.
+ */
+struct NaClZygoteRequest *NaClZygoteServe(int control_d, char *argv0);
+
+EXTERN_C_END
+
+#endif  /* NATIVE_CLIENT_SRC_TRUSTED_SERVICE_RUNTIME_SEL_ZYGOTE_H_ */
@@ -0,0 +1,889 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl service run-time, checkpoint system call and snapshot restore.
+ *
+ * Snapshot file layout:
+ *
+ *   struct NaClSnapshotHeader
+ *   struct NaClSnapshotRegion[num_regions]
+ *   struct NaClSnapshotDyncode[num_dyncode]
+ *   struct NaClSnapshotDesc[num_descs]
+ *   region contents, each at a NACL_MAP_PAGESIZE aligned offset so that
+ *     it can be mapped; all-zero pages are left as holes in the file
+ *   dynamic code contents
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "native_client/src/trusted/service_runtime/sys_checkpoint.h"
+
+#include "native_client/src/include/build_config.h"
+#include "native_client/src/include/nacl_platform.h"
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/shared/platform/nacl_host_desc.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/trusted/desc/nacl_desc_base.h"
+#include "native_client/src/trusted/service_runtime/include/bits/mman.h"
+#include "native_client/src/trusted/service_runtime/include/sys/errno.h"
+#include "native_client/src/trusted/service_runtime/include/sys/fcntl.h"
+#include "native_client/src/trusted/service_runtime/nacl_app_thread.h"
+#include "native_client/src/trusted/service_runtime/nacl_config.h"
+#include "native_client/src/trusted/service_runtime/nacl_text.h"
+#include "native_client/src/trusted/service_runtime/nacl_tls.h"
+#include "native_client/src/trusted/service_runtime/sel_ldr.h"
+#include "native_client/src/trusted/service_runtime/sel_memory.h"
+
+#define NACL_SNAPSHOT_MAGIC   "NACLSNAP"
+#define NACL_SNAPSHOT_VERSION 1
+
+struct NaClSnapshotHeader {
+  char      magic[8];
+  uint32_t  version;
+  uint32_t  arch;
+  uint32_t  subarch;
+  uint32_t  addr_bits;
+  uint64_t  text_hash;
+  uint32_t  static_text_end;
+  uint32_t  rodata_start;
+  uint32_t  data_start;
+  uint32_t  data_end;
+  uint32_t  dynamic_text_start;
+  uint32_t  dynamic_text_end;
+  uint32_t  break_addr;
+  uint32_t  resume_pc;
+  uint32_t  resume_sp;
+  uint32_t  tls1;
+  uint32_t  tls2;
+  uint32_t  exception_handler;
+  uint32_t  num_regions;
+  uint32_t  num_dyncode;
+  uint32_t  num_descs;
+  uint32_t  reserved;
+};
+
+struct NaClSnapshotRegion {
+  uint32_t  start;  /* user address */
+  uint32_t  size;
+  uint32_t  prot;
+  uint32_t  has_data;
+  uint64_t  file_offset;
+};
+
+struct NaClSnapshotDyncode {
+  uint32_t  start;  /* user address */
+  uint32_t  size;
+  uint64_t  file_offset;
+};
+
+struct NaClSnapshotDesc {
+  int32_t   index;
+  uint32_t  type;
+};
+
+struct NaClCheckpointState {
+  struct NaClApp              *nap;
+  uint32_t                    code_end;
+
+  struct NaClSnapshotRegion   *regions;
+  uint32_t                    num_regions;
+  uint32_t                    regions_allocated;
+
+  struct NaClSnapshotDyncode  *dyncode;
+  uint32_t                    num_dyncode;
+  uint32_t                    dyncode_allocated;
+
+  struct NaClSnapshotDesc     *descs;
+  uint32_t                    num_descs;
+
+  int                         out_of_memory;
+  int                         unsaveable;
+};
+
+/*
+ * Everything above the code is saved: rodata, data, break, stack and
+ * mmap regions.  The code itself comes from reloading the nexe.
+ */
+static uint32_t NaClCheckpointCodeEnd(struct NaClApp *nap) {
+  uintptr_t end = (0 != nap->dynamic_text_end
+                   ? nap->dynamic_text_end
+                   : nap->static_text_end);
+  return (uint32_t) NaClRoundAllocPage(end);
+}
+
+/*
+ * FNV-1a over the static text, which identifies the nexe well enough
+ * to reject a snapshot taken from a different one.
+ */
+static uint64_t NaClCheckpointTextHash(struct NaClApp *nap) {
+  uint8_t const *p = (uint8_t const *) (nap->mem_start + NACL_TRAMPOLINE_END);
+  uint8_t const *end = (uint8_t const *) (nap->mem_start +
+                                          nap->static_text_end);
+  uint64_t      hash = 14695981039346656037ULL;
+
+  for (; p < end; ++p) {
+    hash = (hash ^ *p) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+static void NaClCheckpointFillHeader(struct NaClApp *nap,
+                                     struct NaClSnapshotHeader *hdr) {
+  memset(hdr, 0, sizeof *hdr);
+  memcpy(hdr->magic, NACL_SNAPSHOT_MAGIC, sizeof hdr->magic);
+  hdr->version = NACL_SNAPSHOT_VERSION;
+  hdr->arch = NACL_ARCH(NACL_BUILD_ARCH);
+  hdr->subarch = NACL_BUILD_SUBARCH;
+  hdr->addr_bits = nap->addr_bits;
+  hdr->text_hash = NaClCheckpointTextHash(nap);
+  hdr->static_text_end = (uint32_t) nap->static_text_end;
+  hdr->rodata_start = (uint32_t) nap->rodata_start;
+  hdr->data_start = (uint32_t) nap->data_start;
+  hdr->data_end = (uint32_t) nap->data_end;
+  hdr->dynamic_text_start = (uint32_t) nap->dynamic_text_start;
+  hdr->dynamic_text_end = (uint32_t) nap->dynamic_text_end;
+}
+
+/*
+ * Descriptors are not written to the snapshot; the restoring sel_ldr
+ * must be given equivalent ones.  Types it has no way to be given
+ * (objects the nexe created itself, or that only the browser hands
+ * out) make the snapshot useless.
+ */
+static int NaClCheckpointDescRestorable(enum NaClDescTypeTag type) {
+  /* Not a switch: -Wswitch-enum would want every other tag listed. */
+  return (NACL_DESC_HOST_IO == type ||
+          NACL_DESC_CONNECTED_SOCKET == type ||
+          NACL_DESC_SYNC_SOCKET == type ||
+          NACL_DESC_TRANSFERABLE_DATA_SOCKET == type ||
+          NACL_DESC_IMC_SOCKET == type ||
+          NACL_DESC_NULL == type);
+}
+
+static void NaClCheckpointVisitVmmap(void *statev,
+                                     struct NaClVmmapEntry *vmep) {
+  struct NaClCheckpointState  *state = (struct NaClCheckpointState *) statev;
+  uint32_t                    start = (uint32_t) (vmep->page_num <<
+                                                  NACL_PAGESHIFT);
+  uint32_t                    end = start + (uint32_t) (vmep->npages <<
+                                                        NACL_PAGESHIFT);
+  struct NaClSnapshotRegion   *region;
+
+  if (end <= state->code_end || state->out_of_memory) {
+    return;
+  }
+  if (start < state->code_end) {
+    start = state->code_end;
+  }
+  if (NACL_ABI_MAP_SHARED == (vmep->flags & NACL_ABI_MAP_SHARING_MASK)) {
+    NaClLog(LOG_ERROR,
+            ("NaClSysCheckpoint: shared mapping at 0x%08"NACL_PRIx32
+             ", size 0x%"NACL_PRIx32" cannot be saved\n"),
+            start, end - start);
+    state->unsaveable = 1;
+    return;
+  }
+  if (state->num_regions == state->regions_allocated) {
+    uint32_t n = 2 * state->regions_allocated + 8;
+    region = realloc(state->regions, n * sizeof *region);
+    if (NULL == region) {
+      state->out_of_memory = 1;
+      return;
+    }
+    state->regions = region;
+    state->regions_allocated = n;
+  }
+  /* Private file mappings are saved as anonymous memory. */
+  region = &state->regions[state->num_regions++];
+  region->start = start;
+  region->size = end - start;
+  region->prot = vmep->prot;
+  /*
+   * Inaccessible regions are saved too, since the app may make them
+   * accessible again and expect their contents back.
+   */
+  region->has_data = 1;
+  region->file_offset = 0;
+}
+
+static void NaClCheckpointVisitDyncode(void *statev,
+                                       struct NaClDynamicRegion *rg) {
+  struct NaClCheckpointState  *state = (struct NaClCheckpointState *) statev;
+  struct NaClSnapshotDyncode  *dc;
+
+  /* Regions being deleted are not brought back. */
+  if (rg->delete_generation >= 0 || state->out_of_memory) {
+    return;
+  }
+  if (state->num_dyncode == state->dyncode_allocated) {
+    uint32_t n = 2 * state->dyncode_allocated + 8;
+    dc = realloc(state->dyncode, n * sizeof *dc);
+    if (NULL == dc) {
+      state->out_of_memory = 1;
+      return;
+    }
+    state->dyncode = dc;
+    state->dyncode_allocated = n;
+  }
+  dc = &state->dyncode[state->num_dyncode++];
+  dc->start = (uint32_t) NaClSysToUser(state->nap, rg->start);
+  dc->size = (uint32_t) rg->size;
+  dc->file_offset = 0;
+}
+
+static int32_t NaClCheckpointCollectDescs(struct NaClCheckpointState *state) {
+  struct NaClApp  *nap = state->nap;
+  size_t          i;
+  int32_t         retval = 0;
+
+  NaClFastMutexLock(&nap->desc_mu);
+  state->descs = malloc((nap->desc_tbl.num_entries + 1) *
+                        sizeof *state->descs);
+  if (NULL == state->descs) {
+    retval = -NACL_ABI_ENOMEM;
+    goto cleanup;
+  }
+  for (i = 0; i < nap->desc_tbl.num_entries; ++i) {
+    struct NaClDesc       *ndp = DynArrayGet(&nap->desc_tbl, i);
+    enum NaClDescTypeTag  type;
+
+    if (NULL == ndp) {
+      continue;
+    }
+    type = NACL_VTBL(NaClDesc, ndp)->typeTag;
+    if (!NaClCheckpointDescRestorable(type)) {
+      NaClLog(LOG_ERROR,
+              "NaClSysCheckpoint: descriptor %d (%s) cannot be restored\n",
+              (int) i, NaClDescTypeString(type));
+      retval = -NACL_ABI_ENOTSUP;
+    }
+    state->descs[state->num_descs].index = (int32_t) i;
+    state->descs[state->num_descs].type = type;
+    ++state->num_descs;
+  }
+ cleanup:
+  NaClFastMutexUnlock(&nap->desc_mu);
+  return retval;
+}
+
+static int32_t NaClCheckpointPWrite(struct NaClHostDesc *hd,
+                                    void const          *buf,
+                                    size_t              len,
+                                    nacl_off64_t        offset) {
+  while (len > 0) {
+    ssize_t written = NaClHostDescPWrite(hd, buf, len, offset);
+    if (written <= 0) {
+      return written < 0 ? (int32_t) written : -NACL_ABI_EIO;
+    }
+    buf = (char const *) buf + written;
+    len -= written;
+    offset += written;
+  }
+  return 0;
+}
+
+static int NaClCheckpointIsZero(uint8_t const *p, size_t len) {
+  size_t i;
+
+  for (i = 0; i < len; ++i) {
+    if (0 != p[i]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/*
+ * Writes the region contents a mapping page at a time, skipping pages
+ * which are all zero.  *written_end is raised to the end of the last
+ * page written.  A PROT_NONE region is made readable while it is
+ * written; the caller holds nap->mu and is the only untrusted thread,
+ * so nothing else can see it.
+ */
+static int32_t NaClCheckpointWriteRegion(
+    struct NaClApp            *nap,
+    struct NaClHostDesc       *hd,
+    struct NaClSnapshotRegion *region,
+    nacl_off64_t              *written_end) {
+  uint8_t const *base = (uint8_t const *) NaClUserToSys(nap, region->start);
+  uint32_t      done;
+  int32_t       rv = 0;
+
+  if (NACL_ABI_PROT_NONE == region->prot) {
+    rv = NaClMprotect((void *) base, region->size, NACL_ABI_PROT_READ);
+    if (0 != rv) {
+      NaClLog(LOG_ERROR,
+              ("NaClSysCheckpoint: cannot read region at 0x%08"NACL_PRIx32
+               ", error %d\n"), region->start, rv);
+      return rv;
+    }
+  }
+  for (done = 0; done < region->size; done += NACL_MAP_PAGESIZE) {
+    size_t len = region->size - done;
+    if (len > NACL_MAP_PAGESIZE) {
+      len = NACL_MAP_PAGESIZE;
+    }
+    if (NaClCheckpointIsZero(base + done, len)) {
+      continue;
+    }
+    rv = NaClCheckpointPWrite(hd, base + done, len,
+                              region->file_offset + done);
+    if (0 != rv) {
+      break;
+    }
+    *written_end = region->file_offset + done + len;
+  }
+  if (NACL_ABI_PROT_NONE == region->prot &&
+      0 != NaClMprotect((void *) base, region->size, NACL_ABI_PROT_NONE)) {
+    NaClLog(LOG_FATAL, "NaClSysCheckpoint: cannot reprotect region\n");
+  }
+  return rv;
+}
+
+static int32_t NaClCheckpointWrite(struct NaClCheckpointState *state,
+                                   struct NaClSnapshotHeader  *hdr,
+                                   struct NaClHostDesc        *hd) {
+  struct NaClApp  *nap = state->nap;
+  nacl_off64_t    offset;
+  nacl_off64_t    file_size;
+  nacl_off64_t    written_end;
+  uint32_t        i;
+  int32_t         rv;
+
+  offset = (sizeof *hdr +
+            state->num_regions * sizeof *state->regions +
+            state->num_dyncode * sizeof *state->dyncode +
+            state->num_descs * sizeof *state->descs);
+  for (i = 0; i < state->num_regions; ++i) {
+    if (state->regions[i].has_data) {
+      offset = (offset + NACL_MAP_PAGESIZE - 1) &
+               ~(nacl_off64_t) (NACL_MAP_PAGESIZE - 1);
+      state->regions[i].file_offset = offset;
+      offset += state->regions[i].size;
+    }
+  }
+  for (i = 0; i < state->num_dyncode; ++i) {
+    state->dyncode[i].file_offset = offset;
+    offset += state->dyncode[i].size;
+  }
+  file_size = offset;
+
+  hdr->num_regions = state->num_regions;
+  hdr->num_dyncode = state->num_dyncode;
+  hdr->num_descs = state->num_descs;
+  offset = 0;
+  rv = NaClCheckpointPWrite(hd, hdr, sizeof *hdr, offset);
+  if (0 != rv) {
+    return rv;
+  }
+  offset += sizeof *hdr;
+  rv = NaClCheckpointPWrite(hd, state->regions,
+                            state->num_regions * sizeof *state->regions,
+                            offset);
+  if (0 != rv) {
+    return rv;
+  }
+  offset += state->num_regions * sizeof *state->regions;
+  rv = NaClCheckpointPWrite(hd, state->dyncode,
+                            state->num_dyncode * sizeof *state->dyncode,
+                            offset);
+  if (0 != rv) {
+    return rv;
+  }
+  offset += state->num_dyncode * sizeof *state->dyncode;
+  rv = NaClCheckpointPWrite(hd, state->descs,
+                            state->num_descs * sizeof *state->descs,
+                            offset);
+  if (0 != rv) {
+    return rv;
+  }
+  written_end = offset + state->num_descs * sizeof *state->descs;
+
+  for (i = 0; i < state->num_regions; ++i) {
+    if (state->regions[i].has_data) {
+      rv = NaClCheckpointWriteRegion(nap, hd, &state->regions[i],
+                                     &written_end);
+      if (0 != rv) {
+        return rv;
+      }
+    }
+  }
+  for (i = 0; i < state->num_dyncode; ++i) {
+    struct NaClSnapshotDyncode *dc = &state->dyncode[i];
+    rv = NaClCheckpointPWrite(hd, (void *) NaClUserToSys(nap, dc->start),
+                              dc->size, dc->file_offset);
+    if (0 != rv) {
+      return rv;
+    }
+    written_end = dc->file_offset + dc->size;
+  }
+  /*
+   * If the last region ended in zero pages, extend the file over them
+   * so that they can be mapped.
+   */
+  if (file_size > written_end) {
+    static const uint8_t kZero = 0;
+    rv = NaClCheckpointPWrite(hd, &kZero, 1, file_size - 1);
+  }
+  return rv;
+}
+
+int32_t NaClSysCheckpoint(struct NaClAppThread *natp,
+                          uint32_t             resume_pc,
+                          uint32_t             resume_sp) {
+  struct NaClApp              *nap = natp->nap;
+  struct NaClCheckpointState  state;
+  struct NaClSnapshotHeader   hdr;
+  struct NaClHostDesc         hd;
+  int                         num_threads;
+  int                         hd_open = 0;
+  int32_t                     retval;
+
+  NaClLog(3,
+          ("Entered NaClSysCheckpoint(0x%08"NACL_PRIxPTR
+           ", pc=0x%08"NACL_PRIx32", sp=0x%08"NACL_PRIx32")\n"),
+          (uintptr_t) natp, resume_pc, resume_sp);
+
+  memset(&state, 0, sizeof state);
+  state.nap = nap;
+  state.code_end = NaClCheckpointCodeEnd(nap);
+
+  if (NACL_WINDOWS || NULL == nap->checkpoint_file) {
+    retval = -NACL_ABI_ENOSYS;
+    goto cleanup;
+  }
+  if (!NaClIsValidJumpTarget(nap, resume_pc)) {
+    retval = -NACL_ABI_EFAULT;
+    goto cleanup;
+  }
+  /* Align the stack pointer as for thread_create. */
+  resume_sp = ((resume_sp + NACL_STACK_PAD_BELOW_ALIGN)
+               & ~NACL_STACK_ALIGN_MASK) - NACL_STACK_PAD_BELOW_ALIGN
+              - NACL_STACK_ARGS_SIZE;
+  if (kNaClBadAddress == NaClUserToSysAddr(nap, resume_sp)) {
+    retval = -NACL_ABI_EFAULT;
+    goto cleanup;
+  }
+
+  NaClXMutexLock(&nap->threads_mu);
+  num_threads = nap->num_threads;
+  NaClXMutexUnlock(&nap->threads_mu);
+  if (1 != num_threads) {
+    NaClLog(LOG_ERROR,
+            "NaClSysCheckpoint: %d threads running, must be 1\n",
+            num_threads);
+    retval = -NACL_ABI_EBUSY;
+    goto cleanup;
+  }
+
+  retval = NaClCheckpointCollectDescs(&state);
+  if (0 != retval) {
+    goto cleanup;
+  }
+
+  NaClCheckpointFillHeader(nap, &hdr);
+  hdr.resume_pc = resume_pc;
+  hdr.resume_sp = resume_sp;
+  hdr.tls1 = NaClTlsGetTlsValue1(natp);
+  hdr.tls2 = NaClTlsGetTlsValue2(natp);
+  NaClXMutexLock(&nap->exception_mu);
+  hdr.exception_handler = nap->exception_handler;
+  NaClXMutexUnlock(&nap->exception_mu);
+
+  NaClDyncodeVisit(nap, NaClCheckpointVisitDyncode, &state);
+
+  retval = NaClHostDescOpen(&hd, nap->checkpoint_file,
+                            NACL_ABI_O_WRONLY | NACL_ABI_O_CREAT |
+                            NACL_ABI_O_TRUNC, 0600);
+  if (0 != retval) {
+    NaClLog(LOG_ERROR, "NaClSysCheckpoint: cannot open %s\n",
+            nap->checkpoint_file);
+    goto cleanup;
+  }
+  hd_open = 1;
+
+  /*
+   * Hold mu so that trusted code cannot change the address space while
+   * it is written out.  No untrusted thread can, as the caller is the
+   * only one.
+   */
+  NaClXMutexLock(&nap->mu);
+  hdr.break_addr = (uint32_t) nap->break_addr;
+  NaClVmmapVisit(&nap->mem_map, NaClCheckpointVisitVmmap, &state);
+  if (state.out_of_memory) {
+    retval = -NACL_ABI_ENOMEM;
+  } else if (state.unsaveable) {
+    retval = -NACL_ABI_ENOTSUP;
+  } else {
+    retval = NaClCheckpointWrite(&state, &hdr, &hd);
+  }
+  NaClXMutexUnlock(&nap->mu);
+  if (0 != retval) {
+    NaClLog(LOG_ERROR, "NaClSysCheckpoint: could not write %s, error %d\n",
+            nap->checkpoint_file, retval);
+    goto cleanup;
+  }
+  NaClLog(1, ("NaClSysCheckpoint: wrote %"NACL_PRIu32" regions, %"
+              NACL_PRIu32" dynamic code regions to %s\n"),
+          state.num_regions, state.num_dyncode, nap->checkpoint_file);
+
+ cleanup:
+  if (hd_open && 0 != NaClHostDescClose(&hd) && 0 == retval) {
+    retval = -NACL_ABI_EIO;
+  }
+  free(state.regions);
+  free(state.dyncode);
+  free(state.descs);
+  return retval;
+}
+
+static int NaClCheckpointPRead(struct NaClHostDesc *hd,
+                               void                *buf,
+                               size_t              len,
+                               nacl_off64_t        offset) {
+  while (len > 0) {
+    ssize_t got = NaClHostDescPRead(hd, buf, len, offset);
+    if (got <= 0) {
+      return 0;
+    }
+    buf = (char *) buf + got;
+    len -= got;
+    offset += got;
+  }
+  return 1;
+}
+
+static int NaClCheckpointHeaderMatches(struct NaClApp                  *nap,
+                                       struct NaClSnapshotHeader const *hdr) {
+  struct NaClSnapshotHeader expected;
+
+  if (0 != memcmp(hdr->magic, NACL_SNAPSHOT_MAGIC, sizeof hdr->magic) ||
+      NACL_SNAPSHOT_VERSION != hdr->version) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: not a snapshot file\n");
+    return 0;
+  }
+  NaClCheckpointFillHeader(nap, &expected);
+  if (expected.arch != hdr->arch ||
+      expected.subarch != hdr->subarch ||
+      expected.addr_bits != hdr->addr_bits) {
+    NaClLog(LOG_ERROR,
+            "NaClCheckpointRestore: snapshot is for another architecture\n");
+    return 0;
+  }
+  if (expected.text_hash != hdr->text_hash ||
+      expected.static_text_end != hdr->static_text_end ||
+      expected.rodata_start != hdr->rodata_start ||
+      expected.data_start != hdr->data_start ||
+      expected.data_end != hdr->data_end ||
+      expected.dynamic_text_start != hdr->dynamic_text_start ||
+      expected.dynamic_text_end != hdr->dynamic_text_end) {
+    NaClLog(LOG_ERROR,
+            "NaClCheckpointRestore: snapshot was taken from another nexe\n");
+    return 0;
+  }
+  /* The break may not reach into the main thread's stack. */
+  if (hdr->break_addr < hdr->data_end ||
+      hdr->break_addr > NaClGetInitialStackTop(nap) - nap->stack_size) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: bad break address\n");
+    return 0;
+  }
+  return 1;
+}
+
+static int NaClCheckpointCheckDescs(struct NaClApp                *nap,
+                                    struct NaClSnapshotDesc const *descs,
+                                    uint32_t                      num_descs) {
+  uint32_t  i;
+  int       ok = 1;
+
+  NaClFastMutexLock(&nap->desc_mu);
+  for (i = 0; i < num_descs; ++i) {
+    struct NaClDesc *ndp = NULL;
+
+    if (descs[i].index >= 0) {
+      ndp = DynArrayGet(&nap->desc_tbl, descs[i].index);
+    }
+    if (NULL == ndp) {
+      NaClLog(LOG_ERROR,
+              "NaClCheckpointRestore: descriptor %d (%s) is missing\n",
+              (int) descs[i].index,
+              NaClDescTypeString((enum NaClDescTypeTag) descs[i].type));
+      ok = 0;
+    } else if (NACL_VTBL(NaClDesc, ndp)->typeTag != descs[i].type) {
+      NaClLog(LOG_ERROR,
+              "NaClCheckpointRestore: descriptor %d is %s, expected %s\n",
+              (int) descs[i].index,
+              NaClDescTypeString(NACL_VTBL(NaClDesc, ndp)->typeTag),
+              NaClDescTypeString((enum NaClDescTypeTag) descs[i].type));
+      ok = 0;
+    }
+  }
+  NaClFastMutexUnlock(&nap->desc_mu);
+  return ok;
+}
+
+/*
+ * Brings back the dynamic code.  Regions which this instance already
+ * has with the same contents (the IRT) are kept; the others are
+ * validated again as they are added.
+ */
+static int NaClCheckpointRestoreDyncode(
+    struct NaClApp              *nap,
+    struct NaClHostDesc         *hd,
+    struct NaClSnapshotDyncode  *dyncode,
+    uint32_t                    num_dyncode) {
+  int       num_existing;
+  int       num_kept = 0;
+  uint32_t  i;
+  uint8_t   *code = NULL;
+  int       ok = 0;
+
+  NaClXMutexLock(&nap->dynamic_load_mutex);
+  num_existing = nap->num_dynamic_regions;
+  NaClXMutexUnlock(&nap->dynamic_load_mutex);
+
+  for (i = 0; i < num_dyncode; ++i) {
+    struct NaClSnapshotDyncode  *dc = &dyncode[i];
+    struct NaClDynamicRegion    *rg;
+    uintptr_t                   sysaddr;
+    int                         same;
+    int32_t                     rv;
+
+    if (dc->start < nap->dynamic_text_start ||
+        dc->size > nap->dynamic_text_end - dc->start) {
+      NaClLog(LOG_ERROR, "NaClCheckpointRestore: bad dynamic code region\n");
+      goto cleanup;
+    }
+    free(code);
+    code = malloc(dc->size);
+    if (NULL == code ||
+        !NaClCheckpointPRead(hd, code, dc->size, dc->file_offset)) {
+      NaClLog(LOG_ERROR, "NaClCheckpointRestore: cannot read code\n");
+      goto cleanup;
+    }
+    sysaddr = NaClUserToSys(nap, dc->start);
+    NaClXMutexLock(&nap->dynamic_load_mutex);
+    rg = NaClDynamicRegionFind(nap, sysaddr, dc->size);
+    same = (NULL != rg && sysaddr == rg->start && dc->size == rg->size &&
+            0 == memcmp((void *) sysaddr, code, dc->size));
+    NaClXMutexUnlock(&nap->dynamic_load_mutex);
+    if (same) {
+      ++num_kept;
+      continue;
+    }
+    rv = NaClTextDyncodeCreate(nap, dc->start, code, dc->size, NULL);
+    if (0 != rv) {
+      NaClLog(LOG_ERROR,
+              ("NaClCheckpointRestore: cannot restore code at 0x%08"
+               NACL_PRIx32", error %d\n"), dc->start, rv);
+      goto cleanup;
+    }
+  }
+  if (num_kept != num_existing) {
+    NaClLog(LOG_ERROR,
+            ("NaClCheckpointRestore: this instance has dynamic code (a"
+             " different IRT?) that is not in the snapshot\n"));
+    goto cleanup;
+  }
+  ok = 1;
+ cleanup:
+  free(code);
+  return ok;
+}
+
+/*
+ * Replaces everything above the code with the saved regions.  Called
+ * with nap->mu held.  Nothing above the code is executable, so regions
+ * asking to be are rejected: only validated code may run.  The page
+ * below the break must be mapped, since NaClSysBrk() relies on it.
+ */
+static int NaClCheckpointRestoreMemory(struct NaClApp            *nap,
+                                       struct NaClHostDesc       *hd,
+                                       struct NaClSnapshotRegion *regions,
+                                       uint32_t                  num_regions,
+                                       uint32_t                  break_addr) {
+  uint32_t  code_end = NaClCheckpointCodeEnd(nap);
+  uint64_t  space_end = (uint64_t) 1 << nap->addr_bits;
+  int       break_mapped = (break_addr - 1 < code_end);
+  uintptr_t map_result;
+  uint32_t  i;
+
+  for (i = 0; i < num_regions; ++i) {
+    struct NaClSnapshotRegion *region = &regions[i];
+    if (region->start < code_end ||
+        0 == region->size ||
+        0 != ((region->start | region->size) & (NACL_PAGESIZE - 1)) ||
+        region->size > space_end - region->start ||
+        0 != (region->prot & ~NACL_ABI_PROT_MASK) ||
+        0 != (region->prot & NACL_ABI_PROT_EXEC) ||
+        (region->has_data &&
+         0 != (region->file_offset & (NACL_MAP_PAGESIZE - 1)))) {
+      NaClLog(LOG_ERROR, "NaClCheckpointRestore: bad memory region\n");
+      return 0;
+    }
+    if (break_addr - 1 >= region->start &&
+        break_addr - 1 - region->start < region->size) {
+      break_mapped = 1;
+    }
+  }
+  if (!break_mapped) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: break is not mapped\n");
+    return 0;
+  }
+
+  /* Unmap the data, stack and mmaps this instance has set up. */
+  map_result = NaClHostDescMap(NULL, nap->effp,
+                               (void *) NaClUserToSys(nap, code_end),
+                               (size_t) (space_end - code_end),
+                               NACL_ABI_PROT_NONE,
+                               (NACL_ABI_MAP_PRIVATE |
+                                NACL_ABI_MAP_ANONYMOUS |
+                                NACL_ABI_MAP_FIXED),
+                               0);
+  if (NaClPtrIsNegErrno(&map_result)) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: cannot clear memory\n");
+    return 0;
+  }
+  NaClVmmapRemove(&nap->mem_map, code_end >> NACL_PAGESHIFT,
+                  (size_t) ((space_end - code_end) >> NACL_PAGESHIFT));
+
+  for (i = 0; i < num_regions; ++i) {
+    struct NaClSnapshotRegion *region = &regions[i];
+    if (region->has_data) {
+      map_result = NaClHostDescMap(hd, nap->effp,
+                                   (void *) NaClUserToSys(nap, region->start),
+                                   region->size,
+                                   region->prot,
+                                   NACL_ABI_MAP_PRIVATE | NACL_ABI_MAP_FIXED,
+                                   region->file_offset);
+      if (NaClPtrIsNegErrno(&map_result)) {
+        NaClLog(LOG_ERROR,
+                ("NaClCheckpointRestore: cannot map region at 0x%08"
+                 NACL_PRIx32"\n"), region->start);
+        return 0;
+      }
+    }
+    NaClVmmapAddWithOverwrite(&nap->mem_map,
+                              region->start >> NACL_PAGESHIFT,
+                              region->size >> NACL_PAGESHIFT,
+                              region->prot,
+                              NACL_ABI_MAP_PRIVATE,
+                              NULL,
+                              0,
+                              0);
+  }
+  return 1;
+}
+
+int NaClCheckpointRestore(struct NaClApp *nap, char const *path) {
+  struct NaClHostDesc         hd;
+  struct NaClSnapshotHeader   hdr;
+  struct NaClSnapshotRegion   *regions = NULL;
+  struct NaClSnapshotDyncode  *dyncode = NULL;
+  struct NaClSnapshotDesc     *descs = NULL;
+  nacl_off64_t                offset;
+  uintptr_t                   sys_sp;
+  int                         ok = 0;
+  int                         memory_ok;
+
+  if (NACL_WINDOWS) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: not supported on Windows\n");
+    return 0;
+  }
+  if (0 != NaClHostDescOpen(&hd, path, NACL_ABI_O_RDONLY, 0)) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: cannot open %s\n", path);
+    return 0;
+  }
+  if (!NaClCheckpointPRead(&hd, &hdr, sizeof hdr, 0)) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: cannot read %s\n", path);
+    goto cleanup;
+  }
+  if (!NaClCheckpointHeaderMatches(nap, &hdr)) {
+    goto cleanup;
+  }
+  /* Each record covers at least a page, so these bound the counts. */
+  if (hdr.num_regions > (1U << (nap->addr_bits - NACL_PAGESHIFT)) ||
+      hdr.num_dyncode > (1U << (nap->addr_bits - NACL_PAGESHIFT)) ||
+      hdr.num_descs > (1U << 20)) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: bad record counts\n");
+    goto cleanup;
+  }
+  regions = malloc((hdr.num_regions + 1) * sizeof *regions);
+  dyncode = malloc((hdr.num_dyncode + 1) * sizeof *dyncode);
+  descs = malloc((hdr.num_descs + 1) * sizeof *descs);
+  if (NULL == regions || NULL == dyncode || NULL == descs) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: out of memory\n");
+    goto cleanup;
+  }
+  offset = sizeof hdr;
+  if (!NaClCheckpointPRead(&hd, regions, hdr.num_regions * sizeof *regions,
+                           offset) ||
+      !NaClCheckpointPRead(&hd, dyncode, hdr.num_dyncode * sizeof *dyncode,
+                           offset + hdr.num_regions * sizeof *regions) ||
+      !NaClCheckpointPRead(&hd, descs, hdr.num_descs * sizeof *descs,
+                           offset + hdr.num_regions * sizeof *regions +
+                           hdr.num_dyncode * sizeof *dyncode)) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: snapshot is truncated\n");
+    goto cleanup;
+  }
+
+  /* Check everything that can be checked before changing memory. */
+  if (!NaClCheckpointCheckDescs(nap, descs, hdr.num_descs)) {
+    goto cleanup;
+  }
+  if (!NaClIsValidJumpTarget(nap, hdr.resume_pc)) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: bad resume address\n");
+    goto cleanup;
+  }
+  sys_sp = NaClUserToSysAddr(nap, hdr.resume_sp);
+  if (kNaClBadAddress == sys_sp) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: bad resume stack\n");
+    goto cleanup;
+  }
+  if (!NaClCheckpointRestoreDyncode(nap, &hd, dyncode, hdr.num_dyncode)) {
+    goto cleanup;
+  }
+
+  NaClXMutexLock(&nap->mu);
+  memory_ok = NaClCheckpointRestoreMemory(nap, &hd, regions, hdr.num_regions,
+                                          hdr.break_addr);
+  if (memory_ok) {
+    nap->break_addr = hdr.break_addr;
+    /*
+     * The nexe and IRT descriptors are kept, as when a debug stub is
+     * attached (see NaClCreateMainThread()).
+     */
+    nap->running = 1;
+  }
+  NaClXMutexUnlock(&nap->mu);
+  if (!memory_ok) {
+    goto cleanup;
+  }
+
+  NaClXMutexLock(&nap->exception_mu);
+  nap->exception_handler = hdr.exception_handler;
+  NaClXMutexUnlock(&nap->exception_mu);
+
+  NaClVmHoleWaitToStartThread(nap);
+  if (0 != NaClCreateAdditionalThread(nap, hdr.resume_pc, sys_sp,
+                                      hdr.tls1, hdr.tls2)) {
+    goto cleanup;
+  }
+  NaClLog(1, "NaClCheckpointRestore: resumed from %s\n", path);
+  ok = 1;
+
+ cleanup:
+  if (0 != NaClHostDescClose(&hd)) {
+    NaClLog(LOG_ERROR, "NaClCheckpointRestore: error closing %s\n", path);
+  }
+  free(regions);
+  free(dyncode);
+  free(descs);
+  return ok;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl service run-time, checkpoint system call and snapshot restore.
+ *
+ * A nexe which has finished its initialization can ask sel_ldr (run
+ * with -k <file>) to write a snapshot of its address space to a file.
+ * A later sel_ldr run with -K <file> and the same nexe, IRT and
+ * descriptor setup then starts from the snapshot instead of from the
+ * nexe's entry point, mapping the saved memory copy-on-write.
+ *
+ * The snapshot holds the data, heap, stack and mmap regions above the
+ * code, the dynamic code regions, the break, the exception handler and
+ * the numbers and types of the open descriptors.  It does not hold
+ * trusted-side descriptor state (file positions, socket buffers), write
+ * watches or exception stacks.  Snapshots are only usable by the same
+ * sel_ldr build on the same architecture.  POSIX only.
+ *
+ * Thread register state is not saved.  The calling thread must be the
+ * only untrusted thread, and it names a resume function and stack, to
+ * which the restored main thread is started with the caller's TLS
+ * values; nacl_checkpoint() in libnacl turns that back into a return
+ * via longjmp().
+ */
+
+#ifndef NATIVE_CLIENT_SERVICE_RUNTIME_SYS_CHECKPOINT_H__
+#define NATIVE_CLIENT_SERVICE_RUNTIME_SYS_CHECKPOINT_H__ 1
+
+#include "native_client/src/include/nacl_base.h"
+#include "native_client/src/include/portability.h"
+
+EXTERN_C_BEGIN
+
+struct NaClApp;
+struct NaClAppThread;
+
+/*
+ * Writes a snapshot to nap->checkpoint_file.  Fails with ENOSYS if no
+ * file was given, EBUSY if other untrusted threads are running, and
+ * ENOTSUP if a descriptor or mapping cannot be saved; each such
+ * descriptor or mapping is logged.
+ */
+int32_t NaClSysCheckpoint(struct NaClAppThread *natp,
+                          uint32_t             resume_pc,
+                          uint32_t             resume_sp);
+
+/*
+ * Replaces the memory of nap, which has had its nexe and IRT loaded
+ * and its descriptors set up, with the snapshot in path, and starts
+ * the main thread at the snapshot's resume point.  Used instead of
+ * NaClCreateMainThread().  Returns 0 and logs why if the snapshot does
+ * not match nap; nap must not be run in that case.
+ */
+int NaClCheckpointRestore(struct NaClApp *nap, char const *path) NACL_WUR;
+
+EXTERN_C_END
+
+#endif  /* NATIVE_CLIENT_SERVICE_RUNTIME_SYS_CHECKPOINT_H__ */
@@ -16,6 +16,7 @@
 #include "native_client/src/trusted/service_runtime/nacl_copy.h"
 #include "native_client/src/trusted/service_runtime/nacl_syscall_common.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
+#include "native_client/src/trusted/service_runtime/sel_ldr_filename.h"
 
 
 static size_t const kdefault_io_buffer_bytes_to_log = 64;
@@ -212,6 +213,7 @@ int32_t NaClSysRead(struct NaClAppThread  *natp,
   struct NaClApp  *nap = natp->nap;
   int32_t         retval = -NACL_ABI_EINVAL;
   ssize_t         read_result = -NACL_ABI_EINVAL;
+  uint64_t        limited_count;
   uintptr_t       sysaddr;
   struct NaClDesc *ndp;
   size_t          log_bytes;
@@ -245,11 +247,23 @@ int32_t NaClSysRead(struct NaClAppThread  *natp,
     count = INT32_MAX;
   }
 
+  /* Stop at the hard limit, as a short read. */
+  limited_count = count;
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_READ_BYTES, &limited_count);
+  if (0 != retval) {
+    NaClDescUnref(ndp);
+    goto cleanup;
+  }
+  count = (uint32_t) limited_count;
+
   NaClVmIoWillStart(nap, buf, buf + count - 1);
   read_result = (*((struct NaClDescVtbl const *) ndp->base.vtbl)->
                  Read)(ndp, (void *) sysaddr, count);
   NaClVmIoHasEnded(nap, buf, buf + count - 1);
   if (read_result > 0) {
+    NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_READ_BYTES,
+                         (uint64_t) read_result);
     NaClLog(4, "read returned %"NACL_PRIdS" bytes\n", read_result);
     log_bytes = (size_t) read_result;
     if (log_bytes > INT32_MAX) {
@@ -282,6 +296,7 @@ int32_t NaClSysWrite(struct NaClAppThread *natp,
   struct NaClApp  *nap = natp->nap;
   int32_t         retval = -NACL_ABI_EINVAL;
   ssize_t         write_result = -NACL_ABI_EINVAL;
+  uint64_t        limited_count;
   uintptr_t       sysaddr;
   char const      *ellipsis = "";
   struct NaClDesc *ndp;
@@ -330,10 +345,24 @@ int32_t NaClSysWrite(struct NaClAppThread *natp,
     count = INT32_MAX;
   }
 
+  /* Stop at the hard limit, as a short write. */
+  limited_count = count;
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_WRITE_BYTES, &limited_count);
+  if (0 != retval) {
+    NaClDescUnref(ndp);
+    goto cleanup;
+  }
+  count = (uint32_t) limited_count;
+
   NaClVmIoWillStart(nap, buf, buf + count - 1);
   write_result = (*((struct NaClDescVtbl const *) ndp->base.vtbl)->
                   Write)(ndp, (void *) sysaddr, count);
   NaClVmIoHasEnded(nap, buf, buf + count - 1);
+  if (write_result > 0) {
+    NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_WRITE_BYTES,
+                         (uint64_t) write_result);
+  }
 
   NaClDescUnref(ndp);
 
@@ -447,6 +476,7 @@ int32_t NaClSysFchdir(struct NaClAppThread *natp,
 
   retval = (*((struct NaClDescVtbl const *) ndp->base.vtbl)->
             Fchdir)(ndp);
+  NaClMountedCwdChanged();
 
   NaClDescUnref(ndp);
 cleanup:
@@ -34,6 +34,7 @@ int32_t NaClSysOpen(struct NaClAppThread  *natp,
   char                 path[NACL_CONFIG_PATH_MAX];
   nacl_host_stat_t     stbuf;
   int                  allowed_flags;
+  struct NaClDesc      *desc;
 
   NaClLog(3, "NaClSysOpen(0x%08"NACL_PRIxPTR", "
           "0x%08"NACL_PRIx32", 0x%x, 0x%x)\n",
@@ -43,10 +44,6 @@ int32_t NaClSysOpen(struct NaClAppThread  *natp,
     return -NACL_ABI_EACCES;
   }
 
-  retval = CopyHostPathInFromUser(nap, path, sizeof path, pathname);
-  if (0 != retval)
-    goto cleanup;
-
   allowed_flags = (NACL_ABI_O_ACCMODE | NACL_ABI_O_CREAT | NACL_ABI_O_EXCL
                    | NACL_ABI_O_TRUNC | NACL_ABI_O_APPEND
                    | NACL_ABI_O_DIRECTORY);
@@ -60,6 +57,29 @@ int32_t NaClSysOpen(struct NaClAppThread  *natp,
     mode &= 0600;
   }
 
+  /*
+   * Under '-m', resolve and open the path in one step where the host
+   * allows, which avoids the stat/open race described below.
+   */
+  retval = NaClMountedOpen(nap, pathname, flags, mode, &desc);
+  if ((uint32_t) -NACL_ABI_ENOSYS != retval) {
+    if (0 == retval) {
+      if (NACL_DESC_HOST_IO == NACL_VTBL(NaClDesc, desc)->typeTag &&
+          (flags & NACL_ABI_O_ACCMODE) == NACL_ABI_O_RDONLY) {
+        /* As below. */
+        NaClDescSetFlags(desc,
+                         NaClDescGetFlags(desc) | NACL_DESC_FLAGS_MMAP_EXEC_OK);
+      }
+      retval = NaClAppSetDescAvail(nap, desc);
+      NaClLog(1, "Entered into open file table at %d\n", retval);
+    }
+    goto cleanup;
+  }
+
+  retval = CopyHostPathInFromUser(nap, path, sizeof path, pathname);
+  if (0 != retval)
+    goto cleanup;
+
   /*
    * Perform a stat to determine whether the file is a directory.
    *
@@ -151,14 +171,17 @@ int32_t NaClSysStat(struct NaClAppThread  *natp,
     return -NACL_ABI_EACCES;
   }
 
-  retval = CopyHostPathInFromUser(nap, path, sizeof path, pathname);
-  if (0 != retval)
-    goto cleanup;
+  retval = NaClMountedStat(nap, pathname, &stbuf);
+  if (-NACL_ABI_ENOSYS == retval) {
+    retval = CopyHostPathInFromUser(nap, path, sizeof path, pathname);
+    if (0 != retval)
+      goto cleanup;
 
-  /*
-   * Perform a host stat.
-   */
-  retval = NaClHostDescStat(path, &stbuf);
+    /*
+     * Perform a host stat.
+     */
+    retval = NaClHostDescStat(path, &stbuf);
+  }
   if (0 == retval) {
     struct nacl_abi_stat abi_stbuf;
 
@@ -228,6 +251,7 @@ int32_t NaClSysChdir(struct NaClAppThread *natp,
     goto cleanup;
 
   retval = NaClHostDescChdir(path);
+  NaClMountedCwdChanged();
 cleanup:
   return retval;
 }
@@ -318,14 +342,20 @@ int32_t NaClSysLstat(struct NaClAppThread  *natp,
     return -NACL_ABI_EACCES;
   }
 
-  retval = CopyHostPathInFromUser(nap, path, sizeof path, pathname);
-  if (0 != retval)
-    return retval;
-
   /*
-   * Perform a host lstat directly
+   * NaClMountedStat refuses symbolic links, so it is also an lstat.
    */
-  retval = NaClHostDescLstat(path, &stbuf);
+  retval = NaClMountedStat(nap, pathname, &stbuf);
+  if (-NACL_ABI_ENOSYS == retval) {
+    retval = CopyHostPathInFromUser(nap, path, sizeof path, pathname);
+    if (0 != retval)
+      return retval;
+
+    /*
+     * Perform a host lstat directly
+     */
+    retval = NaClHostDescLstat(path, &stbuf);
+  }
   if (0 == retval) {
     struct nacl_abi_stat abi_stbuf;
 
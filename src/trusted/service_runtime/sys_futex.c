@@ -8,15 +8,34 @@
 
 #include "native_client/src/include/build_config.h"
 #include "native_client/src/trusted/service_runtime/include/sys/errno.h"
+#include "native_client/src/trusted/service_runtime/include/sys/nacl_futex_waitv.h"
 #include "native_client/src/trusted/service_runtime/nacl_app_thread.h"
 #include "native_client/src/trusted/service_runtime/nacl_copy.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
 
+/*
+ * Copies in the array of futex_waitv_abs() entries.  Returns 0 or a
+ * negated NACL_ABI_ errno value.
+ */
+static int32_t CopyInFutexWaitv(struct NaClApp *nap, uint32_t waiters_ptr,
+                                uint32_t count,
+                                struct NaClAbiFutexWaitv *waiters) {
+  if (count == 0 || count > NACL_ABI_FUTEX_WAITV_MAX) {
+    return -NACL_ABI_EINVAL;
+  }
+  if (!NaClCopyInFromUser(nap, waiters, waiters_ptr,
+                          count * sizeof(*waiters))) {
+    return -NACL_ABI_EFAULT;
+  }
+  return 0;
+}
+
 #if NACL_LINUX
 
 #include <errno.h>
 #include <linux/futex.h>
 #include <sys/syscall.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "native_client/src/include/nacl_macros.h"
@@ -32,6 +51,40 @@
 # define FUTEX_PRIVATE_FLAG 128
 #endif
 
+/*
+ * futex_waitv() was added in Linux 5.16, and older headers do not
+ * define it.  Its number is the same on all the architectures listed.
+ */
+#if !defined(__NR_futex_waitv) && (defined(__x86_64__) || \
+                                   defined(__i386__) || \
+                                   defined(__arm__) || \
+                                   defined(__aarch64__))
+# define __NR_futex_waitv 449
+#endif
+#if !defined(FUTEX2_SIZE_U32)
+# define FUTEX2_SIZE_U32 0x02
+#endif
+#if !defined(FUTEX2_PRIVATE)
+# define FUTEX2_PRIVATE FUTEX_PRIVATE_FLAG
+#endif
+
+/* Linux's struct futex_waitv, which older headers do not define. */
+struct HostFutexWaitv {
+  uint64_t val;
+  uint64_t uaddr;
+  uint32_t flags;
+  uint32_t reserved;
+};
+
+/*
+ * Linux's struct __kernel_timespec, which futex_waitv() takes on every
+ * architecture.  A 32-bit host's struct timespec has a 32-bit tv_sec.
+ */
+struct HostKernelTimespec {
+  int64_t tv_sec;
+  int64_t tv_nsec;
+};
+
 static void AbsTimeToRelTime(const struct nacl_abi_timespec *abstime,
                              const struct nacl_abi_timespec *now,
                              struct timespec *host_reltime) {
@@ -120,6 +173,71 @@ int32_t NaClSysFutexWake(struct NaClAppThread *natp, uint32_t addr,
   return woken_count;
 }
 
+int32_t NaClSysFutexWaitvAbs(struct NaClAppThread *natp, uint32_t waiters_ptr,
+                             uint32_t count, uint32_t abstime_ptr) {
+#if defined(__NR_futex_waitv)
+  struct NaClApp *nap = natp->nap;
+  struct NaClAbiFutexWaitv waiters[NACL_ABI_FUTEX_WAITV_MAX];
+  struct HostFutexWaitv host_waiters[NACL_ABI_FUTEX_WAITV_MAX];
+  struct nacl_abi_timespec abstime;
+  struct HostKernelTimespec host_abstime;
+  uint32_t index;
+  long result;
+
+  result = CopyInFutexWaitv(nap, waiters_ptr, count, waiters);
+  if (result != 0) {
+    return result;
+  }
+  for (index = 0; index < count; index++) {
+    uintptr_t sysaddr = NaClUserToSysAddrRange(nap, waiters[index].addr,
+                                               sizeof(uint32_t));
+    if (kNaClBadAddress == sysaddr) {
+      NaClLog(1, "NaClSysFutexWaitvAbs: address out of range\n");
+      return -NACL_ABI_EFAULT;
+    }
+    host_waiters[index].val = waiters[index].value;
+    host_waiters[index].uaddr = sysaddr;
+    host_waiters[index].flags = FUTEX2_SIZE_U32 | FUTEX2_PRIVATE;
+    host_waiters[index].reserved = 0;
+  }
+
+  /*
+   * Unlike FUTEX_WAIT, futex_waitv() takes an absolute timeout, so an
+   * absolute time in the past gives ETIMEDOUT without any conversion.
+   */
+  if (abstime_ptr != 0) {
+    if (!NaClCopyInFromUser(nap, &abstime, abstime_ptr, sizeof(abstime))) {
+      return -NACL_ABI_EFAULT;
+    }
+    host_abstime.tv_sec = abstime.tv_sec;
+    host_abstime.tv_nsec = abstime.tv_nsec;
+  }
+
+  result = syscall(__NR_futex_waitv,
+                   host_waiters,
+                   count,
+                   0,
+                   (abstime_ptr != 0 ? &host_abstime : NULL),
+                   CLOCK_REALTIME);
+  if (result < 0) {
+    /* As in NaClSysFutexWaitAbs(), a fault here would be a crash elsewhere. */
+    if (errno == EFAULT) {
+      NaClLog(LOG_FATAL,
+              "NaClSysFutexWaitvAbs: futex_waitv syscall returned EFAULT; "
+              "aborting for consistency\n");
+    }
+    return -NaClXlateErrno(errno);
+  }
+  return (int32_t) result;
+#else
+  UNREFERENCED_PARAMETER(natp);
+  UNREFERENCED_PARAMETER(waiters_ptr);
+  UNREFERENCED_PARAMETER(count);
+  UNREFERENCED_PARAMETER(abstime_ptr);
+  return -NACL_ABI_ENOSYS;
+#endif
+}
+
 #else
 
 /*
@@ -155,30 +273,32 @@ static void ListRemoveNode(struct NaClListNode *node) {
 }
 
 /*
- * Given a pointer to a NaClAppThread's futex_wait_list_node, this
- * returns a pointer to the NaClAppThread.
+ * Given a pointer to a NaClFutexWaitNode's list_node, this returns a
+ * pointer to the NaClFutexWaitNode.
  */
-static struct NaClAppThread *GetNaClAppThreadFromListNode(
+static struct NaClFutexWaitNode *GetFutexWaitNodeFromListNode(
     struct NaClListNode *node) {
-  return (struct NaClAppThread *)
+  return (struct NaClFutexWaitNode *)
          ((uintptr_t) node -
-          offsetof(struct NaClAppThread, futex_wait_list_node));
+          offsetof(struct NaClFutexWaitNode, list_node));
 }
 
-int32_t NaClSysFutexWaitAbs(struct NaClAppThread *natp, uint32_t addr,
-                            uint32_t value, uint32_t abstime_ptr) {
+/*
+ * Waits on the untrusted addresses in |nodes|, where nodes[i] is
+ * expected to contain values[i].  Returns the index of the node that
+ * was woken, or a negated NACL_ABI_ errno value.
+ */
+static int32_t FutexWaitNodes(struct NaClAppThread *natp,
+                              struct NaClFutexWaitNode *nodes,
+                              const uint32_t *values,
+                              uint32_t count,
+                              const struct nacl_abi_timespec *abstime) {
   struct NaClApp *nap = natp->nap;
-  struct nacl_abi_timespec abstime;
   uint32_t read_value;
+  uint32_t index;
   int32_t result;
   NaClSyncStatus sync_status;
 
-  if (abstime_ptr != 0) {
-    if (!NaClCopyInFromUser(nap, &abstime, abstime_ptr, sizeof(abstime))) {
-      return -NACL_ABI_EFAULT;
-    }
-  }
-
   NaClXMutexLock(&nap->futex_wait_list_mu);
 
   /*
@@ -186,29 +306,36 @@ int32_t NaClSysFutexWaitAbs(struct NaClAppThread *natp, uint32_t addr,
    * mutex nap->mu.  nap->mu may be claimed after
    * nap->futex_wait_list_mu but never before it.
    */
-  if (!NaClCopyInFromUser(nap, &read_value, addr, sizeof(uint32_t))) {
-    result = -NACL_ABI_EFAULT;
-    goto cleanup;
-  }
-  if (read_value != value) {
-    result = -NACL_ABI_EWOULDBLOCK;
-    goto cleanup;
+  for (index = 0; index < count; index++) {
+    if (!NaClCopyInFromUser(nap, &read_value, nodes[index].addr,
+                            sizeof(uint32_t))) {
+      result = -NACL_ABI_EFAULT;
+      goto cleanup;
+    }
+    if (read_value != values[index]) {
+      result = -NACL_ABI_EWOULDBLOCK;
+      goto cleanup;
+    }
   }
 
   /* Add the current thread onto the futex wait list. */
-  natp->futex_wait_addr = addr;
-  ListAddNodeAtEnd(&natp->futex_wait_list_node, &nap->futex_wait_list_head);
+  for (index = 0; index < count; index++) {
+    nodes[index].natp = natp;
+    ListAddNodeAtEnd(&nodes[index].list_node, &nap->futex_wait_list_head);
+  }
+  natp->futex_wait_nodes = nodes;
+  natp->futex_wait_count = count;
 
-  if (abstime_ptr == 0) {
+  if (abstime == NULL) {
     sync_status = NaClCondVarWait(
         &natp->futex_condvar, &nap->futex_wait_list_mu);
   } else {
     sync_status = NaClCondVarTimedWaitAbsolute(
-        &natp->futex_condvar, &nap->futex_wait_list_mu, &abstime);
+        &natp->futex_condvar, &nap->futex_wait_list_mu, abstime);
   }
   result = -NaClXlateNaClSyncStatus(sync_status);
 
-  if (natp->futex_wait_list_node.next == NULL) {
+  if (natp->futex_wait_nodes == NULL) {
     /*
      * This thread was woken by NaClSysFutexWake(), which removed this
      * thread from the wait queue.  It might also be the case that
@@ -227,25 +354,75 @@ int32_t NaClSysFutexWaitAbs(struct NaClAppThread *natp, uint32_t addr,
      *
      * See https://bugs.chromium.org/p/nativeclient/issues/detail?id=4373
      */
-    result = 0;
+    result = (int32_t) natp->futex_woken_index;
   } else {
     /*
      * A timeout or spurious wakeup occurred, so NaClSysFutexWake() did not
      * remove this thread from the wait queue, so we must remove it from
      * the wait queue ourselves.
      */
-    ListRemoveNode(&natp->futex_wait_list_node);
+    for (index = 0; index < count; index++) {
+      ListRemoveNode(&nodes[index].list_node);
+    }
+    natp->futex_wait_nodes = NULL;
   }
-  /* Clear these fields to prevent their accidental use. */
-  natp->futex_wait_list_node.next = NULL;
-  natp->futex_wait_list_node.prev = NULL;
-  natp->futex_wait_addr = 0;
+  natp->futex_wait_count = 0;
 
 cleanup:
   NaClXMutexUnlock(&nap->futex_wait_list_mu);
   return result;
 }
 
+int32_t NaClSysFutexWaitAbs(struct NaClAppThread *natp, uint32_t addr,
+                            uint32_t value, uint32_t abstime_ptr) {
+  struct nacl_abi_timespec abstime;
+
+  if (abstime_ptr != 0) {
+    if (!NaClCopyInFromUser(natp->nap, &abstime, abstime_ptr,
+                            sizeof(abstime))) {
+      return -NACL_ABI_EFAULT;
+    }
+  }
+
+  natp->futex_wait_node.addr = addr;
+  return FutexWaitNodes(natp, &natp->futex_wait_node, &value, 1,
+                        abstime_ptr != 0 ? &abstime : NULL);
+}
+
+int32_t NaClSysFutexWaitvAbs(struct NaClAppThread *natp, uint32_t waiters_ptr,
+                             uint32_t count, uint32_t abstime_ptr) {
+  struct NaClAbiFutexWaitv waiters[NACL_ABI_FUTEX_WAITV_MAX];
+  uint32_t values[NACL_ABI_FUTEX_WAITV_MAX];
+  struct NaClFutexWaitNode *nodes;
+  struct nacl_abi_timespec abstime;
+  uint32_t index;
+  int32_t result;
+
+  result = CopyInFutexWaitv(natp->nap, waiters_ptr, count, waiters);
+  if (result != 0) {
+    return result;
+  }
+  if (abstime_ptr != 0) {
+    if (!NaClCopyInFromUser(natp->nap, &abstime, abstime_ptr,
+                            sizeof(abstime))) {
+      return -NACL_ABI_EFAULT;
+    }
+  }
+
+  nodes = malloc(count * sizeof(*nodes));
+  if (NULL == nodes) {
+    return -NACL_ABI_ENOMEM;
+  }
+  for (index = 0; index < count; index++) {
+    nodes[index].addr = waiters[index].addr;
+    values[index] = waiters[index].value;
+  }
+  result = FutexWaitNodes(natp, nodes, values, count,
+                          abstime_ptr != 0 ? &abstime : NULL);
+  free(nodes);
+  return result;
+}
+
 int32_t NaClSysFutexWake(struct NaClAppThread *natp, uint32_t addr,
                          uint32_t nwake) {
   struct NaClApp *nap = natp->nap;
@@ -258,19 +435,29 @@ int32_t NaClSysFutexWake(struct NaClAppThread *natp, uint32_t addr,
   entry = nap->futex_wait_list_head.next;
   while (nwake > 0 && entry != &nap->futex_wait_list_head) {
     struct NaClListNode *next = entry->next;
-    struct NaClAppThread *waiting_thread = GetNaClAppThreadFromListNode(entry);
+    struct NaClFutexWaitNode *node = GetFutexWaitNodeFromListNode(entry);
+
+    if (node->addr == addr) {
+      struct NaClAppThread *waiting_thread = node->natp;
+      uint32_t index;
 
-    if (waiting_thread->futex_wait_addr == addr) {
-      ListRemoveNode(entry);
       /*
-       * Mark the thread as having been removed from the wait queue:
-       * tell it not to try to remove itself from the queue.
+       * Take all of the thread's nodes off the wait queue, not just
+       * this one, stepping |next| past any that we remove.  The thread
+       * does not try to remove them itself once futex_wait_nodes is
+       * cleared.
        */
-      entry->next = NULL;
-
-      /* Also clear these fields to prevent their accidental use. */
-      entry->prev = NULL;
-      waiting_thread->futex_wait_addr = 0;
+      for (index = 0; index < waiting_thread->futex_wait_count; index++) {
+        struct NaClListNode *sibling =
+            &waiting_thread->futex_wait_nodes[index].list_node;
+        if (sibling == next) {
+          next = next->next;
+        }
+        ListRemoveNode(sibling);
+      }
+      waiting_thread->futex_woken_index =
+          (uint32_t) (node - waiting_thread->futex_wait_nodes);
+      waiting_thread->futex_wait_nodes = NULL;
 
       NaClXCondVarSignal(&waiting_thread->futex_condvar);
       woken_count++;
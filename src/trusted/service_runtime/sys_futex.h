@@ -20,12 +20,32 @@ struct NaClListNode {
   struct NaClListNode *prev;
 };
 
+/*
+ * One untrusted address that a thread is waiting on.  A thread waiting
+ * in futex_waitv_abs() has one of these per address in the futex wait
+ * list.
+ */
+struct NaClFutexWaitNode {
+  struct NaClListNode       list_node;
+  struct NaClAppThread      *natp;
+  uint32_t                  addr;
+};
+
 int32_t NaClSysFutexWaitAbs(struct NaClAppThread *natp, uint32_t addr,
                             uint32_t value, uint32_t abstime_ptr);
 
 int32_t NaClSysFutexWake(struct NaClAppThread *natp, uint32_t addr,
                          uint32_t nwake);
 
+/*
+ * Waits until any of the |count| futex words described by the array
+ * of struct NaClAbiFutexWaitv at |waiters_ptr| is woken, and returns
+ * the index of the one that was.  Fails with EWOULDBLOCK without
+ * waiting if any word does not hold its expected value.
+ */
+int32_t NaClSysFutexWaitvAbs(struct NaClAppThread *natp, uint32_t waiters_ptr,
+                             uint32_t count, uint32_t abstime_ptr);
+
 EXTERN_C_END
 
 #endif
@@ -6,6 +6,7 @@
 
 #include "native_client/src/trusted/service_runtime/sys_imc.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "native_client/src/trusted/desc/nacl_desc_imc.h"
@@ -127,6 +128,184 @@ int32_t NaClSysImcConnect(struct NaClAppThread *natp,
   return retval;
 }
 
+/*
+ * Validates the lengths in *nanimh, which must already have been
+ * copied in from untrusted memory, then copies in its IOV array to
+ * naiov and translates it to system addresses in iov.  Returns 0 or
+ * a negated errno value.
+ */
+static int32_t NaClImcCopyInIov(struct NaClApp                      *nap,
+                                struct NaClAbiNaClImcMsgHdr const   *nanimh,
+                                struct NaClAbiNaClImcMsgIoVec       *naiov,
+                                struct NaClImcMsgIoVec              *iov) {
+  uintptr_t sysaddr;
+  size_t    i;
+
+  /*
+   * Some of these checks duplicate checks that will be done in the
+   * nrd xfer library, but it is better to check before doing the
+   * address translation of memory/descriptor vectors if those vectors
+   * might be too long.  Plus, we need to copy and validate vectors
+   * for TOCvTOU race protection, and we must prevent overflows.  The
+   * nrd xfer library's checks should never fire when called from the
+   * service runtime, but the nrd xfer library might be called from
+   * other code.
+   */
+  if (nanimh->iov_length > NACL_ABI_IMC_IOVEC_MAX) {
+    NaClLog(4, "gather/scatter array too large: %"NACL_PRIdNACL_SIZE"\n",
+            nanimh->iov_length);
+    return -NACL_ABI_EINVAL;
+  }
+  if (nanimh->desc_length > NACL_ABI_IMC_USER_DESC_MAX) {
+    NaClLog(4, "handle vector too long: %"NACL_PRIdNACL_SIZE"\n",
+            nanimh->desc_length);
+    return -NACL_ABI_EINVAL;
+  }
+
+  if (nanimh->iov_length > 0) {
+    if (!NaClCopyInFromUser(nap, naiov, (uintptr_t) nanimh->iov,
+                            (nanimh->iov_length * sizeof naiov[0]))) {
+      NaClLog(4, "gather/scatter array not in user address space\n");
+      return -NACL_ABI_EFAULT;
+    }
+
+    /*
+     * Convert every IOV base from user to system address, validate
+     * range of bytes are really in user address space.
+     */
+    for (i = 0; i < nanimh->iov_length; ++i) {
+      sysaddr = NaClUserToSysAddrRange(nap,
+                                       (uintptr_t) naiov[i].base,
+                                       naiov[i].length);
+      if (kNaClBadAddress == sysaddr) {
+        NaClLog(4, "iov number %"NACL_PRIuS" not entirely in user space\n", i);
+        return -NACL_ABI_EFAULT;
+      }
+      iov[i].base = (void *) sysaddr;
+      iov[i].length = naiov[i].length;
+    }
+  }
+  return 0;
+}
+
+/*
+ * Looks up the descriptors named in nanimh->descv for sending.
+ * kern_desc must be zeroed on entry; entries that were filled in must
+ * be unref'd by the caller, even on failure.
+ */
+static int32_t NaClImcCopyInSendDescs(struct NaClApp                    *nap,
+                                      struct NaClAbiNaClImcMsgHdr const *nanimh,
+                                      struct NaClDesc                   **kern_desc) {
+  int32_t usr_desc[NACL_ABI_IMC_USER_DESC_MAX];
+  size_t  i;
+
+  if (0 == nanimh->desc_length) {
+    return 0;
+  }
+  if (!NaClCopyInFromUser(nap, usr_desc, nanimh->descv,
+                          nanimh->desc_length * sizeof usr_desc[0])) {
+    return -NACL_ABI_EFAULT;
+  }
+
+  for (i = 0; i < nanimh->desc_length; ++i) {
+    if (kKnownInvalidDescNumber == usr_desc[i]) {
+      kern_desc[i] = (struct NaClDesc *) NaClDescInvalidMake();
+    } else {
+      /* NaCl modules are ILP32, so this works on ILP32 and LP64 systems */
+      kern_desc[i] = NaClAppGetDesc(nap, usr_desc[i]);
+    }
+    if (NULL == kern_desc[i]) {
+      return -NACL_ABI_EBADF;
+    }
+  }
+  return 0;
+}
+
+/* lock user memory ranges in naiov */
+static void NaClImcVmIoWillStart(struct NaClApp                      *nap,
+                                 struct NaClAbiNaClImcMsgIoVec const *naiov,
+                                 size_t                              count) {
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    NaClVmIoWillStart(nap,
+                      naiov[i].base,
+                      naiov[i].base + naiov[i].length - 1);
+  }
+}
+
+/* unlock user memory ranges in naiov */
+static void NaClImcVmIoHasEnded(struct NaClApp                      *nap,
+                                struct NaClAbiNaClImcMsgIoVec const *naiov,
+                                size_t                              count) {
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    NaClVmIoHasEnded(nap,
+                     naiov[i].base,
+                     naiov[i].base + naiov[i].length - 1);
+  }
+}
+
+/*
+ * Installs the descriptors received in recv_hdr into the descriptor
+ * table and copies their numbers out to nanimh->descv, updating
+ * nanimh's flags and desc_length for copying back out to the user.
+ * Descriptors that do not fit are dropped, and every entry of
+ * new_desc that is consumed is set to NULL.
+ */
+static void NaClImcInstallRecvDescs(struct NaClApp              *nap,
+                                    struct NaClAbiNaClImcMsgHdr *nanimh,
+                                    struct NaClImcTypedMsgHdr   *recv_hdr,
+                                    struct NaClDesc             **new_desc,
+                                    struct NaClDesc             *invalid_desc) {
+  int32_t         usr_desc[NACL_ABI_IMC_USER_DESC_MAX];
+  nacl_abi_size_t num_user_desc;
+  size_t          i;
+
+  /*
+   * NB: recv_hdr->flags may contain NACL_ABI_MESSAGE_TRUNCATED and/or
+   * NACL_ABI_HANDLES_TRUNCATED.
+   */
+
+  nanimh->flags = recv_hdr->flags;
+
+  /*
+   * Now internalize the NaClHandles as NaClDesc objects.
+   */
+  num_user_desc = recv_hdr->ndesc_length;
+
+  if (nanimh->desc_length < num_user_desc) {
+    nanimh->flags |= NACL_ABI_RECVMSG_DESC_TRUNCATED;
+    for (i = nanimh->desc_length; i < num_user_desc; ++i) {
+      NaClDescUnref(new_desc[i]);
+      new_desc[i] = NULL;
+    }
+    num_user_desc = nanimh->desc_length;
+  }
+
+  /* prepare to write out to user space the descriptor numbers */
+  for (i = 0; i < num_user_desc; ++i) {
+    if (invalid_desc == new_desc[i]) {
+      usr_desc[i] = kKnownInvalidDescNumber;
+      NaClDescUnref(new_desc[i]);
+    } else {
+      usr_desc[i] = NaClAppSetDescAvail(nap, new_desc[i]);
+    }
+    new_desc[i] = NULL;
+  }
+  if (0 != num_user_desc &&
+      !NaClCopyOutToUser(nap, (uintptr_t) nanimh->descv, usr_desc,
+                         num_user_desc * sizeof usr_desc[0])) {
+    NaClLog(LOG_FATAL,
+            ("NaClSysImcRecvMsg: in/out ptr (descv %"NACL_PRIxPTR
+             ") became invalid at copyout?\n"),
+            (uintptr_t) nanimh->descv);
+  }
+
+  nanimh->desc_length = num_user_desc;
+}
+
 /*
  * This function converts addresses from user addresses to system
  * addresses, copying into kernel space as needed to avoid TOCvTOU
@@ -139,12 +318,10 @@ int32_t NaClSysImcSendmsg(struct NaClAppThread *natp,
   struct NaClApp                *nap = natp->nap;
   int32_t                       retval = -NACL_ABI_EINVAL;
   ssize_t                       ssize_retval;
-  uintptr_t                     sysaddr;
   /* copy of user-space data for validation */
   struct NaClAbiNaClImcMsgHdr   kern_nanimh;
   struct NaClAbiNaClImcMsgIoVec kern_naiov[NACL_ABI_IMC_IOVEC_MAX];
   struct NaClImcMsgIoVec        kern_iov[NACL_ABI_IMC_IOVEC_MAX];
-  int32_t                       usr_desc[NACL_ABI_IMC_USER_DESC_MAX];
   /* kernel-side representatin of descriptors */
   struct NaClDesc               *kern_desc[NACL_ABI_IMC_USER_DESC_MAX];
   struct NaClImcTypedMsgHdr     kern_msg_hdr;
@@ -163,48 +340,11 @@ int32_t NaClSysImcSendmsg(struct NaClAppThread *natp,
   }
   /* copy before validating contents */
 
-  /*
-   * Some of these checks duplicate checks that will be done in the
-   * nrd xfer library, but it is better to check before doing the
-   * address translation of memory/descriptor vectors if those vectors
-   * might be too long.  Plus, we need to copy and validate vectors
-   * for TOCvTOU race protection, and we must prevent overflows.  The
-   * nrd xfer library's checks should never fire when called from the
-   * service runtime, but the nrd xfer library might be called from
-   * other code.
-   */
-  if (kern_nanimh.iov_length > NACL_ABI_IMC_IOVEC_MAX) {
-    NaClLog(4, "gather/scatter array too large\n");
-    retval = -NACL_ABI_EINVAL;
-    goto cleanup_leave;
-  }
-  if (kern_nanimh.desc_length > NACL_ABI_IMC_USER_DESC_MAX) {
-    NaClLog(4, "handle vector too long\n");
-    retval = -NACL_ABI_EINVAL;
+  retval = NaClImcCopyInIov(nap, &kern_nanimh, kern_naiov, kern_iov);
+  if (0 != retval) {
     goto cleanup_leave;
   }
 
-  if (kern_nanimh.iov_length > 0) {
-    if (!NaClCopyInFromUser(nap, kern_naiov, (uintptr_t) kern_nanimh.iov,
-                            (kern_nanimh.iov_length * sizeof kern_naiov[0]))) {
-      NaClLog(4, "gather/scatter array not in user address space\n");
-      retval = -NACL_ABI_EFAULT;
-      goto cleanup_leave;
-    }
-
-    for (i = 0; i < kern_nanimh.iov_length; ++i) {
-      sysaddr = NaClUserToSysAddrRange(nap,
-                                       (uintptr_t) kern_naiov[i].base,
-                                       kern_naiov[i].length);
-      if (kNaClBadAddress == sysaddr) {
-        retval = -NACL_ABI_EFAULT;
-        goto cleanup_leave;
-      }
-      kern_iov[i].base = (void *) sysaddr;
-      kern_iov[i].length = kern_naiov[i].length;
-    }
-  }
-
   ndp = NaClAppGetDesc(nap, d);
   if (NULL == ndp) {
     retval = -NACL_ABI_EBADF;
@@ -215,51 +355,27 @@ int32_t NaClSysImcSendmsg(struct NaClAppThread *natp,
    * make things easier for cleaup exit processing
    */
   memset(kern_desc, 0, sizeof kern_desc);
-  retval = -NACL_ABI_EINVAL;
 
   kern_msg_hdr.iov = kern_iov;
   kern_msg_hdr.iov_length = kern_nanimh.iov_length;
 
-  if (0 == kern_nanimh.desc_length) {
-    kern_msg_hdr.ndescv = 0;
-    kern_msg_hdr.ndesc_length = 0;
-  } else {
-    if (!NaClCopyInFromUser(nap, usr_desc, kern_nanimh.descv,
-                            kern_nanimh.desc_length * sizeof usr_desc[0])) {
-      retval = -NACL_ABI_EFAULT;
-      goto cleanup;
-    }
-
-    for (i = 0; i < kern_nanimh.desc_length; ++i) {
-      if (kKnownInvalidDescNumber == usr_desc[i]) {
-        kern_desc[i] = (struct NaClDesc *) NaClDescInvalidMake();
-      } else {
-        /* NaCl modules are ILP32, so this works on ILP32 and LP64 systems */
-        kern_desc[i] = NaClAppGetDesc(nap, usr_desc[i]);
-      }
-      if (NULL == kern_desc[i]) {
-        retval = -NACL_ABI_EBADF;
-        goto cleanup;
-      }
-    }
-    kern_msg_hdr.ndescv = kern_desc;
-    kern_msg_hdr.ndesc_length = kern_nanimh.desc_length;
+  retval = NaClImcCopyInSendDescs(nap, &kern_nanimh, kern_desc);
+  if (0 != retval) {
+    goto cleanup;
   }
+  kern_msg_hdr.ndescv = 0 == kern_nanimh.desc_length ? NULL : kern_desc;
+  kern_msg_hdr.ndesc_length = kern_nanimh.desc_length;
   kern_msg_hdr.flags = kern_nanimh.flags;
 
-  /* lock user memory ranges in kern_naiov */
-  for (i = 0; i < kern_nanimh.iov_length; ++i) {
-    NaClVmIoWillStart(nap,
-                      kern_naiov[i].base,
-                      kern_naiov[i].base + kern_naiov[i].length - 1);
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_IMC_SENT, NULL);
+  if (0 != retval) {
+    goto cleanup;
   }
+
+  NaClImcVmIoWillStart(nap, kern_naiov, kern_nanimh.iov_length);
   ssize_retval = NACL_VTBL(NaClDesc, ndp)->SendMsg(ndp, &kern_msg_hdr, flags);
-  /* unlock user memory ranges in kern_naiov */
-  for (i = 0; i < kern_nanimh.iov_length; ++i) {
-    NaClVmIoHasEnded(nap,
-                     kern_naiov[i].base,
-                     kern_naiov[i].base + kern_naiov[i].length - 1);
-  }
+  NaClImcVmIoHasEnded(nap, kern_naiov, kern_nanimh.iov_length);
 
   if (NaClSSizeIsNegErrno(&ssize_retval)) {
     /*
@@ -288,6 +404,7 @@ int32_t NaClSysImcSendmsg(struct NaClAppThread *natp,
   } else {
     /* cast is safe due to range checks above */
     retval = (int32_t)ssize_retval;
+    NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_IMC_SENT, 1);
   }
 
 cleanup:
@@ -316,10 +433,8 @@ int32_t NaClSysImcRecvmsg(struct NaClAppThread *natp,
   struct NaClAbiNaClImcMsgHdr           kern_nanimh;
   struct NaClAbiNaClImcMsgIoVec         kern_naiov[NACL_ABI_IMC_IOVEC_MAX];
   struct NaClImcMsgIoVec                kern_iov[NACL_ABI_IMC_IOVEC_MAX];
-  int32_t                               usr_desc[NACL_ABI_IMC_USER_DESC_MAX];
   struct NaClImcTypedMsgHdr             recv_hdr;
   struct NaClDesc                       *new_desc[NACL_ABI_IMC_DESC_MAX];
-  nacl_abi_size_t                       num_user_desc;
   struct NaClDesc                       *invalid_desc = NULL;
 
   NaClLog(3,
@@ -338,49 +453,15 @@ int32_t NaClSysImcRecvmsg(struct NaClAppThread *natp,
   }
   /* copy before validating */
 
-  if (kern_nanimh.iov_length > NACL_ABI_IMC_IOVEC_MAX) {
-    NaClLog(4, "gather/scatter array too large: %"NACL_PRIdNACL_SIZE"\n",
-            kern_nanimh.iov_length);
-    retval = -NACL_ABI_EINVAL;
-    goto cleanup_leave;
-  }
-  if (kern_nanimh.desc_length > NACL_ABI_IMC_USER_DESC_MAX) {
-    NaClLog(4, "handle vector too long: %"NACL_PRIdNACL_SIZE"\n",
-            kern_nanimh.desc_length);
-    retval = -NACL_ABI_EINVAL;
+  /*
+   * Copy IOV array into kernel space.  Validate this snapshot and do
+   * user->kernel address conversions on this snapshot.
+   */
+  retval = NaClImcCopyInIov(nap, &kern_nanimh, kern_naiov, kern_iov);
+  if (0 != retval) {
     goto cleanup_leave;
   }
 
-  if (kern_nanimh.iov_length > 0) {
-    /*
-     * Copy IOV array into kernel space.  Validate this snapshot and do
-     * user->kernel address conversions on this snapshot.
-     */
-    if (!NaClCopyInFromUser(nap, kern_naiov, (uintptr_t) kern_nanimh.iov,
-                            (kern_nanimh.iov_length * sizeof kern_naiov[0]))) {
-      NaClLog(4, "gather/scatter array not in user address space\n");
-      retval = -NACL_ABI_EFAULT;
-      goto cleanup_leave;
-    }
-    /*
-     * Convert every IOV base from user to system address, validate
-     * range of bytes are really in user address space.
-     */
-
-    for (i = 0; i < kern_nanimh.iov_length; ++i) {
-      sysaddr = NaClUserToSysAddrRange(nap,
-                                       (uintptr_t) kern_naiov[i].base,
-                                       kern_naiov[i].length);
-      if (kNaClBadAddress == sysaddr) {
-        NaClLog(4, "iov number %"NACL_PRIuS" not entirely in user space\n", i);
-        retval = -NACL_ABI_EFAULT;
-        goto cleanup_leave;
-      }
-      kern_iov[i].base = (void *) sysaddr;
-      kern_iov[i].length = kern_naiov[i].length;
-    }
-  }
-
   if (kern_nanimh.desc_length > 0) {
     sysaddr = NaClUserToSysAddrRange(nap,
                                      (uintptr_t) kern_nanimh.descv,
@@ -407,19 +488,15 @@ int32_t NaClSysImcRecvmsg(struct NaClAppThread *natp,
 
   recv_hdr.flags = 0;  /* just to make it obvious; IMC will clear it for us */
 
-  /* lock user memory ranges in kern_naiov */
-  for (i = 0; i < kern_nanimh.iov_length; ++i) {
-    NaClVmIoWillStart(nap,
-                      kern_naiov[i].base,
-                      kern_naiov[i].base + kern_naiov[i].length - 1);
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_IMC_RECEIVED, NULL);
+  if (0 != retval) {
+    goto cleanup;
   }
+
+  NaClImcVmIoWillStart(nap, kern_naiov, kern_nanimh.iov_length);
   ssize_retval = NACL_VTBL(NaClDesc, ndp)->RecvMsg(ndp, &recv_hdr, flags);
-  /* unlock user memory ranges in kern_naiov */
-  for (i = 0; i < kern_nanimh.iov_length; ++i) {
-    NaClVmIoHasEnded(nap,
-                     kern_naiov[i].base,
-                     kern_naiov[i].base + kern_naiov[i].length - 1);
-  }
+  NaClImcVmIoHasEnded(nap, kern_naiov, kern_nanimh.iov_length);
   /*
    * retval is number of user payload bytes received and excludes the
    * header bytes.
@@ -438,49 +515,12 @@ int32_t NaClSysImcRecvmsg(struct NaClAppThread *natp,
     /* cast is safe due to range check above */
     retval = (int32_t) ssize_retval;
   }
-
-  /*
-   * NB: recv_hdr.flags may contain NACL_ABI_MESSAGE_TRUNCATED and/or
-   * NACL_ABI_HANDLES_TRUNCATED.
-   */
-
-  kern_nanimh.flags = recv_hdr.flags;
-
-  /*
-   * Now internalize the NaClHandles as NaClDesc objects.
-   */
-  num_user_desc = recv_hdr.ndesc_length;
-
-  if (kern_nanimh.desc_length < num_user_desc) {
-    kern_nanimh.flags |= NACL_ABI_RECVMSG_DESC_TRUNCATED;
-    for (i = kern_nanimh.desc_length; i < num_user_desc; ++i) {
-      NaClDescUnref(new_desc[i]);
-      new_desc[i] = NULL;
-    }
-    num_user_desc = kern_nanimh.desc_length;
-  }
+  NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_IMC_RECEIVED, 1);
 
   invalid_desc = (struct NaClDesc *) NaClDescInvalidMake();
-  /* prepare to write out to user space the descriptor numbers */
-  for (i = 0; i < num_user_desc; ++i) {
-    if (invalid_desc == new_desc[i]) {
-      usr_desc[i] = kKnownInvalidDescNumber;
-      NaClDescUnref(new_desc[i]);
-    } else {
-      usr_desc[i] = NaClAppSetDescAvail(nap, new_desc[i]);
-    }
-    new_desc[i] = NULL;
-  }
-  if (0 != num_user_desc &&
-      !NaClCopyOutToUser(nap, (uintptr_t) kern_nanimh.descv, usr_desc,
-                         num_user_desc * sizeof usr_desc[0])) {
-    NaClLog(LOG_FATAL,
-            ("NaClSysImcRecvMsg: in/out ptr (descv %"NACL_PRIxPTR
-             ") became invalid at copyout?\n"),
-            (uintptr_t) kern_nanimh.descv);
-  }
+  NaClImcInstallRecvDescs(nap, &kern_nanimh, &recv_hdr, new_desc,
+                          invalid_desc);
 
-  kern_nanimh.desc_length = num_user_desc;
   if (!NaClCopyOutToUser(nap, nanimhp, &kern_nanimh, sizeof kern_nanimh)) {
     NaClLog(LOG_FATAL,
             "NaClSysImcRecvMsg: in/out ptr (iov) became"
@@ -503,6 +543,328 @@ cleanup_leave:
   return retval;
 }
 
+/*
+ * Per-message state for the batched send/receive syscalls.  naiov and
+ * iov point into the same allocation as the state array, and are sized
+ * by the message's iov_length, so that a batch of small messages does
+ * not cost NACL_ABI_IMC_IOVEC_MAX entries each.
+ */
+struct NaClImcMMsgState {
+  struct NaClAbiNaClImcMsgIoVec *naiov;
+  struct NaClImcMsgIoVec        *iov;
+  struct NaClDesc               *desc[NACL_ABI_IMC_DESC_MAX];
+};
+
+/*
+ * Copies in the user's array of vlen NaClAbiNaClImcMMsgHdr and
+ * allocates the matching kernel-side state.  Returns 0 or a negated
+ * errno value; the caller frees *kern_mmsg, *state and *typed in
+ * either case.
+ */
+static int32_t NaClImcMMsgCopyIn(struct NaClApp                 *nap,
+                                 uint32_t                       msgvec,
+                                 uint32_t                       vlen,
+                                 struct NaClAbiNaClImcMMsgHdr   **kern_mmsg,
+                                 struct NaClImcMMsgState        **state,
+                                 struct NaClImcTypedMsgHdr      **typed,
+                                 size_t                         **sizes) {
+  size_t                        total_iov = 0;
+  struct NaClImcMsgIoVec        *iov;
+  struct NaClAbiNaClImcMsgIoVec *naiov;
+  size_t                        i;
+
+  *kern_mmsg = malloc(vlen * sizeof **kern_mmsg);
+  *typed = malloc(vlen * sizeof **typed);
+  *sizes = malloc(vlen * sizeof **sizes);
+  if (NULL == *kern_mmsg || NULL == *typed || NULL == *sizes) {
+    return -NACL_ABI_ENOMEM;
+  }
+  if (!NaClCopyInFromUser(nap, *kern_mmsg, msgvec, vlen * sizeof **kern_mmsg)) {
+    NaClLog(4, "NaClImcMMsgHdr array not in user address space\n");
+    return -NACL_ABI_EFAULT;
+  }
+  for (i = 0; i < vlen; ++i) {
+    nacl_abi_size_t iov_length = (*kern_mmsg)[i].msg_hdr.iov_length;
+    if (iov_length > NACL_ABI_IMC_IOVEC_MAX) {
+      NaClLog(4, "gather/scatter array too large: %"NACL_PRIdNACL_SIZE"\n",
+              iov_length);
+      return -NACL_ABI_EINVAL;
+    }
+    total_iov += iov_length;
+  }
+  /*
+   * The iov entries go first after the state array, since they hold
+   * pointers; vlen and total_iov are small enough that this cannot
+   * overflow.
+   */
+  *state = calloc(1, vlen * sizeof **state
+                  + total_iov * (sizeof *iov + sizeof *naiov));
+  if (NULL == *state) {
+    return -NACL_ABI_ENOMEM;
+  }
+  iov = (struct NaClImcMsgIoVec *) (*state + vlen);
+  naiov = (struct NaClAbiNaClImcMsgIoVec *) (iov + total_iov);
+  for (i = 0; i < vlen; ++i) {
+    (*state)[i].iov = iov;
+    (*state)[i].naiov = naiov;
+    iov += (*kern_mmsg)[i].msg_hdr.iov_length;
+    naiov += (*kern_mmsg)[i].msg_hdr.iov_length;
+  }
+  return 0;
+}
+
+static void NaClImcMMsgFree(struct NaClAbiNaClImcMMsgHdr *kern_mmsg,
+                            struct NaClImcMMsgState      *state,
+                            uint32_t                     vlen,
+                            struct NaClImcTypedMsgHdr    *typed,
+                            size_t                       *sizes) {
+  size_t i;
+  size_t j;
+
+  if (NULL != state) {
+    for (i = 0; i < vlen; ++i) {
+      for (j = 0; j < NACL_ARRAY_SIZE(state[i].desc); ++j) {
+        NaClDescSafeUnref(state[i].desc[j]);
+      }
+    }
+  }
+  free(sizes);
+  free(typed);
+  free(state);
+  free(kern_mmsg);
+}
+
+/*
+ * Batched version of NaClSysImcSendmsg.  msgvec is an array of vlen
+ * struct NaClAbiNaClImcMMsgHdr; at most NACL_ABI_IMC_MSG_BATCH_MAX are
+ * sent per call.  The msg_len of each message sent is updated, and
+ * the number of messages sent is returned.
+ */
+int32_t NaClSysImcSendmmsg(struct NaClAppThread *natp,
+                           int                  d,
+                           uint32_t             msgvec,
+                           uint32_t             vlen,
+                           int                  flags) {
+  struct NaClApp                *nap = natp->nap;
+  int32_t                       retval = -NACL_ABI_EINVAL;
+  ssize_t                       ssize_retval;
+  struct NaClAbiNaClImcMMsgHdr  *kern_mmsg = NULL;
+  struct NaClImcMMsgState       *state = NULL;
+  struct NaClImcTypedMsgHdr     *typed = NULL;
+  size_t                        *sizes = NULL;
+  struct NaClDesc               *ndp = NULL;
+  uint64_t                      batch;
+  size_t                        i;
+
+  NaClLog(3,
+          ("Entered NaClSysImcSendmmsg(0x%08"NACL_PRIxPTR", %d,"
+           " 0x%08"NACL_PRIx32", %"NACL_PRIu32", 0x%x)\n"),
+          (uintptr_t) natp, d, msgvec, vlen, flags);
+
+  if (vlen > NACL_ABI_IMC_MSG_BATCH_MAX) {
+    vlen = NACL_ABI_IMC_MSG_BATCH_MAX;
+  }
+  if (0 == vlen) {
+    return 0;
+  }
+
+  retval = NaClImcMMsgCopyIn(nap, msgvec, vlen, &kern_mmsg, &state, &typed,
+                             &sizes);
+  if (0 != retval) {
+    goto cleanup;
+  }
+  for (i = 0; i < vlen; ++i) {
+    struct NaClAbiNaClImcMsgHdr *nanimh = &kern_mmsg[i].msg_hdr;
+
+    retval = NaClImcCopyInIov(nap, nanimh, state[i].naiov, state[i].iov);
+    if (0 != retval) {
+      goto cleanup;
+    }
+    retval = NaClImcCopyInSendDescs(nap, nanimh, state[i].desc);
+    if (0 != retval) {
+      goto cleanup;
+    }
+    typed[i].iov = state[i].iov;
+    typed[i].iov_length = nanimh->iov_length;
+    typed[i].ndescv = 0 == nanimh->desc_length ? NULL : state[i].desc;
+    typed[i].ndesc_length = nanimh->desc_length;
+    typed[i].flags = nanimh->flags;
+  }
+
+  ndp = NaClAppGetDesc(nap, d);
+  if (NULL == ndp) {
+    retval = -NACL_ABI_EBADF;
+    goto cleanup;
+  }
+
+  /* Send no more messages than are left under the hard limit. */
+  batch = vlen;
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_IMC_SENT, &batch);
+  if (0 != retval) {
+    goto cleanup;
+  }
+
+  for (i = 0; i < batch; ++i) {
+    NaClImcVmIoWillStart(nap, state[i].naiov,
+                         kern_mmsg[i].msg_hdr.iov_length);
+  }
+  ssize_retval = NaClImcSendTypedMessageBatch(ndp, typed, (size_t) batch,
+                                              sizes, flags);
+  for (i = 0; i < batch; ++i) {
+    NaClImcVmIoHasEnded(nap, state[i].naiov,
+                        kern_mmsg[i].msg_hdr.iov_length);
+  }
+  if (ssize_retval < 0) {
+    /* negated errno values fit in 32 bits */
+    retval = (int32_t) ssize_retval;
+    goto cleanup;
+  }
+
+  /* ssize_retval <= batch <= NACL_ABI_IMC_MSG_BATCH_MAX */
+  retval = (int32_t) ssize_retval;
+  NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_IMC_SENT, retval);
+  for (i = 0; i < (size_t) retval; ++i) {
+    kern_mmsg[i].msg_len = (nacl_abi_size_t) sizes[i];
+  }
+  if (!NaClCopyOutToUser(nap, msgvec, kern_mmsg,
+                         retval * sizeof *kern_mmsg)) {
+    NaClLog(LOG_FATAL,
+            "NaClSysImcSendmmsg: in/out ptr (msgvec) became"
+            " invalid at copyout?\n");
+  }
+
+cleanup:
+  NaClImcMMsgFree(kern_mmsg, state, vlen, typed, sizes);
+  NaClDescSafeUnref(ndp);
+  NaClLog(3, "NaClSysImcSendmmsg: returning %d\n", retval);
+  return retval;
+}
+
+/*
+ * Batched version of NaClSysImcRecvmsg.  Blocks (unless
+ * NACL_ABI_IMC_NONBLOCK is given) until at least one message is
+ * available, then receives as many of the vlen messages as are
+ * queued.  Each received message's header is updated as by
+ * imc_recvmsg, its msg_len is set, and the number of messages
+ * received is returned.
+ */
+int32_t NaClSysImcRecvmmsg(struct NaClAppThread *natp,
+                           int                  d,
+                           uint32_t             msgvec,
+                           uint32_t             vlen,
+                           int                  flags) {
+  struct NaClApp                *nap = natp->nap;
+  int32_t                       retval = -NACL_ABI_EINVAL;
+  ssize_t                       ssize_retval;
+  uintptr_t                     sysaddr;
+  struct NaClAbiNaClImcMMsgHdr  *kern_mmsg = NULL;
+  struct NaClImcMMsgState       *state = NULL;
+  struct NaClImcTypedMsgHdr     *typed = NULL;
+  size_t                        *sizes = NULL;
+  struct NaClDesc               *ndp = NULL;
+  struct NaClDesc               *invalid_desc = NULL;
+  uint64_t                      batch;
+  size_t                        i;
+
+  NaClLog(3,
+          ("Entered NaClSysImcRecvmmsg(0x%08"NACL_PRIxPTR", %d,"
+           " 0x%08"NACL_PRIx32", %"NACL_PRIu32", 0x%x)\n"),
+          (uintptr_t) natp, d, msgvec, vlen, flags);
+
+  if (vlen > NACL_ABI_IMC_MSG_BATCH_MAX) {
+    vlen = NACL_ABI_IMC_MSG_BATCH_MAX;
+  }
+  if (0 == vlen) {
+    return 0;
+  }
+
+  retval = NaClImcMMsgCopyIn(nap, msgvec, vlen, &kern_mmsg, &state, &typed,
+                             &sizes);
+  if (0 != retval) {
+    goto cleanup;
+  }
+  for (i = 0; i < vlen; ++i) {
+    struct NaClAbiNaClImcMsgHdr *nanimh = &kern_mmsg[i].msg_hdr;
+
+    retval = NaClImcCopyInIov(nap, nanimh, state[i].naiov, state[i].iov);
+    if (0 != retval) {
+      goto cleanup;
+    }
+    if (nanimh->desc_length > 0) {
+      sysaddr = NaClUserToSysAddrRange(nap,
+                                       (uintptr_t) nanimh->descv,
+                                       nanimh->desc_length * sizeof(int32_t));
+      if (kNaClBadAddress == sysaddr) {
+        retval = -NACL_ABI_EFAULT;
+        goto cleanup;
+      }
+    }
+    typed[i].iov = state[i].iov;
+    typed[i].iov_length = nanimh->iov_length;
+    typed[i].ndescv = state[i].desc;
+    typed[i].ndesc_length = NACL_ARRAY_SIZE(state[i].desc);
+    typed[i].flags = 0;
+  }
+
+  ndp = NaClAppGetDesc(nap, d);
+  if (NULL == ndp) {
+    NaClLog(4, "receiving descriptor invalid\n");
+    retval = -NACL_ABI_EBADF;
+    goto cleanup;
+  }
+
+  /* Receive no more messages than are left under the hard limit. */
+  batch = vlen;
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_IMC_RECEIVED, &batch);
+  if (0 != retval) {
+    goto cleanup;
+  }
+
+  for (i = 0; i < batch; ++i) {
+    NaClImcVmIoWillStart(nap, state[i].naiov,
+                         kern_mmsg[i].msg_hdr.iov_length);
+  }
+  ssize_retval = NaClImcRecvTypedMessageBatch(ndp, typed, (size_t) batch,
+                                              sizes, flags);
+  for (i = 0; i < batch; ++i) {
+    NaClImcVmIoHasEnded(nap, state[i].naiov,
+                        kern_mmsg[i].msg_hdr.iov_length);
+  }
+  NaClLog(3, "NaClSysImcRecvmmsg: RecvMsgBatch returned %"NACL_PRIdS"\n",
+          ssize_retval);
+  if (ssize_retval < 0) {
+    /* negated errno values fit in 32 bits */
+    retval = (int32_t) ssize_retval;
+    goto cleanup;
+  }
+
+  /* ssize_retval <= batch <= NACL_ABI_IMC_MSG_BATCH_MAX */
+  retval = (int32_t) ssize_retval;
+  NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_IMC_RECEIVED,
+                       retval);
+  invalid_desc = (struct NaClDesc *) NaClDescInvalidMake();
+  for (i = 0; i < (size_t) retval; ++i) {
+    NaClImcInstallRecvDescs(nap, &kern_mmsg[i].msg_hdr, &typed[i],
+                            state[i].desc, invalid_desc);
+    kern_mmsg[i].msg_len = (nacl_abi_size_t) sizes[i];
+  }
+  if (!NaClCopyOutToUser(nap, msgvec, kern_mmsg,
+                         retval * sizeof *kern_mmsg)) {
+    NaClLog(LOG_FATAL,
+            "NaClSysImcRecvmmsg: in/out ptr (msgvec) became"
+            " invalid at copyout?\n");
+  }
+
+cleanup:
+  NaClImcMMsgFree(kern_mmsg, state, vlen, typed, sizes);
+  NaClDescSafeUnref(ndp);
+  NaClDescSafeUnref(invalid_desc);
+  NaClLog(3, "NaClSysImcRecvmmsg: returning %d\n", retval);
+  return retval;
+}
+
 int32_t NaClSysImcMemObjCreate(struct NaClAppThread  *natp,
                                size_t                size) {
   struct NaClApp        *nap = natp->nap;
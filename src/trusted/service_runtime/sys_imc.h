@@ -35,6 +35,18 @@ int32_t NaClSysImcRecvmsg(struct NaClAppThread *natp,
                           uint32_t             nanimhp,
                           int                  flags);
 
+int32_t NaClSysImcSendmmsg(struct NaClAppThread *natp,
+                           int                  d,
+                           uint32_t             msgvec,
+                           uint32_t             vlen,
+                           int                  flags);
+
+int32_t NaClSysImcRecvmmsg(struct NaClAppThread *natp,
+                           int                  d,
+                           uint32_t             msgvec,
+                           uint32_t             vlen,
+                           int                  flags);
+
 int32_t NaClSysImcMemObjCreate(struct NaClAppThread  *natp,
                                size_t                size);
 
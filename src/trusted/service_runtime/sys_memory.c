@@ -28,6 +28,7 @@
 #include "native_client/src/trusted/service_runtime/nacl_text.h"
 #include "native_client/src/trusted/service_runtime/sel_ldr.h"
 #include "native_client/src/trusted/service_runtime/sel_memory.h"
+#include "native_client/src/trusted/service_runtime/sys_write_watch.h"
 #include "native_client/src/trusted/validator/validation_metadata.h"
 
 #if NACL_WINDOWS
@@ -241,6 +242,42 @@ int NaClSysCommonAddrRangeInAllowedDynamicCodeSpace(struct NaClApp *nap,
           usr_region_end <= nap->dynamic_text_end);
 }
 
+/*
+ * Finds room for an anonymous mapping of length bytes (a multiple of
+ * NACL_MAP_PAGESIZE) whose host address is NACL_HUGE_PAGESIZE
+ * aligned, so that the host can back it with huge pages.  The hole
+ * searched for is padded by just enough to guarantee an aligned start
+ * inside it, and the mapping is placed as high in the hole as
+ * possible, as NaClVmmapFindMapSpace does.  Since the result is still
+ * a multiple of NACL_MAP_PAGESIZE, the vmmap sees an ordinary
+ * mapping.  Returns the user address, or 0 if there is no such hole.
+ *
+ * Called with nap->mu held.
+ */
+static uintptr_t NaClSysMmapFindHugePageSpace(struct NaClApp *nap,
+                                              size_t         length) {
+  size_t    padded_length = length + NACL_HUGE_PAGESIZE - NACL_MAP_PAGESIZE;
+  uintptr_t usrpage;
+  uintptr_t hole_end;
+  uintptr_t sysaddr;
+
+  if (padded_length < length) {
+    return 0;
+  }
+  usrpage = NaClVmmapFindMapSpace(&nap->mem_map,
+                                  padded_length >> NACL_PAGESHIFT);
+  if (0 == usrpage) {
+    NaClLog(4, "NaClSysMmap: no room for huge page aligned mapping\n");
+    return 0;
+  }
+  hole_end = (usrpage << NACL_PAGESHIFT) + padded_length;
+  sysaddr = NaClUserToSys(nap, hole_end - length)
+      & ~((uintptr_t) NACL_HUGE_PAGESIZE - 1);
+  NaClLog(4, "NaClSysMmap: huge page aligned sysaddr 0x%08"NACL_PRIxPTR"\n",
+          sysaddr);
+  return NaClSysToUser(nap, sysaddr);
+}
+
 /* Warning: sizeof(nacl_abi_off_t)!=sizeof(off_t) on OSX */
 int32_t NaClSysMmapIntern(struct NaClApp        *nap,
                           void                  *start,
@@ -265,6 +302,7 @@ int32_t NaClSysMmapIntern(struct NaClApp        *nap,
   nacl_off64_t                host_rounded_file_bytes;
   size_t                      alloc_rounded_file_bytes;
   uint32_t                    val_flags;
+  int                         huge_page_map;
 
   holding_app_lock = 0;
   ndp = NULL;
@@ -491,6 +529,11 @@ int32_t NaClSysMmapIntern(struct NaClApp        *nap,
   }
   length = size_min(alloc_rounded_length, (size_t) host_rounded_file_bytes);
 
+  huge_page_map = (nap->huge_page_heap &&
+                   NULL == ndp &&
+                   0 == (flags & NACL_ABI_MAP_FIXED) &&
+                   alloc_rounded_length >= NACL_HUGE_PAGESIZE);
+
   /*
    * Lock the addr space.
    */
@@ -509,15 +552,20 @@ int32_t NaClSysMmapIntern(struct NaClApp        *nap,
        * Pick a hole in addr space of appropriate size, anywhere.
        * We pick one that's best for the system.
        */
-      usrpage = NaClVmmapFindMapSpace(&nap->mem_map,
-                                      alloc_rounded_length >> NACL_PAGESHIFT);
-      NaClLog(4, "NaClSysMmap: FindMapSpace: page 0x%05"NACL_PRIxPTR"\n",
-              usrpage);
-      if (0 == usrpage) {
-        map_result = (uintptr_t) -NACL_ABI_ENOMEM;
-        goto cleanup;
+      if (huge_page_map) {
+        usraddr = NaClSysMmapFindHugePageSpace(nap, alloc_rounded_length);
+      }
+      if (0 == usraddr) {
+        usrpage = NaClVmmapFindMapSpace(&nap->mem_map,
+                                        alloc_rounded_length >> NACL_PAGESHIFT);
+        NaClLog(4, "NaClSysMmap: FindMapSpace: page 0x%05"NACL_PRIxPTR"\n",
+                usrpage);
+        if (0 == usrpage) {
+          map_result = (uintptr_t) -NACL_ABI_ENOMEM;
+          goto cleanup;
+        }
+        usraddr = usrpage << NACL_PAGESHIFT;
       }
-      usraddr = usrpage << NACL_PAGESHIFT;
       NaClLog(4, "NaClSysMmap: new starting addr: 0x%08"NACL_PRIxPTR
               "\n", usraddr);
     } else {
@@ -606,9 +654,18 @@ int32_t NaClSysMmapIntern(struct NaClApp        *nap,
     goto cleanup;
   }
 
+  map_result = (uintptr_t) NaClResourceUsageCheckMapping_mu(
+      nap, usraddr >> NACL_PAGESHIFT, alloc_rounded_length >> NACL_PAGESHIFT);
+  if (0 != map_result) {
+    goto cleanup;
+  }
+
   NaClVmIoPendingCheck_mu(nap,
                           (uint32_t) usraddr,
                           (uint32_t) (usraddr + length - 1));
+  NaClWriteWatchForget_mu(nap,
+                          (uint32_t) usraddr,
+                          (uint32_t) (usraddr + length - 1));
 
   /*
    * Force NACL_ABI_MAP_FIXED, since we are specifying address in NaCl
@@ -867,6 +924,9 @@ int32_t NaClSysMmapIntern(struct NaClApp        *nap,
     if (map_result != sysaddr) {
       NaClLog(LOG_FATAL, "system mmap did not honor NACL_ABI_MAP_FIXED\n");
     }
+    if (huge_page_map) {
+      NaClHugePageAdvise((void *) sysaddr, length);
+    }
   }
   /*
    * If we are mapping beyond the end of the file, we fill this space
@@ -1125,6 +1185,7 @@ int32_t NaClSysMunmap(struct NaClAppThread  *natp,
   }
 
   NaClVmIoPendingCheck_mu(nap, start, start + length - 1);
+  NaClWriteWatchForget_mu(nap, start, start + length - 1);
 
   retval = MunmapInternal(nap, sysaddr, length);
 cleanup:
@@ -1346,6 +1407,9 @@ int32_t NaClSysMprotectInternal(struct NaClApp  *nap,
   NaClVmIoPendingCheck_mu(nap,
                           (uint32_t) (uintptr_t) start,
                           (uint32_t) ((uintptr_t) start + length - 1));
+  NaClWriteWatchForget_mu(nap,
+                          (uint32_t) (uintptr_t) start,
+                          (uint32_t) ((uintptr_t) start + length - 1));
 
   retval = MprotectInternal(nap, sysaddr, length, prot);
 cleanup:
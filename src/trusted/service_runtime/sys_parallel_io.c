@@ -32,6 +32,7 @@ int32_t NaClSysPRead(struct NaClAppThread *natp,
   nacl_abi_off64_t offset;
   int32_t retval = -NACL_ABI_EINVAL;
   ssize_t pread_result;
+  uint64_t limited_bytes;
 
   NaClLog(3,
           ("Entered NaClSysPRead(0x%08"NACL_PRIxPTR", %d, 0x%08"NACL_PRIx32
@@ -58,11 +59,24 @@ int32_t NaClSysPRead(struct NaClAppThread *natp,
     goto cleanup;
   }
 
+  /* Stop at the hard limit, as a short pread. */
+  limited_bytes = buffer_bytes;
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_READ_BYTES, &limited_bytes);
+  if (0 != retval) {
+    goto cleanup;
+  }
+  buffer_bytes = (uint32_t) limited_bytes;
+
   NaClVmIoWillStart(nap, usr_addr, usr_addr + buffer_bytes - 1);
   pread_result = (*NACL_VTBL(NaClDesc, ndp)->
                   PRead)(ndp, (void *) sysaddr, buffer_bytes, offset);
   NaClVmIoHasEnded(nap, usr_addr, usr_addr + buffer_bytes - 1);
 
+  if (pread_result > 0) {
+    NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_READ_BYTES,
+                         (uint64_t) pread_result);
+  }
   retval = (int32_t) pread_result;
 
  cleanup:
@@ -81,6 +95,7 @@ int32_t NaClSysPWrite(struct NaClAppThread *natp,
   nacl_abi_off64_t offset;
   int32_t retval = -NACL_ABI_EINVAL;
   ssize_t pwrite_result;
+  uint64_t limited_bytes;
 
   NaClLog(3,
           ("Entered NaClSysPWrite(0x%08"NACL_PRIxPTR", %d, 0x%08"NACL_PRIx32
@@ -107,11 +122,24 @@ int32_t NaClSysPWrite(struct NaClAppThread *natp,
     goto cleanup;
   }
 
+  /* Stop at the hard limit, as a short pwrite. */
+  limited_bytes = buffer_bytes;
+  retval = NaClResourceUsageCheck(&nap->resource_usage,
+                                  NACL_RESOURCE_WRITE_BYTES, &limited_bytes);
+  if (0 != retval) {
+    goto cleanup;
+  }
+  buffer_bytes = (uint32_t) limited_bytes;
+
   NaClVmIoWillStart(nap, usr_addr, usr_addr + buffer_bytes - 1);
   pwrite_result = (*NACL_VTBL(NaClDesc, ndp)->
                    PWrite)(ndp, (void *) sysaddr, buffer_bytes, offset);
   NaClVmIoHasEnded(nap, usr_addr, usr_addr + buffer_bytes - 1);
 
+  if (pwrite_result > 0) {
+    NaClResourceUsageAdd(&nap->resource_usage, NACL_RESOURCE_WRITE_BYTES,
+                         (uint64_t) pwrite_result);
+  }
   retval = (int32_t) pwrite_result;
 
  cleanup:
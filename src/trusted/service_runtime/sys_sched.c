@@ -0,0 +1,479 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl service run-time, thread_sched system call.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "native_client/src/trusted/service_runtime/sys_sched.h"
+
+#include "native_client/src/include/build_config.h"
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/shared/platform/nacl_host_desc.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/trusted/service_runtime/include/sys/errno.h"
+#include "native_client/src/trusted/service_runtime/nacl_app_thread.h"
+#include "native_client/src/trusted/service_runtime/nacl_copy.h"
+#include "native_client/src/trusted/service_runtime/sel_ldr.h"
+
+#if NACL_LINUX
+# include <sched.h>
+# include <sys/resource.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+static int InitialAffinityHas(struct NaClSchedPolicy *self, uint32_t cpu) {
+  return (cpu < NACL_SCHED_HOST_CPUS &&
+          0 != (self->initial_affinity[cpu / 32] & (1U << (cpu % 32))));
+}
+
+int NaClSchedPolicyCtor(struct NaClSchedPolicy *self) {
+#if NACL_LINUX
+  cpu_set_t host_set;
+  uint32_t  cpu;
+  int       nice_value;
+#endif
+
+  memset(self, 0, sizeof *self);
+#if NACL_LINUX
+  /*
+   * Like sc_nprocessors_onln, this must be read before the outer
+   * sandbox is enabled.
+   */
+  if (0 == sched_getaffinity(0, sizeof host_set, &host_set)) {
+    for (cpu = 0; cpu < CPU_SETSIZE && cpu < NACL_SCHED_HOST_CPUS; ++cpu) {
+      if (!CPU_ISSET(cpu, &host_set)) {
+        continue;
+      }
+      self->initial_affinity[cpu / 32] |= 1U << (cpu % 32);
+      if (self->cpu_count < NACL_ABI_SCHED_MAX_CPUS) {
+        self->cpus[self->cpu_count++] = cpu;
+      }
+    }
+  }
+  /* sel_ldr may have been started niced; -1 is a valid nice value. */
+  errno = 0;
+  nice_value = getpriority(PRIO_PROCESS, 0);
+  if (-1 != nice_value || 0 == errno) {
+    self->base_nice = nice_value;
+  }
+#endif
+  return NaClFastMutexCtor(&self->mu);
+}
+
+void NaClSchedPolicyDtor(struct NaClSchedPolicy *self) {
+  NaClFastMutexDtor(&self->mu);
+}
+
+static int ParseNumber(char const *str, char const **end, uint32_t limit,
+                       uint32_t *value) {
+  char          *parse_end;
+  unsigned long result;
+
+  if (*str < '0' || *str > '9') {
+    return 0;
+  }
+  result = strtoul(str, &parse_end, 10);
+  if (result > limit) {
+    return 0;
+  }
+  *value = (uint32_t) result;
+  *end = parse_end;
+  return 1;
+}
+
+/*
+ * Parses a list of host CPUs such as "0-3,6".  The CPUs must be ones
+ * that sel_ldr may run on, and may not repeat.
+ */
+static int ParseCpuList(struct NaClSchedPolicy *self, char const *str) {
+  uint32_t    cpus[NACL_ABI_SCHED_MAX_CPUS];
+  uint32_t    count = 0;
+  uint32_t    first;
+  uint32_t    last;
+  uint32_t    cpu;
+  uint32_t    ix;
+
+  for (;;) {
+    if (!ParseNumber(str, &str, NACL_SCHED_HOST_CPUS - 1, &first)) {
+      return 0;
+    }
+    last = first;
+    if ('-' == *str) {
+      if (!ParseNumber(str + 1, &str, NACL_SCHED_HOST_CPUS - 1, &last) ||
+          last < first) {
+        return 0;
+      }
+    }
+    for (cpu = first; cpu <= last; ++cpu) {
+      if (count == NACL_ABI_SCHED_MAX_CPUS ||
+          !InitialAffinityHas(self, cpu)) {
+        return 0;
+      }
+      for (ix = 0; ix < count; ++ix) {
+        if (cpus[ix] == cpu) {
+          return 0;
+        }
+      }
+      cpus[count++] = cpu;
+    }
+    if ('\0' == *str) {
+      break;
+    }
+    if (',' != *str) {
+      return 0;
+    }
+    ++str;
+  }
+  memcpy(self->cpus, cpus, count * sizeof cpus[0]);
+  self->cpu_count = count;
+  return 1;
+}
+
+int NaClSchedPolicyParse(struct NaClSchedPolicy *self,
+                         char const             *spec) {
+  char const  *value;
+  char const  *rest;
+  uint32_t    number;
+
+  value = strchr(spec, '=');
+  if (NULL == value) {
+    return 0;
+  }
+  ++value;
+  if (0 == strncmp(spec, "cpus=", value - spec)) {
+    return ParseCpuList(self, value);
+  }
+  if (0 == strncmp(spec, "priority=", value - spec)) {
+    if (!ParseNumber(value, &rest, NACL_ABI_SCHED_PRIORITY_MAX, &number) ||
+        '\0' != *rest) {
+      return 0;
+    }
+    self->max_priority = (int32_t) number;
+    return 1;
+  }
+  if (0 == strncmp(spec, "deadline=", value - spec)) {
+    if (!ParseNumber(value, &rest, 100 * NACL_ABI_SCHED_MAX_CPUS, &number) ||
+        '\0' != *rest) {
+      return 0;
+    }
+    self->deadline_capacity = number * (NACL_ABI_SCHED_UTIL_SCALE / 100);
+    return 1;
+  }
+  return 0;
+}
+
+void NaClSchedThreadChanged(struct NaClAppThread *natp) {
+  natp->sched_changed = 1;
+  natp->nap->sched_policy.threads_changed = 1;
+}
+
+void NaClSchedThreadStart(struct NaClAppThread *natp) {
+  if (natp->nap->sched_policy.threads_changed) {
+    natp->sched_changed = 1;
+    if (!NaClSchedThreadReset(natp)) {
+      NaClLog(2, "NaClSchedThreadStart: could not reset scheduling\n");
+    }
+  }
+}
+
+#if NACL_LINUX
+
+#if !defined(SCHED_DEADLINE)
+# define SCHED_DEADLINE 6
+#endif
+#if !defined(SCHED_FLAG_RESET_ON_FORK)
+# define SCHED_FLAG_RESET_ON_FORK 0x01
+#endif
+
+/* Linux's struct sched_attr, which glibc does not define. */
+struct HostSchedAttr {
+  uint32_t size;
+  uint32_t sched_policy;
+  uint64_t sched_flags;
+  int32_t  sched_nice;
+  uint32_t sched_priority;
+  uint64_t sched_runtime;
+  uint64_t sched_deadline;
+  uint64_t sched_period;
+};
+
+static int32_t SchedGetInfo(struct NaClAppThread *natp, uint32_t info_ptr) {
+  struct NaClSchedPolicy  *policy = &natp->nap->sched_policy;
+  struct NaClAbiSchedInfo info;
+
+  info.cpu_count = policy->cpu_count;
+  info.min_priority = NACL_ABI_SCHED_PRIORITY_MIN;
+  info.max_priority = policy->max_priority;
+  info.deadline_capacity = policy->deadline_capacity;
+  NaClFastMutexLock(&policy->mu);
+  info.deadline_available = policy->deadline_capacity - policy->deadline_used;
+  NaClFastMutexUnlock(&policy->mu);
+  if (!NaClCopyOutToUser(natp->nap, info_ptr, &info, sizeof info)) {
+    return -NACL_ABI_EFAULT;
+  }
+  return 0;
+}
+
+static int32_t SchedSetAffinity(struct NaClAppThread *natp,
+                                uint32_t             mask_ptr) {
+  struct NaClSchedPolicy  *policy = &natp->nap->sched_policy;
+  uint64_t                mask;
+  cpu_set_t               host_set;
+  uint32_t                cpu;
+
+  if (!NaClCopyInFromUser(natp->nap, &mask, mask_ptr, sizeof mask)) {
+    return -NACL_ABI_EFAULT;
+  }
+  if (0 == mask ||
+      (policy->cpu_count < 64 && 0 != (mask >> policy->cpu_count))) {
+    return -NACL_ABI_EINVAL;
+  }
+  CPU_ZERO(&host_set);
+  for (cpu = 0; cpu < policy->cpu_count; ++cpu) {
+    if (0 != (mask & ((uint64_t) 1 << cpu))) {
+      CPU_SET(policy->cpus[cpu], &host_set);
+    }
+  }
+  NaClSchedThreadChanged(natp);
+  if (0 != sched_setaffinity(0, sizeof host_set, &host_set)) {
+    return -NaClXlateErrno(errno);
+  }
+  return 0;
+}
+
+static int32_t SchedGetAffinity(struct NaClAppThread *natp,
+                                uint32_t             mask_ptr) {
+  struct NaClSchedPolicy  *policy = &natp->nap->sched_policy;
+  uint64_t                mask = 0;
+  cpu_set_t               host_set;
+  uint32_t                cpu;
+
+  if (0 != sched_getaffinity(0, sizeof host_set, &host_set)) {
+    return -NaClXlateErrno(errno);
+  }
+  for (cpu = 0; cpu < policy->cpu_count; ++cpu) {
+    if (CPU_ISSET(policy->cpus[cpu], &host_set)) {
+      mask |= (uint64_t) 1 << cpu;
+    }
+  }
+  if (!NaClCopyOutToUser(natp->nap, mask_ptr, &mask, sizeof mask)) {
+    return -NACL_ABI_EFAULT;
+  }
+  return 0;
+}
+
+static int32_t SchedSetPriority(struct NaClAppThread *natp, int32_t band) {
+  if (band < NACL_ABI_SCHED_PRIORITY_MIN ||
+      band > NACL_ABI_SCHED_PRIORITY_MAX) {
+    return -NACL_ABI_EINVAL;
+  }
+  if (band > natp->nap->sched_policy.max_priority) {
+    return -NACL_ABI_EPERM;
+  }
+  NaClSchedThreadChanged(natp);
+  /*
+   * As in nacl_thread_nice(), this applies to the calling thread.  The
+   * host clamps nice values to its own range.  Linux gives EACCES when
+   * RLIMIT_NICE does not allow raising priority; callers are promised
+   * EPERM for that.
+   */
+  if (0 != setpriority(PRIO_PROCESS, 0,
+                       natp->nap->sched_policy.base_nice - band)) {
+    return EACCES == errno ? -NACL_ABI_EPERM : -NaClXlateErrno(errno);
+  }
+  return 0;
+}
+
+/*
+ * Switches the calling thread to SCHED_OTHER, at its current nice
+ * value, or to SCHED_DEADLINE with the given parameters.
+ */
+static int HostSetDeadline(struct NaClAbiSchedDeadline const *params) {
+#if defined(__NR_sched_setattr)
+  struct HostSchedAttr attr;
+  int                  nice_value;
+
+  memset(&attr, 0, sizeof attr);
+  attr.size = sizeof attr;
+  if (NULL == params) {
+    errno = 0;
+    nice_value = getpriority(PRIO_PROCESS, 0);
+    if (-1 == nice_value && 0 != errno) {
+      return -1;
+    }
+    attr.sched_policy = SCHED_OTHER;
+    attr.sched_nice = nice_value;
+  } else {
+    attr.sched_policy = SCHED_DEADLINE;
+    /* Threads created by this one do not inherit the reservation. */
+    attr.sched_flags = SCHED_FLAG_RESET_ON_FORK;
+    attr.sched_runtime = params->runtime;
+    attr.sched_deadline = params->deadline;
+    attr.sched_period = params->period;
+  }
+  return syscall(__NR_sched_setattr, 0, &attr, 0);
+#else
+  UNREFERENCED_PARAMETER(params);
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
+static int32_t SchedSetDeadline(struct NaClAppThread *natp,
+                                uint32_t             params_ptr) {
+  struct NaClSchedPolicy      *policy = &natp->nap->sched_policy;
+  struct NaClAbiSchedDeadline params;
+  uint32_t                    util = 0;
+  uint32_t                    old_util = natp->sched_deadline_util;
+  int32_t                     retval = 0;
+
+  if (0 != params_ptr) {
+    if (!NaClCopyInFromUser(natp->nap, &params, params_ptr, sizeof params)) {
+      return -NACL_ABI_EFAULT;
+    }
+    if (0 == params.runtime || params.runtime > params.deadline ||
+        params.deadline > params.period ||
+        params.period > UINT64_MAX / NACL_ABI_SCHED_UTIL_SCALE) {
+      return -NACL_ABI_EINVAL;
+    }
+    /* Round up, so that tiny reservations are still counted. */
+    util = (uint32_t) ((params.runtime * NACL_ABI_SCHED_UTIL_SCALE +
+                        params.period - 1) / params.period);
+  }
+
+  /*
+   * Admission is checked against the sandbox's own budget first, with
+   * the thread's old reservation counted as given back.  The host
+   * kernel then does its own admission test across all processes.
+   */
+  NaClFastMutexLock(&policy->mu);
+  if (util > old_util &&
+      util - old_util > policy->deadline_capacity - policy->deadline_used) {
+    retval = -NACL_ABI_EBUSY;
+  } else {
+    policy->deadline_used = policy->deadline_used - old_util + util;
+  }
+  NaClFastMutexUnlock(&policy->mu);
+  if (0 != retval) {
+    return retval;
+  }
+
+  NaClSchedThreadChanged(natp);
+  if (0 != HostSetDeadline(0 != params_ptr ? &params : NULL)) {
+    retval = -NaClXlateErrno(errno);
+    NaClFastMutexLock(&policy->mu);
+    policy->deadline_used = policy->deadline_used - util + old_util;
+    NaClFastMutexUnlock(&policy->mu);
+    return retval;
+  }
+  natp->sched_deadline_util = util;
+  return 0;
+}
+
+int32_t NaClSysThreadSched(struct NaClAppThread *natp,
+                           uint32_t             op,
+                           uint32_t             arg) {
+  int32_t retval;
+
+  NaClLog(3,
+          ("Entered NaClSysThreadSched(0x%08"NACL_PRIxPTR", %"NACL_PRIu32
+           ", 0x%08"NACL_PRIx32")\n"),
+          (uintptr_t) natp, op, arg);
+
+  switch (op) {
+    case NACL_ABI_SCHED_GET_INFO:
+      retval = SchedGetInfo(natp, arg);
+      break;
+    case NACL_ABI_SCHED_SET_AFFINITY:
+      retval = SchedSetAffinity(natp, arg);
+      break;
+    case NACL_ABI_SCHED_GET_AFFINITY:
+      retval = SchedGetAffinity(natp, arg);
+      break;
+    case NACL_ABI_SCHED_SET_PRIORITY:
+      retval = SchedSetPriority(natp, (int32_t) arg);
+      break;
+    case NACL_ABI_SCHED_SET_DEADLINE:
+      if (0 == natp->nap->sched_policy.deadline_capacity) {
+        retval = -NACL_ABI_EPERM;
+        break;
+      }
+      retval = SchedSetDeadline(natp, arg);
+      break;
+    default:
+      retval = -NACL_ABI_EINVAL;
+      break;
+  }
+  NaClLog(3, "NaClSysThreadSched: returning %"NACL_PRId32"\n", retval);
+  return retval;
+}
+
+int NaClSchedThreadReset(struct NaClAppThread *natp) {
+  struct NaClSchedPolicy  *policy = &natp->nap->sched_policy;
+  cpu_set_t               host_set;
+  uint32_t                cpu;
+  int                     restored = 1;
+
+  if (!natp->sched_changed) {
+    return 1;
+  }
+  natp->sched_changed = 0;
+  if (0 != natp->sched_deadline_util) {
+    if (0 != HostSetDeadline(NULL)) {
+      NaClLog(LOG_WARNING,
+              "NaClSchedThreadReset: cannot leave SCHED_DEADLINE, errno %d\n",
+              errno);
+      restored = 0;
+    }
+    NaClFastMutexLock(&policy->mu);
+    policy->deadline_used -= natp->sched_deadline_util;
+    NaClFastMutexUnlock(&policy->mu);
+    natp->sched_deadline_util = 0;
+  }
+  /*
+   * Going back to the normal priority after the thread lowered its own
+   * needs RLIMIT_NICE on Linux, so this can fail.
+   */
+  if (0 != setpriority(PRIO_PROCESS, 0, policy->base_nice)) {
+    restored = 0;
+  }
+  CPU_ZERO(&host_set);
+  for (cpu = 0; cpu < CPU_SETSIZE && cpu < NACL_SCHED_HOST_CPUS; ++cpu) {
+    if (InitialAffinityHas(policy, cpu)) {
+      CPU_SET(cpu, &host_set);
+    }
+  }
+  if (CPU_COUNT(&host_set) > 0 &&
+      0 != sched_setaffinity(0, sizeof host_set, &host_set)) {
+    restored = 0;
+  }
+  return restored;
+}
+
+#else
+
+int32_t NaClSysThreadSched(struct NaClAppThread *natp,
+                           uint32_t             op,
+                           uint32_t             arg) {
+  UNREFERENCED_PARAMETER(natp);
+  UNREFERENCED_PARAMETER(op);
+  UNREFERENCED_PARAMETER(arg);
+  return -NACL_ABI_ENOSYS;
+}
+
+int NaClSchedThreadReset(struct NaClAppThread *natp) {
+  UNREFERENCED_PARAMETER(natp);
+  return 1;
+}
+
+#endif
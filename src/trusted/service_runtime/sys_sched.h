@@ -0,0 +1,114 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl service run-time, thread_sched system call.
+ *
+ * Lets an untrusted thread choose its CPU affinity, priority band and
+ * deadline reservation, within a policy the embedder sets with sel_ldr's
+ * -P option:
+ *
+ *   cpus=LIST      host CPUs the sandbox may pin threads to, e.g. "0-3,6".
+ *                  Virtual CPU i is the i'th CPU in the list.  Defaults
+ *                  to the CPUs sel_ldr may run on.
+ *   priority=N     highest priority band, 0 .. 20.  Band b is the host
+ *                  nice value sel_ldr started with, minus b.  Defaults
+ *                  to 0, which only allows lowering priority.
+ *   deadline=PCT   total deadline utilization, in percent of one CPU,
+ *                  that the sandbox's threads may reserve.  Defaults to
+ *                  0, which disables deadline scheduling.
+ *
+ * Raising priority above the normal band and deadline scheduling also
+ * need the host privileges (RLIMIT_NICE, CAP_SYS_NICE) that the host
+ * kernel asks for; without them the calls fail with EPERM.  This is
+ * only implemented on Linux.
+ */
+
+#ifndef NATIVE_CLIENT_SERVICE_RUNTIME_NACL_SYS_SCHED_H__
+#define NATIVE_CLIENT_SERVICE_RUNTIME_NACL_SYS_SCHED_H__ 1
+
+#include "native_client/src/include/portability.h"
+
+#include "native_client/src/include/nacl_base.h"
+#include "native_client/src/shared/platform/nacl_sync.h"
+#include "native_client/src/trusted/service_runtime/include/sys/nacl_sched.h"
+
+EXTERN_C_BEGIN
+
+struct NaClAppThread;
+
+/* Host CPUs numbered at or above this are never used. */
+#define NACL_SCHED_HOST_CPUS 1024
+
+struct NaClSchedPolicy {
+  /* Host CPU number of each virtual CPU. */
+  uint32_t              cpu_count;
+  uint32_t              cpus[NACL_ABI_SCHED_MAX_CPUS];
+  int32_t               max_priority;
+  /*
+   * The host nice value sel_ldr started with, which is band 0.
+   * NaClSchedThreadReset() sets a thread's nice value back to this.
+   */
+  int32_t               base_nice;
+  /* In millionths of a CPU, as NACL_ABI_SCHED_UTIL_SCALE. */
+  uint32_t              deadline_capacity;
+  /*
+   * The host CPUs sel_ldr could run on at startup, as a bitmap.
+   * NaClSchedThreadReset() sets a thread's affinity back to this.
+   */
+  uint32_t              initial_affinity[NACL_SCHED_HOST_CPUS / 32];
+  /* mu protects deadline_used. */
+  struct NaClFastMutex  mu;
+  uint32_t              deadline_used;
+  /*
+   * Set once any thread has changed its scheduling parameters.  Until
+   * then new host threads need not be reset, since the thread that
+   * created them had nothing for them to inherit.
+   */
+  volatile int          threads_changed;
+};
+
+int NaClSchedPolicyCtor(struct NaClSchedPolicy *self) NACL_WUR;
+
+void NaClSchedPolicyDtor(struct NaClSchedPolicy *self);
+
+/*
+ * Parses and applies one "name=value" setting, as given to sel_ldr's
+ * -P option.  Returns 0 if the spec is malformed or out of range.
+ */
+int NaClSchedPolicyParse(struct NaClSchedPolicy *self,
+                         char const             *spec) NACL_WUR;
+
+int32_t NaClSysThreadSched(struct NaClAppThread *natp,
+                           uint32_t             op,
+                           uint32_t             arg);
+
+/*
+ * Records that natp is about to change its host scheduling parameters,
+ * by thread_sched or by thread_nice.
+ */
+void NaClSchedThreadChanged(struct NaClAppThread *natp);
+
+/*
+ * Called by a newly created host thread before it runs untrusted code.
+ * Host threads inherit their creator's priority and affinity, which
+ * this undoes, so that new threads start out the same as recycled
+ * ones.
+ */
+void NaClSchedThreadStart(struct NaClAppThread *natp);
+
+/*
+ * Undoes any scheduling changes made by natp, and gives back its
+ * deadline reservation.  Called by natp itself from
+ * NaClAppThreadTeardown(), before its host thread exits or is parked
+ * in the thread pool.  Returns 0 if some change could not be undone,
+ * in which case the host thread should not be reused.
+ */
+int NaClSchedThreadReset(struct NaClAppThread *natp);
+
+EXTERN_C_END
+
+#endif  /* NATIVE_CLIENT_SERVICE_RUNTIME_NACL_SYS_SCHED_H__ */
@@ -0,0 +1,434 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl service run-time, write_watch system call.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "native_client/src/trusted/service_runtime/sys_write_watch.h"
+
+#include "native_client/src/include/build_config.h"
+#include "native_client/src/include/nacl_platform.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/trusted/service_runtime/include/bits/mman.h"
+#include "native_client/src/trusted/service_runtime/include/sys/errno.h"
+#include "native_client/src/trusted/service_runtime/include/sys/nacl_write_watch.h"
+#include "native_client/src/trusted/service_runtime/nacl_app_thread.h"
+#include "native_client/src/trusted/service_runtime/nacl_config.h"
+#include "native_client/src/trusted/service_runtime/nacl_copy.h"
+#include "native_client/src/trusted/service_runtime/sel_ldr.h"
+
+#if NACL_LINUX
+# include <sys/mman.h>
+#endif
+
+#if NACL_ABI_WRITE_WATCH_PAGESIZE != NACL_MAP_PAGESIZE
+# error "NACL_ABI_WRITE_WATCH_PAGESIZE must match NACL_MAP_PAGESIZE"
+#endif
+
+#define NACL_WRITE_WATCH_WATCHED  0x1
+#define NACL_WRITE_WATCH_DIRTY    0x2
+/*
+ * Set on a page when it is disarmed, so that a write fault taken while
+ * it was protected and handled after the disarm is restarted rather
+ * than reported.  The restart clears it: if the page is still not
+ * writable, the write faults again and is not ours.
+ */
+#define NACL_WRITE_WATCH_RELEASED 0x4
+
+/*
+ * The per-page state is guarded by striped spinlocks rather than by
+ * nap->mu, since the fault handler runs in signal context and must
+ * not block on a mutex which the faulting thread may itself hold.
+ */
+#define NACL_WRITE_WATCH_LOCKS    256
+
+struct NaClWriteWatch {
+  uint32_t npages;
+  uint8_t  *state;
+  Atomic32 locks[NACL_WRITE_WATCH_LOCKS];
+};
+
+#if NACL_LINUX
+
+static void NaClWriteWatchLock(struct NaClWriteWatch *ww, uint32_t page) {
+  volatile Atomic32 *lock = &ww->locks[page % NACL_WRITE_WATCH_LOCKS];
+
+  while (CompareAndSwap(lock, 0, 1) != 0) {
+    while (*lock != 0) {
+      /* Spin; the lock is only held around a single mprotect().  */
+    }
+  }
+}
+
+static void NaClWriteWatchUnlock(struct NaClWriteWatch *ww, uint32_t page) {
+  CompareAndSwap(&ww->locks[page % NACL_WRITE_WATCH_LOCKS], 1, 0);
+}
+
+static int NaClWriteWatchProtect(struct NaClApp *nap, uint32_t page,
+                                 int writable) {
+  return mprotect((void *) (nap->mem_start +
+                            ((uintptr_t) page << NACL_MAP_PAGESHIFT)),
+                  NACL_MAP_PAGESIZE,
+                  writable ? PROT_READ | PROT_WRITE : PROT_READ);
+}
+
+/*
+ * Returns the write watch state, creating it on first use.  Must be
+ * called with nap->mu held.
+ */
+static struct NaClWriteWatch *NaClWriteWatchGet_mu(struct NaClApp *nap) {
+  struct NaClWriteWatch *ww = nap->write_watch;
+
+  if (NULL == ww) {
+    ww = (struct NaClWriteWatch *) malloc(sizeof *ww);
+    if (NULL == ww) {
+      return NULL;
+    }
+    ww->npages = (uint32_t) (((uintptr_t) 1 << nap->addr_bits)
+                             >> NACL_MAP_PAGESHIFT);
+    ww->state = (uint8_t *) calloc(ww->npages, 1);
+    if (NULL == ww->state) {
+      free(ww);
+      return NULL;
+    }
+    memset((void *) ww->locks, 0, sizeof ww->locks);
+    nap->write_watch = ww;
+  }
+  return ww;
+}
+
+/*
+ * Checks that every page of the user range is mapped read-write, and
+ * not executable, so that making it read-only temporarily and then
+ * writable again leaves the host protection as the sandbox expects.
+ */
+static int NaClWriteWatchRangeIsWritable_mu(struct NaClApp *nap,
+                                            uint32_t addr,
+                                            uint32_t length) {
+  uintptr_t page_num = addr >> NACL_PAGESHIFT;
+  uintptr_t end_page_num = ((uintptr_t) addr + length) >> NACL_PAGESHIFT;
+
+  while (page_num < end_page_num) {
+    struct NaClVmmapEntry const *entry =
+        NaClVmmapFindPage(&nap->mem_map, page_num);
+
+    if (NULL == entry ||
+        entry->prot != (NACL_ABI_PROT_READ | NACL_ABI_PROT_WRITE)) {
+      return 0;
+    }
+    page_num = entry->page_num + entry->npages;
+  }
+  return 1;
+}
+
+static int NaClWriteWatchIoInFlight_mu(struct NaClApp *nap, uint32_t page) {
+  return (*nap->mem_io_regions->vtbl->OverlapsWith)(
+      nap->mem_io_regions,
+      page << NACL_MAP_PAGESHIFT,
+      ((page + 1) << NACL_MAP_PAGESHIFT) - 1);
+}
+
+/*
+ * Pages which the host kernel may be writing to for a syscall in
+ * progress are armed dirty instead, since protecting them would make
+ * that syscall fail with EFAULT.  NaClVmIoWillStart() has made them
+ * writable already.
+ */
+static void NaClWriteWatchArm_mu(struct NaClApp *nap,
+                                 struct NaClWriteWatch *ww,
+                                 uint32_t first, uint32_t end) {
+  uint32_t page;
+
+  for (page = first; page < end; ++page) {
+    NaClWriteWatchLock(ww, page);
+    if (NaClWriteWatchIoInFlight_mu(nap, page)) {
+      ww->state[page] = NACL_WRITE_WATCH_WATCHED | NACL_WRITE_WATCH_DIRTY;
+    } else {
+      if (0 != NaClWriteWatchProtect(nap, page, 0)) {
+        NaClLog(LOG_FATAL, "NaClWriteWatchArm: mprotect failed\n");
+      }
+      ww->state[page] = NACL_WRITE_WATCH_WATCHED;
+    }
+    NaClWriteWatchUnlock(ww, page);
+  }
+}
+
+static void NaClWriteWatchDisarm_mu(struct NaClApp *nap,
+                                    struct NaClWriteWatch *ww,
+                                    uint32_t first, uint32_t end) {
+  uint32_t page;
+
+  for (page = first; page < end; ++page) {
+    if (0 == (ww->state[page] & NACL_WRITE_WATCH_WATCHED)) {
+      continue;
+    }
+    NaClWriteWatchLock(ww, page);
+    if (0 == (ww->state[page] & NACL_WRITE_WATCH_DIRTY) &&
+        0 != NaClWriteWatchProtect(nap, page, 1)) {
+      NaClLog(LOG_FATAL, "NaClWriteWatchDisarm: mprotect failed\n");
+    }
+    ww->state[page] = NACL_WRITE_WATCH_RELEASED;
+    NaClWriteWatchUnlock(ww, page);
+  }
+}
+
+/*
+ * Collects up to capacity dirty pages into pages[], protecting each
+ * against writes again before it is reported clean, so that no write
+ * can slip between the report and the reset.  Dirty pages which do not
+ * fit stay dirty for the next fetch, as do pages which the host kernel
+ * may still be writing to for a syscall in progress.
+ */
+static uint32_t NaClWriteWatchFetch_mu(struct NaClApp *nap,
+                                       struct NaClWriteWatch *ww,
+                                       uint32_t first, uint32_t end,
+                                       uint32_t *pages, uint32_t capacity) {
+  uint32_t page;
+  uint32_t count = 0;
+
+  for (page = first; page < end && count < capacity; ++page) {
+    if (ww->state[page] !=
+        (NACL_WRITE_WATCH_WATCHED | NACL_WRITE_WATCH_DIRTY)) {
+      continue;
+    }
+    if (NaClWriteWatchIoInFlight_mu(nap, page)) {
+      continue;
+    }
+    NaClWriteWatchLock(ww, page);
+    if (0 != NaClWriteWatchProtect(nap, page, 0)) {
+      NaClLog(LOG_FATAL, "NaClWriteWatchFetch: mprotect failed\n");
+    }
+    ww->state[page] = NACL_WRITE_WATCH_WATCHED;
+    NaClWriteWatchUnlock(ww, page);
+    pages[count++] = page << NACL_MAP_PAGESHIFT;
+  }
+  return count;
+}
+
+int NaClWriteWatchHandleFault(struct NaClApp *nap, uintptr_t sysaddr,
+                              uintptr_t prog_ctr) {
+  struct NaClWriteWatch *ww = nap->write_watch;
+  uint32_t page;
+  int handled = 0;
+
+  if (NULL == ww ||
+      sysaddr < nap->mem_start ||
+      sysaddr - nap->mem_start >= ((uintptr_t) 1 << nap->addr_bits)) {
+    return 0;
+  }
+  /*
+   * Watched pages are never executable, so a fault on fetching an
+   * instruction from one is not ours to handle.  Restarting it would
+   * only fault again.
+   */
+  if (prog_ctr <= sysaddr && sysaddr - prog_ctr < NACL_INSTR_BLOCK_SIZE) {
+    return 0;
+  }
+  page = (uint32_t) ((sysaddr - nap->mem_start) >> NACL_MAP_PAGESHIFT);
+  NaClWriteWatchLock(ww, page);
+  if (0 != (ww->state[page] & NACL_WRITE_WATCH_WATCHED)) {
+    /*
+     * If the page is dirty already, another thread recorded a write
+     * after this fault was taken, and the page is writable now.
+     */
+    ww->state[page] |= NACL_WRITE_WATCH_DIRTY;
+    handled = (0 == NaClWriteWatchProtect(nap, page, 1));
+  } else if (0 != (ww->state[page] & NACL_WRITE_WATCH_RELEASED)) {
+    /*
+     * The page was disarmed, unmapped or reprotected between the fault
+     * and this handler.  Retry the write under its current protection.
+     */
+    ww->state[page] = 0;
+    handled = 1;
+  }
+  NaClWriteWatchUnlock(ww, page);
+  return handled;
+}
+
+void NaClWriteWatchForget_mu(struct NaClApp *nap,
+                             uint32_t       addr_first_usr,
+                             uint32_t       addr_last_usr) {
+  struct NaClWriteWatch *ww = nap->write_watch;
+  uint32_t end;
+
+  if (NULL == ww || addr_last_usr < addr_first_usr) {
+    return;
+  }
+  end = (addr_last_usr >> NACL_MAP_PAGESHIFT) + 1;
+  if (end > ww->npages) {
+    end = ww->npages;
+  }
+  NaClWriteWatchDisarm_mu(nap, ww, addr_first_usr >> NACL_MAP_PAGESHIFT, end);
+}
+
+void NaClWriteWatchTouch_mu(struct NaClApp *nap,
+                            uint32_t       addr_first_usr,
+                            uint32_t       addr_last_usr) {
+  struct NaClWriteWatch *ww = nap->write_watch;
+  uint32_t page;
+  uint32_t end;
+
+  if (NULL == ww || addr_last_usr < addr_first_usr) {
+    return;
+  }
+  end = (addr_last_usr >> NACL_MAP_PAGESHIFT) + 1;
+  if (end > ww->npages) {
+    end = ww->npages;
+  }
+  for (page = addr_first_usr >> NACL_MAP_PAGESHIFT; page < end; ++page) {
+    if (ww->state[page] != NACL_WRITE_WATCH_WATCHED) {
+      continue;
+    }
+    NaClWriteWatchLock(ww, page);
+    if (ww->state[page] == NACL_WRITE_WATCH_WATCHED) {
+      ww->state[page] |= NACL_WRITE_WATCH_DIRTY;
+      if (0 != NaClWriteWatchProtect(nap, page, 1)) {
+        NaClLog(LOG_FATAL, "NaClWriteWatchTouch: mprotect failed\n");
+      }
+    }
+    NaClWriteWatchUnlock(ww, page);
+  }
+}
+
+int32_t NaClSysWriteWatch(struct NaClAppThread *natp,
+                          uint32_t             op,
+                          uint32_t             addr,
+                          uint32_t             length,
+                          uint32_t             pages,
+                          uint32_t             count_ptr) {
+  struct NaClApp *nap = natp->nap;
+  struct NaClWriteWatch *ww;
+  uint32_t first;
+  uint32_t end;
+  uint32_t capacity = 0;
+  uint32_t count = 0;
+  uint32_t *buffer = NULL;
+  int32_t retval = -NACL_ABI_EINVAL;
+
+  NaClLog(3,
+          ("Entered NaClSysWriteWatch(0x%08"NACL_PRIxPTR", %"NACL_PRIu32
+           ", 0x%08"NACL_PRIx32", 0x%"NACL_PRIx32", 0x%08"NACL_PRIx32
+           ", 0x%08"NACL_PRIx32")\n"),
+          (uintptr_t) natp, op, addr, length, pages, count_ptr);
+
+  if (!NaClIsAllocPageMultiple(addr) || !NaClIsAllocPageMultiple(length) ||
+      0 == length) {
+    return -NACL_ABI_EINVAL;
+  }
+  if (kNaClBadAddress == NaClUserToSysAddrRange(nap, addr, length)) {
+    return -NACL_ABI_EFAULT;
+  }
+  first = addr >> NACL_MAP_PAGESHIFT;
+  end = first + (length >> NACL_MAP_PAGESHIFT);
+
+  if (NACL_ABI_WRITE_WATCH_FETCH == op) {
+    if (!NaClCopyInFromUser(nap, &capacity, count_ptr, sizeof capacity)) {
+      return -NACL_ABI_EFAULT;
+    }
+    if (capacity > end - first) {
+      capacity = end - first;
+    }
+    buffer = (uint32_t *) malloc((capacity + 1) * sizeof *buffer);
+    if (NULL == buffer) {
+      return -NACL_ABI_ENOMEM;
+    }
+  }
+
+  NaClXMutexLock(&nap->mu);
+  switch (op) {
+    case NACL_ABI_WRITE_WATCH_ARM:
+      if (!NaClWriteWatchRangeIsWritable_mu(nap, addr, length)) {
+        retval = -NACL_ABI_EACCES;
+        break;
+      }
+      ww = NaClWriteWatchGet_mu(nap);
+      if (NULL == ww) {
+        retval = -NACL_ABI_ENOMEM;
+        break;
+      }
+      NaClWriteWatchArm_mu(nap, ww, first, end);
+      retval = 0;
+      break;
+    case NACL_ABI_WRITE_WATCH_DISARM:
+      NaClWriteWatchForget_mu(nap, addr, addr + length - 1);
+      retval = 0;
+      break;
+    case NACL_ABI_WRITE_WATCH_FETCH:
+      if (NULL != nap->write_watch) {
+        count = NaClWriteWatchFetch_mu(nap, nap->write_watch, first, end,
+                                       buffer, capacity);
+      }
+      retval = 0;
+      break;
+  }
+  NaClXMutexUnlock(&nap->mu);
+
+  if (NACL_ABI_WRITE_WATCH_FETCH == op) {
+    /*
+     * The pages have been reset already, so a fault here loses their
+     * dirty state; that is the caller's bug, as with read() into a bad
+     * buffer.
+     */
+    if (!NaClCopyOutToUser(nap, pages, buffer, count * sizeof *buffer) ||
+        !NaClCopyOutToUser(nap, count_ptr, &count, sizeof count)) {
+      retval = -NACL_ABI_EFAULT;
+    }
+    free(buffer);
+  }
+  return retval;
+}
+
+#else
+
+int NaClWriteWatchHandleFault(struct NaClApp *nap, uintptr_t sysaddr,
+                              uintptr_t prog_ctr) {
+  UNREFERENCED_PARAMETER(nap);
+  UNREFERENCED_PARAMETER(sysaddr);
+  UNREFERENCED_PARAMETER(prog_ctr);
+  return 0;
+}
+
+void NaClWriteWatchForget_mu(struct NaClApp *nap,
+                             uint32_t       addr_first_usr,
+                             uint32_t       addr_last_usr) {
+  UNREFERENCED_PARAMETER(nap);
+  UNREFERENCED_PARAMETER(addr_first_usr);
+  UNREFERENCED_PARAMETER(addr_last_usr);
+}
+
+void NaClWriteWatchTouch_mu(struct NaClApp *nap,
+                            uint32_t       addr_first_usr,
+                            uint32_t       addr_last_usr) {
+  UNREFERENCED_PARAMETER(nap);
+  UNREFERENCED_PARAMETER(addr_first_usr);
+  UNREFERENCED_PARAMETER(addr_last_usr);
+}
+
+/*
+ * Other hosts would need their own fault path (a vectored exception
+ * handler on Windows, a Mach exception port on Mac OS X).
+ */
+int32_t NaClSysWriteWatch(struct NaClAppThread *natp,
+                          uint32_t             op,
+                          uint32_t             addr,
+                          uint32_t             length,
+                          uint32_t             pages,
+                          uint32_t             count_ptr) {
+  UNREFERENCED_PARAMETER(natp);
+  UNREFERENCED_PARAMETER(op);
+  UNREFERENCED_PARAMETER(addr);
+  UNREFERENCED_PARAMETER(length);
+  UNREFERENCED_PARAMETER(pages);
+  UNREFERENCED_PARAMETER(count_ptr);
+  return -NACL_ABI_ENOSYS;
+}
+
+#endif
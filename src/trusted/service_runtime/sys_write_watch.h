@@ -0,0 +1,73 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * NaCl service run-time, write_watch system call.
+ *
+ * Tracks which 64KB pages of a watched range untrusted code has written,
+ * so that a garbage collector running in the sandbox can rescan just
+ * those pages after concurrent marking.  Watched pages which are clean
+ * are kept read-only on the host; the first write faults, and the
+ * SIGSEGV handler marks the page dirty and makes it writable again
+ * before the write is restarted.  This is only implemented on Linux.
+ *
+ * Writes into watched pages made by trusted code (NaClCopyOutToUser()
+ * etc.) fault and are recorded the same way.  Writes made by the host
+ * kernel on behalf of a syscall would fail with EFAULT instead, so
+ * ranges passed to NaClVmIoWillStart() are marked dirty up front.
+ */
+
+#ifndef NATIVE_CLIENT_SERVICE_RUNTIME_NACL_SYS_WRITE_WATCH_H__
+#define NATIVE_CLIENT_SERVICE_RUNTIME_NACL_SYS_WRITE_WATCH_H__ 1
+
+#include "native_client/src/include/portability.h"
+
+#include "native_client/src/include/nacl_base.h"
+
+EXTERN_C_BEGIN
+
+struct NaClApp;
+struct NaClAppThread;
+
+int32_t NaClSysWriteWatch(struct NaClAppThread *natp,
+                          uint32_t             op,
+                          uint32_t             addr,
+                          uint32_t             length,
+                          uint32_t             pages,
+                          uint32_t             count_ptr);
+
+/*
+ * Called from the SIGSEGV handler, so must be async-signal-safe.
+ * sysaddr is the faulting address and prog_ctr the faulting
+ * instruction.  Returns 1 if the fault was a write to a watched page,
+ * which has now been recorded and made writable, or to a page that was
+ * disarmed since the fault, so the faulting instruction can be
+ * restarted.
+ */
+int NaClWriteWatchHandleFault(struct NaClApp *nap, uintptr_t sysaddr,
+                              uintptr_t prog_ctr);
+
+/*
+ * Stops watching the pages overlapping the given user address range.
+ * Called with nap->mu held before the range is unmapped, remapped or
+ * has its protection changed.
+ */
+void NaClWriteWatchForget_mu(struct NaClApp *nap,
+                             uint32_t       addr_first_usr,
+                             uint32_t       addr_last_usr);
+
+/*
+ * Marks the watched pages overlapping the given user address range
+ * dirty and writable, so that the host kernel can write to them.
+ * Called with nap->mu held.
+ */
+void NaClWriteWatchTouch_mu(struct NaClApp *nap,
+                            uint32_t       addr_first_usr,
+                            uint32_t       addr_last_usr);
+
+EXTERN_C_END
+
+#endif  /* NATIVE_CLIENT_SERVICE_RUNTIME_NACL_SYS_WRITE_WATCH_H__ */
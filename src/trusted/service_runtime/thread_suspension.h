@@ -29,6 +29,25 @@ struct NaClSignalContext;
  */
 void NaClUntrustedThreadSuspend(struct NaClAppThread *natp, int save_registers);
 
+/*
+ * NaClUntrustedThreadSuspend() is NaClUntrustedThreadSuspendBegin()
+ * followed by NaClUntrustedThreadSuspendFinish().
+ *
+ * NaClUntrustedThreadSuspendBegin() asks the thread to suspend but
+ * does not wait for the request to take effect.
+ * NaClUntrustedThreadSuspendFinish() waits until the thread has
+ * suspended and, if save_registers is set, saves its registers.  It
+ * must be passed the same save_registers value.  Between the two
+ * calls, the thread's state must not be examined.
+ *
+ * Splitting these lets NaClUntrustedThreadsSuspendAll() have all
+ * threads suspending at once, rather than waiting for each in turn.
+ */
+void NaClUntrustedThreadSuspendBegin(struct NaClAppThread *natp,
+                                     int save_registers);
+void NaClUntrustedThreadSuspendFinish(struct NaClAppThread *natp,
+                                      int save_registers);
+
 /*
  * NaClUntrustedThreadResume() resumes a single thread that was
  * previously suspended with NaClUntrustedThreadSuspend().
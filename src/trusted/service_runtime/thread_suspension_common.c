@@ -16,22 +16,32 @@
 #include "native_client/src/trusted/service_runtime/thread_suspension_unwind.h"
 #include "native_client/src/trusted/service_runtime/win/debug_exception_handler.h"
 
+void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
+                                int save_registers) {
+  NaClUntrustedThreadSuspendBegin(natp, save_registers);
+  NaClUntrustedThreadSuspendFinish(natp, save_registers);
+}
+
 void NaClUntrustedThreadsSuspendAll(struct NaClApp *nap, int save_registers) {
   size_t index;
 
   NaClXMutexLock(&nap->threads_mu);
 
   /*
-   * TODO(mseaborn): A possible refinement here would be to use separate loops
-   * for initiating and waiting for the suspension of the threads.  This might
-   * be faster, since we would not be waiting for each thread to suspend one by
-   * one.  It would take advantage of the asynchronous nature of thread
-   * suspension.
+   * Ask all the threads to suspend before waiting for any of them, so
+   * that the threads suspend in parallel and the total pause is close
+   * to the time taken by the slowest thread rather than the sum.
    */
   for (index = 0; index < nap->threads.num_entries; index++) {
     struct NaClAppThread *natp = NaClGetThreadMu(nap, (int) index);
     if (natp != NULL) {
-      NaClUntrustedThreadSuspend(natp, save_registers);
+      NaClUntrustedThreadSuspendBegin(natp, save_registers);
+    }
+  }
+  for (index = 0; index < nap->threads.num_entries; index++) {
+    struct NaClAppThread *natp = NaClGetThreadMu(nap, (int) index);
+    if (natp != NULL) {
+      NaClUntrustedThreadSuspendFinish(natp, save_registers);
     }
   }
 }
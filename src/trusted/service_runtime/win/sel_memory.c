@@ -402,3 +402,9 @@ int NaClMadvise(void *start, size_t length, int advice) {
   NaClLog(5, "NaClMadvise: done\n");
   return 0;
 }
+
+void NaClHugePageAdvise(void *start, size_t length) {
+  /* Large pages on Windows must be committed up front; not supported. */
+  UNREFERENCED_PARAMETER(start);
+  UNREFERENCED_PARAMETER(length);
+}
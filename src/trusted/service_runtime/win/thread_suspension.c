@@ -36,8 +36,10 @@ void NaClAppThreadSetSuspendState(struct NaClAppThread *natp,
   NaClXMutexUnlock(&natp->suspend_mu);
 }
 
-void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
-                                int save_registers) {
+void NaClUntrustedThreadSuspendBegin(struct NaClAppThread *natp,
+                                     int save_registers) {
+  UNREFERENCED_PARAMETER(save_registers);
+
   /*
    * We claim suspend_mu here to block trusted/untrusted context
    * switches by blocking NaClAppThreadSetSuspendState().  This blocks
@@ -48,21 +50,30 @@ void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
    */
   NaClXMutexLock(&natp->suspend_mu);
   if (natp->suspend_state == NACL_APP_THREAD_UNTRUSTED) {
-    CONTEXT temp_context;
-    CONTEXT *context;
-    HANDLE thread_handle = GetHostThreadHandle(natp);
-
-    if (SuspendThread(thread_handle) == (DWORD) -1) {
-      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspend: "
+    if (SuspendThread(GetHostThreadHandle(natp)) == (DWORD) -1) {
+      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspendBegin: "
               "SuspendThread() call failed, error %u\n",
               GetLastError());
     }
+  }
+  /*
+   * We leave suspend_mu held so that NaClAppThreadSetSuspendState()
+   * will block.
+   */
+}
+
+void NaClUntrustedThreadSuspendFinish(struct NaClAppThread *natp,
+                                      int save_registers) {
+  if (natp->suspend_state == NACL_APP_THREAD_UNTRUSTED) {
+    CONTEXT temp_context;
+    CONTEXT *context;
 
     if (save_registers) {
       if (natp->suspended_registers == NULL) {
         natp->suspended_registers = malloc(sizeof(*natp->suspended_registers));
         if (natp->suspended_registers == NULL) {
-          NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspend: malloc() failed\n");
+          NaClLog(LOG_FATAL,
+                  "NaClUntrustedThreadSuspendFinish: malloc() failed\n");
         }
       }
       context = &natp->suspended_registers->context;
@@ -86,16 +97,12 @@ void NaClUntrustedThreadSuspend(struct NaClAppThread *natp,
       context->ContextFlags = CONTEXT_CONTROL;
     }
 
-    if (!GetThreadContext(thread_handle, context)) {
-      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspend: "
+    if (!GetThreadContext(GetHostThreadHandle(natp), context)) {
+      NaClLog(LOG_FATAL, "NaClUntrustedThreadSuspendFinish: "
               "GetThreadContext() failed, error %u\n",
               GetLastError());
     }
   }
-  /*
-   * We leave suspend_mu held so that NaClAppThreadSetSuspendState()
-   * will block.
-   */
 }
 
 void NaClUntrustedThreadResume(struct NaClAppThread *natp) {
@@ -4,12 +4,23 @@
  * found in the LICENSE file.
  */
 
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "native_client/src/include/build_config.h"
+
+#if !NACL_WINDOWS
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
 #include "native_client/src/include/elf.h"
 #include "native_client/src/include/elf_constants.h"
+#include "native_client/src/include/portability_io.h"
 #include "native_client/src/shared/platform/nacl_check.h"
 #include "native_client/src/trusted/validator/driver/elf_load.h"
 
@@ -38,109 +49,237 @@ void ReadImage(const char *filename, Image *image) {
 }
 
 
+MappedFile::MappedFile() : data_(NULL), size_(0), mapped_(false) {
+}
+
+
+MappedFile::~MappedFile() {
+#if !NACL_WINDOWS
+  if (mapped_)
+    munmap(const_cast<uint8_t *>(data_), size_);
+#endif
+}
+
+
+bool MappedFile::Map(const char *filename, std::string *error) {
+  CHECK(data_ == NULL && size_ == 0);
+#if NACL_WINDOWS
+  FILE *fp = fopen(filename, "rb");
+  if (fp == NULL) {
+    *error = std::string("Failed to open input file: ") + filename;
+    return false;
+  }
+  fseek(fp, 0, SEEK_END);
+  size_t file_size = ftell(fp);
+  contents_.resize(file_size);
+  fseek(fp, 0, SEEK_SET);
+  size_t got = file_size == 0 ? 0 : fread(&contents_[0], 1, file_size, fp);
+  fclose(fp);
+  if (got != file_size) {
+    *error = std::string("Unable to read image from input file: ") + filename;
+    return false;
+  }
+  data_ = contents_.empty() ? NULL : &contents_[0];
+  size_ = file_size;
+  return true;
+#else
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    *error = std::string("Failed to open input file: ") + filename + ": " +
+             strerror(errno);
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    *error = std::string("Unable to stat input file: ") + filename + ": " +
+             strerror(errno);
+    close(fd);
+    return false;
+  }
+  // Mapping an empty file fails, and there is nothing to map anyway.
+  if (st.st_size > 0) {
+    void *addr = mmap(NULL, static_cast<size_t>(st.st_size), PROT_READ,
+                      MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      *error = std::string("Unable to map input file: ") + filename + ": " +
+               strerror(errno);
+      close(fd);
+      return false;
+    }
+    data_ = reinterpret_cast<const uint8_t *>(addr);
+    size_ = static_cast<size_t>(st.st_size);
+    mapped_ = true;
+  }
+  close(fd);
+  return true;
+#endif
+}
+
+
 template<typename ElfEhdrType, typename ElfPhdrType>
-Segment FindTextSegment(const Image &image) {
-  // Initialization only to suppress 'uninitialized' warning.
-  Segment segment = {NULL, 0, 0};
+bool FindTextSegment(const uint8_t *data, size_t size,
+                     Segment *segment, std::string *error) {
   bool found = false;
 
-  const ElfEhdrType &header = *reinterpret_cast<const ElfEhdrType *>(&image[0]);
-  CHECK(sizeof(header) <= image.size());
+  if (size < sizeof(ElfEhdrType)) {
+    *error = "ELF header is truncated.";
+    return false;
+  }
+  const ElfEhdrType &header = *reinterpret_cast<const ElfEhdrType *>(data);
   CHECK(memcmp(header.e_ident, ELFMAG, SELFMAG) == 0);
 
   for (uint64_t index = 0; index < header.e_phnum; ++index) {
     uint64_t phdr_offset = header.e_phoff + header.e_phentsize * index;
+    if (phdr_offset > size || size - phdr_offset < sizeof(ElfPhdrType)) {
+      *error = "Program header is outside of the file.";
+      return false;
+    }
     // static_cast to silence msvc on 32-bit platform
     const ElfPhdrType &phdr = *reinterpret_cast<const ElfPhdrType *>(
-        &image[static_cast<size_t>(phdr_offset)]);
+        &data[static_cast<size_t>(phdr_offset)]);
 
     // TODO(shcherbina): size of other loadable segments
     if (phdr.p_type == PT_LOAD && (phdr.p_flags & PF_X)) {
       if (found) {
-        printf("More than one text segment.\n");
-        exit(1);
+        *error = "More than one text segment.";
+        return false;
       }
 
       if (phdr.p_flags != (PF_R | PF_X)) {
+        char buf[100];
         // Cast to support 64-bit ELF.
-        printf("Text segment is expected to have flags PF_R | PF_X "
-               "(has 0x%" NACL_PRIx64 " instead).\n",
-               static_cast<uint64_t>(phdr.p_flags));
-        exit(1);
+        SNPRINTF(buf, sizeof(buf),
+                 "Text segment is expected to have flags PF_R | PF_X "
+                 "(has 0x%" NACL_PRIx64 " instead).",
+                 static_cast<uint64_t>(phdr.p_flags));
+        *error = buf;
+        return false;
       }
 
-      CHECK(phdr.p_filesz <= phdr.p_memsz);
+      if (phdr.p_filesz > phdr.p_memsz) {
+        *error = "File image is larger than memory image size.";
+        return false;
+      }
       if (phdr.p_filesz < phdr.p_memsz) {
-        printf("File image is smaller than memory image size.\n");
-        exit(1);
+        *error = "File image is smaller than memory image size.";
+        return false;
       }
 
       // TODO(shcherbina): find or introduce proper constant.
       if (phdr.p_filesz > 256 << 20) {
-        printf("Test segment is too large.\n");
-        exit(1);
+        *error = "Test segment is too large.";
+        return false;
       }
 
       if (phdr.p_vaddr > UINT32_MAX - phdr.p_filesz) {
-        printf("Text segment does not fit in 4GB.\n");
-        exit(1);
+        *error = "Text segment does not fit in 4GB.";
+        return false;
       }
 
-      segment.data = &image[static_cast<size_t>(phdr.p_offset)];
-      segment.size = static_cast<uint32_t>(phdr.p_filesz);
-      segment.vaddr = static_cast<uint32_t>(phdr.p_vaddr);
+      if (phdr.p_offset > size || size - phdr.p_offset < phdr.p_filesz) {
+        *error = "Text segment is outside of the file.";
+        return false;
+      }
+
+      segment->data = &data[static_cast<size_t>(phdr.p_offset)];
+      segment->size = static_cast<uint32_t>(phdr.p_filesz);
+      segment->vaddr = static_cast<uint32_t>(phdr.p_vaddr);
       found = true;
     }
   }
   if (!found) {
-    printf("Text segment not found.\n");
-    exit(1);
+    *error = "Text segment not found.";
+    return false;
   }
-  return segment;
+  return true;
 }
 
 
-Architecture GetElfArch(const Image &image) {
+static bool CheckElfMagic(const uint8_t *data, size_t size,
+                          std::string *error) {
+  // We don't know in advance whether it's elf32 or elf64, but we are only
+  // looking at few first fields of the header, and they are the same for
+  // Elf32_Ehdr and Elf64_Ehdr.
+  if (size < sizeof(Elf32_Ehdr) || memcmp(data, ELFMAG, SELFMAG) != 0) {
+    *error = "Not an ELF file.";
+    return false;
+  }
+  return true;
+}
+
+
+bool FindElfArch(const uint8_t *data, size_t size,
+                 Architecture *architecture, std::string *error) {
+  if (!CheckElfMagic(data, size, error))
+    return false;
+
   // e_machine field is the same for Elf32_Ehdr and Elf64_Ehdr.
-  const Elf32_Ehdr &header = *reinterpret_cast<const Elf32_Ehdr *>(&image[0]);
+  const Elf32_Ehdr &header = *reinterpret_cast<const Elf32_Ehdr *>(data);
   switch (header.e_machine) {
     case EM_386:
-      return X86_32;
+      *architecture = X86_32;
+      return true;
     case EM_X86_64:
-      return X86_64;
+      *architecture = X86_64;
+      return true;
     case EM_ARM:
-      return ARM;
-    default:
-      printf("Unsupported e_machine %" NACL_PRIu16 ".\n", header.e_machine);
-      exit(1);
+      *architecture = ARM;
+      return true;
+    default: {
+      char buf[100];
+      SNPRINTF(buf, sizeof(buf), "Unsupported e_machine %" NACL_PRIu16 ".",
+               header.e_machine);
+      *error = buf;
+      return false;
+    }
   }
 }
 
 
-Segment GetElfTextSegment(const Image &image) {
-  // We don't know in advance whether it's elf32 or elf64, but we are only
-  // looking at few first fields of the header, and they are the same for
-  // Elf32_Ehdr and Elf64_Ehdr.
-  const Elf32_Ehdr &header = *reinterpret_cast<const Elf32_Ehdr *>(&image[0]);
-  if (image.size() < sizeof(header) ||
-      memcmp(header.e_ident, ELFMAG, SELFMAG) != 0) {
-    printf("Not an ELF file.\n");
-    exit(1);
-  }
+bool FindElfTextSegment(const uint8_t *data, size_t size,
+                        Segment *segment, std::string *error) {
+  if (!CheckElfMagic(data, size, error))
+    return false;
 
-  Segment segment;
+  const Elf32_Ehdr &header = *reinterpret_cast<const Elf32_Ehdr *>(data);
   switch (header.e_ident[EI_CLASS]) {
     case ELFCLASS32:
-      segment = FindTextSegment<Elf32_Ehdr, Elf32_Phdr>(image);
-      break;
+      return FindTextSegment<Elf32_Ehdr, Elf32_Phdr>(data, size, segment,
+                                                     error);
     case ELFCLASS64:
-      segment = FindTextSegment<Elf64_Ehdr, Elf64_Phdr>(image);
-      break;
-    default:
-      printf("Invalid ELF class %d.\n", header.e_ident[EI_CLASS]);
-      exit(1);
+      return FindTextSegment<Elf64_Ehdr, Elf64_Phdr>(data, size, segment,
+                                                     error);
+    default: {
+      char buf[100];
+      SNPRINTF(buf, sizeof(buf), "Invalid ELF class %d.",
+               header.e_ident[EI_CLASS]);
+      *error = buf;
+      return false;
+    }
   }
+}
 
+
+Architecture GetElfArch(const Image &image) {
+  Architecture architecture;
+  std::string error;
+  if (!FindElfArch(image.empty() ? NULL : &image[0], image.size(),
+                   &architecture, &error)) {
+    printf("%s\n", error.c_str());
+    exit(1);
+  }
+  return architecture;
+}
+
+
+Segment GetElfTextSegment(const Image &image) {
+  Segment segment;
+  std::string error;
+  if (!FindElfTextSegment(image.empty() ? NULL : &image[0], image.size(),
+                          &segment, &error)) {
+    printf("%s\n", error.c_str());
+    exit(1);
+  }
   return segment;
 }
 
@@ -7,8 +7,10 @@
 #ifndef NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_DRIVER_ELF_LOAD_H_
 #define NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_DRIVER_ELF_LOAD_H_
 
+#include <string>
 #include <vector>
 
+#include "native_client/src/include/nacl_macros.h"
 #include "native_client/src/include/portability.h"
 
 
@@ -22,6 +24,30 @@ typedef std::vector<uint8_t> Image;
 void ReadImage(const char *filename, Image *image);
 
 
+// Read-only view of a whole ELF file, mapped rather than read so that
+// validating many files does not copy each of them.  Where mapping is
+// not available the file is read into memory instead.
+class MappedFile {
+ public:
+  MappedFile();
+  ~MappedFile();
+
+  // Returns false and describes the problem in *error on failure.
+  bool Map(const char *filename, std::string *error);
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const uint8_t *data_;
+  size_t size_;
+  bool mapped_;
+  Image contents_;
+
+  NACL_DISALLOW_COPY_AND_ASSIGN(MappedFile);
+};
+
+
 enum Architecture {
   X86_32,
   X86_64,
@@ -44,6 +70,16 @@ struct Segment {
 
 Segment GetElfTextSegment(const Image &image);
 
+
+// Variants of GetElfArch() and GetElfTextSegment() for callers which go
+// on after a bad file: instead of exiting, they return false and describe
+// the problem in *error.  They also check that the headers and the text
+// segment lie within the file.
+bool FindElfArch(const uint8_t *data, size_t size,
+                 Architecture *architecture, std::string *error);
+bool FindElfTextSegment(const uint8_t *data, size_t size,
+                        Segment *segment, std::string *error);
+
 }  // namespace elf_load
 
 #endif
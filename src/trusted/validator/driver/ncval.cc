@@ -9,15 +9,30 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include <vector>
 
+#include "native_client/src/include/build_config.h"
+
+#if NACL_WINDOWS
+# include <windows.h>
+#else
+# include <dirent.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
 #include "native_client/src/include/elf.h"
 #include "native_client/src/include/elf_constants.h"
 #include "native_client/src/include/nacl_macros.h"
 #include "native_client/src/include/portability_io.h"
 #include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/shared/platform/nacl_threads.h"
+#include "native_client/src/shared/platform/nacl_time.h"
+#include "native_client/src/shared/platform/platform_init.h"
 #include "native_client/src/shared/utils/types.h"
 #include "native_client/src/trusted/cpu_features/arch/arm/cpu_arm.h"
 #include "native_client/src/trusted/validator/driver/elf_load.h"
@@ -340,23 +355,260 @@ bool ValidateArm(const Segment &segment, vector<Error> *errors) {
 }
 
 
+bool ValidateSegment(elf_load::Architecture architecture,
+                     const Segment &segment,
+                     vector<Error> *errors,
+                     uint32_t flags) {
+  switch (architecture) {
+    case elf_load::X86_32:
+      return ValidateX86(segment, ValidateChunkIA32, errors, flags);
+    case elf_load::X86_64:
+      return ValidateX86(segment, ValidateChunkAMD64, errors, flags);
+    case elf_load::ARM:
+      return ValidateArm(segment, errors);
+    default:
+      CHECK(false);
+  }
+  return false;
+}
+
+
+// Batch mode validates many files in one process, spread over a pool of
+// worker threads, and reports on each of them in JSON, one object per
+// line, in the order the files were given.  A file which cannot be
+// validated at all (unreadable, not ELF, ...) is reported as an error
+// rather than ending the batch.
+
+struct BatchResult {
+  BatchResult() : architecture(elf_load::X86_32), status(kError),
+                  map_us(0), validate_us(0) {}
+  elf_load::Architecture architecture;
+  enum { kValid, kInvalid, kError } status;
+  string load_error;
+  vector<Error> errors;
+  int64_t map_us;
+  int64_t validate_us;
+};
+
+
+struct Batch {
+  vector<string> files;
+  vector<BatchResult> results;
+  uint32_t flags;
+  struct NaClMutex mu;
+  size_t next_file;  // Protected by mu.
+};
+
+
+void ValidateBatchFile(const string &filename, uint32_t flags,
+                       BatchResult *result) {
+  int64_t start = NaClGetTimeOfDayMicroseconds();
+  elf_load::MappedFile file;
+  Segment segment;
+  bool ok = file.Map(filename.c_str(), &result->load_error) &&
+            elf_load::FindElfArch(file.data(), file.size(),
+                                  &result->architecture,
+                                  &result->load_error) &&
+            elf_load::FindElfTextSegment(file.data(), file.size(),
+                                         &segment, &result->load_error);
+  int64_t mapped = NaClGetTimeOfDayMicroseconds();
+  result->map_us = mapped - start;
+  if (!ok) {
+    result->status = BatchResult::kError;
+    return;
+  }
+
+  bool valid = ValidateSegment(result->architecture, segment,
+                               &result->errors, flags);
+  result->validate_us = NaClGetTimeOfDayMicroseconds() - mapped;
+  result->status = valid ? BatchResult::kValid : BatchResult::kInvalid;
+}
+
+
+void WINAPI BatchWorker(void *state) {
+  Batch *batch = reinterpret_cast<Batch *>(state);
+  for (;;) {
+    NaClXMutexLock(&batch->mu);
+    size_t index = batch->next_file++;
+    NaClXMutexUnlock(&batch->mu);
+    if (index >= batch->files.size())
+      break;
+    ValidateBatchFile(batch->files[index], batch->flags,
+                      &batch->results[index]);
+  }
+}
+
+
+bool IsElfFile(const string &filename) {
+  char magic[SELFMAG];
+  FILE *fp = fopen(filename.c_str(), "rb");
+  if (fp == NULL)
+    return false;
+  bool is_elf = fread(magic, 1, SELFMAG, fp) == SELFMAG &&
+                memcmp(magic, ELFMAG, SELFMAG) == 0;
+  fclose(fp);
+  return is_elf;
+}
+
+
+// Adds the ELF files under the directory "path", recursively, in sorted
+// order.  Returns false if "path" is not a directory.
+bool AddBatchDirectory(const string &path, vector<string> *files) {
+#if NACL_WINDOWS
+  UNREFERENCED_PARAMETER(path);
+  UNREFERENCED_PARAMETER(files);
+  return false;
+#else
+  DIR *dir = opendir(path.c_str());
+  if (dir == NULL)
+    return false;
+  vector<string> names;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL) {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+      names.push_back(entry->d_name);
+  }
+  closedir(dir);
+  std::sort(names.begin(), names.end());
+
+  for (size_t i = 0; i < names.size(); i++) {
+    string child = path + "/" + names[i];
+    struct stat st;
+    if (stat(child.c_str(), &st) != 0)
+      continue;
+    if (S_ISDIR(st.st_mode)) {
+      AddBatchDirectory(child, files);
+    } else if (S_ISREG(st.st_mode) && IsElfFile(child)) {
+      files->push_back(child);
+    }
+  }
+  return true;
+#endif
+}
+
+
+// Adds the files listed in a manifest, one per line.  Blank lines and
+// lines starting with '#' are ignored.  "-" reads the manifest from stdin.
+bool AddBatchManifest(const string &path, vector<string> *files) {
+  FILE *fp = path == "-" ? stdin : fopen(path.c_str(), "r");
+  if (fp == NULL)
+    return false;
+  char line[4096];
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    size_t len = strlen(line);
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+      line[--len] = '\0';
+    if (len > 0 && line[0] != '#')
+      files->push_back(line);
+  }
+  if (fp != stdin)
+    fclose(fp);
+  return true;
+}
+
+
+string JsonString(const string &str) {
+  string out = "\"";
+  for (size_t i = 0; i < str.size(); i++) {
+    unsigned char ch = static_cast<unsigned char>(str[i]);
+    if (ch == '"' || ch == '\\') {
+      out += '\\';
+      out += ch;
+    } else if (ch < 0x20) {
+      char buf[8];
+      SNPRINTF(buf, sizeof(buf), "\\u%04x", ch);
+      out += buf;
+    } else {
+      out += ch;
+    }
+  }
+  return out + "\"";
+}
+
+
+const char *ArchitectureName(elf_load::Architecture architecture) {
+  switch (architecture) {
+    case elf_load::X86_32:
+      return "x86-32";
+    case elf_load::X86_64:
+      return "x86-64";
+    case elf_load::ARM:
+      return "arm";
+  }
+  return "unknown";
+}
+
+
+void WriteBatchResult(FILE *out, const string &filename,
+                      const BatchResult &result) {
+  static const char *const kStatusNames[] = { "valid", "invalid", "error" };
+
+  fprintf(out, "{\"file\": %s, \"result\": \"%s\"",
+          JsonString(filename).c_str(), kStatusNames[result.status]);
+  if (result.status == BatchResult::kError) {
+    fprintf(out, ", \"error\": %s", JsonString(result.load_error).c_str());
+  } else {
+    fprintf(out, ", \"arch\": \"%s\"",
+            ArchitectureName(result.architecture));
+  }
+  fprintf(out, ", \"map_us\": %" NACL_PRId64 ", \"validate_us\": %"
+          NACL_PRId64, result.map_us, result.validate_us);
+  if (!result.errors.empty()) {
+    fprintf(out, ", \"errors\": [");
+    for (size_t i = 0; i < result.errors.size(); i++) {
+      const Error &e = result.errors[i];
+      fprintf(out, "%s{\"offset\": \"0x%" NACL_PRIx32 "\", \"message\": %s}",
+              i == 0 ? "" : ", ", e.offset, JsonString(e.message).c_str());
+    }
+    fprintf(out, "]");
+  }
+  fprintf(out, "}\n");
+}
+
+
+int DefaultBatchJobs() {
+#if NACL_WINDOWS
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return static_cast<int>(info.dwNumberOfProcessors);
+#else
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  return cpus > 0 ? static_cast<int>(cpus) : 1;
+#endif
+}
+
+
 void Usage() {
   fprintf(stderr, "Usage:\n");
   fprintf(stderr, "    ncval [-vd] <ELF file>\n");
+  fprintf(stderr, "    ncval -b [-vd] [-j jobs] [-o report] "
+          "<manifest or directory>...\n");
+  fprintf(stderr, "\n");
+  fprintf(stderr, "With -b, each argument is a directory, whose ELF files "
+          "are validated\n");
+  fprintf(stderr, "recursively, or a manifest listing one file per line "
+          "(\"-\" for stdin).\n");
+  fprintf(stderr, "A JSON report line per file is written to the report "
+          "file (default stdout).\n");
 }
 
 
 struct Options {
-  Options() : input_file(NULL), verbose(false), flags(0) {}
+  Options() : input_file(NULL), verbose(false), flags(0), batch(false),
+              jobs(0), report_file(NULL) {}
   const char *input_file;
   bool verbose;
   uint32_t flags;
+  bool batch;
+  int jobs;
+  const char *report_file;
+  vector<string> batch_inputs;
 };
 
 
 void ParseOptions(int argc, char **argv, Options *options) {
   int opt;
-  while ((opt = getopt(argc, argv, "vd")) != -1) {
+  while ((opt = getopt(argc, argv, "vdbj:o:")) != -1) {
     switch (opt) {
       case 'v':
         options->verbose = true;
@@ -364,6 +616,20 @@ void ParseOptions(int argc, char **argv, Options *options) {
       case 'd':
         options->flags = NACL_DISABLE_NONTEMPORALS_X86;
         break;
+      case 'b':
+        options->batch = true;
+        break;
+      case 'j':
+        options->jobs = atoi(optarg);
+        if (options->jobs <= 0) {
+          fprintf(stderr, "ERROR: bad number of jobs: %s\n\n", optarg);
+          Usage();
+          exit(1);
+        }
+        break;
+      case 'o':
+        options->report_file = optarg;
+        break;
       default:
         fprintf(stderr, "ERROR: unknown option: [%c]\n\n", opt);
         Usage();
@@ -371,6 +637,23 @@ void ParseOptions(int argc, char **argv, Options *options) {
     }
   }
 
+  if (options->batch) {
+    if (argc - optind < 1) {
+      fprintf(stderr, "ERROR: no manifest or directory provided\n\n");
+      Usage();
+      exit(1);
+    }
+    for (int i = optind; i < argc; i++)
+      options->batch_inputs.push_back(argv[i]);
+    return;
+  }
+
+  if (options->jobs != 0 || options->report_file != NULL) {
+    fprintf(stderr, "ERROR: -j and -o are only used with -b\n\n");
+    Usage();
+    exit(1);
+  }
+
   if (argc - optind != 1) {
     fprintf(stderr, "ERROR: too many arguments provided\n\n");
     Usage();
@@ -381,10 +664,82 @@ void ParseOptions(int argc, char **argv, Options *options) {
 }
 
 
+int RunBatch(const Options &options) {
+  Batch batch;
+  for (size_t i = 0; i < options.batch_inputs.size(); i++) {
+    const string &input = options.batch_inputs[i];
+    if (!AddBatchDirectory(input, &batch.files) &&
+        !AddBatchManifest(input, &batch.files)) {
+      fprintf(stderr, "ERROR: cannot read manifest or directory: %s\n",
+              input.c_str());
+      return 1;
+    }
+  }
+
+  FILE *report = stdout;
+  if (options.report_file != NULL) {
+    report = fopen(options.report_file, "w");
+    if (report == NULL) {
+      fprintf(stderr, "ERROR: cannot open report file: %s\n",
+              options.report_file);
+      return 1;
+    }
+  }
+
+  NaClPlatformInit();
+  int64_t start = NaClGetTimeOfDayMicroseconds();
+
+  batch.results.resize(batch.files.size());
+  batch.flags = options.flags;
+  batch.next_file = 0;
+  NaClXMutexCtor(&batch.mu);
+
+  size_t jobs = options.jobs > 0 ? options.jobs : DefaultBatchJobs();
+  jobs = std::min(jobs, batch.files.size());
+  // The x86 validators keep their jump target bitmaps on the heap, so
+  // workers do not need big stacks.
+  static const size_t kWorkerStackSize = 1 << 20;
+  vector<struct NaClThread> threads(jobs);
+  for (size_t i = 0; i < jobs; i++) {
+    CHECK(NaClThreadCreateJoinable(&threads[i], BatchWorker, &batch,
+                                   kWorkerStackSize));
+  }
+  for (size_t i = 0; i < jobs; i++)
+    NaClThreadJoin(&threads[i]);
+  NaClMutexDtor(&batch.mu);
+
+  size_t counts[3] = { 0, 0, 0 };
+  for (size_t i = 0; i < batch.files.size(); i++) {
+    WriteBatchResult(report, batch.files[i], batch.results[i]);
+    counts[batch.results[i].status]++;
+  }
+  if (report != stdout)
+    fclose(report);
+
+  int64_t elapsed_us = NaClGetTimeOfDayMicroseconds() - start;
+  if (options.verbose ||
+      counts[BatchResult::kInvalid] + counts[BatchResult::kError] != 0) {
+    fprintf(stderr,
+            "%" NACL_PRIuS " files: %" NACL_PRIuS " valid, %" NACL_PRIuS
+            " invalid, %" NACL_PRIuS " errors (%" NACL_PRIuS " jobs, %"
+            NACL_PRId64 " ms)\n",
+            batch.files.size(), counts[BatchResult::kValid],
+            counts[BatchResult::kInvalid], counts[BatchResult::kError],
+            jobs, elapsed_us / 1000);
+  }
+  NaClPlatformFini();
+
+  return counts[BatchResult::kValid] == batch.files.size() ? 0 : 1;
+}
+
+
 int main(int argc, char **argv) {
   Options options;
   ParseOptions(argc, argv, &options);
 
+  if (options.batch)
+    return RunBatch(options);
+
   elf_load::Image image;
   elf_load::ReadImage(options.input_file, &image);
 
@@ -392,22 +747,8 @@ int main(int argc, char **argv) {
   Segment segment = elf_load::GetElfTextSegment(image);
 
   vector<Error> errors;
-  bool result = false;
-  switch (architecture) {
-    case elf_load::X86_32:
-      result = ValidateX86(segment, ValidateChunkIA32, &errors,
-                           options.flags);
-      break;
-    case elf_load::X86_64:
-      result = ValidateX86(segment, ValidateChunkAMD64, &errors,
-                           options.flags);
-      break;
-    case elf_load::ARM:
-      result = ValidateArm(segment, &errors);
-      break;
-    default:
-      CHECK(false);
-  }
+  bool result = ValidateSegment(architecture, segment, &errors,
+                                options.flags);
 
   for (size_t i = 0; i < errors.size(); i++) {
     const Error &e = errors[i];
@@ -8,6 +8,7 @@ import sys
 sys.path.append(os.path.join(os.path.dirname(__file__),
                              "..", "..", "..", "tests"))
 
+import json
 import re
 import subprocess
 import unittest
@@ -103,6 +104,53 @@ ADDRESS \(FILENAME:[0-9]+, function _start\): unrecognized instruction
                     if re.match(filter_pattern, line)])
     self.assertEquals(failures, 10)
 
+  def test_ncval_batch_mode(self):
+    # Check that batch mode reports each file, in order, and fails if any
+    # of them is invalid or is not an ELF file at all.
+    temp_dir = self.make_temp_dir()
+    sources = {
+        "good": "void _start() { while (1) {} }",
+        "bad": """
+void _start() {
+#if defined(__i386__) || defined(__x86_64__)
+  __asm__("ret");
+#else
+#  error Update this test for other architectures!
+#endif
+}
+"""}
+    for name, source in sorted(sources.items()):
+      source_file = os.path.join(temp_dir, name + ".c")
+      write_file(source_file, source)
+      testutils.check_call(["x86_64-nacl-gcc", "-nostartfiles", "-nostdlib",
+                            source_file,
+                            "-o", os.path.join(temp_dir, name)] + NACL_CFLAGS)
+    not_elf = os.path.join(temp_dir, "not_elf")
+    write_file(not_elf, "not an ELF file")
+    files = [os.path.join(temp_dir, "good"), os.path.join(temp_dir, "bad"),
+             not_elf]
+    manifest = os.path.join(temp_dir, "manifest")
+    write_file(manifest, "# Comment\n" + "\n".join(files) + "\n")
+    report = os.path.join(temp_dir, "report")
+    rc = subprocess.call(["ncval_new", "-b", "-j", "2", "-o", report,
+                          manifest])
+    self.assertEquals(rc, 1)
+    results = [json.loads(line) for line in open(report, "r")]
+    self.assertEquals([result["file"] for result in results], files)
+    self.assertEquals([result["result"] for result in results],
+                      ["valid", "invalid", "error"])
+    self.assertEquals(results[1]["errors"][0]["message"],
+                      "unrecognized instruction")
+
+    # A directory is searched for ELF files only.
+    if sys.platform == "win32":
+      return
+    rc = subprocess.call(["ncval_new", "-b", "-o", report, temp_dir])
+    self.assertEquals(rc, 1)
+    results = [json.loads(line) for line in open(report, "r")]
+    self.assertEquals(sorted(result["file"] for result in results),
+                      sorted(files[:2]))
+
 
 if __name__ == "__main__":
   unittest.main()
@@ -155,6 +155,33 @@ typedef NaClValidationStatus (*NaClIsOnInstBoundaryFunc)(
     size_t size,
     const NaClCPUFeatures *cpu_features);
 
+/* Function types for validating a code segment while it is being loaded.
+ * ValidateStreamCreate starts the validation of a code segment whose
+ * contents are not there yet; it returns NULL if it fails.  After the
+ * first end bytes of data have been written, ValidateStreamAdd may
+ * validate them; end must be a multiple of the bundle size or size
+ * itself.  Pieces need not come from the thread which writes data, but
+ * the bytes already added must not change.  ValidateStreamFinish
+ * validates whatever is left, returns the same status as Validate and
+ * frees the stream.  ValidateStreamDestroy frees an unfinished stream.
+ *
+ * Parameters are as for NaClValidateFunc, without stubout_mode (not
+ * supported), readonly_text (text is never read-only while it is being
+ * loaded) and caching (the code is not known up front).
+ */
+typedef void *(*NaClValidateStreamCreateFunc)(
+    uintptr_t guest_addr,
+    uint8_t *data,
+    size_t size,
+    uint32_t flags,
+    const NaClCPUFeatures *cpu_features);
+
+typedef void (*NaClValidateStreamAddFunc)(void *stream, size_t end);
+
+typedef NaClValidationStatus (*NaClValidateStreamFinishFunc)(void *stream);
+
+typedef void (*NaClValidateStreamDestroyFunc)(void *stream);
+
 /* The full set of validator APIs. */
 struct NaClValidatorInterface {
   /* Meta-information for early diagnosis. We assume that at least basic
@@ -177,6 +204,11 @@ struct NaClValidatorInterface {
   /* Get the features for the CPU this code is running on. */
   NaClCPUFeaturesAllFunc GetCurrentCPUFeatures;
   NaClIsOnInstBoundaryFunc IsOnInstBoundary;
+  /* Optional streaming validation API: NULL if not implemented. */
+  NaClValidateStreamCreateFunc ValidateStreamCreate;
+  NaClValidateStreamAddFunc ValidateStreamAdd;
+  NaClValidateStreamFinishFunc ValidateStreamFinish;
+  NaClValidateStreamDestroyFunc ValidateStreamDestroy;
 };
 
 /* Make a choice of validating functions. */
@@ -266,6 +266,10 @@ static struct NaClValidatorInterface validator = {
   NaClSetAllCPUFeaturesArm,
   NaClGetCurrentCPUFeaturesArm,
   IsOnInstBoundaryArm,
+  NULL,  /* Optional streaming validation is not implemented.  */
+  NULL,
+  NULL,
+  NULL,
 };
 
 const struct NaClValidatorInterface *NaClValidatorCreateArm() {
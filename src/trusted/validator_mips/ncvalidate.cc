@@ -228,6 +228,10 @@ static struct NaClValidatorInterface validator = {
   NaClSetAllCPUFeaturesMips,
   NaClGetCurrentCPUFeaturesMips,
   IsOnInstBoundaryMips,
+  NULL,  /* Optional streaming validation is not implemented.  */
+  NULL,
+  NULL,
+  NULL,
 };
 
 const struct NaClValidatorInterface *NaClValidatorCreateMips() {
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * This file contains the bundle memo table used by ValidateChunk* when the
+ * MEMOIZE_BUNDLES option is given.
+ *
+ * With the usual per-bundle processing the DFA outcome for a bundle depends
+ * only on its 32 bytes (options and CPU features are fixed for one call), with
+ * two exceptions: relative jumps mark jump_dests at positions which depend on
+ * where the bundle is, and errors are reported with pointers into the bundle.
+ * Bundles with either of these are never stored; for the rest we only need to
+ * remember which valid_targets bits the DFA produced.
+ */
+
+#ifndef NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_BUNDLE_MEMO_H_
+#define NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_BUNDLE_MEMO_H_
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "native_client/src/trusted/validator_ragel/bitmap.h"
+#include "native_client/src/trusted/validator_ragel/validator.h"
+
+/* Table size limit: 16K entries is about 600KB.  */
+#define kBundleMemoMaxEntries (1 << 14)
+/* Give up on insertion after this many occupied slots.  */
+#define kBundleMemoMaxProbes 8
+
+struct BundleMemoEntry {
+  uint8_t bytes[kBundleSize];
+  /* valid_targets bits for the bundle, bit 0 is the first byte.  */
+  uint32_t valid_targets;
+  uint8_t used;
+};
+
+struct BundleMemo {
+  struct BundleMemoEntry *entries;
+  size_t mask;
+  /* Callback and data given to ValidateChunk*.  */
+  ValidationCallbackFunc user_callback;
+  void *callback_data;
+  /* All the validation_info bits seen in the current bundle.  */
+  uint32_t info_seen;
+};
+
+/*
+ * Allocates a table big enough for the given number of bundles.  Returns
+ * FALSE if there is no memory, in which case the caller should validate
+ * without memoization.
+ */
+static INLINE Bool BundleMemoCtor(struct BundleMemo *memo, size_t bundles,
+                                  ValidationCallbackFunc user_callback,
+                                  void *callback_data) {
+  size_t entries = 1;
+
+  while (entries < bundles && entries < kBundleMemoMaxEntries)
+    entries <<= 1;
+  memo->entries = calloc(entries, sizeof *memo->entries);
+  memo->mask = entries - 1;
+  memo->user_callback = user_callback;
+  memo->callback_data = callback_data;
+  memo->info_seen = 0;
+  return memo->entries != NULL;
+}
+
+static INLINE void BundleMemoDtor(struct BundleMemo *memo) {
+  free(memo->entries);
+  memo->entries = NULL;
+}
+
+/*
+ * Installed as the user callback while memoizing, with the validator asked to
+ * call it on each instruction.  Records what the bundle produced and passes
+ * the calls the caller would have seen without memoization along.
+ */
+static Bool BundleMemoCallback(const uint8_t *instruction_begin,
+                               const uint8_t *instruction_end,
+                               uint32_t validation_info,
+                               void *callback_data) {
+  struct BundleMemo *memo = callback_data;
+
+  memo->info_seen |= validation_info;
+  if (validation_info & VALIDATION_ERRORS_MASK)
+    return memo->user_callback(instruction_begin, instruction_end,
+                               validation_info, memo->callback_data);
+  return TRUE;
+}
+
+/* Whether the bundle just processed can be stored in the table.  */
+static FORCEINLINE Bool BundleMemoIsCacheable(const struct BundleMemo *memo) {
+  return (memo->info_seen & (VALIDATION_ERRORS_MASK | RELATIVE_PRESENT)) == 0;
+}
+
+/*
+ * Returns the entry holding the bundle, or a free slot for it (with used
+ * clear), or NULL if the probe sequence is full.
+ */
+static INLINE struct BundleMemoEntry *BundleMemoFind(struct BundleMemo *memo,
+                                                     const uint8_t *bundle) {
+  uint32_t words[kBundleSize / sizeof(uint32_t)];
+  uint32_t hash = 2166136261U;
+  size_t i;
+
+  memcpy(words, bundle, kBundleSize);
+  for (i = 0; i < NACL_ARRAY_SIZE(words); i++)
+    hash = (hash ^ words[i]) * 16777619U;
+  hash ^= hash >> 15;
+
+  for (i = 0; i < kBundleMemoMaxProbes; i++) {
+    struct BundleMemoEntry *entry = &memo->entries[(hash + i) & memo->mask];
+    if (!entry->used || memcmp(entry->bytes, bundle, kBundleSize) == 0)
+      return entry;
+  }
+  return NULL;
+}
+
+/*
+ * Bundles are aligned, so a bundle's bits never straddle two bitmap words.
+ */
+static FORCEINLINE void BundleMemoStore(struct BundleMemoEntry *entry,
+                                        const uint8_t *bundle,
+                                        bitmap_word *valid_targets,
+                                        size_t offset) {
+  memcpy(entry->bytes, bundle, kBundleSize);
+  entry->valid_targets = (uint32_t) (valid_targets[offset / NACL_HOST_WORDSIZE]
+                                     >> (offset % NACL_HOST_WORDSIZE));
+  entry->used = TRUE;
+}
+
+static FORCEINLINE void BundleMemoReplay(const struct BundleMemoEntry *entry,
+                                         bitmap_word *valid_targets,
+                                         size_t offset) {
+  valid_targets[offset / NACL_HOST_WORDSIZE] |=
+      ((bitmap_word) entry->valid_targets) << (offset % NACL_HOST_WORDSIZE);
+}
+
+#endif  /* NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_BUNDLE_MEMO_H_ */
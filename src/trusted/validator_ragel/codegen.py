@@ -3,6 +3,7 @@
 # Use of this source code is governed by a BSD-style license that can be
 # found in the LICENSE file.
 
+import optparse
 import sys
 import os
 
@@ -10,6 +11,7 @@ import dfa_parser
 
 
 class Generator(object):
+  """Table-driven code: one row of (action, action) indices per state."""
 
   def __init__(self, dfa, c_file):
     self.dfa = dfa
@@ -98,13 +100,99 @@ class Generator(object):
         '_done: ;\n')
 
 
+class GotoGenerator(object):
+  """Goto-driven code: each state is a switch on the input byte.
+
+  There is no data: the current state is kept in the program counter.  Each
+  distinct (actions, target state) pair becomes one block of code which runs
+  the actions inline and jumps to the target, so the CPU sees one indirect
+  branch per byte instead of a table lookup followed by two.  The price is
+  a much bigger code footprint.
+  """
+
+  def __init__(self, dfa, c_file):
+    self.dfa = dfa
+    self.c_file = c_file
+
+  def WriteData(self):
+    self.c_file.write(
+        '/* The goto-driven automaton has no data tables.  */\n')
+
+  def WriteInit(self):
+    # The state lives in the program counter, but the variable is still
+    # declared by the .rl file.
+    self.c_file.write('(void) current_state;\n')
+
+  def WriteExec(self):
+    transitions = {}
+    reachable = set([self.dfa.initial_state.index])
+    for state in self.dfa.states:
+      for t in state.forward_transitions.itervalues():
+        key = (tuple(a.body for a in t.actions), t.to_state.index)
+        if key not in transitions:
+          transitions[key] = len(transitions)
+        reachable.add(t.to_state.index)
+
+    self.c_file.write('goto st%d;\n' % self.dfa.initial_state.index)
+
+    for state in self.dfa.states:
+      if state.index not in reachable:
+        continue
+      self.c_file.write('st%d:\n' % state.index)
+      if state.is_accepting:
+        self.c_file.write(
+            'if (current_position == end_position) goto _done;\n')
+      else:
+        self.c_file.write(
+            'if (current_position == end_position) goto _error;\n')
+
+      by_target = {}
+      for byte, t in sorted(state.forward_transitions.iteritems()):
+        key = (tuple(a.body for a in t.actions), t.to_state.index)
+        by_target.setdefault(transitions[key], []).append(byte)
+      self.c_file.write('switch (*current_position) {\n')
+      for index, byte_list in sorted(by_target.items(),
+                                     key=lambda (_, byte_list): byte_list[0]):
+        self.c_file.write(
+            '  %s\n    goto tr%d;\n' % (
+                ' '.join('case 0x%02x:' % byte for byte in byte_list),
+                index))
+      if len(state.forward_transitions) < 256:
+        self.c_file.write('  default:\n    goto _error;\n')
+      self.c_file.write('}\n')
+
+    for (actions, to_state), index in sorted(transitions.items(),
+                                             key=lambda (_, index): index):
+      self.c_file.write('tr%d:\n' % index)
+      self.c_file.write(' '.join(actions))
+      self.c_file.write(
+          'current_position++; goto st%d;\n' % to_state)
+
+    self.c_file.write('_error:\n')
+    self.c_file.write(self.dfa.error_action.body)
+    self.c_file.write(
+        '_done: ;\n')
+
+
+GENERATORS = {
+    'table': Generator,
+    'goto': GotoGenerator,
+}
+
+
 def main():
-  if len(sys.argv[1:]) != 3:
-    print 'Usage:'
-    print '   %s <rl file> <xml file> <output c file>' % os.path.basename(
-        __file__)
-    sys.exit(1)
-  rl_filename, xml_filename, c_filename = sys.argv[1:]
+  parser = optparse.OptionParser(
+      usage='%prog [--style=table|goto] <rl file> <xml file> <output c file>')
+  parser.add_option('--style',
+                    default='table',
+                    choices=sorted(GENERATORS),
+                    help='code generation style: "table" (the default) '
+                         'drives the automaton from data tables, "goto" '
+                         'compiles each state to code')
+  options, args = parser.parse_args()
+  if len(args) != 3:
+    parser.error('expected <rl file> <xml file> <output c file>')
+  rl_filename, xml_filename, c_filename = args
 
   dfa = dfa_parser.ParseXml(xml_filename)
 
@@ -112,16 +200,20 @@ def main():
     lines = list(rl_file)
 
   with open(c_filename, 'wt') as c_file:
+    style_note = ''
+    if options.style != 'table':
+      style_note = ' in the %s style' % options.style
     c_file.write(
       '/*\n'
       ' * THIS FILE IS AUTO-GENERATED. DO NOT EDIT.\n'
-      ' * Generated by %s from %s and %s.\n'
+      ' * Generated by %s from %s and %s%s.\n'
       ' */\n\n' % (
           os.path.basename(__file__),
           os.path.basename(rl_filename),
-          os.path.basename(xml_filename)))
+          os.path.basename(xml_filename),
+          style_note))
 
-    generator = Generator(dfa, c_file)
+    generator = GENERATORS[options.style](dfa, c_file)
 
     in_ragel_block = False
     for line in lines:
@@ -6,6 +6,7 @@
 
 /* Implement the Validator API for the x86-32 architecture. */
 #include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "native_client/src/include/build_config.h"
@@ -359,6 +360,64 @@ static NaClValidationStatus IsOnInstBoundary_x86_32(
                                   : NaClValidationFailed;
 }
 
+static void *ValidateStreamCreate_x86_32(
+    uintptr_t guest_addr,
+    uint8_t *data,
+    size_t size,
+    uint32_t flags,
+    const NaClCPUFeatures *f) {
+  /* TODO(jfb) Use a safe cast here. */
+  NaClCPUFeaturesX86 *cpu_features = (NaClCPUFeaturesX86 *) f;
+  struct DfaValidateStream *dfa_stream;
+  UNREFERENCED_PARAMETER(guest_addr);
+
+  if (!NaClArchSupportedX86(cpu_features))
+    return NULL;
+  if (size & kBundleMask)
+    return NULL;
+  dfa_stream = malloc(sizeof *dfa_stream);
+  if (dfa_stream == NULL)
+    return NULL;
+  dfa_stream->cpu_features = *cpu_features;
+  dfa_stream->callback_data.flags = flags;
+  dfa_stream->callback_data.chunk_begin = data;
+  dfa_stream->callback_data.chunk_end = data + size;
+  dfa_stream->callback_data.cpu_features = &dfa_stream->cpu_features;
+  dfa_stream->callback_data.validate_chunk_func = ValidateChunkIA32;
+  dfa_stream->callback_data.did_rewrite = 0;
+  dfa_stream->stream = ValidationStreamCreateIA32(
+      data, size, 0 /*options*/, &dfa_stream->cpu_features,
+      NaClDfaStubOutUnsupportedInstruction, &dfa_stream->callback_data);
+  if (dfa_stream->stream == NULL) {
+    free(dfa_stream);
+    return NULL;
+  }
+  return dfa_stream;
+}
+
+static void ValidateStreamAdd_x86_32(void *stream, size_t end) {
+  struct DfaValidateStream *dfa_stream = stream;
+  ValidationStreamAddIA32(dfa_stream->stream, end);
+}
+
+static NaClValidationStatus ValidateStreamFinish_x86_32(void *stream) {
+  struct DfaValidateStream *dfa_stream = stream;
+  enum NaClValidationStatus status = NaClValidationFailed;
+
+  if (ValidationStreamFinishIA32(dfa_stream->stream))
+    status = NaClValidationSucceeded;
+  else if (errno == ENOMEM)
+    status = NaClValidationFailedOutOfMemory;
+  free(dfa_stream);
+  return status;
+}
+
+static void ValidateStreamDestroy_x86_32(void *stream) {
+  struct DfaValidateStream *dfa_stream = stream;
+  ValidationStreamDestroyIA32(dfa_stream->stream);
+  free(dfa_stream);
+}
+
 static const struct NaClValidatorInterface validator = {
   FALSE, /* Optional stubout_mode is not implemented.            */
   TRUE,  /* Optional readonly_text mode is implemented.          */
@@ -370,6 +429,10 @@ static const struct NaClValidatorInterface validator = {
   NaClSetAllCPUFeaturesX86,
   NaClGetCurrentCPUFeaturesX86,
   IsOnInstBoundary_x86_32,
+  ValidateStreamCreate_x86_32,
+  ValidateStreamAdd_x86_32,
+  ValidateStreamFinish_x86_32,
+  ValidateStreamDestroy_x86_32,
 };
 
 const struct NaClValidatorInterface *NaClDfaValidatorCreate_x86_32(void) {
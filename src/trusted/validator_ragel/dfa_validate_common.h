@@ -63,6 +63,13 @@ Bool NaClDfaStubOutUnsupportedInstruction(const uint8_t *begin,
                                           uint32_t info,
                                           void *callback_data);
 
+/* State of a NaClValidateStreamCreateFunc stream.  */
+struct DfaValidateStream {
+  struct StubOutCallbackData callback_data;
+  NaClCPUFeaturesX86 cpu_features;
+  struct ValidationStream *stream;
+};
+
 struct CodeCopyCallbackData {
   NaClCopyInstructionFunc copy_func;
   /* Difference between addresses: dest - src.  */
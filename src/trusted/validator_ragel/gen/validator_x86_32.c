@@ -25,6 +25,8 @@
 #include <string.h>
 
 #include "native_client/src/trusted/validator_ragel/bitmap.h"
+#include "native_client/src/trusted/validator_ragel/bundle_memo.h"
+#include "native_client/src/trusted/validator_ragel/jump_window.h"
 #include "native_client/src/trusted/validator_ragel/validator_internal.h"
 
 /* Ignore this information: it's not used by security model in IA32 mode.  */
@@ -331,32 +333,42 @@ Bool ValidateChunkIA32(const uint8_t codeblock[],
                        const NaClCPUFeaturesX86 *cpu_features,
                        ValidationCallbackFunc user_callback,
                        void *callback_data) {
-  bitmap_word valid_targets_small;
-  bitmap_word jump_dests_small;
-  bitmap_word *valid_targets;
-  bitmap_word *jump_dests;
+  return ValidateChunkIA32WithStats(codeblock, size, options, cpu_features,
+                                    user_callback, callback_data, NULL);
+}
+
+/*
+ * Runs the DFA over the bundles of the chunk and fills valid_targets and
+ * jump_dests, which must be zeroed and hold at least size + 1 bits.  Direct
+ * jumps are not checked here.
+ */
+static Bool ValidateBundlesIA32(const uint8_t codeblock[],
+                                size_t size,
+                                uint32_t options,
+                                const NaClCPUFeaturesX86 *cpu_features,
+                                ValidationCallbackFunc user_callback,
+                                void *callback_data,
+                                bitmap_word *valid_targets,
+                                bitmap_word *jump_dests,
+                                struct ValidationStats *stats) {
   const uint8_t *current_position;
   const uint8_t *end_position;
+  struct BundleMemo memo;
+  Bool memoize = FALSE;
   int result = TRUE;
 
-  CHECK(sizeof valid_targets_small == sizeof jump_dests_small);
-  CHECK(size % kBundleSize == 0);
-
-  /* For a very small sequences (one bundle) malloc is too expensive.  */
-  if (size <= (sizeof valid_targets_small * 8)) {
-    valid_targets_small = 0;
-    valid_targets = &valid_targets_small;
-    jump_dests_small = 0;
-    jump_dests = &jump_dests_small;
-  } else {
-    valid_targets = BitmapAllocate(size);
-    jump_dests = BitmapAllocate(size);
-    if (!valid_targets || !jump_dests) {
-      free(jump_dests);
-      free(valid_targets);
-      errno = ENOMEM;
-      return FALSE;
-    }
+  /*
+   * Memoization needs bundles to be processed independently, and it only
+   * passes error reports to the user callback.  See bundle_memo.h.
+   */
+  if ((options & MEMOIZE_BUNDLES) &&
+      !(options & (CALL_USER_CALLBACK_ON_EACH_INSTRUCTION |
+                   PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM)) &&
+      BundleMemoCtor(&memo, size / kBundleSize, user_callback, callback_data)) {
+    memoize = TRUE;
+    user_callback = BundleMemoCallback;
+    callback_data = &memo;
+    options |= CALL_USER_CALLBACK_ON_EACH_INSTRUCTION;
   }
 
   /*
@@ -379,6 +391,10 @@ Bool ValidateChunkIA32(const uint8_t codeblock[],
        current_position < codeblock + size;
        current_position = end_position,
        end_position = current_position + kBundleSize) {
+    /* Start of the bundle being processed.  */
+    const uint8_t *bundle_begin = current_position;
+    /* Slot for this bundle in the memo table, if there is one.  */
+    struct BundleMemoEntry *memo_entry = NULL;
     /* Start of the instruction being processed.  */
     const uint8_t *instruction_begin = current_position;
     /* Only used locally in the end_of_instruction_cleanup action.  */
@@ -386,6 +402,17 @@ Bool ValidateChunkIA32(const uint8_t codeblock[],
     uint32_t instruction_info_collected = 0;
     int current_state;
 
+    if (memoize) {
+      memo_entry = BundleMemoFind(&memo, bundle_begin);
+      if (memo_entry != NULL && memo_entry->used) {
+        BundleMemoReplay(memo_entry, valid_targets, bundle_begin - codeblock);
+        if (stats != NULL)
+          stats->memo_hits++;
+        continue;
+      }
+      memo.info_seen = 0;
+    }
+
     /*
      * The "write init" statement causes Ragel to emit initialization code.
      * This should be executed once before the ragel machine is started.
@@ -403,7 +430,7 @@ if (current_position == end_position) {
                             UNRECOGNIZED_INSTRUCTION, callback_data);
     /*
      * Process the next bundle: "continue" here is for the "for" cycle in
-     * the ValidateChunkIA32 function.
+     * the ValidateBundlesIA32 function.
      *
      * It does not affect the case which we really care about (when code
      * is validatable), but makes it possible to detect more errors in one
@@ -418,7 +445,7 @@ switch (_dfa_transitions[current_state][*current_position][0]) {
                             UNRECOGNIZED_INSTRUCTION, callback_data);
     /*
      * Process the next bundle: "continue" here is for the "for" cycle in
-     * the ValidateChunkIA32 function.
+     * the ValidateBundlesIA32 function.
      *
      * It does not affect the case which we really care about (when code
      * is validatable), but makes it possible to detect more errors in one
@@ -1911,8 +1938,70 @@ current_state = 247; current_position++; goto _again;
   break;
 }
 _done: ;
+
+    if (memo_entry != NULL && BundleMemoIsCacheable(&memo))
+      BundleMemoStore(memo_entry, bundle_begin, valid_targets,
+                      bundle_begin - codeblock);
+  }
+
+  if (memoize)
+    BundleMemoDtor(&memo);
+
+  return result;
+}
+
+Bool ValidateChunkIA32WithStats(const uint8_t codeblock[],
+                                size_t size,
+                                uint32_t options,
+                                const NaClCPUFeaturesX86 *cpu_features,
+                                ValidationCallbackFunc user_callback,
+                                void *callback_data,
+                                struct ValidationStats *stats) {
+  bitmap_word valid_targets_small;
+  bitmap_word jump_dests_small;
+  bitmap_word *valid_targets;
+  bitmap_word *jump_dests;
+  int result;
+
+  CHECK(sizeof valid_targets_small == sizeof jump_dests_small);
+  CHECK(size % kBundleSize == 0);
+
+  if (stats != NULL) {
+    stats->bundles = size / kBundleSize;
+    stats->memo_hits = 0;
+  }
+
+  /*
+   * Big chunks are validated window by window so that the memory used for
+   * jump targets does not grow with the code size.  See jump_window.h.
+   */
+  if (size > kJumpWindowSize &&
+      !(options & PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM))
+    return ValidateChunkInWindows(codeblock, size, options, cpu_features,
+                                  user_callback, callback_data, stats,
+                                  ValidateBundlesIA32);
+
+  /* For a very small sequences (one bundle) malloc is too expensive.  */
+  if (size <= (sizeof valid_targets_small * 8)) {
+    valid_targets_small = 0;
+    valid_targets = &valid_targets_small;
+    jump_dests_small = 0;
+    jump_dests = &jump_dests_small;
+  } else {
+    valid_targets = BitmapAllocate(size);
+    jump_dests = BitmapAllocate(size);
+    if (!valid_targets || !jump_dests) {
+      free(jump_dests);
+      free(valid_targets);
+      errno = ENOMEM;
+      return FALSE;
+    }
   }
 
+  result = ValidateBundlesIA32(codeblock, size, options, cpu_features,
+                               user_callback, callback_data,
+                               valid_targets, jump_dests, stats);
+
   /*
    * Check the direct jumps.  All the targets from jump_dests must be in
    * valid_targets.
@@ -1930,3 +2019,44 @@ _done: ;
   if (!result) errno = EINVAL;
   return result;
 }
+
+
+struct ValidationStream *ValidationStreamCreateIA32(
+    const uint8_t codeblock[],
+    size_t size,
+    uint32_t options,
+    const NaClCPUFeaturesX86 *cpu_features,
+    ValidationCallbackFunc user_callback,
+    void *callback_data) {
+  struct ValidationStream *stream;
+
+  CHECK(size % kBundleSize == 0);
+  CHECK(!(options & PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM));
+  stream = malloc(sizeof *stream);
+  if (stream == NULL) {
+    errno = ENOMEM;
+    return NULL;
+  }
+  if (!ValidationStreamInit(stream, codeblock, size, options, cpu_features,
+                            user_callback, callback_data, NULL,
+                            ValidateBundlesIA32)) {
+    free(stream);
+    return NULL;
+  }
+  return stream;
+}
+
+void ValidationStreamAddIA32(struct ValidationStream *stream, size_t end) {
+  ValidationStreamAdd(stream, end);
+}
+
+Bool ValidationStreamFinishIA32(struct ValidationStream *stream) {
+  Bool result = ValidationStreamFinish(stream);
+  free(stream);
+  return result;
+}
+
+void ValidationStreamDestroyIA32(struct ValidationStream *stream) {
+  ValidationStreamRelease(stream);
+  free(stream);
+}
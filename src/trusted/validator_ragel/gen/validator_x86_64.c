@@ -25,6 +25,8 @@
 #include <string.h>
 
 #include "native_client/src/trusted/validator_ragel/bitmap.h"
+#include "native_client/src/trusted/validator_ragel/bundle_memo.h"
+#include "native_client/src/trusted/validator_ragel/jump_window.h"
 #include "native_client/src/trusted/validator_ragel/validator_internal.h"
 
 
@@ -1554,40 +1556,42 @@ Bool ValidateChunkAMD64(const uint8_t codeblock[],
                         const NaClCPUFeaturesX86 *cpu_features,
                         ValidationCallbackFunc user_callback,
                         void *callback_data) {
-  bitmap_word valid_targets_small;
-  bitmap_word jump_dests_small;
-  bitmap_word *valid_targets;
-  bitmap_word *jump_dests;
+  return ValidateChunkAMD64WithStats(codeblock, size, options, cpu_features,
+                                     user_callback, callback_data, NULL);
+}
+
+/*
+ * Runs the DFA over the bundles of the chunk and fills valid_targets and
+ * jump_dests, which must be zeroed and hold at least size + 1 bits.  Direct
+ * jumps are not checked here.
+ */
+static Bool ValidateBundlesAMD64(const uint8_t codeblock[],
+                                 size_t size,
+                                 uint32_t options,
+                                 const NaClCPUFeaturesX86 *cpu_features,
+                                 ValidationCallbackFunc user_callback,
+                                 void *callback_data,
+                                 bitmap_word *valid_targets,
+                                 bitmap_word *jump_dests,
+                                 struct ValidationStats *stats) {
   const uint8_t *current_position;
   const uint8_t *end_position;
+  struct BundleMemo memo;
+  Bool memoize = FALSE;
   int result = TRUE;
 
-  CHECK(sizeof valid_targets_small == sizeof jump_dests_small);
-  CHECK(size % kBundleSize == 0);
-
   /*
-   * For a very small sequences (one bundle) malloc is too expensive.
-   *
-   * Note1: we allocate one extra bit, because we set valid jump target bits
-   * _after_ instructions, so there will be one at the end of the chunk.
-   *
-   * Note2: we don't ever mark first bit as a valid jump target but this is
-   * not a problem because any aligned address is valid jump target.
+   * Memoization needs bundles to be processed independently, and it only
+   * passes error reports to the user callback.  See bundle_memo.h.
    */
-  if ((size + 1) <= (sizeof valid_targets_small * 8)) {
-    valid_targets_small = 0;
-    valid_targets = &valid_targets_small;
-    jump_dests_small = 0;
-    jump_dests = &jump_dests_small;
-  } else {
-    valid_targets = BitmapAllocate(size + 1);
-    jump_dests = BitmapAllocate(size + 1);
-    if (!valid_targets || !jump_dests) {
-      free(jump_dests);
-      free(valid_targets);
-      errno = ENOMEM;
-      return FALSE;
-    }
+  if ((options & MEMOIZE_BUNDLES) &&
+      !(options & (CALL_USER_CALLBACK_ON_EACH_INSTRUCTION |
+                   PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM)) &&
+      BundleMemoCtor(&memo, size / kBundleSize, user_callback, callback_data)) {
+    memoize = TRUE;
+    user_callback = BundleMemoCallback;
+    callback_data = &memo;
+    options |= CALL_USER_CALLBACK_ON_EACH_INSTRUCTION;
   }
 
   /*
@@ -1610,6 +1614,10 @@ Bool ValidateChunkAMD64(const uint8_t codeblock[],
        current_position < codeblock + size;
        current_position = end_position,
        end_position = current_position + kBundleSize) {
+    /* Start of the bundle being processed.  */
+    const uint8_t *bundle_begin = current_position;
+    /* Slot for this bundle in the memo table, if there is one.  */
+    struct BundleMemoEntry *memo_entry = NULL;
     /* Start of the instruction being processed.  */
     const uint8_t *instruction_begin = current_position;
     /* Only used locally in the end_of_instruction_cleanup action.  */
@@ -1632,6 +1640,17 @@ Bool ValidateChunkAMD64(const uint8_t codeblock[],
     uint8_t vex_prefix2 = VEX_R | VEX_X | VEX_B;
     uint8_t vex_prefix3 = 0x00;
 
+    if (memoize) {
+      memo_entry = BundleMemoFind(&memo, bundle_begin);
+      if (memo_entry != NULL && memo_entry->used) {
+        BundleMemoReplay(memo_entry, valid_targets, bundle_begin - codeblock);
+        if (stats != NULL)
+          stats->memo_hits++;
+        continue;
+      }
+      memo.info_seen = 0;
+    }
+
     /*
      * The "write init" statement causes Ragel to emit initialization code.
      * This should be executed once before the ragel machine is started.
@@ -1649,7 +1668,7 @@ if (current_position == end_position) {
                             UNRECOGNIZED_INSTRUCTION, callback_data);
     /*
      * Process the next bundle: "continue" here is for the "for" cycle in
-     * the ValidateChunkAMD64 function.
+     * the ValidateBundlesAMD64 function.
      *
      * It does not affect the case which we really care about (when code
      * is validatable), but makes it possible to detect more errors in one
@@ -1664,7 +1683,7 @@ switch (_dfa_transitions[current_state][*current_position][0]) {
                             UNRECOGNIZED_INSTRUCTION, callback_data);
     /*
      * Process the next bundle: "continue" here is for the "for" cycle in
-     * the ValidateChunkAMD64 function.
+     * the ValidateBundlesAMD64 function.
      *
      * It does not affect the case which we really care about (when code
      * is validatable), but makes it possible to detect more errors in one
@@ -12455,8 +12474,78 @@ _done: ;
                               RESTRICTED_RSP_UNPROCESSED |
                               ((NC_REG_RSP << RESTRICTED_REGISTER_SHIFT) &
                                RESTRICTED_REGISTER_MASK), callback_data);
+
+    if (memo_entry != NULL && BundleMemoIsCacheable(&memo))
+      BundleMemoStore(memo_entry, bundle_begin, valid_targets,
+                      bundle_begin - codeblock);
   }
 
+  if (memoize)
+    BundleMemoDtor(&memo);
+
+  return result;
+}
+
+Bool ValidateChunkAMD64WithStats(const uint8_t codeblock[],
+                                 size_t size,
+                                 uint32_t options,
+                                 const NaClCPUFeaturesX86 *cpu_features,
+                                 ValidationCallbackFunc user_callback,
+                                 void *callback_data,
+                                 struct ValidationStats *stats) {
+  bitmap_word valid_targets_small;
+  bitmap_word jump_dests_small;
+  bitmap_word *valid_targets;
+  bitmap_word *jump_dests;
+  int result;
+
+  CHECK(sizeof valid_targets_small == sizeof jump_dests_small);
+  CHECK(size % kBundleSize == 0);
+
+  if (stats != NULL) {
+    stats->bundles = size / kBundleSize;
+    stats->memo_hits = 0;
+  }
+
+  /*
+   * Big chunks are validated window by window so that the memory used for
+   * jump targets does not grow with the code size.  See jump_window.h.
+   */
+  if (size > kJumpWindowSize &&
+      !(options & PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM))
+    return ValidateChunkInWindows(codeblock, size, options, cpu_features,
+                                  user_callback, callback_data, stats,
+                                  ValidateBundlesAMD64);
+
+  /*
+   * For a very small sequences (one bundle) malloc is too expensive.
+   *
+   * Note1: we allocate one extra bit, because we set valid jump target bits
+   * _after_ instructions, so there will be one at the end of the chunk.
+   *
+   * Note2: we don't ever mark first bit as a valid jump target but this is
+   * not a problem because any aligned address is valid jump target.
+   */
+  if ((size + 1) <= (sizeof valid_targets_small * 8)) {
+    valid_targets_small = 0;
+    valid_targets = &valid_targets_small;
+    jump_dests_small = 0;
+    jump_dests = &jump_dests_small;
+  } else {
+    valid_targets = BitmapAllocate(size + 1);
+    jump_dests = BitmapAllocate(size + 1);
+    if (!valid_targets || !jump_dests) {
+      free(jump_dests);
+      free(valid_targets);
+      errno = ENOMEM;
+      return FALSE;
+    }
+  }
+
+  result = ValidateBundlesAMD64(codeblock, size, options, cpu_features,
+                                user_callback, callback_data,
+                                valid_targets, jump_dests, stats);
+
   /*
    * Check the direct jumps.  All the targets from jump_dests must be in
    * valid_targets.
@@ -12474,3 +12563,44 @@ _done: ;
   if (!result) errno = EINVAL;
   return result;
 }
+
+
+struct ValidationStream *ValidationStreamCreateAMD64(
+    const uint8_t codeblock[],
+    size_t size,
+    uint32_t options,
+    const NaClCPUFeaturesX86 *cpu_features,
+    ValidationCallbackFunc user_callback,
+    void *callback_data) {
+  struct ValidationStream *stream;
+
+  CHECK(size % kBundleSize == 0);
+  CHECK(!(options & PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM));
+  stream = malloc(sizeof *stream);
+  if (stream == NULL) {
+    errno = ENOMEM;
+    return NULL;
+  }
+  if (!ValidationStreamInit(stream, codeblock, size, options, cpu_features,
+                            user_callback, callback_data, NULL,
+                            ValidateBundlesAMD64)) {
+    free(stream);
+    return NULL;
+  }
+  return stream;
+}
+
+void ValidationStreamAddAMD64(struct ValidationStream *stream, size_t end) {
+  ValidationStreamAdd(stream, end);
+}
+
+Bool ValidationStreamFinishAMD64(struct ValidationStream *stream) {
+  Bool result = ValidationStreamFinish(stream);
+  free(stream);
+  return result;
+}
+
+void ValidationStreamDestroyAMD64(struct ValidationStream *stream) {
+  ValidationStreamRelease(stream);
+  free(stream);
+}
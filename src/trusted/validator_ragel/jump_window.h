@@ -0,0 +1,331 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * This file contains windowed validation of big chunks used by ValidateChunk*.
+ *
+ * Normally valid_targets and jump_dests are dense bitmaps with one bit per
+ * byte of code, so a 200MB text segment needs 50MB of zeroed memory just for
+ * them.  Since bundles are validated independently, a big chunk can instead be
+ * validated as a sequence of kJumpWindowSize windows which reuse the same pair
+ * of bitmaps.  Direct jumps which stay inside their window are checked as
+ * usual.  Unaligned targets in other windows are kept in a sorted array (so
+ * the memory used grows with the number of such jumps, not with the code size)
+ * and checked at the end by running the DFA again over each target bundle.
+ *
+ * The same machinery lets ValidationStream* validate a chunk piece by piece
+ * while the rest of it is still being loaded.
+ */
+
+#ifndef NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_JUMP_WINDOW_H_
+#define NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_JUMP_WINDOW_H_
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "native_client/src/trusted/validator_ragel/bitmap.h"
+#include "native_client/src/trusted/validator_ragel/validator_internal.h"
+
+/* Window size: both bitmaps take 128KB.  Must be a multiple of kBundleSize.  */
+#define kJumpWindowSize (1 << 20)
+
+/* Number of bitmap words needed for a window (see ValidateBundles*).  */
+#define kJumpWindowWords \
+  ((kJumpWindowSize + 1 + NACL_HOST_WORDSIZE - 1) / NACL_HOST_WORDSIZE)
+
+/* ValidateBundlesIA32 or ValidateBundlesAMD64.  */
+typedef Bool (*ValidateBundlesFunc)(const uint8_t codeblock[],
+                                    size_t size,
+                                    uint32_t options,
+                                    const NaClCPUFeaturesX86 *cpu_features,
+                                    ValidationCallbackFunc user_callback,
+                                    void *callback_data,
+                                    bitmap_word *valid_targets,
+                                    bitmap_word *jump_dests,
+                                    struct ValidationStats *stats);
+
+/* Growable array of code offsets.  */
+struct JumpTargetList {
+  size_t *offsets;
+  size_t count;
+  size_t capacity;
+};
+
+struct FarJumpTargets {
+  /* The whole chunk.  */
+  const uint8_t *codeblock;
+  size_t size;
+  /* Unaligned targets outside of the jump's own window.  */
+  struct JumpTargetList targets;
+  /*
+   * Bad targets already reported by the window checks, so that a target which
+   * is reached both from its own window and from far away is reported once.
+   */
+  struct JumpTargetList reported;
+  Bool out_of_memory;
+  /* Callback and data given to ValidateChunk*.  */
+  ValidationCallbackFunc user_callback;
+  void *callback_data;
+  Bool call_on_each_instruction;
+};
+
+static INLINE Bool JumpTargetListAdd(struct JumpTargetList *list,
+                                     size_t offset) {
+  if (list->count == list->capacity) {
+    size_t capacity = list->capacity ? list->capacity * 2 : 1024;
+    size_t *offsets = realloc(list->offsets, capacity * sizeof *offsets);
+    if (offsets == NULL)
+      return FALSE;
+    list->offsets = offsets;
+    list->capacity = capacity;
+  }
+  list->offsets[list->count++] = offset;
+  return TRUE;
+}
+
+/*
+ * Installed as the user callback for each window.  Inside a window a jump to
+ * an unaligned address in another window looks like DIRECT_JUMP_OUT_OF_RANGE;
+ * here we find out whether the target is inside the whole chunk and, if so,
+ * record it instead of reporting the error.
+ */
+static Bool FarJumpTargetsCallback(const uint8_t *instruction_begin,
+                                   const uint8_t *instruction_end,
+                                   uint32_t validation_info,
+                                   void *callback_data) {
+  struct FarJumpTargets *far = callback_data;
+
+  if (validation_info & DIRECT_JUMP_OUT_OF_RANGE) {
+    /* The relative field is always the last one, see Rel32Operand.  */
+    const uint8_t *rip = instruction_end;
+    size_t jump_dest;
+    if ((validation_info & RELATIVE_32BIT) == RELATIVE_32BIT) {
+      int32_t offset =
+          rip[-4] + 256U * (rip[-3] + 256U * (rip[-2] + 256U * (rip[-1])));
+      jump_dest = offset + (rip - far->codeblock);
+    } else {
+      int8_t offset = rip[-1];
+      jump_dest = offset + (rip - far->codeblock);
+    }
+    if (jump_dest < far->size) {
+      if (!JumpTargetListAdd(&far->targets, jump_dest)) {
+        far->out_of_memory = TRUE;
+        return FALSE;
+      }
+      validation_info &= ~DIRECT_JUMP_OUT_OF_RANGE;
+      if (!(validation_info & VALIDATION_ERRORS_MASK) &&
+          !far->call_on_each_instruction)
+        return TRUE;
+    }
+  }
+  return far->user_callback(instruction_begin, instruction_end,
+                            validation_info, far->callback_data);
+}
+
+/*
+ * Installed as the user callback for the window checks: remembers the bad
+ * targets it reports.  Windows are checked in order, so the list is sorted.
+ */
+static Bool FarJumpTargetsReportBadTarget(const uint8_t *instruction_begin,
+                                          const uint8_t *instruction_end,
+                                          uint32_t validation_info,
+                                          void *callback_data) {
+  struct FarJumpTargets *far = callback_data;
+
+  if (!JumpTargetListAdd(&far->reported, instruction_begin - far->codeblock))
+    far->out_of_memory = TRUE;
+  return far->user_callback(instruction_begin, instruction_end,
+                            validation_info, far->callback_data);
+}
+
+static Bool IgnoreValidationInfo(const uint8_t *instruction_begin,
+                                 const uint8_t *instruction_end,
+                                 uint32_t validation_info,
+                                 void *callback_data) {
+  UNREFERENCED_PARAMETER(instruction_begin);
+  UNREFERENCED_PARAMETER(instruction_end);
+  UNREFERENCED_PARAMETER(validation_info);
+  UNREFERENCED_PARAMETER(callback_data);
+  return TRUE;
+}
+
+static int CompareJumpTargets(const void *a, const void *b) {
+  size_t left = *(const size_t *) a;
+  size_t right = *(const size_t *) b;
+  return left < right ? -1 : left > right;
+}
+
+/*
+ * Checks the recorded far jump targets.  Valid targets of a bundle only depend
+ * on the bundle itself, so it's enough to run the DFA over the target bundle
+ * alone.  Errors in that bundle were already reported by the main pass.
+ */
+static INLINE Bool CheckFarJumpTargets(struct FarJumpTargets *far,
+                                       uint32_t options,
+                                       const NaClCPUFeaturesX86 *cpu_features,
+                                       ValidateBundlesFunc validate_bundles) {
+  /* kBundleSize + 1 bits, see ValidateBundles*.  */
+  bitmap_word valid_targets[2];
+  bitmap_word jump_dests[2];
+  size_t bundle = 0;
+  size_t i;
+  Bool result = TRUE;
+
+  options &= ~(MEMOIZE_BUNDLES | CALL_USER_CALLBACK_ON_EACH_INSTRUCTION);
+  qsort(far->targets.offsets, far->targets.count,
+        sizeof *far->targets.offsets, CompareJumpTargets);
+  for (i = 0; i < far->targets.count; i++) {
+    size_t target = far->targets.offsets[i];
+    if (i > 0 && target == far->targets.offsets[i - 1])
+      continue;
+    if (i == 0 || (target & ~(size_t) kBundleMask) != bundle) {
+      bundle = target & ~(size_t) kBundleMask;
+      memset(valid_targets, 0, sizeof valid_targets);
+      memset(jump_dests, 0, sizeof jump_dests);
+      validate_bundles(far->codeblock + bundle, kBundleSize, options,
+                       cpu_features, IgnoreValidationInfo, NULL,
+                       valid_targets, jump_dests, NULL);
+    }
+    if (!BitmapIsBitSet(valid_targets, target - bundle) &&
+        bsearch(&target, far->reported.offsets, far->reported.count,
+                sizeof *far->reported.offsets, CompareJumpTargets) == NULL)
+      result &= far->user_callback(far->codeblock + target,
+                                   far->codeblock + target,
+                                   BAD_JUMP_TARGET,
+                                   far->callback_data);
+  }
+  return result;
+}
+
+/*
+ * Validation of a chunk whose bytes arrive in order, e.g. while it is being
+ * read from a file.  Each piece is validated in windows as soon as it is
+ * added; jumps into the part which is not there yet are recorded as far
+ * targets, so the result is the same as validating the whole chunk at once.
+ */
+struct ValidationStream {
+  struct FarJumpTargets far;
+  bitmap_word *valid_targets;
+  bitmap_word *jump_dests;
+  /* Number of bytes validated so far.  */
+  size_t validated;
+  uint32_t options;
+  NaClCPUFeaturesX86 cpu_features;
+  ValidateBundlesFunc validate_bundles;
+  struct ValidationStats *stats;
+  Bool result;
+};
+
+static INLINE void ValidationStreamRelease(struct ValidationStream *stream) {
+  free(stream->far.reported.offsets);
+  free(stream->far.targets.offsets);
+  free(stream->jump_dests);
+  free(stream->valid_targets);
+}
+
+static INLINE Bool ValidationStreamInit(
+    struct ValidationStream *stream,
+    const uint8_t codeblock[],
+    size_t size,
+    uint32_t options,
+    const NaClCPUFeaturesX86 *cpu_features,
+    ValidationCallbackFunc user_callback,
+    void *callback_data,
+    struct ValidationStats *stats,
+    ValidateBundlesFunc validate_bundles) {
+  NACL_COMPILE_TIME_ASSERT(kJumpWindowSize % kBundleSize == 0);
+  memset(stream, 0, sizeof *stream);
+  stream->valid_targets = BitmapAllocate(kJumpWindowSize + 1);
+  stream->jump_dests = BitmapAllocate(kJumpWindowSize + 1);
+  if (!stream->valid_targets || !stream->jump_dests) {
+    ValidationStreamRelease(stream);
+    errno = ENOMEM;
+    return FALSE;
+  }
+  stream->far.codeblock = codeblock;
+  stream->far.size = size;
+  stream->far.user_callback = user_callback;
+  stream->far.callback_data = callback_data;
+  stream->far.call_on_each_instruction =
+      (options & CALL_USER_CALLBACK_ON_EACH_INSTRUCTION) != 0;
+  stream->options = options;
+  stream->cpu_features = *cpu_features;
+  stream->validate_bundles = validate_bundles;
+  stream->stats = stats;
+  stream->result = TRUE;
+  return TRUE;
+}
+
+/*
+ * Validates the bytes up to end, which must be a multiple of kBundleSize or
+ * the size of the whole chunk.  Nothing is done once we ran out of memory.
+ */
+static INLINE void ValidationStreamAdd(struct ValidationStream *stream,
+                                       size_t end) {
+  const uint8_t *codeblock = stream->far.codeblock;
+
+  CHECK(end <= stream->far.size);
+  CHECK(end == stream->far.size || end % kBundleSize == 0);
+  while (stream->validated < end && !stream->far.out_of_memory) {
+    size_t offset = stream->validated;
+    size_t window_size = end - offset;
+    if (window_size > kJumpWindowSize)
+      window_size = kJumpWindowSize;
+    stream->result &= stream->validate_bundles(
+        codeblock + offset, window_size, stream->options,
+        &stream->cpu_features, FarJumpTargetsCallback, &stream->far,
+        stream->valid_targets, stream->jump_dests, stream->stats);
+    stream->result &= ProcessInvalidJumpTargets(
+        codeblock + offset, window_size,
+        stream->valid_targets, stream->jump_dests,
+        FarJumpTargetsReportBadTarget, &stream->far);
+    memset(stream->valid_targets, 0,
+           kJumpWindowWords * sizeof *stream->valid_targets);
+    memset(stream->jump_dests, 0,
+           kJumpWindowWords * sizeof *stream->jump_dests);
+    stream->validated = offset + window_size;
+  }
+}
+
+/* Validates the rest of the chunk, checks far targets and frees the stream.  */
+static INLINE Bool ValidationStreamFinish(struct ValidationStream *stream) {
+  Bool result;
+
+  ValidationStreamAdd(stream, stream->far.size);
+  if (!stream->far.out_of_memory)
+    stream->result &= CheckFarJumpTargets(&stream->far, stream->options,
+                                          &stream->cpu_features,
+                                          stream->validate_bundles);
+  ValidationStreamRelease(stream);
+  if (stream->far.out_of_memory) {
+    errno = ENOMEM;
+    return FALSE;
+  }
+  result = stream->result;
+  if (!result) errno = EINVAL;
+  return result;
+}
+
+static INLINE Bool ValidateChunkInWindows(
+    const uint8_t codeblock[],
+    size_t size,
+    uint32_t options,
+    const NaClCPUFeaturesX86 *cpu_features,
+    ValidationCallbackFunc user_callback,
+    void *callback_data,
+    struct ValidationStats *stats,
+    ValidateBundlesFunc validate_bundles) {
+  struct ValidationStream stream;
+
+  if (!ValidationStreamInit(&stream, codeblock, size, options, cpu_features,
+                            user_callback, callback_data, stats,
+                            validate_bundles))
+    return FALSE;
+  return ValidationStreamFinish(&stream);
+}
+
+#endif  /* NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_JUMP_WINDOW_H_ */
@@ -141,7 +141,12 @@ enum ValidationOptions {
   /* Call process_error function on instruction.  */
   CALL_USER_CALLBACK_ON_EACH_INSTRUCTION = 0x00000100,
   /* Process all instruction as a contiguous stream.  */
-  PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM   = 0x00000200
+  PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM   = 0x00000200,
+  /*
+   * Reuse the DFA result for bundles which repeat within the chunk.  Ignored
+   * if either of the two options above is given.
+   */
+  MEMOIZE_BUNDLES                        = 0x00000400
 };
 
 /* NC_NO_REG is default value for restricted register */
@@ -210,6 +215,89 @@ Bool ValidateChunkIA32(const uint8_t codeblock[],
                        ValidationCallbackFunc user_callback,
                        void *callback_data);
 
+/* Filled in by ValidateChunk*WithStats.  */
+struct ValidationStats {
+  /* Number of bundles processed.  */
+  size_t bundles;
+  /* Number of bundles taken from the memo table (see MEMOIZE_BUNDLES).  */
+  size_t memo_hits;
+};
+
+/*
+ * Same as ValidateChunkAMD64 and ValidateChunkIA32, but also fill stats.
+ */
+VALIDATOR_EXPORT
+Bool ValidateChunkAMD64WithStats(const uint8_t codeblock[],
+                                 size_t size,
+                                 uint32_t options,
+                                 const NaClCPUFeaturesX86 *cpu_features,
+                                 ValidationCallbackFunc user_callback,
+                                 void *callback_data,
+                                 struct ValidationStats *stats);
+
+VALIDATOR_EXPORT
+Bool ValidateChunkIA32WithStats(const uint8_t codeblock[],
+                                size_t size,
+                                uint32_t options,
+                                const NaClCPUFeaturesX86 *cpu_features,
+                                ValidationCallbackFunc user_callback,
+                                void *callback_data,
+                                struct ValidationStats *stats);
+
+/*
+ * Validation of a chunk which is not fully there yet, e.g. because it is
+ * still being read from a file.  ValidationStreamCreate* takes the whole
+ * buffer, but only looks at the bytes which were passed to
+ * ValidationStreamAdd*: end is the number of bytes available so far and must
+ * be a multiple of kBundleSize (or the size of the whole chunk).  Pieces may
+ * be added from a different thread than the one which fills the buffer, as
+ * long as the bytes given to ValidationStreamAdd* are not modified later.
+ *
+ * ValidationStreamFinish* validates the rest of the chunk and returns the
+ * same result ValidateChunk* would return for it; it frees the stream.
+ * ValidationStreamDestroy* abandons a stream which will not be finished.
+ *
+ * ValidationStreamCreate* returns NULL (and sets errno) if it runs out of
+ * memory.  PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM is not supported.
+ */
+struct ValidationStream;
+
+VALIDATOR_EXPORT
+struct ValidationStream *ValidationStreamCreateAMD64(
+    const uint8_t codeblock[],
+    size_t size,
+    uint32_t options,
+    const NaClCPUFeaturesX86 *cpu_features,
+    ValidationCallbackFunc user_callback,
+    void *callback_data);
+
+VALIDATOR_EXPORT
+void ValidationStreamAddAMD64(struct ValidationStream *stream, size_t end);
+
+VALIDATOR_EXPORT
+Bool ValidationStreamFinishAMD64(struct ValidationStream *stream);
+
+VALIDATOR_EXPORT
+void ValidationStreamDestroyAMD64(struct ValidationStream *stream);
+
+VALIDATOR_EXPORT
+struct ValidationStream *ValidationStreamCreateIA32(
+    const uint8_t codeblock[],
+    size_t size,
+    uint32_t options,
+    const NaClCPUFeaturesX86 *cpu_features,
+    ValidationCallbackFunc user_callback,
+    void *callback_data);
+
+VALIDATOR_EXPORT
+void ValidationStreamAddIA32(struct ValidationStream *stream, size_t end);
+
+VALIDATOR_EXPORT
+Bool ValidationStreamFinishIA32(struct ValidationStream *stream);
+
+VALIDATOR_EXPORT
+void ValidationStreamDestroyIA32(struct ValidationStream *stream);
+
 EXTERN_C_END
 
 #endif  /* NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_VALIDATOR_H_ */
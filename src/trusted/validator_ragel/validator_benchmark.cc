@@ -9,12 +9,20 @@
 #include <string.h>
 #include <time.h>
 
+#include <vector>
+
+#include "native_client/src/include/build_config.h"
 #include "native_client/src/include/elf.h"
 #include "native_client/src/include/elf_constants.h"
 #include "native_client/src/shared/platform/nacl_check.h"
 #include "native_client/src/shared/utils/types.h"
 #include "native_client/src/trusted/validator/driver/elf_load.h"
 #include "native_client/src/trusted/validator_ragel/validator.h"
+#include "native_client/src/trusted/validator_ragel/validator_styles.h"
+
+#if !NACL_WINDOWS
+# include <sys/resource.h>
+#endif
 
 
 Bool ProcessError(
@@ -29,18 +37,62 @@ Bool ProcessError(
     return TRUE;
 }
 
+// Peak resident set size of the process in KB, or -1 if unknown.
+long PeakRssKb() {
+#if !NACL_WINDOWS
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    return usage.ru_maxrss;
+#endif
+  return -1;
+}
+
 
 int main(int argc, char *argv[]) {
-  if (argc != 3) {
+  uint32_t options = 0;
+  int text_copies = 1;
+  // The production validator, unless a style is given.
+  ValidateChunkWithStatsFunc *validate_ia32 = ValidateChunkIA32WithStats;
+  ValidateChunkWithStatsFunc *validate_amd64 = ValidateChunkAMD64WithStats;
+  const char *style_name = "default";
+  for (int i = 3; i < argc; i++) {
+    if (strcmp(argv[i], "--memoize_bundles") == 0) {
+      options |= MEMOIZE_BUNDLES;
+    } else if (strncmp(argv[i], "--text_copies=", 14) == 0) {
+      text_copies = atoi(argv[i] + 14);
+    } else if (strncmp(argv[i], "--style=", 8) == 0) {
+      const ValidatorStyle *style = FindValidatorStyle(argv[i] + 8);
+      if (style == NULL) {
+        argc = 0;
+        break;
+      }
+      validate_ia32 = style->validate_ia32;
+      validate_amd64 = style->validate_amd64;
+      style_name = style->name;
+    } else {
+      argc = 0;
+    }
+  }
+  if (argc < 3 || text_copies <= 0) {
     printf("Usage:\n");
-    printf("    validator_benchmark <nexe> <number of repetitions>\n");
+    printf("    validator_benchmark <nexe> <number of repetitions> "
+           "[--memoize_bundles] [--text_copies=N] [--style=S]\n");
+    printf("--text_copies validates N copies of the text segment as one "
+           "chunk, to\nmeasure memory use on big code segments.\n");
+    printf("--style picks the DFA code generation style:");
+    for (const ValidatorStyle *style = kValidatorStyles; style->name != NULL;
+         style++) {
+      printf(" %s", style->name);
+    }
+    printf(".\n");
     exit(1);
   }
   const char *input_file = argv[1];
   int repetitions = atoi(argv[2]);
   CHECK(repetitions > 0);
 
-  printf("Validating %s %d times ...\n", input_file, repetitions);
+  printf("Validating %s %d times (%s DFA style) ...\n", input_file,
+         repetitions, style_name);
 
   elf_load::Image image;
   elf_load::ReadImage(input_file, &image);
@@ -55,22 +107,37 @@ int main(int argc, char *argv[]) {
     exit(1);
   }
 
+  std::vector<uint8_t> copies;
+  if (text_copies > 1) {
+    // Reserve up front: growing the vector would leave a peak of up to twice
+    // its size behind.
+    copies.reserve(static_cast<size_t>(segment.size) * text_copies);
+    for (int i = 0; i < text_copies; i++)
+      copies.insert(copies.end(), segment.data, segment.data + segment.size);
+    segment.data = &copies[0];
+    segment.size *= text_copies;
+  }
+
+  // The image and the copies are all in memory by now, so the growth of the
+  // peak from here on is what the validator itself uses.
+  long inputs_rss_kb = PeakRssKb();
   Bool result = FALSE;
+  ValidationStats stats = { 0, 0 };
 
   clock_t start = clock();
   for (int i = 0; i < repetitions; i++) {
     switch (architecture) {
       case elf_load::X86_32:
-        result = ValidateChunkIA32(
+        result = validate_ia32(
             segment.data, segment.size,
-            0, &kFullCPUIDFeatures,
-            ProcessError, NULL);
+            options, &kFullCPUIDFeatures,
+            ProcessError, NULL, &stats);
         break;
       case elf_load::X86_64:
-        result = ValidateChunkAMD64(
+        result = validate_amd64(
             segment.data, segment.size,
-            0, &kFullCPUIDFeatures,
-            ProcessError, NULL);
+            options, &kFullCPUIDFeatures,
+            ProcessError, NULL, &stats);
         break;
       case elf_load::ARM:
         CHECK(false);
@@ -90,5 +157,17 @@ int main(int argc, char *argv[]) {
 
   printf("\n");
 
+  long peak_rss_kb = PeakRssKb();
+  if (peak_rss_kb >= 0) {
+    printf("Peak RSS: %ld KB (%ld KB above the inputs)\n",
+           peak_rss_kb, peak_rss_kb - inputs_rss_kb);
+  }
+
+  if (options & MEMOIZE_BUNDLES) {
+    printf("Memo hits: %" NACL_PRIuS " of %" NACL_PRIuS " bundles (%.1f%%)\n",
+           stats.memo_hits, stats.bundles,
+           stats.bundles ? 100.0 * stats.memo_hits / stats.bundles : 0.0);
+  }
+
   return result ? 0 : 1;
 }
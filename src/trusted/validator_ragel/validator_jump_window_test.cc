@@ -0,0 +1,289 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Tests for the windowed validation of chunks bigger than kJumpWindowSize
+ * (see jump_window.h).  The reference is the dense path, which
+ * PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM selects for any chunk size.  That
+ * option also lets instructions cross bundle boundaries and gives up on the
+ * rest of the chunk after an invalid instruction, so the code compared
+ * against it has neither.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/trusted/validator_ragel/decoder.h"
+#include "native_client/src/trusted/validator_ragel/validator.h"
+
+namespace {
+
+// Same as in jump_window.h, which is internal to the validator.
+const size_t kWindowSize = 1 << 20;
+
+struct Report {
+  size_t begin;
+  size_t end;
+  uint32_t info;
+  bool operator==(const Report &other) const {
+    return begin == other.begin && end == other.end && info == other.info;
+  }
+  bool operator<(const Report &other) const {
+    if (begin != other.begin)
+      return begin < other.begin;
+    if (end != other.end)
+      return end < other.end;
+    return info < other.info;
+  }
+};
+
+struct ValidationRun {
+  const uint8_t *data;
+  std::vector<Report> reports;
+};
+
+Bool RecordReport(const uint8_t *begin, const uint8_t *end,
+                  uint32_t info, void *run_ptr) {
+  ValidationRun *run = reinterpret_cast<ValidationRun *>(run_ptr);
+  Report report = { static_cast<size_t>(begin - run->data),
+                    static_cast<size_t>(end - run->data), info };
+  run->reports.push_back(report);
+  return (info & (VALIDATION_ERRORS_MASK | BAD_JUMP_TARGET)) ? FALSE : TRUE;
+}
+
+// Six "mov $imm32, %eax" followed by two nops: instruction boundaries are
+// at multiples of 5 and at 31.
+void PutMovBundle(std::vector<uint8_t> *code, size_t offset) {
+  for (int i = 0; i < 6; i++) {
+    (*code)[offset + i * 5] = 0xb8;
+    (*code)[offset + i * 5 + 1] = static_cast<uint8_t>(i);
+  }
+}
+
+// jmp rel32 at offset to target, which may be outside of the chunk.
+void PutJump(std::vector<uint8_t> *code, size_t offset, int64_t target) {
+  int32_t rel = static_cast<int32_t>(target - static_cast<int64_t>(offset + 5));
+  (*code)[offset] = 0xe9;
+  memcpy(&(*code)[offset + 1], &rel, sizeof(rel));
+}
+
+typedef Bool ValidateChunkFunc(const uint8_t codeblock[],
+                               size_t size,
+                               uint32_t options,
+                               const NaClCPUFeaturesX86 *cpu_features,
+                               ValidationCallbackFunc user_callback,
+                               void *callback_data);
+
+ValidateChunkFunc *ValidatorFor(int bits) {
+  return bits == 32 ? ValidateChunkIA32 : ValidateChunkAMD64;
+}
+
+class ValidatorJumpWindowTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    // A fixed seed keeps failures reproducible.
+    srand(1);
+  }
+
+  // Validates code in windows and densely, expects the same result and the
+  // same reports (in any order) and returns the result.
+  bool ExpectSameAsDense(const std::vector<uint8_t> &code, int bits,
+                         std::vector<Report> *reports) {
+    ValidationRun windowed = { &code[0], std::vector<Report>() };
+    ValidationRun dense = { &code[0], std::vector<Report>() };
+
+    Bool windowed_result = ValidatorFor(bits)(
+        &code[0], code.size(), 0, &kFullCPUIDFeatures,
+        RecordReport, &windowed);
+    Bool dense_result = ValidatorFor(bits)(
+        &code[0], code.size(), PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM,
+        &kFullCPUIDFeatures, RecordReport, &dense);
+    std::sort(windowed.reports.begin(), windowed.reports.end());
+    std::sort(dense.reports.begin(), dense.reports.end());
+    EXPECT_EQ(dense_result, windowed_result) << "x86-" << bits;
+    EXPECT_TRUE(dense.reports == windowed.reports)
+        << "x86-" << bits << ": " << dense.reports.size()
+        << " reports densely vs " << windowed.reports.size() << " in windows";
+    if (reports != NULL)
+      *reports = windowed.reports;
+    return windowed_result != FALSE;
+  }
+};
+
+TEST_F(ValidatorJumpWindowTest, NopsOnly) {
+  std::vector<uint8_t> code(3 * kWindowSize + 7 * kBundleSize, 0x90);
+  for (int bits = 32; bits <= 64; bits += 32) {
+    std::vector<Report> reports;
+    EXPECT_TRUE(ExpectSameAsDense(code, bits, &reports));
+    EXPECT_TRUE(reports.empty());
+  }
+}
+
+TEST_F(ValidatorJumpWindowTest, FarJumps) {
+  // Targets live in a mov bundle in the second window; jumps come from the
+  // first window (forward), the last window (backward) and from the same
+  // window.
+  const size_t kSize = 2 * kWindowSize + 7 * kBundleSize;
+  const size_t kTargetBundle = kWindowSize + 64 * kBundleSize;
+  const size_t kSources[] = {
+    0, kWindowSize - kBundleSize, kTargetBundle + 16 * kBundleSize,
+    kSize - kBundleSize
+  };
+  const int kTargets[] = { 0, 1, 3, 5, 6, 25, 29, 30, 31 };
+
+  for (size_t source = 0; source < NACL_ARRAY_SIZE(kSources); source++) {
+    for (size_t i = 0; i < NACL_ARRAY_SIZE(kTargets); i++) {
+      int target = kTargets[i];
+      std::vector<uint8_t> code(kSize, 0x90);
+      PutMovBundle(&code, kTargetBundle);
+      PutJump(&code, kSources[source], kTargetBundle + target);
+      bool good_target = target % 5 == 0 || target == 31;
+      for (int bits = 32; bits <= 64; bits += 32) {
+        std::vector<Report> reports;
+        EXPECT_EQ(good_target, ExpectSameAsDense(code, bits, &reports))
+            << "x86-" << bits << ", source " << kSources[source]
+            << ", target " << target;
+        if (!good_target) {
+          ASSERT_EQ(1U, reports.size());
+          EXPECT_EQ(kTargetBundle + target, reports[0].begin);
+          EXPECT_EQ(static_cast<uint32_t>(BAD_JUMP_TARGET), reports[0].info);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(ValidatorJumpWindowTest, ErrorsInSeveralWindows) {
+  // An invalid instruction in one window does not stop the validation of
+  // the others, nor the check of far targets.
+  const size_t kSize = 3 * kWindowSize;
+  const size_t kInvalid = kWindowSize + 5 * kBundleSize;
+  const size_t kTarget = 2 * kWindowSize + kBundleSize + 3;
+  std::vector<uint8_t> code(kSize, 0x90);
+  code[kInvalid] = 0xcd;  // int $0x80
+  code[kInvalid + 1] = 0x80;
+  PutMovBundle(&code, kTarget - 3);
+  PutJump(&code, kBundleSize, kTarget);
+  for (int bits = 32; bits <= 64; bits += 32) {
+    ValidationRun run = { &code[0], std::vector<Report>() };
+    EXPECT_FALSE(ValidatorFor(bits)(&code[0], code.size(), 0,
+                                    &kFullCPUIDFeatures, RecordReport, &run));
+    std::sort(run.reports.begin(), run.reports.end());
+    ASSERT_EQ(2U, run.reports.size()) << "x86-" << bits;
+    EXPECT_EQ(kInvalid, run.reports[0].begin);
+    EXPECT_NE(0U, run.reports[0].info & VALIDATION_ERRORS_MASK);
+    EXPECT_EQ(kTarget, run.reports[1].begin);
+    EXPECT_EQ(static_cast<uint32_t>(BAD_JUMP_TARGET), run.reports[1].info);
+  }
+}
+
+TEST_F(ValidatorJumpWindowTest, BadTargetReachedFromNearAndFar) {
+  // The same bad target is reached from its own window and from another
+  // one; it must be reported once.
+  const size_t kTarget = 2 * kWindowSize + 3;
+  std::vector<uint8_t> code(3 * kWindowSize, 0x90);
+  PutMovBundle(&code, kTarget - 3);
+  PutJump(&code, kTarget - 3 + kBundleSize, kTarget);
+  PutJump(&code, kBundleSize, kTarget);
+  for (int bits = 32; bits <= 64; bits += 32) {
+    std::vector<Report> reports;
+    EXPECT_FALSE(ExpectSameAsDense(code, bits, &reports));
+    EXPECT_EQ(1U, reports.size());
+  }
+}
+
+TEST_F(ValidatorJumpWindowTest, JumpsOutOfChunk) {
+  // Aligned targets outside of the chunk are fine, unaligned ones are not.
+  const size_t kSize = 2 * kWindowSize + kBundleSize;
+  const int64_t kTargets[] = {
+    -static_cast<int64_t>(kBundleSize), -1,
+    static_cast<int64_t>(kSize), static_cast<int64_t>(kSize) + 1,
+    static_cast<int64_t>(kSize) + kBundleSize
+  };
+  for (size_t i = 0; i < NACL_ARRAY_SIZE(kTargets); i++) {
+    std::vector<uint8_t> code(kSize, 0x90);
+    PutJump(&code, kWindowSize + kBundleSize, kTargets[i]);
+    for (int bits = 32; bits <= 64; bits += 32) {
+      EXPECT_EQ(kTargets[i] % kBundleSize == 0,
+                ExpectSameAsDense(code, bits, NULL))
+          << "x86-" << bits << ", target " << kTargets[i];
+    }
+  }
+}
+
+TEST_F(ValidatorJumpWindowTest, RandomJumps) {
+  // Many jumps to random bytes of a chunk full of mov bundles, and a few
+  // just outside of it.
+  const size_t kSize = 2 * kWindowSize + kWindowSize / 2;
+  for (int round = 0; round < 4; round++) {
+    std::vector<uint8_t> code(kSize, 0x90);
+    for (size_t bundle = 0; bundle < kSize; bundle += kBundleSize) {
+      if (rand() % 8 == 0) {
+        PutJump(&code, bundle,
+                static_cast<int64_t>(rand() % (kSize + 2 * kBundleSize)) -
+                kBundleSize);
+      } else {
+        PutMovBundle(&code, bundle);
+      }
+    }
+    for (int bits = 32; bits <= 64; bits += 32)
+      ExpectSameAsDense(code, bits, NULL);
+  }
+}
+
+TEST_F(ValidatorJumpWindowTest, StreamInPieces) {
+  // ValidationStream* gives the same result as ValidateChunk*, whatever
+  // the pieces are, including jumps into the part not added yet.
+  const size_t kSize = 2 * kWindowSize + 5 * kBundleSize;
+  std::vector<uint8_t> code(kSize, 0x90);
+  for (size_t bundle = 0; bundle < kSize; bundle += 4 * kBundleSize) {
+    PutMovBundle(&code, bundle);
+    PutJump(&code, bundle + kBundleSize,
+            static_cast<int64_t>(rand() % kSize));
+  }
+
+  for (int bits = 32; bits <= 64; bits += 32) {
+    std::vector<Report> expected;
+    bool expected_result = ExpectSameAsDense(code, bits, &expected);
+    for (int round = 0; round < 4; round++) {
+      ValidationRun run = { &code[0], std::vector<Report>() };
+      ValidationStream *stream =
+          bits == 32 ?
+          ValidationStreamCreateIA32(&code[0], code.size(), 0,
+                                     &kFullCPUIDFeatures, RecordReport, &run) :
+          ValidationStreamCreateAMD64(&code[0], code.size(), 0,
+                                      &kFullCPUIDFeatures, RecordReport, &run);
+      ASSERT_TRUE(stream != NULL);
+      for (size_t end = 0; end < kSize; ) {
+        end += (1 + rand() % (kWindowSize / kBundleSize)) * kBundleSize;
+        if (end >= kSize)
+          break;
+        if (bits == 32)
+          ValidationStreamAddIA32(stream, end);
+        else
+          ValidationStreamAddAMD64(stream, end);
+      }
+      Bool result = bits == 32 ? ValidationStreamFinishIA32(stream) :
+                                 ValidationStreamFinishAMD64(stream);
+      std::sort(run.reports.begin(), run.reports.end());
+      EXPECT_EQ(expected_result, result != FALSE) << "x86-" << bits;
+      EXPECT_TRUE(expected == run.reports) << "x86-" << bits;
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
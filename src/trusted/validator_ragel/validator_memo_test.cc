@@ -0,0 +1,218 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Checks that MEMOIZE_BUNDLES does not change what the validator accepts
+ * or reports.  The inputs are built from a few bundle templates, so most
+ * bundles repeat, mixed with jumps into the repeated bundles (both to
+ * instruction boundaries and into the middle of instructions), invalid
+ * bundles and randomly mutated copies.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "native_client/src/trusted/validator_ragel/decoder.h"
+#include "native_client/src/trusted/validator_ragel/validator.h"
+
+namespace {
+
+struct Report {
+  size_t begin;
+  size_t end;
+  uint32_t info;
+  bool operator==(const Report &other) const {
+    return begin == other.begin && end == other.end && info == other.info;
+  }
+};
+
+struct ValidationRun {
+  const uint8_t *data;
+  std::vector<Report> reports;
+};
+
+Bool RecordReport(const uint8_t *begin, const uint8_t *end,
+                  uint32_t info, void *run_ptr) {
+  ValidationRun *run = reinterpret_cast<ValidationRun *>(run_ptr);
+  Report report = { static_cast<size_t>(begin - run->data),
+                    static_cast<size_t>(end - run->data), info };
+  run->reports.push_back(report);
+  return (info & (VALIDATION_ERRORS_MASK | BAD_JUMP_TARGET)) ? FALSE : TRUE;
+}
+
+enum BundleKind {
+  kNops,
+  kMovImmediates,   // mov $imm32, %eax six times: targets every 5 bytes
+  kInvalid,         // int $0x80
+  kShortJump,       // jmp rel8 to a nearby byte
+  kNearJump,        // jmp rel32 to anywhere in the chunk
+  kNumBundleKinds
+};
+
+void AppendBundle(std::vector<uint8_t> *code, BundleKind kind,
+                  size_t chunk_bundles) {
+  size_t start = code->size();
+  code->resize(start + kBundleSize, 0x90);
+  uint8_t *bundle = &(*code)[start];
+
+  switch (kind) {
+    case kNops:
+      break;
+    case kMovImmediates:
+      for (int i = 0; i < 6; i++) {
+        bundle[i * 5] = 0xb8;
+        bundle[i * 5 + 1] = static_cast<uint8_t>(i);
+      }
+      break;
+    case kInvalid:
+      bundle[0] = 0xcd;
+      bundle[1] = 0x80;
+      break;
+    case kShortJump:
+      bundle[0] = 0xeb;
+      bundle[1] = static_cast<uint8_t>(rand());
+      break;
+    case kNearJump: {
+      // Aim at a random byte of a random bundle, so that some jumps land
+      // inside the immediates of repeated kMovImmediates bundles.
+      int32_t target = static_cast<int32_t>(
+          (rand() % chunk_bundles) * kBundleSize + rand() % kBundleSize);
+      int32_t rel = target - static_cast<int32_t>(start + 5);
+      bundle[0] = 0xe9;
+      memcpy(&bundle[1], &rel, sizeof(rel));
+      break;
+    }
+    case kNumBundleKinds:
+      break;
+  }
+}
+
+std::vector<uint8_t> MakeCorpus(size_t bundles, bool with_errors) {
+  std::vector<uint8_t> code;
+  for (size_t i = 0; i < bundles; i++) {
+    BundleKind kind = static_cast<BundleKind>(rand() % kNumBundleKinds);
+    if (kind == kInvalid && !with_errors)
+      kind = kNops;
+    AppendBundle(&code, kind, bundles);
+  }
+  return code;
+}
+
+typedef Bool ValidateChunkWithStatsFunc(const uint8_t codeblock[],
+                                        size_t size,
+                                        uint32_t options,
+                                        const NaClCPUFeaturesX86 *cpu_features,
+                                        ValidationCallbackFunc user_callback,
+                                        void *callback_data,
+                                        struct ValidationStats *stats);
+
+ValidateChunkWithStatsFunc *ValidatorFor(int bits) {
+  return bits == 32 ? ValidateChunkIA32WithStats : ValidateChunkAMD64WithStats;
+}
+
+class ValidatorMemoTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    // A fixed seed keeps failures reproducible.
+    srand(1);
+  }
+
+  // Validates code with and without MEMOIZE_BUNDLES and expects the same
+  // result and reports.  Returns the number of memo hits.
+  size_t ExpectSameResults(const std::vector<uint8_t> &code, int bits) {
+    ValidateChunkWithStatsFunc *validate = ValidatorFor(bits);
+    ValidationRun plain = { &code[0], std::vector<Report>() };
+    ValidationRun memoized = { &code[0], std::vector<Report>() };
+    ValidationStats plain_stats = { 0, 0 };
+    ValidationStats memoized_stats = { 0, 0 };
+
+    Bool plain_result = validate(&code[0], code.size(), 0,
+                                 &kFullCPUIDFeatures, RecordReport, &plain,
+                                 &plain_stats);
+    Bool memoized_result = validate(&code[0], code.size(), MEMOIZE_BUNDLES,
+                                    &kFullCPUIDFeatures, RecordReport,
+                                    &memoized, &memoized_stats);
+    EXPECT_EQ(plain_result, memoized_result) << "x86-" << bits;
+    EXPECT_TRUE(plain.reports == memoized.reports)
+        << "x86-" << bits << ": " << plain.reports.size() << " reports vs "
+        << memoized.reports.size() << " with MEMOIZE_BUNDLES";
+    EXPECT_EQ(plain_stats.bundles, memoized_stats.bundles);
+    EXPECT_EQ(0U, plain_stats.memo_hits);
+    return memoized_stats.memo_hits;
+  }
+};
+
+TEST_F(ValidatorMemoTest, RepeatedValidBundles) {
+  // Only in-range jumps and valid instructions, though jumps into the
+  // middle of instructions still make some chunks invalid.
+  for (int round = 0; round < 20; round++) {
+    std::vector<uint8_t> code = MakeCorpus(256, false);
+    EXPECT_GT(ExpectSameResults(code, 32), 0U);
+    EXPECT_GT(ExpectSameResults(code, 64), 0U);
+  }
+}
+
+TEST_F(ValidatorMemoTest, RepeatedInvalidBundles) {
+  for (int round = 0; round < 20; round++) {
+    std::vector<uint8_t> code = MakeCorpus(256, true);
+    ExpectSameResults(code, 32);
+    ExpectSameResults(code, 64);
+  }
+}
+
+TEST_F(ValidatorMemoTest, MutatedBundles) {
+  // Near-duplicates: the memo table must compare whole bundles, not
+  // just their hashes or prefixes.
+  for (int round = 0; round < 20; round++) {
+    std::vector<uint8_t> code = MakeCorpus(256, false);
+    for (size_t i = 0; i < code.size() / 128; i++)
+      code[rand() % code.size()] = static_cast<uint8_t>(rand());
+    ExpectSameResults(code, 32);
+    ExpectSameResults(code, 64);
+  }
+}
+
+TEST_F(ValidatorMemoTest, JumpIntoRepeatedBundle) {
+  // The first and last bundles are identical, so the last one comes from
+  // the memo table.  The jump in the middle bundle targets the last one,
+  // and whether it lands on an instruction boundary is only known from
+  // the replayed valid_targets bits.
+  for (int target = 0; target < kBundleSize; target++) {
+    std::vector<uint8_t> code;
+    AppendBundle(&code, kMovImmediates, 3);
+    std::vector<uint8_t> jump(kBundleSize, 0x90);
+    int32_t rel = 2 * kBundleSize + target - (kBundleSize + 5);
+    jump[0] = 0xe9;
+    memcpy(&jump[1], &rel, sizeof(rel));
+    code.insert(code.end(), jump.begin(), jump.end());
+    AppendBundle(&code, kMovImmediates, 3);
+
+    // Six 5-byte movs followed by two nops.
+    bool expect_valid = target % 5 == 0 || target >= 30;
+    for (int bits = 32; bits <= 64; bits += 32) {
+      ValidationRun run = { &code[0], std::vector<Report>() };
+      ValidationStats stats = { 0, 0 };
+      EXPECT_EQ(expect_valid,
+                ValidatorFor(bits)(&code[0], code.size(), MEMOIZE_BUNDLES,
+                                   &kFullCPUIDFeatures, RecordReport, &run,
+                                   &stats) != FALSE)
+          << "x86-" << bits << ", target " << target;
+      EXPECT_EQ(1U, stats.memo_hits) << "x86-" << bits;
+      ExpectSameResults(code, bits);
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
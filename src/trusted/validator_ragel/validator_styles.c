@@ -0,0 +1,31 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <string.h>
+
+#include "native_client/src/trusted/validator_ragel/validator_styles.h"
+
+/* Entry points of the renamed copies, see build.scons.  */
+ValidateChunkWithStatsFunc ValidateChunkIA32WithStatsTable;
+ValidateChunkWithStatsFunc ValidateChunkAMD64WithStatsTable;
+ValidateChunkWithStatsFunc ValidateChunkIA32WithStatsGoto;
+ValidateChunkWithStatsFunc ValidateChunkAMD64WithStatsGoto;
+
+const struct ValidatorStyle kValidatorStyles[] = {
+  { "table", ValidateChunkIA32WithStatsTable,
+    ValidateChunkAMD64WithStatsTable },
+  { "goto", ValidateChunkIA32WithStatsGoto, ValidateChunkAMD64WithStatsGoto },
+  { NULL, NULL, NULL }
+};
+
+const struct ValidatorStyle *FindValidatorStyle(const char *name) {
+  const struct ValidatorStyle *style;
+  for (style = kValidatorStyles; style->name != NULL; style++) {
+    if (strcmp(style->name, name) == 0)
+      return style;
+  }
+  return NULL;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * The validator DFAs can be generated in several code styles (see
+ * codegen.py --style).  The production validator is built from one style
+ * per bitness; this interface gives the benchmark and the differential
+ * test every style side by side.  Each style's gen/validator_x86_*.c is
+ * compiled again with its entry points renamed by adding the capitalized
+ * style name, e.g. ValidateChunkAMD64WithStatsGoto.
+ */
+
+#ifndef NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_VALIDATOR_STYLES_H_
+#define NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_VALIDATOR_STYLES_H_
+
+#include "native_client/src/trusted/validator_ragel/validator.h"
+
+EXTERN_C_BEGIN
+
+typedef Bool ValidateChunkWithStatsFunc(const uint8_t codeblock[],
+                                        size_t size,
+                                        uint32_t options,
+                                        const NaClCPUFeaturesX86 *cpu_features,
+                                        ValidationCallbackFunc user_callback,
+                                        void *callback_data,
+                                        struct ValidationStats *stats);
+
+struct ValidatorStyle {
+  const char *name;
+  ValidateChunkWithStatsFunc *validate_ia32;
+  ValidateChunkWithStatsFunc *validate_amd64;
+};
+
+/* Terminated by an entry with a NULL name.  */
+extern const struct ValidatorStyle kValidatorStyles[];
+
+/* Returns NULL if there is no style with the given name.  */
+const struct ValidatorStyle *FindValidatorStyle(const char *name);
+
+EXTERN_C_END
+
+#endif  /* NATIVE_CLIENT_SRC_TRUSTED_VALIDATOR_RAGEL_VALIDATOR_STYLES_H_ */
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Differential test of the DFA code generation styles: every style must
+ * accept the same language and report exactly the same instructions and
+ * errors as the table style.  The inputs are the text of a real nexe,
+ * randomly mutated copies of it, all two-byte instruction starts and all
+ * three-byte starts after common prefix and escape bytes.  Each input is
+ * validated as both x86-32 and x86-64 code, with and without per-instruction
+ * callbacks.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "native_client/src/include/build_config.h"
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/trusted/validator/driver/elf_load.h"
+#include "native_client/src/trusted/validator_ragel/validator.h"
+#include "native_client/src/trusted/validator_ragel/validator_styles.h"
+
+namespace {
+
+struct Report {
+  size_t begin;
+  size_t end;
+  uint32_t info;
+  bool operator==(const Report &other) const {
+    return begin == other.begin && end == other.end && info == other.info;
+  }
+};
+
+struct Run {
+  const uint8_t *data;
+  std::vector<Report> reports;
+};
+
+Bool RecordReport(const uint8_t *begin, const uint8_t *end,
+                  uint32_t info, void *run_ptr) {
+  Run *run = reinterpret_cast<Run *>(run_ptr);
+  Report report = { static_cast<size_t>(begin - run->data),
+                    static_cast<size_t>(end - run->data), info };
+  run->reports.push_back(report);
+  return (info & (VALIDATION_ERRORS_MASK | BAD_JUMP_TARGET)) ? FALSE : TRUE;
+}
+
+const uint32_t kOptions[] = {
+  0,
+  CALL_USER_CALLBACK_ON_EACH_INSTRUCTION,
+  CALL_USER_CALLBACK_ON_EACH_INSTRUCTION | PROCESS_CHUNK_AS_A_CONTIGUOUS_STREAM,
+  MEMOIZE_BUNDLES,
+};
+
+// Returns the number of mismatches between the table style and the others.
+int CompareStyles(const char *input_name, const std::vector<uint8_t> &code) {
+  CHECK(code.size() % kBundleSize == 0);
+  const ValidatorStyle *reference = FindValidatorStyle("table");
+  CHECK(reference != NULL);
+  int errors = 0;
+
+  for (size_t bits = 32; bits <= 64; bits += 32) {
+    for (size_t i = 0; i < NACL_ARRAY_SIZE(kOptions); i++) {
+      Run expected = { &code[0], std::vector<Report>() };
+      ValidateChunkWithStatsFunc *validate =
+          bits == 32 ? reference->validate_ia32 : reference->validate_amd64;
+      Bool expected_result = validate(&code[0], code.size(), kOptions[i],
+                                      &kFullCPUIDFeatures, RecordReport,
+                                      &expected, NULL);
+
+      for (const ValidatorStyle *style = kValidatorStyles;
+           style->name != NULL; style++) {
+        if (style == reference)
+          continue;
+        Run actual = { &code[0], std::vector<Report>() };
+        validate = bits == 32 ? style->validate_ia32 : style->validate_amd64;
+        Bool actual_result = validate(&code[0], code.size(), kOptions[i],
+                                      &kFullCPUIDFeatures, RecordReport,
+                                      &actual, NULL);
+        if (actual_result != expected_result ||
+            actual.reports != expected.reports) {
+          printf("MISMATCH: %s, x86-%d, options 0x%x: %s style gives %s with "
+                 "%d reports, table style gives %s with %d reports\n",
+                 input_name, static_cast<int>(bits), kOptions[i], style->name,
+                 actual_result ? "valid" : "invalid",
+                 static_cast<int>(actual.reports.size()),
+                 expected_result ? "valid" : "invalid",
+                 static_cast<int>(expected.reports.size()));
+          errors++;
+        }
+      }
+    }
+  }
+  return errors;
+}
+
+// Bundles which start with the given bytes, padded with nops.
+void AddBundle(std::vector<uint8_t> *code, const uint8_t *start, size_t len) {
+  code->insert(code->end(), start, start + len);
+  code->insert(code->end(), kBundleSize - len, 0x90);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    printf("Usage:\n");
+    printf("    validator_styles_test <nexe>\n");
+    return 1;
+  }
+
+  elf_load::Image image;
+  elf_load::ReadImage(argv[1], &image);
+  elf_load::Segment segment = elf_load::GetElfTextSegment(image);
+  std::vector<uint8_t> text(segment.data, segment.data + segment.size);
+  text.resize(text.size() - text.size() % kBundleSize);
+
+  int errors = CompareStyles("text", text);
+
+  // A fixed seed keeps failures reproducible.
+  srand(1);
+  for (int copy = 0; copy < 4; copy++) {
+    std::vector<uint8_t> mutated(text);
+    for (size_t i = 0; i < mutated.size() / 64; i++)
+      mutated[rand() % mutated.size()] = static_cast<uint8_t>(rand());
+    errors += CompareStyles("mutated text", mutated);
+  }
+
+  std::vector<uint8_t> pairs;
+  for (int i = 0; i < 0x10000; i++) {
+    uint8_t start[2] = { static_cast<uint8_t>(i >> 8),
+                         static_cast<uint8_t>(i) };
+    AddBundle(&pairs, start, sizeof(start));
+  }
+  errors += CompareStyles("two-byte starts", pairs);
+
+  // Operand size, REX and segment prefixes, the 0x0f escape and VEX.
+  static const uint8_t kFirstBytes[] = {
+    0x0f, 0x26, 0x2e, 0x36, 0x3e, 0x40, 0x41, 0x44, 0x48, 0x49, 0x4c, 0x4d,
+    0x64, 0x65, 0x66, 0x67, 0xc4, 0xc5, 0xf0, 0xf2, 0xf3,
+  };
+  for (size_t first = 0; first < NACL_ARRAY_SIZE(kFirstBytes); first++) {
+    std::vector<uint8_t> triples;
+    for (int i = 0; i < 0x10000; i++) {
+      uint8_t start[3] = { kFirstBytes[first], static_cast<uint8_t>(i >> 8),
+                           static_cast<uint8_t>(i) };
+      AddBundle(&triples, start, sizeof(start));
+    }
+    errors += CompareStyles("three-byte starts", triples);
+  }
+
+  if (errors != 0) {
+    printf("FAILED: %d mismatches\n", errors);
+    return 1;
+  }
+  printf("PASSED\n");
+  return 0;
+}
@@ -18,6 +18,10 @@
 #else
 #include <sys/mman.h>
 #endif
+#if NACL_LINUX == 1
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -107,11 +111,62 @@ static int IsTrustedWrite(uint8_t *dst,
 void* g_squashybuffer = NULL;
 char g_firstbyte = 0;
 
-static Bool SerializeAllProcessors(void) {
+#if NACL_LINUX == 1 && defined(__NR_membarrier)
+/* From <linux/membarrier.h>, which older systems do not have. */
+#define NACL_MEMBARRIER_CMD_QUERY                                 0
+#define NACL_MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE           (1 << 5)
+#define NACL_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED_SYNC_CORE  (1 << 6)
+
+/*
+ * 0 until the first call, then 1 if the process is registered for
+ * sync-core membarriers and -1 if they are not available.  Registering
+ * twice is harmless, so racing first calls are fine.
+ */
+static volatile int g_membarrier_state = 0;
+
+/*
+ * membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE) makes every
+ * other running thread of this process execute a core serializing
+ * instruction before it returns, which is what we need from the
+ * mprotect() trick below, without changing page tables or shooting
+ * down TLBs.  Linux has it on x86 since 4.16.
+ */
+static Bool SerializeWithMembarrier(void) {
+  if (0 == g_membarrier_state) {
+    long cmds = syscall(__NR_membarrier, NACL_MEMBARRIER_CMD_QUERY, 0);
+    if (cmds >= 0 &&
+        0 != (cmds & NACL_MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE) &&
+        0 == syscall(__NR_membarrier,
+                     NACL_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED_SYNC_CORE,
+                     0)) {
+      NaClLog(1, "NaClSerializeAllProcessors: using membarrier\n");
+      g_membarrier_state = 1;
+    } else {
+      NaClLog(1, "NaClSerializeAllProcessors: membarrier not available\n");
+      g_membarrier_state = -1;
+    }
+  }
+  if (g_membarrier_state < 0) {
+    return FALSE;
+  }
+  return 0 == syscall(__NR_membarrier,
+                      NACL_MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE, 0);
+}
+#endif
+
+int NaClSerializeAllProcessors(void) {
+  int size = NACL_MAP_PAGESIZE;
+
+#if NACL_LINUX == 1 && defined(__NR_membarrier)
+  if (SerializeWithMembarrier()) {
+    return TRUE;
+  }
+#endif
+
   /*
-   * We rely on the OS mprotect() call to issue interprocessor interrupts,
-   * which will cause other processors to execute an IRET, which is
-   * serializing.
+   * Otherwise we rely on the OS mprotect() call to issue interprocessor
+   * interrupts, which will cause other processors to execute an IRET,
+   * which is serializing.
    *
    * This code is based on two main considerations:
    * 1. Only switching the page from exec to non-exec state is guaranteed
@@ -119,25 +174,23 @@ static Bool SerializeAllProcessors(void) {
    * 2. It's bad to have a page that is both writeable and executable,
    * even if that happens not simultaneously.
    */
-
-  int size = NACL_MAP_PAGESIZE;
   if (NULL == g_squashybuffer) {
     if ((0 != NaClPageAlloc(&g_squashybuffer, size)) ||
         (0 != NaClMprotect(g_squashybuffer, size, PROT_READ|PROT_WRITE))) {
       NaClLog(0,
-              ("SerializeAllProcessors: initial squashybuffer allocation"
+              ("NaClSerializeAllProcessors: initial squashybuffer allocation"
                " failed\n"));
       return FALSE;
     }
 
     NaClFillMemoryRegionWithHalt(g_squashybuffer, size);
     g_firstbyte = *(char *) g_squashybuffer;
-    NaClLog(0, "SerializeAllProcessors: g_firstbyte is %d\n", g_firstbyte);
+    NaClLog(0, "NaClSerializeAllProcessors: g_firstbyte is %d\n", g_firstbyte);
   }
 
   if ((0 != NaClMprotect(g_squashybuffer, size, PROT_READ|PROT_EXEC))) {
     NaClLog(0,
-            ("SerializeAllProcessors: interprocessor interrupt"
+            ("NaClSerializeAllProcessors: interprocessor interrupt"
              " generation failed: could not reverse shield polarity (1)\n"));
     return FALSE;
   }
@@ -147,10 +200,10 @@ static Bool SerializeAllProcessors(void) {
    */
   if (*(char *) g_squashybuffer != g_firstbyte) {
     NaClLog(0,
-            ("SerializeAllProcessors: interprocessor interrupt"
+            ("NaClSerializeAllProcessors: interprocessor interrupt"
              " generation failed: could not reverse shield polarity (2)\n"));
-    NaClLog(0, "SerializeAllProcessors: g_firstbyte is %d\n", g_firstbyte);
-    NaClLog(0, "SerializeAllProcessors: *g_squashybuffer is %d\n",
+    NaClLog(0, "NaClSerializeAllProcessors: g_firstbyte is %d\n", g_firstbyte);
+    NaClLog(0, "NaClSerializeAllProcessors: *g_squashybuffer is %d\n",
             *(char *) g_squashybuffer);
     return FALSE;
   }
@@ -161,16 +214,21 @@ static Bool SerializeAllProcessors(void) {
    */
   if (0 != NaClMprotect(g_squashybuffer, size, PROT_READ)) {
     NaClLog(0,
-            ("SerializeAllProcessors: interprocessor interrupt"
+            ("NaClSerializeAllProcessors: interprocessor interrupt"
              " generation failed: could not reverse shield polarity (3)\n"));
     return FALSE;
   }
   return TRUE;
 }
 
-int NaClCopyInstruction(uint8_t *dst, uint8_t *src, uint8_t sz) {
+/*
+ * Makes the change from dst to src with a single store if that is
+ * safe.  Returns 1 if dst now matches src, and 0 if the instruction
+ * needs the slow path.
+ */
+static int CopyInstructionWithOneStore(uint8_t *dst, uint8_t *src,
+                                       uint8_t sz) {
   intptr_t offset = 0;
-  uint8_t *firstbyte_p = dst;
 
   while (sz > 0 && dst[0] == src[0]) {
     /* scroll to first changed byte */
@@ -201,24 +259,51 @@ int NaClCopyInstruction(uint8_t *dst, uint8_t *src, uint8_t sz) {
     memcpy(tmp+offset, src, sz);
     onestore_memmove8(dst-offset, tmp);
   } else {
-    /* the slow path, first flip first byte to halt*/
-    uint8_t firstbyte = firstbyte_p[0];
-    firstbyte_p[0] = kNaClFullStop;
+    return 0;
+  }
+  return 1;
+}
 
-    if (!SerializeAllProcessors()) return 0;
+int NaClCopyInstruction(uint8_t *dst, uint8_t *src, uint8_t sz) {
+  if (CopyInstructionWithOneStore(dst, src, sz)) {
+    return 1;
+  }
 
-    /* copy the rest of instruction */
-    if (dst == firstbyte_p) {
-      /* but not the first byte! */
-      firstbyte = *src;
-      dst++, src++, sz--;
-    }
-    memcpy(dst, src, sz);
+  /* the slow path, first flip first byte to halt */
+  dst[0] = kNaClFullStop;
+  if (!NaClSerializeAllProcessors()) return 0;
+
+  /* copy the rest of instruction, but not the first byte! */
+  memcpy(dst + 1, src + 1, sz - 1);
+  if (!NaClSerializeAllProcessors()) return 0;
+
+  /* flip first byte back */
+  dst[0] = src[0];
+  return 1;
+}
 
-    if (!SerializeAllProcessors()) return 0;
+int NaClCopyInstructionBatchHalt(uint8_t *dst, uint8_t *src, uint8_t sz) {
+  if (!CopyInstructionWithOneStore(dst, src, sz)) {
+    dst[0] = kNaClFullStop;
+  }
+  return 1;
+}
 
-    /* flip first byte back */
-    firstbyte_p[0] = firstbyte;
+int NaClCopyInstructionBatchBody(uint8_t *dst, uint8_t *src, uint8_t sz) {
+  if (0 == memcmp(dst, src, sz)) {
+    return 1;
   }
+  if (kNaClFullStop != dst[0]) {
+    /* NaClCopyInstructionBatchHalt() did not see this instruction. */
+    return 0;
+  }
+  memcpy(dst + 1, src + 1, sz - 1);
+  return 1;
+}
+
+int NaClCopyInstructionBatchFirstByte(uint8_t *dst, uint8_t *src,
+                                      uint8_t sz) {
+  UNREFERENCED_PARAMETER(sz);
+  dst[0] = src[0];
   return 1;
 }
@@ -272,6 +272,68 @@ struct nacl_irt_thread_v0_2 {
   int (*thread_nice)(const int nice);
 };
 
+struct nacl_irt_sched_info {
+  /* Virtual CPUs are numbered 0 .. cpu_count - 1. */
+  uint32_t cpu_count;
+  /* The range of priority bands.  Band 0 is the normal priority. */
+  int32_t min_priority;
+  int32_t max_priority;
+  /*
+   * Deadline utilization (runtime / period) that all threads together
+   * may reserve, and how much of it is not yet reserved, in units of
+   * NACL_IRT_SCHED_UTIL_SCALE per CPU.
+   */
+  uint32_t deadline_capacity;
+  uint32_t deadline_available;
+};
+
+/* Times are in nanoseconds, with runtime <= deadline <= period. */
+struct nacl_irt_sched_deadline {
+  uint64_t runtime;
+  uint64_t deadline;
+  uint64_t period;
+};
+
+#define NACL_IRT_SCHED_MAX_CPUS    64
+#define NACL_IRT_SCHED_UTIL_SCALE  1000000
+
+/*
+ * The irt_sched interface lets a thread ask for the CPUs it runs on, a
+ * priority band and a deadline reservation.  Each function applies to
+ * the calling thread, within limits that the embedder sets, and returns
+ * an errno value on failure.  New threads start with no reservation and
+ * the host's default affinity.  They also start at the normal priority,
+ * unless their creator lowered its own and the host does not let the
+ * sandbox raise priority again, in which case they keep the lower one.
+ */
+#define NACL_IRT_SCHED_v0_1    "nacl-irt-sched-0.1"
+struct nacl_irt_sched {
+  int (*sched_get_info)(struct nacl_irt_sched_info *info);
+  /*
+   * sched_set_affinity() restricts the thread to the virtual CPUs set
+   * in |cpu_mask|.  It returns EINVAL if the mask is empty or names a
+   * CPU numbered cpu_count or above.
+   */
+  int (*sched_set_affinity)(uint64_t cpu_mask);
+  int (*sched_get_affinity)(uint64_t *cpu_mask);
+  /*
+   * sched_set_priority() returns EPERM if |priority| is above
+   * max_priority, or if the host does not let the sandbox raise its
+   * priority that far.
+   */
+  int (*sched_set_priority)(int priority);
+  /*
+   * sched_set_deadline() gives the thread a deadline reservation of
+   * |params->runtime| nanoseconds of CPU time in each period, to be
+   * used within |params->deadline| of the start of the period; NULL
+   * returns the thread to normal scheduling.  It returns EBUSY if the
+   * reservation does not fit in deadline_available (plus the thread's
+   * current reservation), and EPERM if deadline scheduling is not
+   * allowed.
+   */
+  int (*sched_set_deadline)(const struct nacl_irt_sched_deadline *params);
+};
+
 /*
  * The irt_futex interface is based on Linux's futex() system call.
  *
@@ -307,6 +369,40 @@ struct nacl_irt_futex {
   int (*futex_wake)(volatile int *addr, int nwake, int *count);
 };
 
+/* One futex word for futex_waitv_abs(), with the value it should hold. */
+struct nacl_irt_futex_waitv {
+  volatile int *addr;
+  int value;
+};
+
+#define NACL_IRT_FUTEX_WAITV_MAX   128
+
+#define NACL_IRT_FUTEX_v0_2        "nacl-irt-futex-0.2"
+struct nacl_irt_futex_v0_2 {
+  int (*futex_wait_abs)(volatile int *addr, int value,
+                        const struct timespec *abstime);
+  int (*futex_wake)(volatile int *addr, int nwake, int *count);
+  /*
+   * futex_waitv_abs() waits on |count| futex words at once.  If any
+   * |waiters[i].addr| does not contain |waiters[i].value|, it
+   * immediately returns EAGAIN.  Otherwise it waits until a
+   * futex_wake() on any of the addresses wakes it, and then returns 0
+   * and stores the index of that address in |*woken_index|.  Each call
+   * is woken at most once, so a futex_wake() that wakes it counts one
+   * thread however many of its addresses match.  As with
+   * futex_wait_abs(), |abstime| is an absolute time, and ETIMEDOUT is
+   * returned once it passes.
+   *
+   * |count| must be between 1 and NACL_IRT_FUTEX_WAITV_MAX, otherwise
+   * this returns EINVAL.  It returns ENOSYS if the host cannot wait on
+   * several addresses, in which case the caller must fall back to
+   * waiting some other way.
+   */
+  int (*futex_waitv_abs)(const struct nacl_irt_futex_waitv *waiters,
+                         size_t count, const struct timespec *abstime,
+                         int *woken_index);
+};
+
 /*
  * "irt-mutex" is deprecated and is disabled under PNaCl (see
  * https://code.google.com/p/nativeclient/issues/detail?id=3484).
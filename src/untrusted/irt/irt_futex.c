@@ -4,6 +4,8 @@
  * found in the LICENSE file.
  */
 
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/trusted/service_runtime/include/sys/nacl_futex_waitv.h"
 #include "native_client/src/untrusted/irt/irt.h"
 #include "native_client/src/untrusted/nacl/syscall_bindings_trampoline.h"
 
@@ -24,11 +26,36 @@ static int nacl_irt_futex_wake(volatile int *addr, int nwake, int *count) {
   return 0;
 }
 
+static int nacl_irt_futex_waitv(const struct nacl_irt_futex_waitv *waiters,
+                                size_t count, const struct timespec *abstime,
+                                int *woken_index) {
+  int result;
+
+  /* The syscall takes the same layout, with 32-bit addresses. */
+  NACL_ASSERT_SAME_SIZE(struct nacl_irt_futex_waitv, struct NaClAbiFutexWaitv);
+  NACL_COMPILE_TIME_ASSERT(NACL_IRT_FUTEX_WAITV_MAX ==
+                           NACL_ABI_FUTEX_WAITV_MAX);
+
+  result = NACL_GC_WRAP_SYSCALL(NACL_SYSCALL(futex_waitv_abs)(
+      (const struct NaClAbiFutexWaitv *) waiters, count, abstime));
+  if (result < 0) {
+    return -result;
+  }
+  *woken_index = result;
+  return 0;
+}
+
 const struct nacl_irt_futex nacl_irt_futex = {
   nacl_irt_futex_wait,
   nacl_irt_futex_wake,
 };
 
+const struct nacl_irt_futex_v0_2 nacl_irt_futex_v0_2 = {
+  nacl_irt_futex_wait,
+  nacl_irt_futex_wake,
+  nacl_irt_futex_waitv,
+};
+
 /*
  * This name is used inside the IRT itself and in libpthread_private,
  * by the private copies of nc_mutex and nc_cond.
@@ -85,7 +85,10 @@ static const struct nacl_irt_interface irt_interfaces[] = {
   { NACL_IRT_DYNCODE_v0_1, &nacl_irt_dyncode, sizeof(nacl_irt_dyncode),
     non_pnacl_filter },
   { NACL_IRT_THREAD_v0_1, &nacl_irt_thread, sizeof(nacl_irt_thread), NULL },
+  { NACL_IRT_SCHED_v0_1, &nacl_irt_sched, sizeof(nacl_irt_sched), NULL },
   { NACL_IRT_FUTEX_v0_1, &nacl_irt_futex, sizeof(nacl_irt_futex), NULL },
+  { NACL_IRT_FUTEX_v0_2, &nacl_irt_futex_v0_2, sizeof(nacl_irt_futex_v0_2),
+    NULL },
   /*
    * "irt-mutex", "irt-cond" and "irt-sem" are deprecated and
    * superseded by the "irt-futex" interface, and so are disabled
@@ -8,19 +8,75 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
+#include "native_client/src/public/imc_types.h"
+#include "native_client/src/public/pnacl_compile_server.h"
 #include "native_client/src/shared/platform/nacl_log.h"
 #include "native_client/src/untrusted/irt/irt_dev.h"
 #include "native_client/src/untrusted/irt/irt_interfaces.h"
 #include "native_client/src/untrusted/irt/irt_pnacl_translator_common.h"
+#include "native_client/src/untrusted/nacl/syscall_bindings_trampoline.h"
 
 static const char kInputVar[] = "NACL_IRT_PNACL_TRANSLATOR_COMPILE_INPUT";
 static const char kOutputVar[] = "NACL_IRT_PNACL_TRANSLATOR_COMPILE_OUTPUT";
 static const char kArgVar[] = "NACL_IRT_PNACL_TRANSLATOR_COMPILE_ARG";
 static const char kThreadsVar[] = "NACL_IRT_PNACL_TRANSLATOR_COMPILE_THREADS";
 
-static void serve_translate_request(
+/*
+ * Bitcode is handed to data_callback in pieces of this size, whether
+ * it comes from a mapping of the input file or from read().
+ */
+#define DATA_CHUNK_SIZE (1 << 20)
+
+/*
+ * Feeds the whole of input_fd to data_callback.  The input is mapped
+ * if possible, which saves copying it through a buffer; otherwise it
+ * is read in DATA_CHUNK_SIZE pieces.  Returns 0 on success, -1 if the
+ * input could not be read (errno is set) and 1 if data_callback failed.
+ */
+static int stream_input(const struct nacl_irt_pnacl_compile_funcs *funcs,
+                        int input_fd) {
+  struct stat st;
+  if (fstat(input_fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    size_t size = st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, input_fd, 0);
+    if (map != MAP_FAILED) {
+      int result = 0;
+      size_t offset;
+      for (offset = 0; offset < size && result == 0;
+           offset += DATA_CHUNK_SIZE) {
+        size_t chunk = size - offset;
+        if (chunk > DATA_CHUNK_SIZE)
+          chunk = DATA_CHUNK_SIZE;
+        if (funcs->data_callback((const char *) map + offset, chunk) != 0)
+          result = 1;
+      }
+      munmap(map, size);
+      return result;
+    }
+  }
+
+  static char *buf;
+  if (buf == NULL) {
+    buf = malloc(DATA_CHUNK_SIZE);
+    if (buf == NULL)
+      return -1;
+  }
+  for (;;) {
+    ssize_t bytes_read = read(input_fd, buf, DATA_CHUNK_SIZE);
+    if (bytes_read < 0)
+      return -1;
+    if (bytes_read == 0)
+      return 0;
+    if (funcs->data_callback(buf, bytes_read) != 0)
+      return 1;
+  }
+}
+
+static void serve_env_request(
     const struct nacl_irt_pnacl_compile_funcs *funcs) {
   const char *input_filename = getenv(kInputVar);
   const char *threads_str = getenv(kThreadsVar);
@@ -79,18 +135,11 @@ static void serve_translate_request(
   int thread_count = atoi(threads_str);
   funcs->init_callback(thread_count, output_fds, outputs_count,
                        args, args_count);
-  char buf[0x1000];
-  for (;;) {
-    ssize_t bytes_read = read(input_fd, buf, sizeof(buf));
-    if (bytes_read < 0) {
-      NaClLog(LOG_FATAL,
-              "serve_translate_request: "
-              "Error while reading input file \"%s\": %s\n",
-              input_filename, strerror(errno));
-    }
-    if (bytes_read == 0)
-      break;
-    funcs->data_callback(buf, bytes_read);
+  if (stream_input(funcs, input_fd) < 0) {
+    NaClLog(LOG_FATAL,
+            "serve_translate_request: "
+            "Error while reading input file \"%s\": %s\n",
+            input_filename, strerror(errno));
   }
   int rc = close(input_fd);
   if (rc != 0) {
@@ -100,6 +149,172 @@ static void serve_translate_request(
   funcs->end_callback();
 }
 
+static void send_reply(int channel, int32_t status, const char *message) {
+  char buf[NACL_PNACL_COMPILE_REPLY_BYTES_MAX];
+  struct NaClPnaclCompileReply *reply = (struct NaClPnaclCompileReply *) buf;
+  size_t message_max = sizeof(buf) - sizeof(*reply) - 1;
+  size_t message_len = message == NULL ? 0 : strlen(message);
+  if (message_len > message_max)
+    message_len = message_max;
+
+  reply->magic = NACL_PNACL_COMPILE_REPLY_MAGIC;
+  reply->status = status;
+  if (message_len > 0)
+    memcpy(buf + sizeof(*reply), message, message_len);
+  buf[sizeof(*reply) + message_len] = '\0';
+
+  struct NaClAbiNaClImcMsgIoVec iov;
+  struct NaClAbiNaClImcMsgHdr hdr;
+  iov.base = buf;
+  iov.length = sizeof(*reply) + message_len + 1;
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.iov = &iov;
+  hdr.iov_length = 1;
+  int rc = NACL_SYSCALL(imc_sendmsg)(channel, &hdr, 0);
+  if (rc < 0) {
+    NaClLog(LOG_ERROR, "serve_translate_request: imc_sendmsg failed: %s\n",
+            strerror(-rc));
+  }
+}
+
+/*
+ * Runs one translation described by a request message.  desc_count
+ * descriptors were received with it, all of which are closed here.
+ * Returns the status for the reply; *error is set to a message from
+ * the translator or the IRT, which the caller frees.
+ */
+static int32_t handle_request(
+    const struct nacl_irt_pnacl_compile_funcs *funcs,
+    char *msg, size_t msg_len, int *descs, size_t desc_count,
+    char **error) {
+  const struct NaClPnaclCompileRequest *request =
+      (const struct NaClPnaclCompileRequest *) msg;
+  int32_t status = NACL_PNACL_COMPILE_BAD_REQUEST;
+  char **args = NULL;
+  size_t i;
+
+  *error = NULL;
+  if (msg_len < sizeof(*request) ||
+      request->magic != NACL_PNACL_COMPILE_REQUEST_MAGIC ||
+      desc_count < 2 || desc_count > 1 + NACL_PNACL_COMPILE_OUTPUTS_MAX ||
+      request->arg_count > msg_len) {
+    *error = strdup("malformed compile request");
+    goto done;
+  }
+
+  /* The flags follow the header, each null-terminated. */
+  args = malloc((request->arg_count + 1) * sizeof(*args));
+  if (args == NULL) {
+    *error = strdup("out of memory");
+    goto done;
+  }
+  char *p = msg + sizeof(*request);
+  char *end = msg + msg_len;
+  for (i = 0; i < request->arg_count; ++i) {
+    char *nul = memchr(p, '\0', end - p);
+    if (nul == NULL) {
+      *error = strdup("malformed compile request flags");
+      goto done;
+    }
+    args[i] = p;
+    p = nul + 1;
+  }
+  args[i] = NULL;
+
+  *error = funcs->init_callback(request->thread_count, descs + 1,
+                                desc_count - 1, args, request->arg_count);
+  if (*error != NULL) {
+    status = NACL_PNACL_COMPILE_INIT_FAILED;
+    goto done;
+  }
+  int stream_result = stream_input(funcs, descs[0]);
+  if (stream_result < 0) {
+    /* end_callback() and free() may change errno. */
+    int input_errno = errno;
+    status = NACL_PNACL_COMPILE_INPUT_ERROR;
+    free(funcs->end_callback());
+    *error = strdup(strerror(input_errno));
+    goto done;
+  }
+  /* end_callback gives the reason for a data_callback failure too. */
+  *error = funcs->end_callback();
+  if (stream_result > 0)
+    status = NACL_PNACL_COMPILE_DATA_FAILED;
+  else if (*error != NULL)
+    status = NACL_PNACL_COMPILE_END_FAILED;
+  else
+    status = NACL_PNACL_COMPILE_OK;
+
+ done:
+  free(args);
+  for (i = 0; i < desc_count; ++i)
+    close(descs[i]);
+  return status;
+}
+
+/*
+ * Handles compile requests on channel until the client hangs up; see
+ * pnacl_compile_server.h for the protocol.  This saves the sandbox
+ * startup, translator load and validation costs for all but the first
+ * translation.
+ */
+static void serve_channel_requests(
+    const struct nacl_irt_pnacl_compile_funcs *funcs, int channel) {
+  char *msg = malloc(NACL_PNACL_COMPILE_REQUEST_BYTES_MAX);
+  if (msg == NULL)
+    NaClLog(LOG_FATAL, "serve_translate_request: out of memory\n");
+
+  for (;;) {
+    int descs[NACL_ABI_IMC_DESC_MAX];
+    struct NaClAbiNaClImcMsgIoVec iov;
+    struct NaClAbiNaClImcMsgHdr hdr;
+    iov.base = msg;
+    iov.length = NACL_PNACL_COMPILE_REQUEST_BYTES_MAX;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.iov = &iov;
+    hdr.iov_length = 1;
+    hdr.descv = descs;
+    hdr.desc_length = NACL_ABI_IMC_DESC_MAX;
+    int rc = NACL_SYSCALL(imc_recvmsg)(channel, &hdr, 0);
+    if (rc <= 0) {
+      /* The client closed the channel, or it is broken. */
+      if (rc < 0) {
+        NaClLog(LOG_ERROR,
+                "serve_translate_request: imc_recvmsg failed: %s\n",
+                strerror(-rc));
+      }
+      break;
+    }
+
+    if ((hdr.flags & (NACL_ABI_RECVMSG_DATA_TRUNCATED |
+                      NACL_ABI_RECVMSG_DESC_TRUNCATED)) != 0) {
+      size_t i;
+      for (i = 0; i < hdr.desc_length; ++i)
+        close(descs[i]);
+      send_reply(channel, NACL_PNACL_COMPILE_BAD_REQUEST,
+                 "compile request truncated");
+      continue;
+    }
+
+    char *error;
+    int32_t status = handle_request(funcs, msg, rc, descs, hdr.desc_length,
+                                    &error);
+    send_reply(channel, status, error);
+    free(error);
+  }
+  free(msg);
+  close(channel);
+}
+
+static void serve_translate_request(
+    const struct nacl_irt_pnacl_compile_funcs *funcs) {
+  const char *channel_str = getenv(NACL_PNACL_COMPILE_SERVER_FD_VAR);
+  if (channel_str != NULL)
+    serve_channel_requests(funcs, atoi(channel_str));
+  else
+    serve_env_request(funcs);
+}
+
 const struct nacl_irt_private_pnacl_translator_compile
     nacl_irt_private_pnacl_translator_compile = {
   serve_translate_request
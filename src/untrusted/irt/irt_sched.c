@@ -0,0 +1,53 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/trusted/service_runtime/include/sys/nacl_sched.h"
+#include "native_client/src/untrusted/irt/irt.h"
+#include "native_client/src/untrusted/nacl/syscall_bindings_trampoline.h"
+
+static int nacl_irt_sched_get_info(struct nacl_irt_sched_info *info) {
+  /* The syscall takes the same layouts and limits. */
+  NACL_ASSERT_SAME_SIZE(struct nacl_irt_sched_info, struct NaClAbiSchedInfo);
+  NACL_ASSERT_SAME_SIZE(struct nacl_irt_sched_deadline,
+                        struct NaClAbiSchedDeadline);
+  NACL_COMPILE_TIME_ASSERT(NACL_IRT_SCHED_MAX_CPUS ==
+                           NACL_ABI_SCHED_MAX_CPUS);
+  NACL_COMPILE_TIME_ASSERT(NACL_IRT_SCHED_UTIL_SCALE ==
+                           NACL_ABI_SCHED_UTIL_SCALE);
+
+  return -NACL_SYSCALL(thread_sched)(NACL_ABI_SCHED_GET_INFO,
+                                     (uintptr_t) info);
+}
+
+static int nacl_irt_sched_set_affinity(uint64_t cpu_mask) {
+  return -NACL_SYSCALL(thread_sched)(NACL_ABI_SCHED_SET_AFFINITY,
+                                     (uintptr_t) &cpu_mask);
+}
+
+static int nacl_irt_sched_get_affinity(uint64_t *cpu_mask) {
+  return -NACL_SYSCALL(thread_sched)(NACL_ABI_SCHED_GET_AFFINITY,
+                                     (uintptr_t) cpu_mask);
+}
+
+static int nacl_irt_sched_set_priority(int priority) {
+  return -NACL_SYSCALL(thread_sched)(NACL_ABI_SCHED_SET_PRIORITY,
+                                     (uintptr_t) priority);
+}
+
+static int nacl_irt_sched_set_deadline(
+    const struct nacl_irt_sched_deadline *params) {
+  return -NACL_SYSCALL(thread_sched)(NACL_ABI_SCHED_SET_DEADLINE,
+                                     (uintptr_t) params);
+}
+
+const struct nacl_irt_sched nacl_irt_sched = {
+  nacl_irt_sched_get_info,
+  nacl_irt_sched_set_affinity,
+  nacl_irt_sched_get_affinity,
+  nacl_irt_sched_set_priority,
+  nacl_irt_sched_set_deadline,
+};
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "native_client/src/untrusted/nacl/nacl_checkpoint.h"
+
+#include <errno.h>
+#include <setjmp.h>
+
+#include "native_client/src/untrusted/nacl/syscall_bindings_trampoline.h"
+
+/*
+ * The restored program starts in checkpoint_resume() on this stack,
+ * with the TLS of the thread that called nacl_checkpoint(), and
+ * jumps back into that call.
+ */
+static jmp_buf checkpoint_env;
+static char checkpoint_resume_stack[4096] __attribute__((aligned(32)));
+
+static void checkpoint_resume(void) {
+  longjmp(checkpoint_env, 1);
+}
+
+int nacl_checkpoint(void) {
+  int error;
+
+  if (setjmp(checkpoint_env) != 0) {
+    return 1;
+  }
+  error = NACL_SYSCALL(checkpoint)(
+      checkpoint_resume,
+      checkpoint_resume_stack + sizeof(checkpoint_resume_stack));
+  if (error < 0) {
+    errno = -error;
+    return -1;
+  }
+  return 0;
+}
@@ -15,6 +15,11 @@
  *
  * We of course do not lack <time.h>, but this prevents malloc from calling
  * time() in its initialization, which is a dependency we want to avoid.
+ *
+ * dlmalloc provides the central heap(s) behind the thread cache below,
+ * so its entry points get the "dl" prefix.  FOOTERS lets dlfree() and
+ * dlrealloc() find the arena a chunk came from.  There is no mremap()
+ * in NaCl, so HAVE_MREMAP stays off.
  */
 #define LACKS_TIME_H            1
 #define USE_LOCKS               1
@@ -22,10 +27,279 @@
 #define HAVE_MORECORE           0  /* Don't try to use sbrk() */
 #define HAVE_MMAP               1
 #define HAVE_MREMAP             0
+#define USE_DL_PREFIX           1
+#define MSPACES                 1
+#define FOOTERS                 1
 
 /* @IGNORE_LINES_FOR_CODE_HYGIENE[1] */
 #include "native_client/src/third_party/dlmalloc/malloc.c"
 
+/*
+ * Thread cache.
+ *
+ * Each thread keeps a free list per size class for small chunks, so
+ * that most malloc() and free() calls take no lock at all.  An empty
+ * list is refilled with a batch of chunks from one
+ * independent_comalloc() call, and a list which grows too long gives a
+ * batch back with one bulk_free() call, so the central heap lock is
+ * taken once per batch rather than once per call.
+ *
+ * The chunks on the lists are ordinary allocated dlmalloc chunks, so
+ * realloc(), malloc_usable_size() etc. need no special cases.
+ *
+ * The central heap is dlmalloc's global heap.  If the NACL_MALLOC_ARENAS
+ * environment variable asks for more than one arena, threads are
+ * spread round-robin over that many heaps, each with its own lock.
+ */
+
+#define TCACHE_CLASS_SHIFT  4
+#define TCACHE_CLASSES      16   /* Sizes up to 256 bytes.  */
+#define TCACHE_BATCH        16
+#define TCACHE_MAX_COUNT    64
+#define MAX_ARENAS          8
+
+struct tcache_bin {
+  void *head;
+  unsigned count;
+};
+
+struct tcache {
+  struct tcache_bin bins[TCACHE_CLASSES];
+  mspace arena;       /* NULL means the global heap.  */
+  int arena_chosen;
+  int disabled;       /* Set once the thread has started to exit.  */
+};
+
+static __thread struct tcache g_tcache;
+
+/* Set once the main thread's TLS is usable.  */
+static int g_tcache_enabled;
+static int g_arena_count = 1;
+static mspace g_arenas[MAX_ARENAS];
+static unsigned g_next_arena;
+
+static void *arena_malloc(mspace arena, size_t bytes) {
+  return arena == NULL ? dlmalloc(bytes) : mspace_malloc(arena, bytes);
+}
+
+static void **arena_comalloc(mspace arena, size_t n, size_t *sizes,
+                             void **chunks) {
+  if (arena == NULL)
+    return dlindependent_comalloc(n, sizes, chunks);
+  return mspace_independent_comalloc(arena, n, sizes, chunks);
+}
+
+static size_t arena_bulk_free(mspace arena, void **array, size_t n) {
+  if (arena == NULL)
+    return dlbulk_free(array, n);
+  return mspace_bulk_free(arena, array, n);
+}
+
+static mspace tcache_arena(struct tcache *tc) {
+  if (!tc->arena_chosen) {
+    unsigned index = __sync_fetch_and_add(&g_next_arena, 1) % g_arena_count;
+    if (index != 0 && g_arenas[index] == NULL) {
+      mspace arena = create_mspace(0, 1);
+      if (arena != NULL &&
+          !__sync_bool_compare_and_swap(&g_arenas[index], NULL, arena))
+        destroy_mspace(arena);
+    }
+    /* If create_mspace() failed we just use the global heap.  */
+    tc->arena = g_arenas[index];
+    tc->arena_chosen = 1;
+  }
+  return tc->arena;
+}
+
+static struct tcache *tcache_get(void) {
+  if (!g_tcache_enabled || g_tcache.disabled)
+    return NULL;
+  return &g_tcache;
+}
+
+/*
+ * Gives the first count chunks of the bin back to the central heap.
+ * Chunks which another thread allocated from another arena are left
+ * by bulk_free() and freed one by one.
+ */
+static void tcache_release(struct tcache *tc, struct tcache_bin *bin,
+                           unsigned count) {
+  void *batch[TCACHE_MAX_COUNT];
+  unsigned n = 0;
+  unsigned i;
+
+  while (n < count && bin->head != NULL) {
+    batch[n] = bin->head;
+    bin->head = *(void **) bin->head;
+    ++n;
+  }
+  bin->count -= n;
+  if (arena_bulk_free(tcache_arena(tc), batch, n) != 0) {
+    for (i = 0; i < n; ++i) {
+      if (batch[i] != NULL)
+        dlfree(batch[i]);
+    }
+  }
+}
+
+static void *tcache_malloc(struct tcache *tc, size_t bytes) {
+  size_t class_index = (bytes + (1 << TCACHE_CLASS_SHIFT) - 1)
+      >> TCACHE_CLASS_SHIFT;
+  struct tcache_bin *bin;
+  void *mem;
+
+  if (class_index == 0)
+    class_index = 1;
+  bin = &tc->bins[class_index - 1];
+  if (bin->head == NULL) {
+    size_t sizes[TCACHE_BATCH];
+    void *chunks[TCACHE_BATCH];
+    unsigned i;
+
+    for (i = 0; i < TCACHE_BATCH; ++i)
+      sizes[i] = class_index << TCACHE_CLASS_SHIFT;
+    if (arena_comalloc(tcache_arena(tc), TCACHE_BATCH, sizes, chunks) == NULL)
+      return arena_malloc(tcache_arena(tc), bytes);
+    for (i = 0; i < TCACHE_BATCH; ++i) {
+      *(void **) chunks[i] = bin->head;
+      bin->head = chunks[i];
+    }
+    bin->count = TCACHE_BATCH;
+  }
+  mem = bin->head;
+  bin->head = *(void **) mem;
+  --bin->count;
+  return mem;
+}
+
+/*
+ * A chunk goes to the bin whose requests it can satisfy: every chunk
+ * in bin i has at least (i + 1) << TCACHE_CLASS_SHIFT usable bytes.
+ */
+static int tcache_free(struct tcache *tc, void *mem) {
+  size_t class_index = dlmalloc_usable_size(mem) >> TCACHE_CLASS_SHIFT;
+  struct tcache_bin *bin;
+
+  if (class_index == 0 || class_index > TCACHE_CLASSES)
+    return 0;
+  bin = &tc->bins[class_index - 1];
+  *(void **) mem = bin->head;
+  bin->head = mem;
+  if (++bin->count > TCACHE_MAX_COUNT)
+    tcache_release(tc, bin, TCACHE_MAX_COUNT / 2);
+  return 1;
+}
+
+/*
+ * Called by __pthread_initialize_minimal() once the main thread's TLS
+ * is set up: malloc() is used to allocate that TLS area, so the cache
+ * cannot be used before.
+ */
+void __nacl_malloc_thread_init(void) {
+  const char *arenas = getenv("NACL_MALLOC_ARENAS");
+
+  if (arenas != NULL) {
+    g_arena_count = atoi(arenas);
+    if (g_arena_count < 1)
+      g_arena_count = 1;
+    if (g_arena_count > MAX_ARENAS)
+      g_arena_count = MAX_ARENAS;
+  }
+  g_tcache_enabled = 1;
+}
+
+/*
+ * Called by pthread_exit().  Returns the thread's cached chunks and
+ * stops caching for the thread, since its TLS is about to be freed.
+ */
+void __nacl_malloc_thread_exit(void) {
+  unsigned i;
+
+  if (!g_tcache_enabled)
+    return;
+  for (i = 0; i < TCACHE_CLASSES; ++i) {
+    while (g_tcache.bins[i].count != 0)
+      tcache_release(&g_tcache, &g_tcache.bins[i], TCACHE_MAX_COUNT);
+  }
+  g_tcache.disabled = 1;
+}
+
+void *malloc(size_t bytes) {
+  struct tcache *tc = tcache_get();
+
+  if (tc == NULL)
+    return dlmalloc(bytes);
+  if (bytes <= (TCACHE_CLASSES << TCACHE_CLASS_SHIFT))
+    return tcache_malloc(tc, bytes);
+  return arena_malloc(tcache_arena(tc), bytes);
+}
+
+void free(void *mem) {
+  struct tcache *tc;
+
+  if (mem == NULL)
+    return;
+  tc = tcache_get();
+  if (tc == NULL || !tcache_free(tc, mem))
+    dlfree(mem);
+}
+
+void *calloc(size_t n_elements, size_t elem_size) {
+  struct tcache *tc = tcache_get();
+  size_t bytes = n_elements * elem_size;
+  void *mem;
+
+  if (tc == NULL || bytes > (TCACHE_CLASSES << TCACHE_CLASS_SHIFT) ||
+      (elem_size != 0 && bytes / elem_size != n_elements))
+    return dlcalloc(n_elements, elem_size);
+  mem = tcache_malloc(tc, bytes);
+  if (mem != NULL)
+    memset(mem, 0, bytes);
+  return mem;
+}
+
+void *realloc(void *mem, size_t bytes) {
+  if (mem == NULL)
+    return malloc(bytes);
+  return dlrealloc(mem, bytes);
+}
+
+void *memalign(size_t alignment, size_t bytes) {
+  return dlmemalign(alignment, bytes);
+}
+
+int posix_memalign(void **pp, size_t alignment, size_t bytes) {
+  return dlposix_memalign(pp, alignment, bytes);
+}
+
+void *valloc(size_t bytes) {
+  return dlvalloc(bytes);
+}
+
+void *pvalloc(size_t bytes) {
+  return dlpvalloc(bytes);
+}
+
+size_t malloc_usable_size(void *mem) {
+  return dlmalloc_usable_size(mem);
+}
+
+int malloc_trim(size_t pad) {
+  return dlmalloc_trim(pad);
+}
+
+int mallopt(int param_number, int value) {
+  return dlmallopt(param_number, value);
+}
+
+struct mallinfo mallinfo(void) {
+  return dlmallinfo();
+}
+
+void malloc_stats(void) {
+  dlmalloc_stats();
+}
+
 /*
  * Crufty newlib internals use these entry points rather than the standard ones.
  */
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef _NATIVE_CLIENT_SRC_UNTRUSTED_NACL_NACL_CHECKPOINT_H_
+#define _NATIVE_CLIENT_SRC_UNTRUSTED_NACL_NACL_CHECKPOINT_H_ 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  @nacl
+ *  Writes a snapshot of the program to the file given to sel_ldr with
+ *  -k, so that a later sel_ldr run with -K can resume from this call
+ *  rather than start the program again.  Memory, dynamic code, the
+ *  break and the exception handler are saved.  Descriptors are not:
+ *  the resumed program finds whatever the new sel_ldr was given at the
+ *  same numbers, and a descriptor the new sel_ldr cannot be given (a
+ *  mutex, shared memory, etc.) makes the checkpoint fail.
+ *  The calling thread must be the only thread.
+ *  @return Returns 0 after writing the snapshot, 1 when returning in
+ *  the resumed program, and -1 on failure.
+ *  Sets errno to ENOSYS if sel_ldr was not given a snapshot file.
+ *  Sets errno to EBUSY if other threads are running.
+ *  Sets errno to ENOTSUP if a descriptor or a shared mapping cannot be
+ *  saved.
+ */
+int nacl_checkpoint(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* _NATIVE_CLIENT_SRC_UNTRUSTED_NACL_NACL_CHECKPOINT_H_ */
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef _NATIVE_CLIENT_SRC_UNTRUSTED_NACL_NACL_WRITE_WATCH_H_
+#define _NATIVE_CLIENT_SRC_UNTRUSTED_NACL_NACL_WRITE_WATCH_H_ 1
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Write watch tracks which pages of a range have been written, so that
+ * a garbage collector can mark concurrently with the mutator and then
+ * rescan only the pages the mutator has dirtied.  Pages are 64KB, the
+ * granularity of mmap(), and ranges must be aligned to them.
+ */
+#define NACL_WRITE_WATCH_PAGESIZE 0x10000
+
+/**
+ *  @nacl
+ *  Starts tracking writes to a range of read-write mapped memory, with
+ *  all of its pages clean.
+ *  @param start Start of the range, 64KB aligned.
+ *  @param length Length of the range, a multiple of 64KB.
+ *  @return Returns zero on success, -1 on failure.
+ *  Sets errno to EINVAL if the range is not aligned.
+ *  Sets errno to EACCES if part of the range is not mapped read-write.
+ *  Sets errno to ENOSYS if the host does not support write watch.
+ */
+int nacl_write_watch_arm(void *start, size_t length);
+
+/**
+ *  @nacl
+ *  Stops tracking writes to a range.  Unmapping memory, mapping over
+ *  it or changing its protection also stops tracking writes to it.
+ *  @param start Start of the range, 64KB aligned.
+ *  @param length Length of the range, a multiple of 64KB.
+ *  @return Returns zero on success, -1 on failure.
+ */
+int nacl_write_watch_disarm(void *start, size_t length);
+
+/**
+ *  @nacl
+ *  Gets the pages of a range written since it was armed or last
+ *  fetched, in address order, and marks them clean again.
+ *  @param start Start of the range, 64KB aligned.
+ *  @param length Length of the range, a multiple of 64KB.
+ *  @param pages Destination to receive the start addresses of the pages.
+ *  @param count On entry, the number of pages there are space for.  On
+ *  return, the number of pages stored.  Dirty pages which did not fit
+ *  stay dirty.
+ *  @return Returns zero on success, -1 on failure.
+ *  Sets errno to EFAULT if output locations are bad.
+ */
+int nacl_write_watch_fetch(void *start, size_t length,
+                           void **pages, size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* _NATIVE_CLIENT_SRC_UNTRUSTED_NACL_NACL_WRITE_WATCH_H_ */
@@ -54,6 +54,12 @@ void __pthread_initialize_minimal(size_t tdb_size) {
    */
   nacl_tls_init(tp);
 
+  /*
+   * malloc() can only start using its thread cache now.
+   */
+  if (__nacl_malloc_thread_init != NULL)
+    __nacl_malloc_thread_init();
+
   /*
    * Initialize newlib's thread-specific pointer.
    */
@@ -23,6 +23,8 @@ extern "C" {
 #include "native_client/src/trusted/service_runtime/nacl_config.h"
 
 struct NaClExceptionContext;
+struct NaClAbiFutexWaitv;
+struct NaClAbiNaClImcMMsgHdr;
 struct NaClAbiNaClImcMsgHdr;
 struct NaClMemMappingInfo;
 struct stat;
@@ -112,6 +114,14 @@ typedef int (*TYPE_nacl_imc_recvmsg) (int desc,
 typedef int (*TYPE_nacl_imc_sendmsg) (int desc,
                                       struct NaClAbiNaClImcMsgHdr const *nmhp,
                                       int flags);
+typedef int (*TYPE_nacl_imc_recvmmsg) (int desc,
+                                       struct NaClAbiNaClImcMMsgHdr *msgvec,
+                                       unsigned int vlen,
+                                       int flags);
+typedef int (*TYPE_nacl_imc_sendmmsg) (int desc,
+                                       struct NaClAbiNaClImcMMsgHdr *msgvec,
+                                       unsigned int vlen,
+                                       int flags);
 typedef int (*TYPE_nacl_imc_accept) (int d);
 
 typedef int (*TYPE_nacl_imc_connect) (int d);
@@ -140,6 +150,9 @@ typedef int (*TYPE_nacl_mprotect) (void *start, size_t length, int prot);
 typedef int (*TYPE_nacl_list_mappings) (struct NaClMemMappingInfo *region,
                                         size_t count);
 
+typedef int (*TYPE_nacl_write_watch) (int op, void *start, size_t length,
+                                      void **pages, size_t *count);
+
 /* ============================================================ */
 /* threads */
 /* ============================================================ */
@@ -150,6 +163,7 @@ typedef int (*TYPE_nacl_thread_create) (void *start_user_address,
                                         void *thread_ptr,
                                         void *second_thread_ptr);
 typedef int (*TYPE_nacl_thread_nice) (const int nice);
+typedef int (*TYPE_nacl_thread_sched) (int op, uintptr_t arg);
 
 /* ============================================================ */
 /* mutex */
@@ -192,6 +206,9 @@ typedef int (*TYPE_nacl_sched_yield) (void);
 
 typedef int (*TYPE_nacl_sysconf) (int name, int *res);
 
+typedef int (*TYPE_nacl_checkpoint) (void (*resume_pc)(void),
+                                     void *resume_sp);
+
 typedef void *(*TYPE_nacl_brk) (void *p);
 
 typedef pid_t (*TYPE_nacl_getpid) (void);
@@ -276,6 +293,10 @@ typedef int (*TYPE_nacl_futex_wait_abs) (volatile int *addr, int value,
 
 typedef int (*TYPE_nacl_futex_wake) (volatile int *addr, int nwake);
 
+typedef int (*TYPE_nacl_futex_waitv_abs) (
+    const struct NaClAbiFutexWaitv *waiters, size_t count,
+    const struct timespec *abstime);
+
 typedef int (*TYPE_nacl_get_random_bytes) (void *buf, size_t buf_size);
 
 #if defined(__cplusplus)
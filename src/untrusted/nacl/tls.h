@@ -25,6 +25,15 @@ void __newlib_thread_init(void);
 
 void __newlib_thread_exit(void);
 
+/*
+ * Hooks into the thread cache of libnacl's malloc().  They are
+ * referenced weakly, so they are NULL when another malloc() is used.
+ * The first is called once the main thread's TLS is set up, the second
+ * when a thread exits, before its TLS is freed.
+ */
+void __nacl_malloc_thread_init(void) __attribute__((weak));
+void __nacl_malloc_thread_exit(void) __attribute__((weak));
+
 
 /*
  * Returns the allocation size of the combined area, including TLS
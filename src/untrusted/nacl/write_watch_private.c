@@ -0,0 +1,35 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "native_client/src/untrusted/nacl/nacl_write_watch.h"
+
+#include <errno.h>
+
+#include "native_client/src/trusted/service_runtime/include/sys/nacl_write_watch.h"
+#include "native_client/src/untrusted/nacl/syscall_bindings_trampoline.h"
+
+static int write_watch(int op, void *start, size_t length,
+                       void **pages, size_t *count) {
+  int error = NACL_SYSCALL(write_watch)(op, start, length, pages, count);
+  if (error < 0) {
+    errno = -error;
+    return -1;
+  }
+  return 0;
+}
+
+int nacl_write_watch_arm(void *start, size_t length) {
+  return write_watch(NACL_ABI_WRITE_WATCH_ARM, start, length, NULL, NULL);
+}
+
+int nacl_write_watch_disarm(void *start, size_t length) {
+  return write_watch(NACL_ABI_WRITE_WATCH_DISARM, start, length, NULL, NULL);
+}
+
+int nacl_write_watch_fetch(void *start, size_t length,
+                           void **pages, size_t *count) {
+  return write_watch(NACL_ABI_WRITE_WATCH_FETCH, start, length, pages, count);
+}
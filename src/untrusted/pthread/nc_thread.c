@@ -487,6 +487,10 @@ void pthread_exit(void *retval) {
 
   __newlib_thread_exit();
 
+  /* Return the chunks cached by malloc(), if that is our malloc(). */
+  if (__nacl_malloc_thread_exit != NULL)
+    __nacl_malloc_thread_exit();
+
   if (__nc_initial_thread_id != basic_data) {
     pthread_mutex_lock(&__nc_thread_management_lock);
     --__nc_running_threads_counter;
@@ -507,16 +511,18 @@ void pthread_exit(void *retval) {
     basic_data->status = THREAD_TERMINATED;
     pthread_cond_signal(&basic_data->join_condvar);
   }
+  if (!joinable) {
+    nc_release_basic_data_mu(basic_data);
+    tdb->basic_data = NULL;
+  }
+
   /*
    * We can release TLS+TDB - thread id and its return value are still
-   * kept in basic_data.
+   * kept in basic_data.  This must be the last free() on this thread,
+   * since free() may look at the thread's TLS.
    */
   nc_release_tls_allocation(tdb->tls_allocation, tdb);
 
-  if (!joinable) {
-    nc_release_basic_data_mu(basic_data);
-  }
-
   /* Now add the stack to the list but keep it marked as used. */
   nc_free_memory_block_mu(stack_node);
 
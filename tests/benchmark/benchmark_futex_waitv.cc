@@ -0,0 +1,243 @@
+// Copyright 2016 The Native Client Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "native_client/src/untrusted/irt/irt.h"
+#include "native_client/tests/benchmark/framework.h"
+
+namespace {
+
+// A receiver thread waits for a message on any of several channels,
+// plus a shutdown channel, and acknowledges each one; the sender posts
+// to the channels in turn and waits for each acknowledgement.  The
+// condvar version is the usual emulation of "wait for any": one shared
+// condition variable and a flag per channel.  The futex_waitv version
+// gives each channel its own futex word and waits on all of them.
+const int kChannels = 8;
+const int kShutdown = kChannels;
+const int kRoundTrips = 2000;
+
+class WaitAnyTest {
+ public:
+  explicit WaitAnyTest(bool use_waitv)
+      : use_waitv_(use_waitv), initialized_(false), supported_(false) {}
+  bool Init();
+  bool Cycle();
+  bool supported() const { return supported_; }
+
+ private:
+  static void* ReceiverThread(void* data);
+  void ReceiveCondvar();
+  void ReceiveWaitv();
+  void SendCondvar(int channel);
+  void SendWaitv(int channel);
+
+  bool use_waitv_;
+  bool initialized_;
+  bool supported_;
+  bool failed_;
+  struct nacl_irt_futex_v0_2 futex_;
+
+  // Condvar version.
+  pthread_mutex_t mu_;
+  pthread_cond_t cv_;
+  pthread_cond_t ack_cv_;
+  bool pending_[kChannels + 1];
+
+  // Both versions: the number of messages acknowledged.  The futex_waitv
+  // version also waits on it as a futex word.
+  volatile int acked_;
+
+  // futex_waitv version: a sequence number per channel.
+  volatile int words_[kChannels + 1];
+};
+
+bool WaitAnyTest::Init() {
+  if (initialized_)
+    return true;
+  initialized_ = true;
+  supported_ = true;
+  acked_ = 0;
+  memset(const_cast<int*>(words_), 0, sizeof(words_));
+  if (!use_waitv_) {
+    pthread_mutex_init(&mu_, NULL);
+    pthread_cond_init(&cv_, NULL);
+    pthread_cond_init(&ack_cv_, NULL);
+    return true;
+  }
+  if (nacl_interface_query(NACL_IRT_FUTEX_v0_2, &futex_, sizeof(futex_)) !=
+      sizeof(futex_)) {
+    printf("irt-futex 0.2 is not available\n");
+    supported_ = false;
+    return true;
+  }
+  // A mismatched value returns at once, and tells us whether the host
+  // can wait on several addresses at all.
+  int index;
+  struct nacl_irt_futex_waitv waiter = { &words_[0], words_[0] + 1 };
+  int rc = futex_.futex_waitv_abs(&waiter, 1, NULL, &index);
+  if (rc == ENOSYS) {
+    printf("futex_waitv_abs() is not supported on this host\n");
+    supported_ = false;
+    return true;
+  }
+  return rc == EAGAIN;
+}
+
+void WaitAnyTest::ReceiveCondvar() {
+  pthread_mutex_lock(&mu_);
+  for (;;) {
+    int channel = -1;
+    for (int i = 0; i <= kChannels; ++i) {
+      if (pending_[i]) {
+        pending_[i] = false;
+        channel = i;
+        break;
+      }
+    }
+    if (channel == kShutdown)
+      break;
+    if (channel < 0) {
+      pthread_cond_wait(&cv_, &mu_);
+      continue;
+    }
+    acked_++;
+    pthread_cond_signal(&ack_cv_);
+  }
+  pthread_mutex_unlock(&mu_);
+}
+
+void WaitAnyTest::SendCondvar(int channel) {
+  pthread_mutex_lock(&mu_);
+  int target = acked_ + 1;
+  pending_[channel] = true;
+  pthread_cond_signal(&cv_);
+  if (channel != kShutdown) {
+    while (acked_ != target)
+      pthread_cond_wait(&ack_cv_, &mu_);
+  }
+  pthread_mutex_unlock(&mu_);
+}
+
+void WaitAnyTest::ReceiveWaitv() {
+  struct nacl_irt_futex_waitv waiters[kChannels + 1];
+  for (int i = 0; i <= kChannels; ++i) {
+    waiters[i].addr = &words_[i];
+    waiters[i].value = words_[i];
+  }
+  for (;;) {
+    int channel = -1;
+    for (int i = 0; i <= kChannels; ++i) {
+      int value = words_[i];
+      if (value != waiters[i].value) {
+        waiters[i].value = value;
+        channel = i;
+        break;
+      }
+    }
+    if (channel == kShutdown)
+      break;
+    if (channel < 0) {
+      int index;
+      int rc = futex_.futex_waitv_abs(waiters, kChannels + 1, NULL, &index);
+      if (rc != 0 && rc != EAGAIN) {
+        failed_ = true;
+        return;
+      }
+      continue;
+    }
+    __sync_fetch_and_add(&acked_, 1);
+    int count;
+    futex_.futex_wake(&acked_, 1, &count);
+  }
+}
+
+void WaitAnyTest::SendWaitv(int channel) {
+  int target = acked_ + 1;
+  int count;
+  __sync_fetch_and_add(&words_[channel], 1);
+  futex_.futex_wake(&words_[channel], 1, &count);
+  if (channel == kShutdown)
+    return;
+  for (;;) {
+    int value = acked_;
+    if (value == target)
+      break;
+    futex_.futex_wait_abs(&acked_, value, NULL);
+  }
+}
+
+void* WaitAnyTest::ReceiverThread(void* data) {
+  WaitAnyTest* test = static_cast<WaitAnyTest*>(data);
+  if (test->use_waitv_)
+    test->ReceiveWaitv();
+  else
+    test->ReceiveCondvar();
+  return NULL;
+}
+
+bool WaitAnyTest::Cycle() {
+  memset(pending_, 0, sizeof(pending_));
+  acked_ = 0;
+  failed_ = false;
+
+  pthread_t tid;
+  if (pthread_create(&tid, NULL, ReceiverThread, this) != 0)
+    return false;
+  for (int i = 0; i < kRoundTrips; ++i) {
+    if (use_waitv_)
+      SendWaitv(i % kChannels);
+    else
+      SendCondvar(i % kChannels);
+  }
+  if (use_waitv_)
+    SendWaitv(kShutdown);
+  else
+    SendCondvar(kShutdown);
+  if (pthread_join(tid, NULL) != 0)
+    return false;
+  return !failed_ && acked_ == kRoundTrips;
+}
+
+
+// Wrap wait-for-any tests in benchmark harness
+class BenchmarkWaitAnyCondvar : public Benchmark {
+ public:
+  BenchmarkWaitAnyCondvar() : test_(false) {}
+  virtual int Run() {
+    if (!test_.Init())
+      return 1;
+    return test_.Cycle() ? 0 : 1;
+  }
+  virtual const std::string Name() { return "WaitAnyCondvar"; }
+  virtual const std::string Notes() { return "shared condvar emulation"; }
+ private:
+  WaitAnyTest test_;
+};
+
+class BenchmarkWaitAnyFutexWaitv : public Benchmark {
+ public:
+  BenchmarkWaitAnyFutexWaitv() : test_(true) {}
+  virtual int Run() {
+    if (!test_.Init())
+      return 1;
+    if (!test_.supported())
+      return 0;
+    return test_.Cycle() ? 0 : 1;
+  }
+  virtual const std::string Name() { return "WaitAnyFutexWaitv"; }
+  virtual const std::string Notes() { return "futex_waitv_abs"; }
+ private:
+  WaitAnyTest test_;
+};
+
+}  // namespace
+
+// Register instances to the list of benchmarks to be run.
+RegisterBenchmark<BenchmarkWaitAnyCondvar> benchmark_wait_any_condvar;
+RegisterBenchmark<BenchmarkWaitAnyFutexWaitv> benchmark_wait_any_futex_waitv;
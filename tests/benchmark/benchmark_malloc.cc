@@ -0,0 +1,127 @@
+// Copyright 2016 The Native Client Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "native_client/tests/benchmark/framework.h"
+#include "native_client/tests/benchmark/thread_pool.h"
+
+namespace {
+
+const int kThreads = 4;
+const int kRounds = 200;
+const int kObjectsPerThread = 1024;
+
+// Sizes cycle through small requests, which the thread cache serves, with
+// an occasional larger one which goes to the central heap.
+size_t ObjectSize(uint32_t* seed) {
+  *seed = *seed * 1103515245 + 12345;
+  uint32_t r = *seed >> 16;
+  if (r % 16 == 0)
+    return 512 + r % 1024;
+  return 8 + r % 248;
+}
+
+class MallocTest {
+ public:
+  MallocTest() : pool_(kThreads) {
+    memset(objects_, 0, sizeof(objects_));
+  }
+  // Each thread allocates and frees its own objects.
+  bool Churn();
+  // Each thread frees the objects the previous thread allocated.
+  bool Handoff();
+
+ private:
+  static void ChurnTask(int task_index, void* data);
+  static void AllocateTask(int task_index, void* data);
+  static void FreeNextTask(int task_index, void* data);
+
+  sdk_util::ThreadPool pool_;
+  void* objects_[kThreads][kObjectsPerThread];
+  bool failed_;
+};
+
+void MallocTest::ChurnTask(int task_index, void* data) {
+  MallocTest* test = static_cast<MallocTest*>(data);
+  void** objects = test->objects_[task_index];
+  uint32_t seed = task_index;
+  for (int round = 0; round < kRounds; ++round) {
+    for (int i = 0; i < kObjectsPerThread; ++i) {
+      objects[i] = malloc(ObjectSize(&seed));
+      if (objects[i] == NULL) {
+        test->failed_ = true;
+        return;
+      }
+      *static_cast<char*>(objects[i]) = 1;
+    }
+    for (int i = 0; i < kObjectsPerThread; ++i) {
+      free(objects[i]);
+      objects[i] = NULL;
+    }
+  }
+}
+
+void MallocTest::AllocateTask(int task_index, void* data) {
+  MallocTest* test = static_cast<MallocTest*>(data);
+  void** objects = test->objects_[task_index];
+  uint32_t seed = task_index;
+  for (int i = 0; i < kObjectsPerThread; ++i) {
+    objects[i] = malloc(ObjectSize(&seed));
+    if (objects[i] == NULL)
+      test->failed_ = true;
+  }
+}
+
+void MallocTest::FreeNextTask(int task_index, void* data) {
+  MallocTest* test = static_cast<MallocTest*>(data);
+  void** objects = test->objects_[(task_index + 1) % kThreads];
+  for (int i = 0; i < kObjectsPerThread; ++i) {
+    free(objects[i]);
+    objects[i] = NULL;
+  }
+}
+
+bool MallocTest::Churn() {
+  failed_ = false;
+  pool_.Dispatch(kThreads, ChurnTask, this);
+  return !failed_;
+}
+
+bool MallocTest::Handoff() {
+  failed_ = false;
+  for (int round = 0; round < kRounds; ++round) {
+    pool_.Dispatch(kThreads, AllocateTask, this);
+    pool_.Dispatch(kThreads, FreeNextTask, this);
+  }
+  return !failed_;
+}
+
+
+// Wrap malloc tests in benchmark harness
+class BenchmarkMallocChurn : public Benchmark {
+ public:
+  virtual int Run() { return test_.Churn() ? 0 : 1; }
+  virtual const std::string Name() { return "MallocChurn"; }
+  virtual const std::string Notes() { return "4 threads, same-thread free"; }
+ private:
+  MallocTest test_;
+};
+
+class BenchmarkMallocHandoff : public Benchmark {
+ public:
+  virtual int Run() { return test_.Handoff() ? 0 : 1; }
+  virtual const std::string Name() { return "MallocHandoff"; }
+  virtual const std::string Notes() { return "4 threads, cross-thread free"; }
+ private:
+  MallocTest test_;
+};
+
+}  // namespace
+
+// Register instances to the list of benchmarks to be run.
+RegisterBenchmark<BenchmarkMallocChurn> benchmark_malloc_churn;
+RegisterBenchmark<BenchmarkMallocHandoff> benchmark_malloc_handoff;
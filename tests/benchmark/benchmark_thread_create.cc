@@ -0,0 +1,44 @@
+// Copyright 2016 The Native Client Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <pthread.h>
+
+#include "native_client/tests/benchmark/framework.h"
+
+namespace {
+
+// Create and join threads one at a time, so that each pthread_create()
+// can be served by the host thread the previous thread exited from when
+// sel_ldr keeps a thread pool (see sel_ldr -t).
+const int kThreads = 500;
+
+void* ThreadFunc(void* data) {
+  return data;
+}
+
+int CreateAndJoin() {
+  for (int i = 0; i < kThreads; ++i) {
+    pthread_t tid;
+    void* result;
+    if (pthread_create(&tid, NULL, ThreadFunc, &tid) != 0)
+      return 1;
+    if (pthread_join(tid, &result) != 0 || result != &tid)
+      return 1;
+  }
+  return 0;
+}
+
+
+// Wrap thread create/join in benchmark harness
+class BenchmarkThreadCreate : public Benchmark {
+ public:
+  virtual int Run() { return CreateAndJoin(); }
+  virtual const std::string Name() { return "ThreadCreate"; }
+  virtual const std::string Notes() { return "500 create/join pairs"; }
+};
+
+}  // namespace
+
+// Register an instance to the list of benchmarks to be run.
+RegisterBenchmark<BenchmarkThreadCreate> benchmark_thread_create;
@@ -0,0 +1,83 @@
+// Copyright 2016 The Native Client Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "native_client/tests/benchmark/framework.h"
+
+namespace {
+
+// Chase pointers through a buffer much larger than the TLB reach of
+// small pages, so that nearly every load takes a dTLB miss unless the
+// buffer is backed by huge pages (see sel_ldr -H).
+const size_t kBufferBytes = 64 << 20;
+const size_t kSlotBytes = 64;  // one cache line per slot
+const size_t kSlots = kBufferBytes / kSlotBytes;
+
+struct Slot {
+  uint32_t next;
+  uint8_t pad[kSlotBytes - sizeof(uint32_t)];
+};
+
+class TlbChase {
+ public:
+  TlbChase() : slots_(NULL) {}
+  virtual ~TlbChase() { free(slots_); }
+  bool Init();
+  // Follows kSlots links starting at slot 0, and returns the final
+  // slot, which is 0 again if the links form a single cycle.
+  uint32_t Chase();
+
+ private:
+  Slot* slots_;
+};
+
+bool TlbChase::Init() {
+  if (slots_ != NULL)
+    return true;
+  slots_ = static_cast<Slot*>(malloc(kSlots * sizeof(Slot)));
+  if (slots_ == NULL)
+    return false;
+  for (size_t i = 0; i < kSlots; ++i)
+    slots_[i].next = static_cast<uint32_t>(i);
+  // Sattolo's algorithm gives a random permutation that is a single
+  // cycle.  A fixed LCG keeps the access pattern the same across runs.
+  uint32_t seed = 12345;
+  for (size_t i = kSlots - 1; i > 0; --i) {
+    seed = seed * 1103515245 + 12345;
+    size_t j = seed % i;
+    uint32_t tmp = slots_[i].next;
+    slots_[i].next = slots_[j].next;
+    slots_[j].next = tmp;
+  }
+  return true;
+}
+
+uint32_t TlbChase::Chase() {
+  uint32_t index = 0;
+  for (size_t i = 0; i < kSlots; ++i)
+    index = slots_[index].next;
+  return index;
+}
+
+
+// Wrap TLB chase in benchmark harness
+class BenchmarkTlb : public Benchmark {
+ public:
+  virtual int Run() {
+    if (!chase_.Init())
+      return 1;
+    return chase_.Chase() == 0 ? 0 : 1;
+  }
+  virtual const std::string Name() { return "TlbChase"; }
+  virtual const std::string Notes() { return "64MB random pointer chase"; }
+ private:
+  TlbChase chase_;
+};
+
+}  // namespace
+
+// Register an instance to the list of benchmarks to be run.
+RegisterBenchmark<BenchmarkTlb> benchmark_tlb;
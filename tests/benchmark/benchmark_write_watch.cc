@@ -0,0 +1,176 @@
+// Copyright 2016 The Native Client Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "native_client/src/untrusted/nacl/nacl_write_watch.h"
+#include "native_client/tests/benchmark/framework.h"
+#include "native_client/tests/benchmark/thread_pool.h"
+
+namespace {
+
+// A concurrent-marking collector cycle: one thread marks (scans) the
+// whole heap while the other threads keep mutating it, after which the
+// pages the mutators dirtied are rescanned.  The card-marking version
+// finds those pages with a software write barrier on every store; the
+// write-watch version uses plain stores and asks the service runtime.
+const int kThreads = 4;
+const int kHeapPages = 64;
+const size_t kPageBytes = NACL_WRITE_WATCH_PAGESIZE;
+const size_t kHeapBytes = kHeapPages * kPageBytes;
+const size_t kHeapWords = kHeapBytes / sizeof(uint32_t);
+const size_t kPageWords = kPageBytes / sizeof(uint32_t);
+const int kMarkPasses = 8;
+const int kStoresPerMutator = 1 << 20;
+// Mutators mostly store to a few pages, as they would to recently
+// allocated objects.
+const int kHotPages = 8;
+
+class MarkingTest {
+ public:
+  explicit MarkingTest(bool use_write_watch)
+      : pool_(kThreads), use_write_watch_(use_write_watch), supported_(false),
+        heap_(NULL) {}
+  bool Init();
+  bool Cycle();
+  bool supported() const { return supported_; }
+
+ private:
+  static void Task(int task_index, void* data);
+  void Mark();
+  void Mutate(uint32_t seed);
+  uint32_t Rescan(size_t page);
+
+  sdk_util::ThreadPool pool_;
+  bool use_write_watch_;
+  bool supported_;
+  uint32_t* heap_;
+  volatile uint8_t cards_[kHeapPages];
+  volatile uint32_t sink_;
+};
+
+bool MarkingTest::Init() {
+  if (heap_ != NULL)
+    return true;
+  void* addr = mmap(NULL, kHeapBytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (addr == MAP_FAILED)
+    return false;
+  heap_ = static_cast<uint32_t*>(addr);
+  for (size_t i = 0; i < kHeapWords; ++i)
+    heap_[i] = static_cast<uint32_t>(i);
+  memset(const_cast<uint8_t*>(cards_), 0, sizeof(cards_));
+  supported_ = true;
+  if (use_write_watch_ && nacl_write_watch_arm(heap_, kHeapBytes) != 0) {
+    if (errno != ENOSYS)
+      return false;
+    printf("write watch is not supported on this host\n");
+    supported_ = false;
+  }
+  return true;
+}
+
+void MarkingTest::Mark() {
+  uint32_t sum = 0;
+  for (int pass = 0; pass < kMarkPasses; ++pass) {
+    for (size_t i = 0; i < kHeapWords; ++i)
+      sum += heap_[i];
+  }
+  sink_ = sum;
+}
+
+void MarkingTest::Mutate(uint32_t seed) {
+  for (int i = 0; i < kStoresPerMutator; ++i) {
+    seed = seed * 1103515245 + 12345;
+    uint32_t r = seed >> 8;
+    size_t page = (r & 63) == 0 ? r % kHeapPages : r % kHotPages;
+    size_t word = page * kPageWords + (r >> 6) % kPageWords;
+    heap_[word] = r;
+    if (!use_write_watch_)
+      cards_[page] = 1;
+  }
+}
+
+uint32_t MarkingTest::Rescan(size_t page) {
+  uint32_t sum = 0;
+  const uint32_t* words = heap_ + page * kPageWords;
+  for (size_t i = 0; i < kPageWords; ++i)
+    sum += words[i];
+  return sum;
+}
+
+void MarkingTest::Task(int task_index, void* data) {
+  MarkingTest* test = static_cast<MarkingTest*>(data);
+  if (task_index == 0)
+    test->Mark();
+  else
+    test->Mutate(task_index);
+}
+
+bool MarkingTest::Cycle() {
+  pool_.Dispatch(kThreads, Task, this);
+
+  uint32_t sum = 0;
+  if (use_write_watch_) {
+    void* pages[kHeapPages];
+    size_t count = kHeapPages;
+    if (nacl_write_watch_fetch(heap_, kHeapBytes, pages, &count) != 0)
+      return false;
+    for (size_t i = 0; i < count; ++i) {
+      size_t page = (static_cast<uint32_t*>(pages[i]) - heap_) / kPageWords;
+      sum += Rescan(page);
+    }
+  } else {
+    for (size_t page = 0; page < kHeapPages; ++page) {
+      if (cards_[page]) {
+        cards_[page] = 0;
+        sum += Rescan(page);
+      }
+    }
+  }
+  sink_ = sum;
+  return true;
+}
+
+
+// Wrap marking tests in benchmark harness
+class BenchmarkMarkingCardTable : public Benchmark {
+ public:
+  BenchmarkMarkingCardTable() : test_(false) {}
+  virtual int Run() {
+    if (!test_.Init())
+      return 1;
+    return test_.Cycle() ? 0 : 1;
+  }
+  virtual const std::string Name() { return "MarkingCardTable"; }
+  virtual const std::string Notes() { return "software write barrier"; }
+ private:
+  MarkingTest test_;
+};
+
+class BenchmarkMarkingWriteWatch : public Benchmark {
+ public:
+  BenchmarkMarkingWriteWatch() : test_(true) {}
+  virtual int Run() {
+    if (!test_.Init())
+      return 1;
+    if (!test_.supported())
+      return 0;
+    return test_.Cycle() ? 0 : 1;
+  }
+  virtual const std::string Name() { return "MarkingWriteWatch"; }
+  virtual const std::string Notes() { return "write_watch syscall"; }
+ private:
+  MarkingTest test_;
+};
+
+}  // namespace
+
+// Register instances to the list of benchmarks to be run.
+RegisterBenchmark<BenchmarkMarkingCardTable> benchmark_marking_card_table;
+RegisterBenchmark<BenchmarkMarkingWriteWatch> benchmark_marking_write_watch;
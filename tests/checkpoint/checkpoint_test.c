@@ -0,0 +1,119 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Run with "nosys" and no snapshot file, this checks that
+ * nacl_checkpoint() fails.  Otherwise it builds up some state and
+ * checkpoints; run again from the snapshot, it checks that the state
+ * came back.
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "native_client/src/include/nacl_assert.h"
+#include "native_client/src/untrusted/nacl/nacl_checkpoint.h"
+
+#define PAGE 0x10000
+#define HEAP_SIZE (1 << 20)
+
+static volatile int g_counter;
+static char g_bss[1000];
+static char *g_heap;
+static char *g_mapping;
+static char *g_hidden;
+
+static void set_up(void) {
+  int i;
+
+  g_counter = 1234;
+  strcpy(g_bss, "in bss");
+  g_heap = malloc(HEAP_SIZE);
+  ASSERT_NE(g_heap, NULL);
+  for (i = 0; i < HEAP_SIZE; i++) {
+    g_heap[i] = (char) (i * 7);
+  }
+  /* The middle page is left all zero, so it is a hole in the snapshot. */
+  g_mapping = mmap(NULL, 3 * PAGE, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(g_mapping, MAP_FAILED);
+  memset(g_mapping, 0x55, PAGE);
+  g_mapping[3 * PAGE - 1] = 0x66;
+  /* Its contents must survive even though it is inaccessible. */
+  g_hidden = mmap(NULL, PAGE, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(g_hidden, MAP_FAILED);
+  memset(g_hidden, 0x77, PAGE);
+  ASSERT_EQ(0, mprotect(g_hidden, PAGE, PROT_NONE));
+}
+
+static void check(void) {
+  int i;
+
+  ASSERT_EQ(g_counter, 1234);
+  ASSERT_EQ(0, strcmp(g_bss, "in bss"));
+  for (i = 0; i < HEAP_SIZE; i++) {
+    ASSERT_EQ(g_heap[i], (char) (i * 7));
+  }
+  for (i = 0; i < PAGE; i++) {
+    ASSERT_EQ(g_mapping[i], 0x55);
+    ASSERT_EQ(g_mapping[PAGE + i], 0);
+  }
+  ASSERT_EQ(g_mapping[3 * PAGE - 1], 0x66);
+  ASSERT_EQ(0, mprotect(g_hidden, PAGE, PROT_READ));
+  for (i = 0; i < PAGE; i++) {
+    ASSERT_EQ(g_hidden[i], 0x77);
+  }
+  ASSERT_EQ(0, mprotect(g_hidden, PAGE, PROT_NONE));
+}
+
+/*
+ * Writes over everything.  After a checkpoint, this must not change
+ * the snapshot; after a restore, memory must be writable and must not
+ * write through to the snapshot either.
+ */
+static void scribble(void) {
+  g_counter = 1;
+  strcpy(g_bss, "changed");
+  memset(g_heap, 1, HEAP_SIZE);
+  memset(g_mapping, 2, 3 * PAGE);
+  ASSERT_EQ(g_mapping[PAGE], 2);
+  ASSERT_EQ(0, mprotect(g_hidden, PAGE, PROT_READ | PROT_WRITE));
+  memset(g_hidden, 3, PAGE);
+}
+
+int main(int argc, char **argv) {
+  int rc;
+
+  if (argc == 2 && strcmp(argv[1], "nosys") == 0) {
+    printf("Testing that checkpoint needs a snapshot file...\n");
+    ASSERT_EQ(-1, nacl_checkpoint());
+    ASSERT_EQ(ENOSYS, errno);
+    return 0;
+  }
+
+  set_up();
+  /* Anything left in the stdio buffer would be written again on resume. */
+  fflush(stdout);
+  rc = nacl_checkpoint();
+  if (rc == 0) {
+    printf("Checkpoint written.\n");
+    check();
+    scribble();
+    return 0;
+  }
+  ASSERT_EQ(1, rc);
+  printf("Resumed from checkpoint.\n");
+  check();
+  scribble();
+  /* The heap can still grow. */
+  ASSERT_NE(malloc(HEAP_SIZE), NULL);
+  return 0;
+}
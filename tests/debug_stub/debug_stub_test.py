@@ -49,6 +49,16 @@ def EncodeHex(data):
   return ''.join('%02x' % ord(byte) for byte in data)
 
 
+def EncodeEscaping(data):
+  ret = ''
+  for byte in data:
+    if byte in '}#$*':
+      ret += '}' + chr(ord(byte) ^ 0x20)
+    else:
+      ret += byte
+  return ret
+
+
 def DecodeEscaping(data):
   ret = ''
   last = None
@@ -623,6 +633,61 @@ class DebugStubTest(unittest.TestCase):
 
       self.CheckReadMemoryAtInvalidAddr(connection)
 
+  def test_binary_memory_write(self):
+    with LaunchDebugStub('test_getting_registers') as connection:
+      reply = connection.RspRequest('qSupported')
+      self.assertIn('PacketSize=20000', reply.split(';'))
+
+      mem_addr = GetSymbols()['g_example_var']
+      # An empty write is how GDB checks for 'X' support.
+      reply = connection.RspRequest('X%x,0:' % mem_addr)
+      self.assertEquals(reply, 'OK')
+      # Include characters which need escaping.
+      new_data = '}#$*\0binary\0'
+      reply = connection.RspRequest('X%x,%x:%s' % (mem_addr, len(new_data),
+                                                   EncodeEscaping(new_data)))
+      self.assertEquals(reply, 'OK')
+      reply = connection.RspRequest('m%x,%x' % (mem_addr, len(new_data)))
+      self.assertEquals(DecodeHex(reply), new_data)
+
+  def test_memory_map(self):
+    with LaunchDebugStub('test_getting_registers') as connection:
+      reply = connection.RspRequest('qXfer:memory-map:read::0,fff')
+      self.assertEquals(reply[0], 'l')
+      whole = DecodeEscaping(reply[1:])
+      memory_map = xml.etree.ElementTree.fromstring(whole)
+      mem_addr = GetSymbols()['g_example_var']
+      found = False
+      for region in memory_map.findall('memory'):
+        start = int(region.get('start'), 16)
+        length = int(region.get('length'), 16)
+        if start <= mem_addr < start + length:
+          found = True
+      self.assertTrue(found)
+
+      # Reading in small chunks should give the same document.
+      data = ''
+      while True:
+        reply = connection.RspRequest('qXfer:memory-map:read::%x,40'
+                                      % len(data))
+        data += DecodeEscaping(reply[1:])
+        if reply[0] == 'l':
+          break
+        self.assertEquals(reply[0], 'm')
+      self.assertEquals(data, whole)
+
+  def test_libraries_svr4(self):
+    with LaunchDebugStub('test_getting_registers') as connection:
+      reply = connection.RspRequest('qXfer:libraries-svr4:read::0,fff')
+      # Static nexes have no dynamic linker, so there is no list to
+      # report and GDB is told to look for itself.
+      if reply.startswith('E'):
+        return
+      self.assertEquals(reply[0], 'l')
+      library_list = xml.etree.ElementTree.fromstring(
+          DecodeEscaping(reply[1:]))
+      self.assertEquals(library_list.tag, 'library-list-svr4')
+
   def test_exit_code(self):
     with LaunchDebugStub('test_exit_code') as connection:
       reply = connection.RspRequest('c')
@@ -200,6 +200,50 @@ void test_replacing_code_slowpaths(void) {
   assert(rc == 0);
   assert(memcmp(buf + off3, load_area + off3, size) == 0);
 }
+
+/*
+ * Check that one call can rewrite many instructions, most of which need
+ * the slow path: the service runtime halts all of them before copying
+ * any of them, instead of taking them one at a time.
+ */
+void test_replacing_code_slowpaths_batched(void) {
+  uint8_t *load_area = allocate_code_space(1);
+  uint8_t buf[BUF_SIZE + 4 * NACL_BUNDLE_SIZE];
+  uint8_t *bundle;
+  size_t size;
+  int rc;
+  int i;
+  int (*func)(void);
+
+  size = (size_t) (&template_instr_end - &template_instr);
+  assert(size <= 5);
+  copy_and_pad_fragment(buf, BUF_SIZE, &template_func, &template_func_end);
+  fill_nops(buf + BUF_SIZE, sizeof(buf) - BUF_SIZE);
+  for (i = 0; i < 4; i++) {
+    bundle = buf + BUF_SIZE + i * NACL_BUNDLE_SIZE;
+    memcpy(bundle + 4 - size + 1, &template_instr, size);
+    memcpy(bundle + 16 - size + 1, &template_instr, size);
+    memcpy(bundle + 24 - size + 1, &template_instr, size);
+  }
+  rc = nacl_dyncode_create(load_area, buf, sizeof(buf));
+  assert(rc == 0);
+
+  copy_and_pad_fragment(buf, BUF_SIZE, &template_func_replacement,
+                                       &template_func_replacement_end);
+  for (i = 0; i < 4; i++) {
+    bundle = buf + BUF_SIZE + i * NACL_BUNDLE_SIZE;
+    memcpy(bundle + 4 - size + 1, &template_instr_replace, size);
+    memcpy(bundle + 16 - size + 1, &template_instr_replace, size);
+    memcpy(bundle + 24 - size + 1, &template_instr_replace, size);
+  }
+  rc = nacl_dyncode_modify(load_area, buf, sizeof(buf));
+  assert(rc == 0);
+  /* No HLT may be left behind. */
+  assert(memcmp(buf, load_area, sizeof(buf)) == 0);
+  func = (int (*)(void)) (uintptr_t) load_area;
+  rc = func();
+  assert(rc == MARKER_NEW);
+}
 #endif
 
 /* Check code replacement constraints */
@@ -431,6 +475,7 @@ int TestMain(void) {
   RUN_TEST(test_replacing_code_unaligned);
 #if defined(__i386__) || defined(__x86_64__)
   RUN_TEST(test_replacing_code_slowpaths);
+  RUN_TEST(test_replacing_code_slowpaths_batched);
   RUN_TEST(test_jump_into_super_inst_create);
   RUN_TEST(test_start_with_super_inst_replace);
   RUN_TEST(test_jump_into_super_inst_replace);
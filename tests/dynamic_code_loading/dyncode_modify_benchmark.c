@@ -0,0 +1,97 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Measures how many instruction patches per second dyncode_modify can
+ * apply, as a JIT updating inline caches would use it: each patch
+ * changes the immediate of a "mov $imm32, %eax" which straddles an
+ * 8-byte boundary, so it cannot be made with a single store and the
+ * service runtime has to serialize every processor.  The patches are
+ * applied with one dyncode_modify call each and with one call for the
+ * whole region.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <nacl/nacl_dyncode.h>
+
+#include "native_client/tests/dynamic_code_loading/dynamic_segment.h"
+
+#define NACL_BUNDLE_SIZE  32
+#define NUM_BUNDLES       16
+#define CODE_SIZE         (NUM_BUNDLES * NACL_BUNDLE_SIZE)
+/* Puts the immediate at bytes 6-9 of the bundle. */
+#define MOV_OFFSET        5
+#define NUM_ROUNDS        200
+
+/*
+ * Each round's immediate differs from the last one in all four bytes
+ * (every byte holds the round number, which stays below 256), so that
+ * the changed bytes straddle the 8-byte boundary.
+ */
+static void make_code(uint8_t *buf, uint32_t round) {
+  uint32_t value = round * 0x01010101;
+  int i;
+
+  memset(buf, 0x90, CODE_SIZE);  /* NOPs */
+  for (i = 0; i < NUM_BUNDLES; i++) {
+    uint8_t *mov = buf + i * NACL_BUNDLE_SIZE + MOV_OFFSET;
+    mov[0] = 0xb8;  /* mov $imm32, %eax */
+    memcpy(mov + 1, &value, sizeof value);
+  }
+}
+
+static double get_seconds(void) {
+  struct timeval tv;
+  int rc = gettimeofday(&tv, NULL);
+  assert(rc == 0);
+  return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static void report(const char *name, double seconds) {
+  printf("RESULT DyncodeModify%s: patches= %.0f patches/s\n",
+         name, NUM_ROUNDS * NUM_BUNDLES / seconds);
+}
+
+int main(void) {
+  uint8_t *load_area = (uint8_t *) DYNAMIC_CODE_SEGMENT_START;
+  uint8_t buf[CODE_SIZE];
+  double start;
+  int round;
+  int i;
+  int rc;
+
+  make_code(buf, 0);
+  rc = nacl_dyncode_create(load_area, buf, CODE_SIZE);
+  assert(rc == 0);
+
+  start = get_seconds();
+  for (round = 1; round <= NUM_ROUNDS; round++) {
+    make_code(buf, round);
+    for (i = 0; i < NUM_BUNDLES; i++) {
+      rc = nacl_dyncode_modify(load_area + i * NACL_BUNDLE_SIZE,
+                               buf + i * NACL_BUNDLE_SIZE, NACL_BUNDLE_SIZE);
+      assert(rc == 0);
+    }
+  }
+  report("OnePerCall", get_seconds() - start);
+  assert(memcmp(load_area, buf, CODE_SIZE) == 0);
+
+  start = get_seconds();
+  for (round = 1; round <= NUM_ROUNDS; round++) {
+    make_code(buf, NUM_ROUNDS + round);
+    rc = nacl_dyncode_modify(load_area, buf, CODE_SIZE);
+    assert(rc == 0);
+  }
+  report("Batched", get_seconds() - start);
+  assert(memcmp(load_area, buf, CODE_SIZE) == 0);
+
+  return 0;
+}
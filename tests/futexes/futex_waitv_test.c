@@ -0,0 +1,208 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "native_client/src/include/nacl_assert.h"
+#include "native_client/src/include/nacl_macros.h"
+#include "native_client/src/untrusted/irt/irt.h"
+
+#if !TEST_IRT_FUTEX
+# include "native_client/src/untrusted/nacl/syscall_bindings_trampoline.h"
+#endif
+
+/*
+ * This tests futex_waitv_abs(), either through the IRT interface or
+ * through the syscall directly.  As in futex_test.c, a spurious wakeup
+ * could make some of these checks fail.
+ */
+
+#if TEST_IRT_FUTEX
+
+static struct nacl_irt_futex_v0_2 irt_futex;
+
+static int futex_waitv(const struct nacl_irt_futex_waitv *waiters,
+                       size_t count, const struct timespec *abstime,
+                       int *woken_index) {
+  return irt_futex.futex_waitv_abs(waiters, count, abstime, woken_index);
+}
+
+static int futex_wake(volatile int *addr, int nwake, int *count) {
+  return irt_futex.futex_wake(addr, nwake, count);
+}
+
+#else
+
+static int futex_waitv(const struct nacl_irt_futex_waitv *waiters,
+                       size_t count, const struct timespec *abstime,
+                       int *woken_index) {
+  int result = NACL_SYSCALL(futex_waitv_abs)(
+      (const struct NaClAbiFutexWaitv *) waiters, count, abstime);
+  if (result < 0)
+    return -result;
+  *woken_index = result;
+  return 0;
+}
+
+static int futex_wake(volatile int *addr, int nwake, int *count) {
+  int result = NACL_SYSCALL(futex_wake)(addr, nwake);
+  if (result < 0)
+    return -result;
+  *count = result;
+  return 0;
+}
+
+#endif
+
+#define NUM_WORDS 3
+
+static volatile int g_words[NUM_WORDS];
+
+
+/* Returns whether the host supports waiting on several addresses. */
+static int futex_waitv_supported(void) {
+  struct nacl_irt_futex_waitv waiter = { &g_words[0], g_words[0] + 1 };
+  int woken_index;
+  int rc = futex_waitv(&waiter, 1, NULL, &woken_index);
+  if (rc == ENOSYS)
+    return 0;
+  ASSERT_EQ(rc, EAGAIN);
+  return 1;
+}
+
+static void fill_waiters(struct nacl_irt_futex_waitv *waiters) {
+  int i;
+  for (i = 0; i < NUM_WORDS; i++) {
+    waiters[i].addr = &g_words[i];
+    waiters[i].value = g_words[i];
+  }
+}
+
+void test_futex_waitv_value_mismatch(void) {
+  struct nacl_irt_futex_waitv waiters[NUM_WORDS];
+  int woken_index = -1;
+  fill_waiters(waiters);
+  waiters[NUM_WORDS - 1].value++;
+  ASSERT_EQ(futex_waitv(waiters, NUM_WORDS, NULL, &woken_index), EAGAIN);
+  ASSERT_EQ(woken_index, -1);
+}
+
+void test_futex_waitv_bad_count(void) {
+  struct nacl_irt_futex_waitv waiters[NUM_WORDS];
+  int woken_index;
+  fill_waiters(waiters);
+  ASSERT_EQ(futex_waitv(waiters, 0, NULL, &woken_index), EINVAL);
+  ASSERT_EQ(futex_waitv(waiters, NACL_IRT_FUTEX_WAITV_MAX + 1, NULL,
+                        &woken_index), EINVAL);
+}
+
+void test_futex_waitv_timeout(void) {
+  struct nacl_irt_futex_waitv waiters[NUM_WORDS];
+  struct timespec abstime = { 0, 1000 /* nanoseconds */ };
+  int woken_index;
+  int count;
+  int i;
+
+  fill_waiters(waiters);
+  ASSERT_EQ(futex_waitv(waiters, NUM_WORDS, &abstime, &woken_index),
+            ETIMEDOUT);
+
+  /* The timed-out call must have left no waiters behind. */
+  for (i = 0; i < NUM_WORDS; i++) {
+    ASSERT_EQ(futex_wake(&g_words[i], INT_MAX, &count), 0);
+    ASSERT_EQ(count, 0);
+  }
+}
+
+struct ThreadState {
+  pthread_t tid;
+  volatile int about_to_wait;
+  volatile int woken_index;
+};
+
+static void *waitv_thread(void *thread_arg) {
+  struct ThreadState *thread = thread_arg;
+  struct nacl_irt_futex_waitv waiters[NUM_WORDS];
+  int woken_index;
+
+  fill_waiters(waiters);
+  thread->about_to_wait = 1;
+  ASSERT_EQ(futex_waitv(waiters, NUM_WORDS, NULL, &woken_index), 0);
+  thread->woken_index = woken_index;
+  return NULL;
+}
+
+/*
+ * Wake each word in turn and check that the waiter reports that word,
+ * and that a wakeup counts the waiter only once.
+ */
+void test_futex_waitv_wakeup(void) {
+  int word;
+
+  for (word = 0; word < NUM_WORDS; word++) {
+    struct ThreadState thread;
+    struct timespec wait_time = { 0, 100 * 1000000 /* nanoseconds */ };
+    int count;
+    int i;
+
+    thread.about_to_wait = 0;
+    thread.woken_index = -1;
+    ASSERT_EQ(pthread_create(&thread.tid, NULL, waitv_thread, &thread), 0);
+    while (!thread.about_to_wait) {
+      sched_yield();
+    }
+    /* Give the thread time to enter futex_waitv_abs(). */
+    ASSERT_EQ(nanosleep(&wait_time, NULL), 0);
+    ASSERT_EQ(thread.woken_index, -1);
+
+    g_words[word]++;
+    ASSERT_EQ(futex_wake(&g_words[word], INT_MAX, &count), 0);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(pthread_join(thread.tid, NULL), 0);
+    ASSERT_EQ(thread.woken_index, word);
+
+    /* The thread must be off the wait queues of the other words too. */
+    for (i = 0; i < NUM_WORDS; i++) {
+      ASSERT_EQ(futex_wake(&g_words[i], INT_MAX, &count), 0);
+      ASSERT_EQ(count, 0);
+    }
+  }
+}
+
+void run_test(const char *test_name, void (*test_func)(void)) {
+  printf("Running %s...\n", test_name);
+  test_func();
+}
+
+#define RUN_TEST(test_func) (run_test(#test_func, test_func))
+
+int main(void) {
+  /* Turn off stdout buffering to aid debugging. */
+  setvbuf(stdout, NULL, _IONBF, 0);
+
+#if TEST_IRT_FUTEX
+  size_t bytes = nacl_interface_query(NACL_IRT_FUTEX_v0_2, &irt_futex,
+                                      sizeof(irt_futex));
+  ASSERT_EQ(bytes, sizeof(irt_futex));
+#endif
+
+  if (!futex_waitv_supported()) {
+    printf("futex_waitv_abs() is not supported on this host\n");
+    return 0;
+  }
+  RUN_TEST(test_futex_waitv_bad_count);
+  RUN_TEST(test_futex_waitv_value_mismatch);
+  RUN_TEST(test_futex_waitv_timeout);
+  RUN_TEST(test_futex_waitv_wakeup);
+
+  return 0;
+}
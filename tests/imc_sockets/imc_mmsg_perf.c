@@ -0,0 +1,179 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/** @file
+ *
+ * Check imc_sendmmsg()/imc_recvmmsg() and compare their small-message
+ * throughput with one imc_sendmsg()/imc_recvmsg() call per message.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "native_client/src/public/imc_syscalls.h"
+#include "native_client/src/public/imc_types.h"
+
+#define BATCH_SIZE 32
+#define MESSAGE_SIZE 64
+
+static int g_num_batches = 2000;
+
+struct Batch {
+  struct NaClAbiNaClImcMMsgHdr  msgs[BATCH_SIZE];
+  struct NaClAbiNaClImcMsgIoVec iov[BATCH_SIZE];
+  char                          data[BATCH_SIZE][MESSAGE_SIZE];
+};
+
+static void batch_init(struct Batch *batch) {
+  int i;
+
+  memset(batch, 0, sizeof *batch);
+  for (i = 0; i < BATCH_SIZE; ++i) {
+    batch->iov[i].base = batch->data[i];
+    batch->iov[i].length = MESSAGE_SIZE;
+    batch->msgs[i].msg_hdr.iov = &batch->iov[i];
+    batch->msgs[i].msg_hdr.iov_length = 1;
+  }
+}
+
+static void fill_batch(struct Batch *batch, int seq) {
+  int i;
+
+  for (i = 0; i < BATCH_SIZE; ++i) {
+    memset(batch->data[i], (seq + i) & 0xff, MESSAGE_SIZE);
+  }
+}
+
+static void check_batch(struct Batch *batch, int seq) {
+  int i;
+  int j;
+
+  for (i = 0; i < BATCH_SIZE; ++i) {
+    for (j = 0; j < MESSAGE_SIZE; ++j) {
+      if (batch->data[i][j] != (char) ((seq + i) & 0xff)) {
+        fprintf(stderr, "message %d of batch %d corrupted at byte %d\n",
+                i, seq, j);
+        exit(1);
+      }
+    }
+  }
+}
+
+static double elapsed(struct timeval *start, struct timeval *end) {
+  return (end->tv_sec - start->tv_sec) + (end->tv_usec - start->tv_usec) / 1e6;
+}
+
+static void report(const char *name, struct timeval *start,
+                   struct timeval *end) {
+  double secs = elapsed(start, end);
+  int messages = g_num_batches * BATCH_SIZE;
+
+  printf("%-8s %d messages in %.6fs: %.0f messages/sec\n",
+         name, messages, secs, messages / secs);
+}
+
+static void run_single(int pair[2]) {
+  struct Batch send_batch;
+  struct Batch recv_batch;
+  struct timeval start;
+  struct timeval end;
+  int seq;
+  int i;
+  int rc;
+
+  batch_init(&send_batch);
+  batch_init(&recv_batch);
+  gettimeofday(&start, NULL);
+  for (seq = 0; seq < g_num_batches; ++seq) {
+    fill_batch(&send_batch, seq);
+    for (i = 0; i < BATCH_SIZE; ++i) {
+      rc = imc_sendmsg(pair[0], &send_batch.msgs[i].msg_hdr, 0);
+      assert(rc == MESSAGE_SIZE);
+    }
+    for (i = 0; i < BATCH_SIZE; ++i) {
+      rc = imc_recvmsg(pair[1], &recv_batch.msgs[i].msg_hdr, 0);
+      assert(rc == MESSAGE_SIZE);
+    }
+    check_batch(&recv_batch, seq);
+  }
+  gettimeofday(&end, NULL);
+  report("sendmsg", &start, &end);
+}
+
+static void run_batched(int pair[2]) {
+  struct Batch send_batch;
+  struct Batch recv_batch;
+  struct timeval start;
+  struct timeval end;
+  int seq;
+  int done;
+  int i;
+  int rc;
+
+  batch_init(&send_batch);
+  batch_init(&recv_batch);
+  gettimeofday(&start, NULL);
+  for (seq = 0; seq < g_num_batches; ++seq) {
+    fill_batch(&send_batch, seq);
+    for (done = 0; done < BATCH_SIZE; done += rc) {
+      rc = imc_sendmmsg(pair[0], &send_batch.msgs[done],
+                        BATCH_SIZE - done, 0);
+      assert(rc > 0);
+    }
+    for (done = 0; done < BATCH_SIZE; done += rc) {
+      rc = imc_recvmmsg(pair[1], &recv_batch.msgs[done],
+                        BATCH_SIZE - done, 0);
+      assert(rc > 0);
+    }
+    for (i = 0; i < BATCH_SIZE; ++i) {
+      assert(send_batch.msgs[i].msg_len == MESSAGE_SIZE);
+      assert(recv_batch.msgs[i].msg_len == MESSAGE_SIZE);
+      assert(recv_batch.msgs[i].msg_hdr.flags == 0);
+    }
+    check_batch(&recv_batch, seq);
+  }
+  gettimeofday(&end, NULL);
+  report("sendmmsg", &start, &end);
+}
+
+static void test_empty_nonblocking_receive(int pair[2]) {
+  struct Batch recv_batch;
+  int rc;
+
+  batch_init(&recv_batch);
+  rc = imc_recvmmsg(pair[1], recv_batch.msgs, BATCH_SIZE,
+                    NACL_ABI_IMC_NONBLOCK);
+  assert(rc == -1);
+  assert(errno == EAGAIN);
+}
+
+int main(int argc, char **argv) {
+  int pair[2];
+  int rc;
+
+  if (argc > 1) {
+    g_num_batches = atoi(argv[1]);
+  }
+
+  rc = imc_socketpair(pair);
+  assert(rc == 0);
+
+  test_empty_nonblocking_receive(pair);
+  run_single(pair);
+  run_batched(pair);
+
+  rc = close(pair[0]);
+  assert(rc == 0);
+  rc = close(pair[1]);
+  assert(rc == 0);
+  printf("PASSED\n");
+  return 0;
+}
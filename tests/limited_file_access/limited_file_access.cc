@@ -239,6 +239,12 @@ void test_symlink_access() {
   // Cannot open symlinks (even if they already exist)
   ASSERT_EQ(open(g_temp_symlink_path, O_RDONLY), -1);
   ASSERT_EQ(errno, EACCES);
+  // Nor stat them, with or without following the link
+  struct stat buf;
+  ASSERT_EQ(stat(g_temp_symlink_path, &buf), -1);
+  ASSERT_EQ(errno, EACCES);
+  ASSERT_EQ(lstat(g_temp_symlink_path, &buf), -1);
+  ASSERT_EQ(errno, EACCES);
 
   passed("test_symlink_access", "all");
 }
@@ -390,6 +396,23 @@ void test_parent_directory_access() {
   passed("test_parent_directory_access", "all");
 }
 
+void test_fchdir_access() {
+  // Relative paths must follow the cwd after fchdir as well as chdir.
+  struct stat buf;
+  ASSERT_EQ(chdir("/"), 0);
+  int fd = open(g_temp_sub_dir_name, O_RDONLY | O_DIRECTORY);
+  ASSERT_NE(fd, -1);
+  ASSERT_EQ(fchdir(fd), 0);
+  ASSERT_EQ(stat(g_temp_sub_file_name, &buf), 0);
+  ASSERT_EQ(stat(g_temp_file_name, &buf), -1);
+  ASSERT_EQ(errno, ENOENT);
+  ASSERT_EQ(close(fd), 0);
+  ASSERT_EQ(chdir("/"), 0);
+  ASSERT_EQ(stat(g_temp_file_name, &buf), 0);
+
+  passed("test_fchdir_access", "all");
+}
+
 void test_valid_file_access() {
   // Show that reads and writes to valid files work.
   char file_name[PATH_MAX];
@@ -451,6 +474,7 @@ void testSuite() {
   test_escape_attempt();
   test_information_leak();
   test_parent_directory_access();
+  test_fchdir_access();
   test_valid_file_access();
   test_new_file_access();
 }
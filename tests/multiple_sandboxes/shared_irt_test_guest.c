@@ -0,0 +1,13 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <stdio.h>
+
+/* stdio goes through the IRT, so this exercises the shared IRT code. */
+int main(void) {
+  printf("Hello from a sandbox using the shared IRT\n");
+  return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * This test loads the IRT into several sandboxes in one host process
+ * and checks that they share one validated copy of its code.
+ */
+
+#include <string.h>
+
+#include "native_client/src/include/build_config.h"
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/shared/platform/nacl_exit.h"
+#include "native_client/src/shared/platform/nacl_log.h"
+#include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/shared/platform/nacl_time.h"
+#include "native_client/src/trusted/desc/nacl_desc_base.h"
+#include "native_client/src/trusted/desc/nacl_desc_io.h"
+#include "native_client/src/trusted/service_runtime/include/sys/fcntl.h"
+#include "native_client/src/trusted/service_runtime/nacl_all_modules.h"
+#include "native_client/src/trusted/service_runtime/nacl_app.h"
+#include "native_client/src/trusted/service_runtime/nacl_text.h"
+#include "native_client/src/trusted/service_runtime/sel_ldr.h"
+#include "native_client/src/trusted/service_runtime/sel_main_common.h"
+
+#define NUM_APPS 3
+
+int main(int argc, char **argv) {
+  struct NaClApp app[NUM_APPS];
+  struct NaClDesc *irt_desc;
+  struct NaClDesc *nexe_desc;
+  char *guest_args[] = {"prog"};
+  uint8_t *irt_code[NUM_APPS];
+  uint32_t irt_start = 0;
+  size_t irt_size = 0;
+  int64_t load_us[NUM_APPS];
+  int i;
+
+  if (argc != 3)
+    NaClLog(LOG_FATAL, "Expected 2 arguments: IRT and executable filenames\n");
+
+  NaClAllModulesInit();
+
+  irt_desc = (struct NaClDesc *) NaClDescIoDescOpen(argv[1],
+                                                    NACL_ABI_O_RDONLY, 0);
+  CHECK(NULL != irt_desc);
+  nexe_desc = (struct NaClDesc *) NaClDescIoDescOpen(argv[2],
+                                                     NACL_ABI_O_RDONLY, 0);
+  CHECK(NULL != nexe_desc);
+
+  for (i = 0; i < NUM_APPS; i++) {
+    struct NaClDynamicRegion *region;
+    int64_t start_us;
+
+    CHECK(NaClAppCtor(&app[i]));
+    /* See multidomain_test_host.c. */
+#if NACL_ARCH(NACL_BUILD_ARCH) == NACL_x86 && NACL_BUILD_SUBARCH == 32
+    app[i].addr_bits = 29; /* 512MB per process */
+#endif
+    NaClXMutexLock(&app[i].mu);
+    CHECK(NaClAppLoadFileAslr(nexe_desc, &app[i],
+                              NACL_DISABLE_ASLR) == LOAD_OK);
+    NaClXMutexUnlock(&app[i].mu);
+
+    start_us = NaClGetTimeOfDayMicroseconds();
+    CHECK(NaClMainLoadIrt(&app[i], irt_desc, NULL) == LOAD_OK);
+    load_us[i] = NaClGetTimeOfDayMicroseconds() - start_us;
+
+    /*
+     * The IRT's code is the only dynamic code, and it is mapped rather
+     * than copied in.
+     */
+    CHECK(1 == app[i].num_dynamic_regions);
+    region = &app[i].dynamic_regions[0];
+    CHECK(region->is_mmap);
+    if (0 == i) {
+      irt_start = (uint32_t) (region->start - app[i].mem_start);
+      irt_size = region->size;
+    } else {
+      CHECK(irt_start == region->start - app[i].mem_start);
+      CHECK(irt_size == region->size);
+    }
+    irt_code[i] = (uint8_t *) region->start;
+    CHECK(0 == memcmp(irt_code[0], irt_code[i], irt_size));
+
+    /* The shared code cannot be written over with dyncode_create. */
+    CHECK(0 != NaClTextDyncodeCreate(&app[i], irt_start, irt_code[0],
+                                     app[i].bundle_size, NULL));
+
+    NaClAppInitialDescriptorHookup(&app[i]);
+    CHECK(NaClAppPrepareToLaunch(&app[i]) == LOAD_OK);
+  }
+
+  for (i = 0; i < NUM_APPS; i++) {
+    NaClLog(LOG_INFO, "IRT load into sandbox %d took %"NACL_PRId64" us\n",
+            i, load_us[i]);
+  }
+
+  /* Check that the guests can run on the shared IRT. */
+  for (i = 0; i < NUM_APPS; i++) {
+    CHECK(NaClCreateMainThread(&app[i], 1, guest_args, NULL));
+    CHECK(NaClWaitForMainThreadToExit(&app[i]) == 0);
+  }
+
+  /*
+   * Avoid calling exit() because it runs process-global destructors
+   * which might break code that is running in our unjoined threads.
+   */
+  NaClExit(0);
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Run by nonsfi_loader with its prefault and huge page options, to
+ * check that the segments are still laid out correctly.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "native_client/src/include/nacl_assert.h"
+
+static const char kRodata[] = "read-only data";
+static int g_data = 1234;
+static char g_bss[1 << 16];
+
+int main(void) {
+  ASSERT_EQ(strcmp(kRodata, "read-only data"), 0);
+  ASSERT_EQ(g_data, 1234);
+  for (size_t i = 0; i < sizeof(g_bss); ++i)
+    ASSERT_EQ(g_bss[i], 0);
+
+  g_data = 5678;
+  memset(g_bss, 0xff, sizeof(g_bss));
+  ASSERT_EQ(g_data, 5678);
+
+  printf("PASSED\n");
+  return 0;
+}
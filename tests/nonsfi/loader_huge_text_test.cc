@@ -0,0 +1,128 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Run by nonsfi_loader with --huge-text.  The functions below are
+ * aligned to 2MB, so the text segment spans whole huge pages and the
+ * loader really copies it onto an anonymous huge page mapping.  The
+ * test checks in /proc/self/smaps that the text is no longer mapped
+ * from the file and, where transparent huge pages are enabled, that
+ * some of it is on huge pages.  It then calls the functions to check
+ * that the copy is intact.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "native_client/src/include/nacl_assert.h"
+
+#define HUGE_PAGE_SIZE 0x200000
+
+#define DEFINE_CHUNK(name, multiplier) \
+  __attribute__((noinline, aligned(HUGE_PAGE_SIZE))) \
+  static uint32_t name(uint32_t seed) { \
+    volatile uint32_t x = seed; \
+    for (int i = 0; i < 100; ++i) \
+      x = x * multiplier + 7; \
+    return x; \
+  }
+
+DEFINE_CHUNK(Chunk0, 31)
+DEFINE_CHUNK(Chunk1, 37)
+DEFINE_CHUNK(Chunk2, 41)
+
+typedef uint32_t (*ChunkFunc)(uint32_t seed);
+
+static uint32_t Expected(uint32_t seed, uint32_t multiplier) {
+  uint32_t x = seed;
+  for (int i = 0; i < 100; ++i)
+    x = x * multiplier + 7;
+  return x;
+}
+
+/* Returns whether the kernel may back madvise()d memory with THPs. */
+static bool HugePagesEnabled(void) {
+  FILE *fp = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+  if (fp == NULL)
+    return false;
+  char line[128];
+  bool enabled = fgets(line, sizeof(line), fp) != NULL &&
+                 strstr(line, "[never]") == NULL;
+  fclose(fp);
+  return enabled;
+}
+
+/*
+ * Finds the mapping holding addr in /proc/self/smaps.  Sets *anonymous
+ * if it has no backing file and *huge_kb to its AnonHugePages.
+ */
+static void FindMapping(uintptr_t addr, bool *anonymous, long *huge_kb) {
+  FILE *fp = fopen("/proc/self/smaps", "r");
+  ASSERT_NE(fp, NULL);
+  char line[512];
+  bool found = false;
+  bool in_mapping = false;
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    unsigned long start;
+    unsigned long end;
+    int path_pos = 0;
+    /* Mapping headers are "start-end perms offset dev inode [path]". */
+    if (sscanf(line, "%lx-%lx %*s %*x %*s %*u %n",
+               &start, &end, &path_pos) == 2 && path_pos > 0) {
+      in_mapping = start <= addr && addr < end;
+      if (in_mapping) {
+        found = true;
+        *anonymous = line[path_pos] == '\0';
+        *huge_kb = 0;
+      }
+    } else if (in_mapping) {
+      sscanf(line, "AnonHugePages: %ld kB", huge_kb);
+    }
+  }
+  fclose(fp);
+  ASSERT(found);
+}
+
+int main(void) {
+  static const ChunkFunc kChunks[] = { Chunk0, Chunk1, Chunk2 };
+  static const uint32_t kMultipliers[] = { 31, 37, 41 };
+  uintptr_t lowest = UINTPTR_MAX;
+  uintptr_t highest = 0;
+
+  for (size_t i = 0; i < sizeof(kChunks) / sizeof(kChunks[0]); ++i) {
+    uintptr_t addr = (uintptr_t) kChunks[i];
+    ASSERT_EQ(addr % HUGE_PAGE_SIZE, 0);
+    if (addr < lowest)
+      lowest = addr;
+    if (addr > highest)
+      highest = addr;
+    ASSERT_EQ(kChunks[i](i + 1), Expected(i + 1, kMultipliers[i]));
+  }
+  /*
+   * At least one whole huge page lies between the lowest and highest
+   * chunk, or the loader would have had nothing to put on huge pages.
+   */
+  ASSERT_GE(highest - lowest, (uintptr_t) 2 * HUGE_PAGE_SIZE);
+
+  /*
+   * The huge page starting at the lowest chunk is wholly inside the
+   * text, so the loader must have remapped it.
+   */
+  bool anonymous = false;
+  long huge_kb = 0;
+  FindMapping(lowest, &anonymous, &huge_kb);
+  ASSERT(anonymous);
+  if (HugePagesEnabled()) {
+    ASSERT_GT(huge_kb, 0);
+  } else {
+    printf("Transparent huge pages are disabled; not checking"
+           " AnonHugePages\n");
+  }
+
+  printf("PASSED\n");
+  return 0;
+}
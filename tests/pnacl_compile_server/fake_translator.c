@@ -0,0 +1,91 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * A stand-in for the PNaCl translator which serves requests through
+ * the IRT's translator compile interface.  It copies the bitcode to
+ * its first output and writes its flags, one per line, to the second
+ * output if there is one.  The flags "--fail-init" and "--fail-data"
+ * make the corresponding callback fail.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "native_client/src/untrusted/irt/irt.h"
+#include "native_client/src/untrusted/irt/irt_dev.h"
+
+static int g_output_fd;
+static int g_fail_data;
+static int g_data_failed;
+
+static int write_all(int fd, const void *buf, size_t size) {
+  const char *p = buf;
+  while (size > 0) {
+    ssize_t written = write(fd, p, size);
+    if (written <= 0)
+      return -1;
+    p += written;
+    size -= written;
+  }
+  return 0;
+}
+
+static char *init_callback(uint32_t num_threads,
+                           int *obj_file_fds, size_t obj_file_fd_count,
+                           char **cmd_flags, size_t cmd_flags_len) {
+  size_t i;
+
+  g_output_fd = obj_file_fds[0];
+  g_fail_data = 0;
+  g_data_failed = 0;
+  for (i = 0; i < cmd_flags_len; ++i) {
+    if (strcmp(cmd_flags[i], "--fail-init") == 0)
+      return strdup("init_callback failed as requested");
+    if (strcmp(cmd_flags[i], "--fail-data") == 0)
+      g_fail_data = 1;
+    if (obj_file_fd_count > 1 &&
+        (write_all(obj_file_fds[1], cmd_flags[i], strlen(cmd_flags[i])) != 0 ||
+         write_all(obj_file_fds[1], "\n", 1) != 0))
+      return strdup("failed to write flags");
+  }
+  return NULL;
+}
+
+static int data_callback(const void *data, size_t num_bytes) {
+  if (g_fail_data || write_all(g_output_fd, data, num_bytes) != 0) {
+    g_data_failed = 1;
+    return 1;
+  }
+  return 0;
+}
+
+static char *end_callback(void) {
+  if (g_data_failed)
+    return strdup("data_callback failed");
+  return NULL;
+}
+
+static const struct nacl_irt_pnacl_compile_funcs funcs = {
+  init_callback,
+  data_callback,
+  end_callback,
+};
+
+int main(void) {
+  struct nacl_irt_private_pnacl_translator_compile interface;
+
+  if (nacl_interface_query(NACL_IRT_PRIVATE_PNACL_TRANSLATOR_COMPILE_v0_1,
+                           &interface, sizeof(interface)) !=
+      sizeof(interface)) {
+    fprintf(stderr, "translator compile interface not available\n");
+    return 1;
+  }
+  interface.serve_translate_request(&funcs);
+  return 0;
+}
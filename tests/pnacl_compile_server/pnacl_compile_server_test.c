@@ -0,0 +1,302 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+/*
+ * Runs the fake translator nexe (the sel_ldr command line given as our
+ * arguments) in the IRT's compile server mode with the channel on
+ * descriptor 3, checks the replies to good and bad requests, and then
+ * compares the time taken by N translations in one sandbox with N
+ * sandboxes doing one translation each.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "native_client/src/public/pnacl_compile_server.h"
+#include "native_client/src/shared/imc/nacl_imc_c.h"
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/trusted/desc/nacl_desc_base.h"
+#include "native_client/src/trusted/desc/nacl_desc_imc.h"
+#include "native_client/src/trusted/desc/nacl_desc_io.h"
+#include "native_client/src/trusted/desc/nrd_all_modules.h"
+#include "native_client/src/trusted/desc/nrd_xfer.h"
+#include "native_client/src/trusted/service_runtime/include/sys/fcntl.h"
+
+#define kChannelFd 3
+/* Large enough to be delivered in more than one chunk. */
+#define kInputSize ((3 << 20) + 123)
+#define kBenchmarkRuns 10
+
+static char const *g_temp_dir;
+static char g_input_path[1024];
+
+struct Server {
+  pid_t           pid;
+  struct NaClDesc *channel;
+};
+
+static void StartServer(struct Server *server, char **argv) {
+  NaClHandle              pair[2];
+  struct NaClDescImcDesc  *channel;
+
+  CHECK(NaClSocketPair(pair) == 0);
+  server->pid = fork();
+  CHECK(server->pid >= 0);
+  if (0 == server->pid) {
+    CHECK(dup2(pair[1], kChannelFd) == kChannelFd);
+    execvp(argv[0], argv);
+    perror("pnacl_compile_server_test: execvp");
+    _exit(127);
+  }
+  CHECK(NaClClose(pair[1]) == 0);
+  channel = malloc(sizeof *channel);
+  CHECK(NULL != channel);
+  CHECK(NaClDescImcDescCtor(channel, pair[0]));
+  server->channel = (struct NaClDesc *) channel;
+}
+
+/* Closing the channel makes the server exit. */
+static void StopServer(struct Server *server) {
+  int status;
+
+  NaClDescUnref(server->channel);
+  CHECK(waitpid(server->pid, &status, 0) == server->pid);
+  CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+static void PathInTempDir(char *buf, size_t size, char const *name) {
+  CHECK(snprintf(buf, size, "%s/%s", g_temp_dir, name) < (int) size);
+}
+
+static void WriteInput(void) {
+  FILE    *fp;
+  size_t  i;
+
+  PathInTempDir(g_input_path, sizeof g_input_path, "input.bc");
+  fp = fopen(g_input_path, "wb");
+  CHECK(NULL != fp);
+  for (i = 0; i < kInputSize; ++i) {
+    CHECK(putc((int) ((i * 7 + (i >> 12)) & 0xff), fp) != EOF);
+  }
+  CHECK(fclose(fp) == 0);
+}
+
+static char *ReadFile(char const *path, size_t *size) {
+  FILE  *fp = fopen(path, "rb");
+  char  *buf;
+  long  len;
+
+  CHECK(NULL != fp);
+  CHECK(fseek(fp, 0, SEEK_END) == 0);
+  len = ftell(fp);
+  CHECK(len >= 0);
+  CHECK(fseek(fp, 0, SEEK_SET) == 0);
+  buf = malloc(len + 1);
+  CHECK(NULL != buf);
+  CHECK(fread(buf, 1, len, fp) == (size_t) len);
+  CHECK(fclose(fp) == 0);
+  buf[len] = '\0';
+  *size = len;
+  return buf;
+}
+
+/*
+ * Sends one request translating the input to output_count files named
+ * out<N>.o and waits for the reply.  Returns the reply status, and
+ * copies the reply's message to message.
+ */
+static int32_t Translate(struct Server *server, uint32_t magic,
+                         char const *const *flags, size_t flag_count,
+                         size_t output_count,
+                         char *message, size_t message_size) {
+  char                          req_buf[1024];
+  struct NaClPnaclCompileRequest *req =
+      (struct NaClPnaclCompileRequest *) req_buf;
+  size_t                        req_len = sizeof *req;
+  char                          reply_buf[NACL_PNACL_COMPILE_REPLY_BYTES_MAX];
+  struct NaClPnaclCompileReply  *reply =
+      (struct NaClPnaclCompileReply *) reply_buf;
+  struct NaClDesc               *descs[1 + NACL_PNACL_COMPILE_OUTPUTS_MAX];
+  struct NaClImcMsgIoVec        iov;
+  struct NaClImcTypedMsgHdr     hdr;
+  char                          path[1024];
+  char                          name[16];
+  ssize_t                       rc;
+  size_t                        i;
+
+  CHECK(output_count <= NACL_PNACL_COMPILE_OUTPUTS_MAX);
+  req->magic = magic;
+  req->thread_count = 1;
+  req->arg_count = (uint32_t) flag_count;
+  for (i = 0; i < flag_count; ++i) {
+    size_t len = strlen(flags[i]) + 1;
+    CHECK(req_len + len <= sizeof req_buf);
+    memcpy(req_buf + req_len, flags[i], len);
+    req_len += len;
+  }
+
+  descs[0] = (struct NaClDesc *) NaClDescIoDescOpen(g_input_path,
+                                                    NACL_ABI_O_RDONLY, 0);
+  CHECK(NULL != descs[0]);
+  for (i = 0; i < output_count; ++i) {
+    snprintf(name, sizeof name, "out%d.o", (int) i);
+    PathInTempDir(path, sizeof path, name);
+    descs[1 + i] = (struct NaClDesc *) NaClDescIoDescOpen(
+        path, NACL_ABI_O_WRONLY | NACL_ABI_O_CREAT | NACL_ABI_O_TRUNC, 0600);
+    CHECK(NULL != descs[1 + i]);
+  }
+
+  iov.base = req_buf;
+  iov.length = req_len;
+  memset(&hdr, 0, sizeof hdr);
+  hdr.iov = &iov;
+  hdr.iov_length = 1;
+  hdr.ndescv = descs;
+  hdr.ndesc_length = (uint32_t) (1 + output_count);
+  rc = NaClImcSendTypedMessage(server->channel, &hdr, 0);
+  CHECK(rc == (ssize_t) req_len);
+  for (i = 0; i < 1 + output_count; ++i) {
+    NaClDescUnref(descs[i]);
+  }
+
+  iov.base = reply_buf;
+  iov.length = sizeof reply_buf;
+  memset(&hdr, 0, sizeof hdr);
+  hdr.iov = &iov;
+  hdr.iov_length = 1;
+  rc = NaClImcRecvTypedMessage(server->channel, &hdr, 0);
+  CHECK(rc > (ssize_t) sizeof *reply);
+  CHECK(reply->magic == NACL_PNACL_COMPILE_REPLY_MAGIC);
+  CHECK(reply_buf[rc - 1] == '\0');
+  snprintf(message, message_size, "%s", reply_buf + sizeof *reply);
+  return reply->status;
+}
+
+static void CheckOutputs(char const *expected_flags) {
+  char    path[1024];
+  char    *input;
+  char    *output;
+  size_t  input_size;
+  size_t  output_size;
+
+  input = ReadFile(g_input_path, &input_size);
+  PathInTempDir(path, sizeof path, "out0.o");
+  output = ReadFile(path, &output_size);
+  CHECK(input_size == kInputSize);
+  CHECK(output_size == input_size);
+  CHECK(memcmp(input, output, input_size) == 0);
+  free(input);
+  free(output);
+
+  PathInTempDir(path, sizeof path, "out1.o");
+  output = ReadFile(path, &output_size);
+  CHECK(strcmp(output, expected_flags) == 0);
+  free(output);
+}
+
+static void TestRequests(char **argv) {
+  static char const *const good_flags[] = { "-O2", "-mtriple=x" };
+  static char const *const fail_init_flags[] = { "--fail-init" };
+  static char const *const fail_data_flags[] = { "--fail-data" };
+  struct Server server;
+  char          message[NACL_PNACL_COMPILE_REPLY_BYTES_MAX];
+  int           i;
+
+  StartServer(&server, argv);
+
+  for (i = 0; i < 2; ++i) {
+    CHECK(NACL_PNACL_COMPILE_OK ==
+          Translate(&server, NACL_PNACL_COMPILE_REQUEST_MAGIC,
+                    good_flags, 2, 2, message, sizeof message));
+    CHECK(strcmp(message, "") == 0);
+    CheckOutputs("-O2\n-mtriple=x\n");
+  }
+
+  /* Failures are reported and the server carries on. */
+  CHECK(NACL_PNACL_COMPILE_BAD_REQUEST ==
+        Translate(&server, 0, good_flags, 2, 2, message, sizeof message));
+  CHECK(NACL_PNACL_COMPILE_BAD_REQUEST ==
+        Translate(&server, NACL_PNACL_COMPILE_REQUEST_MAGIC,
+                  good_flags, 2, 0, message, sizeof message));
+  CHECK(NACL_PNACL_COMPILE_INIT_FAILED ==
+        Translate(&server, NACL_PNACL_COMPILE_REQUEST_MAGIC,
+                  fail_init_flags, 1, 2, message, sizeof message));
+  CHECK(strstr(message, "init_callback failed") != NULL);
+  CHECK(NACL_PNACL_COMPILE_DATA_FAILED ==
+        Translate(&server, NACL_PNACL_COMPILE_REQUEST_MAGIC,
+                  fail_data_flags, 1, 1, message, sizeof message));
+  CHECK(strstr(message, "data_callback failed") != NULL);
+
+  CHECK(NACL_PNACL_COMPILE_OK ==
+        Translate(&server, NACL_PNACL_COMPILE_REQUEST_MAGIC,
+                  good_flags, 1, 2, message, sizeof message));
+  CheckOutputs("-O2\n");
+
+  StopServer(&server);
+}
+
+static double TimeNow(void) {
+  struct timespec ts;
+
+  CHECK(clock_gettime(CLOCK_MONOTONIC, &ts) == 0);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void Benchmark(char **argv) {
+  struct Server server;
+  char          message[NACL_PNACL_COMPILE_REPLY_BYTES_MAX];
+  double        start;
+  double        one_process;
+  double        n_processes;
+  int           i;
+
+  start = TimeNow();
+  StartServer(&server, argv);
+  for (i = 0; i < kBenchmarkRuns; ++i) {
+    CHECK(NACL_PNACL_COMPILE_OK ==
+          Translate(&server, NACL_PNACL_COMPILE_REQUEST_MAGIC,
+                    NULL, 0, 1, message, sizeof message));
+  }
+  StopServer(&server);
+  one_process = TimeNow() - start;
+
+  start = TimeNow();
+  for (i = 0; i < kBenchmarkRuns; ++i) {
+    StartServer(&server, argv);
+    CHECK(NACL_PNACL_COMPILE_OK ==
+          Translate(&server, NACL_PNACL_COMPILE_REQUEST_MAGIC,
+                    NULL, 0, 1, message, sizeof message));
+    StopServer(&server);
+  }
+  n_processes = TimeNow() - start;
+
+  printf("%d translations in 1 process:   %.3f ms each\n",
+         kBenchmarkRuns, one_process * 1000 / kBenchmarkRuns);
+  printf("%d translations in %d processes: %.3f ms each\n",
+         kBenchmarkRuns, kBenchmarkRuns, n_processes * 1000 / kBenchmarkRuns);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s temp_dir sel_ldr [args...] nexe\n", argv[0]);
+    return 1;
+  }
+  g_temp_dir = argv[1];
+  NaClNrdAllModulesInit();
+  WriteInput();
+
+  TestRequests(argv + 2);
+  Benchmark(argv + 2);
+
+  NaClNrdAllModulesFini();
+  printf("PASSED\n");
+  return 0;
+}
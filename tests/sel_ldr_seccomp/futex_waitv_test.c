@@ -0,0 +1,33 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <errno.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/trusted/seccomp_bpf/seccomp_bpf.h"
+
+#if !defined(__NR_futex_waitv)
+# define __NR_futex_waitv 449
+#endif
+
+int main(void) {
+  long rc;
+
+  CHECK(0 == NaClInstallBpfFilter());
+
+  /*
+   * An empty wait list is rejected with EINVAL, or ENOSYS before Linux
+   * 5.16.  Either way the filter must let the call through rather than
+   * raise SIGSYS.
+   */
+  rc = syscall(__NR_futex_waitv, NULL, 0, 0, NULL, 0);
+  CHECK(rc < 0);
+  CHECK(errno == EINVAL || errno == ENOSYS);
+
+  return 0;
+}
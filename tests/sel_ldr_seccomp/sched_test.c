@@ -0,0 +1,63 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <errno.h>
+#include <sched.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "native_client/src/shared/platform/nacl_check.h"
+#include "native_client/src/trusted/seccomp_bpf/seccomp_bpf.h"
+
+/*
+ * Makes the host calls that thread_sched() and thread exit make, each
+ * with values that leave the thread as it was.  None may raise SIGSYS.
+ */
+int main(void) {
+  cpu_set_t cpus;
+  int       nice_value;
+
+  CHECK(0 == sched_getaffinity(0, sizeof cpus, &cpus));
+  errno = 0;
+  nice_value = getpriority(PRIO_PROCESS, 0);
+  CHECK(0 == errno);
+
+  CHECK(0 == NaClInstallBpfFilter());
+
+  errno = 0;
+  CHECK(nice_value == getpriority(PRIO_PROCESS, 0));
+  CHECK(0 == errno);
+  CHECK(0 == setpriority(PRIO_PROCESS, 0, nice_value));
+  CHECK(0 == sched_setaffinity(0, sizeof cpus, &cpus));
+
+#if defined(__NR_sched_setattr)
+  {
+    /* Linux's struct sched_attr, as in sys_sched.c. */
+    struct {
+      uint32_t size;
+      uint32_t sched_policy;
+      uint64_t sched_flags;
+      int32_t  sched_nice;
+      uint32_t sched_priority;
+      uint64_t sched_runtime;
+      uint64_t sched_deadline;
+      uint64_t sched_period;
+    } attr;
+
+    memset(&attr, 0, sizeof attr);
+    attr.size = sizeof attr;
+    attr.sched_policy = SCHED_OTHER;
+    attr.sched_nice = nice_value;
+    CHECK(0 == syscall(__NR_sched_setattr, 0, &attr, 0) ||
+          ENOSYS == errno || EPERM == errno);
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "native_client/src/include/nacl_assert.h"
+#include "native_client/src/untrusted/irt/irt.h"
+
+/*
+ * This tests the irt-sched interface.  argv[1] and argv[2] are the
+ * priority and deadline settings given to sel_ldr's -P option.  Raising
+ * priority and deadline scheduling also need host privileges, so where
+ * those are involved either success or EPERM is accepted.
+ */
+
+static struct nacl_irt_sched g_sched;
+static struct nacl_irt_sched_info g_info;
+static uint64_t g_all_cpus;
+
+static void test_get_info(int max_priority, int deadline_percent) {
+  printf("Testing sched_get_info()...\n");
+  ASSERT_EQ(g_sched.sched_get_info(&g_info), 0);
+  ASSERT_GE(g_info.cpu_count, 1);
+  ASSERT_LE(g_info.cpu_count, NACL_IRT_SCHED_MAX_CPUS);
+  ASSERT_EQ(g_info.min_priority, -19);
+  ASSERT_EQ(g_info.max_priority, max_priority);
+  ASSERT_EQ(g_info.deadline_capacity,
+            (uint32_t) deadline_percent * (NACL_IRT_SCHED_UTIL_SCALE / 100));
+  ASSERT_EQ(g_info.deadline_available, g_info.deadline_capacity);
+}
+
+static void test_affinity(void) {
+  uint64_t mask;
+  uint32_t cpu;
+
+  printf("Testing sched_set_affinity()...\n");
+  ASSERT_EQ(g_sched.sched_get_affinity(&g_all_cpus), 0);
+  ASSERT_NE(g_all_cpus, 0);
+  if (g_info.cpu_count < 64) {
+    ASSERT_EQ(g_all_cpus >> g_info.cpu_count, 0);
+  }
+
+  for (cpu = 0; cpu < g_info.cpu_count; cpu++) {
+    uint64_t bit = (uint64_t) 1 << cpu;
+    if ((g_all_cpus & bit) == 0)
+      continue;
+    ASSERT_EQ(g_sched.sched_set_affinity(bit), 0);
+    ASSERT_EQ(g_sched.sched_get_affinity(&mask), 0);
+    ASSERT_EQ(mask, bit);
+  }
+
+  ASSERT_EQ(g_sched.sched_set_affinity(0), EINVAL);
+  if (g_info.cpu_count < 64) {
+    ASSERT_EQ(g_sched.sched_set_affinity((uint64_t) 1 << g_info.cpu_count),
+              EINVAL);
+  }
+}
+
+static void *new_thread_affinity(void *arg) {
+  uint64_t *mask = (uint64_t *) arg;
+  ASSERT_EQ(g_sched.sched_get_affinity(mask), 0);
+  return NULL;
+}
+
+/*
+ * The calling thread is still pinned to one CPU by test_affinity(); a
+ * new thread must not inherit that.
+ */
+static void test_new_thread_not_pinned(void) {
+  pthread_t tid;
+  uint64_t mask = 0;
+
+  printf("Testing that new threads start unpinned...\n");
+  ASSERT_EQ(pthread_create(&tid, NULL, new_thread_affinity, &mask), 0);
+  ASSERT_EQ(pthread_join(tid, NULL), 0);
+  ASSERT_EQ(mask, g_all_cpus);
+  ASSERT_EQ(g_sched.sched_set_affinity(g_all_cpus), 0);
+}
+
+static void *lower_priority(void *arg) {
+  ASSERT_EQ(g_sched.sched_set_priority(-5), 0);
+  return NULL;
+}
+
+static void test_priority(void) {
+  pthread_t tid;
+  int rc;
+
+  printf("Testing sched_set_priority()...\n");
+  ASSERT_EQ(g_sched.sched_set_priority(g_info.max_priority + 1), EPERM);
+  ASSERT_EQ(g_sched.sched_set_priority(g_info.min_priority - 1), EINVAL);
+
+  /* Lowering priority needs no privileges; do it on a throwaway thread. */
+  ASSERT_EQ(pthread_create(&tid, NULL, lower_priority, NULL), 0);
+  ASSERT_EQ(pthread_join(tid, NULL), 0);
+
+  rc = g_sched.sched_set_priority(g_info.max_priority);
+  ASSERT(rc == 0 || rc == EPERM);
+  rc = g_sched.sched_set_priority(0);
+  ASSERT(rc == 0 || rc == EPERM);
+}
+
+static void test_deadline(void) {
+  /* 1% of a CPU. */
+  struct nacl_irt_sched_deadline small = { 1000000, 10000000, 100000000 };
+  struct nacl_irt_sched_deadline bad = { 2000000, 1000000, 100000000 };
+  /* A whole CPU. */
+  struct nacl_irt_sched_deadline big = { 100000000, 100000000, 100000000 };
+  struct nacl_irt_sched_info info;
+  int rc;
+
+  printf("Testing sched_set_deadline()...\n");
+  if (g_info.deadline_capacity == 0) {
+    ASSERT_EQ(g_sched.sched_set_deadline(&small), EPERM);
+    return;
+  }
+  ASSERT_EQ(g_sched.sched_set_deadline(&bad), EINVAL);
+
+  /* More than the sandbox may reserve is refused before the host sees it. */
+  if (g_info.deadline_capacity < NACL_IRT_SCHED_UTIL_SCALE) {
+    ASSERT_EQ(g_sched.sched_set_deadline(&big), EBUSY);
+  }
+
+  rc = g_sched.sched_set_deadline(&small);
+  ASSERT(rc == 0 || rc == EPERM);
+  ASSERT_EQ(g_sched.sched_get_info(&info), 0);
+  if (rc == 0) {
+    ASSERT_EQ(info.deadline_available, g_info.deadline_capacity - 10000);
+    ASSERT_EQ(g_sched.sched_set_deadline(NULL), 0);
+    ASSERT_EQ(g_sched.sched_get_info(&info), 0);
+  } else {
+    printf("SCHED_DEADLINE is not permitted on this host\n");
+  }
+  ASSERT_EQ(info.deadline_available, g_info.deadline_capacity);
+}
+
+int main(int argc, char **argv) {
+  int max_priority;
+  int deadline_percent;
+
+  if (argc != 3) {
+    fprintf(stderr, "Usage: thread_sched_test <priority> <deadline>\n");
+    return 1;
+  }
+  max_priority = atoi(argv[1]);
+  deadline_percent = atoi(argv[2]);
+
+  ASSERT_EQ(nacl_interface_query(NACL_IRT_SCHED_v0_1, &g_sched,
+                                 sizeof(g_sched)), sizeof(g_sched));
+
+  test_get_info(max_priority, deadline_percent);
+  test_affinity();
+  test_new_thread_not_pinned();
+  test_priority();
+  test_deadline();
+
+  printf("PASSED\n");
+  return 0;
+}
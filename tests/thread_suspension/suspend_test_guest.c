@@ -7,6 +7,7 @@
 #include "native_client/tests/thread_suspension/suspend_test.h"
 
 #include <assert.h>
+#include <pthread.h>
 #include <setjmp.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -32,6 +33,40 @@ static void MutatorThread(struct SuspendTestShm *test_shm) {
   }
 }
 
+static void *MultiMutatorThreadFunc(void *thread_arg) {
+  struct SuspendTestShm *test_shm = (struct SuspendTestShm *) thread_arg;
+  volatile uint32_t next_val = 0;
+
+  __sync_fetch_and_add(&test_shm->var, 1);
+  while (!test_shm->should_exit) {
+    next_val++;
+  }
+  return NULL;
+}
+
+/*
+ * Run |thread_count| threads that spin in untrusted code without
+ * making syscalls, so that each one has to be stopped by a signal.
+ */
+static void MultiMutatorThreads(struct SuspendTestShm *test_shm,
+                                int thread_count) {
+  pthread_t *threads = malloc(thread_count * sizeof(*threads));
+  int i;
+
+  assert(threads != NULL);
+  for (i = 1; i < thread_count; i++) {
+    int rc = pthread_create(&threads[i], NULL, MultiMutatorThreadFunc,
+                            test_shm);
+    assert(rc == 0);
+  }
+  MultiMutatorThreadFunc(test_shm);
+  for (i = 1; i < thread_count; i++) {
+    int rc = pthread_join(threads[i], NULL);
+    assert(rc == 0);
+  }
+  free(threads);
+}
+
 static void SyscallReturnThread(struct SuspendTestShm *test_shm) {
   int rc = NACL_SYSCALL(test_syscall_1)(test_shm);
   assert(rc == 0);
@@ -262,8 +297,9 @@ static void SyscallRegisterSetterLoopThread(struct SuspendTestShm *test_shm) {
 }
 
 int main(int argc, char **argv) {
-  if (argc != 3) {
-    fprintf(stderr, "Expected 2 arguments: <test-type> <memory-address>\n");
+  if (argc != 3 && argc != 4) {
+    fprintf(stderr, "Expected 2 or 3 arguments: <test-type> <memory-address>"
+            " [<thread-count>]\n");
     return 1;
   }
   char *test_type = argv[1];
@@ -275,6 +311,9 @@ int main(int argc, char **argv) {
 
   if (strcmp(test_type, "MutatorThread") == 0) {
     MutatorThread(test_shm);
+  } else if (strcmp(test_type, "MultiMutatorThreads") == 0) {
+    assert(argc == 4);
+    MultiMutatorThreads(test_shm, atoi(argv[3]));
   } else if (strcmp(test_type, "SyscallReturnThread") == 0) {
     SyscallReturnThread(test_shm);
   } else if (strcmp(test_type, "SyscallInvokerThread") == 0) {
@@ -8,11 +8,13 @@
 
 #include "native_client/src/include/build_config.h"
 #include "native_client/src/include/nacl_assert.h"
+#include "native_client/src/include/nacl_macros.h"
 #include "native_client/src/include/portability_io.h"
 #include "native_client/src/shared/platform/nacl_check.h"
 #include "native_client/src/shared/platform/nacl_exit.h"
 #include "native_client/src/shared/platform/nacl_log.h"
 #include "native_client/src/shared/platform/nacl_sync_checked.h"
+#include "native_client/src/shared/platform/nacl_time.h"
 #include "native_client/src/trusted/service_runtime/include/bits/mman.h"
 #include "native_client/src/trusted/service_runtime/include/bits/nacl_syscalls.h"
 #include "native_client/src/trusted/service_runtime/load_file.h"
@@ -67,10 +69,10 @@ static void WaitForThreadToExitFully(struct NaClApp *nap) {
   } while (!done);
 }
 
-static struct SuspendTestShm *StartGuestWithSharedMemory(
-    struct NaClApp *nap, char *test_name) {
+static struct SuspendTestShm *StartGuestWithSharedMemoryAndArg(
+    struct NaClApp *nap, char *test_name, char *extra_arg) {
   char arg_string[32];
-  char *args[] = {"prog_name", test_name, arg_string};
+  char *args[] = {"prog_name", test_name, arg_string, extra_arg};
   uint32_t mmap_addr;
 
   /*
@@ -87,10 +89,15 @@ static struct SuspendTestShm *StartGuestWithSharedMemory(
 
   WaitForThreadToExitFully(nap);
 
-  CHECK(NaClCreateMainThread(nap, 3, args, NULL));
+  CHECK(NaClCreateMainThread(nap, extra_arg != NULL ? 4 : 3, args, NULL));
   return (struct SuspendTestShm *) NaClUserToSys(nap, mmap_addr);
 }
 
+static struct SuspendTestShm *StartGuestWithSharedMemory(
+    struct NaClApp *nap, char *test_name) {
+  return StartGuestWithSharedMemoryAndArg(nap, test_name, NULL);
+}
+
 /*
  * This test checks that after NaClUntrustedThreadsSuspendAll() has
  * returned, untrusted threads are completely suspended.  We test this
@@ -473,8 +480,52 @@ static void TestGettingRegisterSnapshotInSyscallContextSwitch(
   WaitForThreadToExitFully(nap);
 }
 
+/*
+ * This measures how long NaClUntrustedThreadsSuspendAll() takes to
+ * stop |thread_count| threads that are all running untrusted code,
+ * which is the pause seen by anything that stops the world.
+ */
+static void BenchmarkSuspendAllPauseTime(struct NaClApp *nap,
+                                         int thread_count) {
+  const int kIterations = 200;
+  char thread_count_string[16];
+  struct SuspendTestShm *test_shm;
+  int64_t total_us = 0;
+  int64_t max_us = 0;
+  int iteration;
+
+  SNPRINTF(thread_count_string, sizeof(thread_count_string),
+           "%d", thread_count);
+  test_shm = StartGuestWithSharedMemoryAndArg(nap, "MultiMutatorThreads",
+                                              thread_count_string);
+
+  /* Wait for all the guest threads to be running untrusted code. */
+  while (test_shm->var != (uint32_t) thread_count) { /* do nothing */ }
+
+  for (iteration = 0; iteration < kIterations; iteration++) {
+    int64_t start_us = NaClGetTimeOfDayMicroseconds();
+    int64_t pause_us;
+
+    NaClUntrustedThreadsSuspendAll(nap, /* save_registers= */ 0);
+    pause_us = NaClGetTimeOfDayMicroseconds() - start_us;
+    NaClUntrustedThreadsResumeAll(nap);
+
+    total_us += pause_us;
+    if (pause_us > max_us) {
+      max_us = pause_us;
+    }
+  }
+  printf("SuspendAll pause with %d threads: mean %d us, max %d us\n",
+         thread_count, (int) (total_us / kIterations), (int) max_us);
+
+  test_shm->should_exit = 1;
+  CHECK(NaClWaitForMainThreadToExit(nap) == 0);
+}
+
 int main(int argc, char **argv) {
   struct NaClApp app;
+  static const int kBenchmarkThreadCounts[] = { 1, 2, 4, 8, 16 };
+  size_t index;
 
   NaClHandleBootstrapArgs(&argc, &argv);
 
@@ -531,6 +582,13 @@ int main(int argc, char **argv) {
   printf("Running TestGettingRegisterSnapshotInSyscallContextSwitch...\n");
   TestGettingRegisterSnapshotInSyscallContextSwitch(&app);
 
+  for (index = 0; index < NACL_ARRAY_SIZE(kBenchmarkThreadCounts); index++) {
+    printf("Running BenchmarkSuspendAllPauseTime (%d threads)...\n",
+           kBenchmarkThreadCounts[index]);
+    WaitForThreadToExitFully(&app);
+    BenchmarkSuspendAllPauseTime(&app, kBenchmarkThreadCounts[index]);
+  }
+
   /*
    * Avoid calling exit() because it runs process-global destructors
    * which might break code that is running in our unjoined threads.
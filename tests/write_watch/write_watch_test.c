@@ -0,0 +1,172 @@
+/*
+ * Copyright 2016 The Native Client Authors. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#include <nacl/nacl_random.h>
+
+#include "native_client/src/include/nacl_assert.h"
+#include "native_client/src/untrusted/nacl/nacl_write_watch.h"
+
+#define PAGE NACL_WRITE_WATCH_PAGESIZE
+#define NUM_PAGES 4
+
+static char *map_pages(void) {
+  void *addr = mmap(NULL, NUM_PAGES * PAGE, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(addr, MAP_FAILED);
+  return (char *) addr;
+}
+
+static size_t fetch(char *base, void **pages, size_t capacity) {
+  size_t count = capacity;
+  ASSERT_EQ(0, nacl_write_watch_fetch(base, NUM_PAGES * PAGE,
+                                      pages, &count));
+  ASSERT_LE(count, capacity);
+  return count;
+}
+
+static void test_arm_fetch_reset(void) {
+  char *base = map_pages();
+  void *pages[NUM_PAGES];
+
+  printf("Testing that writes are reported once.\n");
+  memset(base, 1, NUM_PAGES * PAGE);
+  ASSERT_EQ(0, nacl_write_watch_arm(base, NUM_PAGES * PAGE));
+  ASSERT_EQ(0, fetch(base, pages, NUM_PAGES));
+
+  /* Reads do not dirty pages, and existing contents are kept.  */
+  ASSERT_EQ(1, base[2 * PAGE]);
+
+  base[PAGE + 10] = 2;
+  base[3 * PAGE + PAGE - 1] = 3;
+  base[3 * PAGE] = 4;
+  ASSERT_EQ(2, fetch(base, pages, NUM_PAGES));
+  ASSERT_EQ(base + PAGE, pages[0]);
+  ASSERT_EQ(base + 3 * PAGE, pages[1]);
+  ASSERT_EQ(2, base[PAGE + 10]);
+  ASSERT_EQ(3, base[3 * PAGE + PAGE - 1]);
+  ASSERT_EQ(4, base[3 * PAGE]);
+
+  ASSERT_EQ(0, fetch(base, pages, NUM_PAGES));
+  base[PAGE] = 5;
+  ASSERT_EQ(1, fetch(base, pages, NUM_PAGES));
+  ASSERT_EQ(base + PAGE, pages[0]);
+
+  ASSERT_EQ(0, nacl_write_watch_disarm(base, NUM_PAGES * PAGE));
+  base[0] = 6;
+  ASSERT_EQ(0, fetch(base, pages, NUM_PAGES));
+  ASSERT_EQ(0, munmap(base, NUM_PAGES * PAGE));
+}
+
+static void test_partial_fetch(void) {
+  char *base = map_pages();
+  void *pages[NUM_PAGES];
+
+  printf("Testing that pages which do not fit stay dirty.\n");
+  ASSERT_EQ(0, nacl_write_watch_arm(base, NUM_PAGES * PAGE));
+  base[0] = 1;
+  base[PAGE] = 1;
+  base[2 * PAGE] = 1;
+  ASSERT_EQ(2, fetch(base, pages, 2));
+  ASSERT_EQ(base, pages[0]);
+  ASSERT_EQ(base + PAGE, pages[1]);
+  ASSERT_EQ(1, fetch(base, pages, 2));
+  ASSERT_EQ(base + 2 * PAGE, pages[0]);
+  ASSERT_EQ(0, munmap(base, NUM_PAGES * PAGE));
+}
+
+static void test_syscall_writes(void) {
+  char *base = map_pages();
+  void *pages[NUM_PAGES];
+  struct timespec *ts = (struct timespec *) (base + PAGE);
+  size_t nread;
+
+  printf("Testing writes made by syscalls.\n");
+  ASSERT_EQ(0, nacl_write_watch_arm(base, NUM_PAGES * PAGE));
+
+  /* Copied out by the service runtime.  */
+  ASSERT_EQ(0, clock_gettime(CLOCK_REALTIME, ts));
+  /* Written to untrusted memory directly, like read().  */
+  ASSERT_EQ(0, nacl_secure_random(base + 3 * PAGE, 16, &nread));
+  ASSERT_EQ(16, nread);
+
+  ASSERT_EQ(2, fetch(base, pages, NUM_PAGES));
+  ASSERT_EQ(base + PAGE, pages[0]);
+  ASSERT_EQ(base + 3 * PAGE, pages[1]);
+  ASSERT_EQ(0, munmap(base, NUM_PAGES * PAGE));
+}
+
+static void test_remap_forgets(void) {
+  char *base = map_pages();
+  void *pages[NUM_PAGES];
+  void *addr;
+
+  printf("Testing that mprotect, mmap and munmap stop the watch.\n");
+  ASSERT_EQ(0, nacl_write_watch_arm(base, NUM_PAGES * PAGE));
+
+  ASSERT_EQ(0, mprotect(base, PAGE, PROT_READ));
+  ASSERT_EQ(0, mprotect(base, PAGE, PROT_READ | PROT_WRITE));
+  base[0] = 1;
+  addr = mmap(base + PAGE, PAGE, PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+  ASSERT_EQ(base + PAGE, addr);
+  base[PAGE] = 1;
+  ASSERT_EQ(0, munmap(base + 2 * PAGE, PAGE));
+  addr = mmap(base + 2 * PAGE, PAGE, PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+  ASSERT_EQ(base + 2 * PAGE, addr);
+  base[2 * PAGE] = 1;
+  base[3 * PAGE] = 1;
+
+  ASSERT_EQ(1, fetch(base, pages, NUM_PAGES));
+  ASSERT_EQ(base + 3 * PAGE, pages[0]);
+  ASSERT_EQ(0, munmap(base, NUM_PAGES * PAGE));
+}
+
+static void test_bad_ranges(void) {
+  char *base = map_pages();
+  void *pages[NUM_PAGES];
+  size_t count = NUM_PAGES;
+
+  printf("Testing invalid ranges.\n");
+  ASSERT_EQ(-1, nacl_write_watch_arm(base + 1, PAGE));
+  ASSERT_EQ(EINVAL, errno);
+  ASSERT_EQ(-1, nacl_write_watch_arm(base, PAGE + 1));
+  ASSERT_EQ(EINVAL, errno);
+  ASSERT_EQ(-1, nacl_write_watch_arm(base, 0));
+  ASSERT_EQ(EINVAL, errno);
+
+  ASSERT_EQ(0, mprotect(base + PAGE, PAGE, PROT_READ));
+  ASSERT_EQ(-1, nacl_write_watch_arm(base, NUM_PAGES * PAGE));
+  ASSERT_EQ(EACCES, errno);
+  ASSERT_EQ(0, munmap(base + PAGE, PAGE));
+  ASSERT_EQ(-1, nacl_write_watch_arm(base, NUM_PAGES * PAGE));
+  ASSERT_EQ(EACCES, errno);
+
+  ASSERT_EQ(-1, nacl_write_watch_fetch(base, NUM_PAGES * PAGE,
+                                       pages, (size_t *) 1));
+  ASSERT_EQ(EFAULT, errno);
+  ASSERT_EQ(0, nacl_write_watch_fetch(base, NUM_PAGES * PAGE,
+                                      pages, &count));
+  ASSERT_EQ(0, count);
+  ASSERT_EQ(0, munmap(base, NUM_PAGES * PAGE));
+}
+
+int main(void) {
+  test_arm_fetch_reset();
+  test_partial_fetch();
+  test_syscall_writes();
+  test_remap_forgets();
+  test_bad_ranges();
+  printf("PASSED\n");
+  return 0;
+}